@@ -0,0 +1,92 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "arena.h"
+#include "utils.h"
+
+// A region allocator for everything that lives until the end of assemble().
+// Memory is handed out from large blocks by bumping a pointer and is only ever
+// released all at once by free_arena().
+
+#define BLOCK_SIZE (1024 * 1024)
+#define ALIGNMENT 8
+
+typedef struct block {
+    struct block *next;
+    int size;
+    int used;
+    char data[];
+} Block;
+
+static Block *blocks;
+
+static Block *new_block(int size) {
+    Block *block = calloc(1, sizeof(Block) + size);
+    if (!block) panic("Unable to allocate %d bytes", size);
+    block->size = size;
+
+    return block;
+}
+
+// Allocate zeroed memory
+void *arena_alloc(int size) {
+    size = ALIGN_UP(size, ALIGNMENT);
+
+    // Give large allocations a block of their own, behind the current block, so that
+    // the rest of the current block doesn't get wasted
+    if (size > BLOCK_SIZE / 4) {
+        Block *block = new_block(size);
+        block->used = size;
+
+        if (blocks) {
+            block->next = blocks->next;
+            blocks->next = block;
+        }
+        else
+            blocks = block;
+
+        return block->data;
+    }
+
+    if (!blocks || blocks->used + size > blocks->size) {
+        Block *block = new_block(BLOCK_SIZE);
+        block->next = blocks;
+        blocks = block;
+    }
+
+    void *result = blocks->data + blocks->used;
+    blocks->used += size;
+
+    return result;
+}
+
+char *arena_strdup(char *string) {
+    int size = strlen(string) + 1;
+    char *result = arena_alloc(size);
+    memcpy(result, string, size);
+
+    return result;
+}
+
+// Release everything. One block is kept for the next user of the arena, which
+// saves mapping in fresh memory when assembling many small files.
+void free_arena(void) {
+    Block *spare = NULL;
+
+    while (blocks) {
+        Block *next = blocks->next;
+
+        if (!spare && blocks->size == BLOCK_SIZE) {
+            spare = blocks;
+            memset(spare->data, 0, spare->used);
+            spare->used = 0;
+            spare->next = NULL;
+        }
+        else
+            free(blocks);
+
+        blocks = next;
+    }
+
+    blocks = spare;
+}
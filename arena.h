@@ -0,0 +1,8 @@
+#ifndef _ARENA_H
+#define _ARENA_H
+
+void *arena_alloc(int size);
+char *arena_strdup(char *string);
+void free_arena(void);
+
+#endif
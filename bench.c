@@ -0,0 +1,312 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "arena.h"
+#include "instr.h"
+#include "lexer.h"
+#include "opcodes.h"
+#include "scan.h"
+#include "strmap.h"
+#include "utils.h"
+#include "was.h"
+
+// Benchmarks. Run all of them with ./bench or a single one with ./bench NAME. The lexer
+// benchmark takes an optional input file: ./bench lexer FILE
+
+#define STARTUP_ITERATIONS 200
+#define ENCODE_ITERATIONS  20000
+#define LEXER_CORPUS_LINES 4000000
+#define LEXER_ITERATIONS   3
+
+static char *lexer_corpus_filename;
+
+// Return a monotonic time in seconds
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Time how long it takes to assemble a tiny file. This is dominated by startup costs,
+// which matter when was is invoked thousands of times on small inputs.
+static void bench_startup(void) {
+    double start = now();
+    for (int i = 0; i < STARTUP_ITERATIONS; i++) assemble("tests/hello.s", "/dev/null");
+    double assemble_time = (now() - start) / STARTUP_ITERATIONS;
+
+    printf("startup: assemble tests/hello.s %8.3f ms\n", assemble_time * 1000);
+}
+
+// An instruction in the encode benchmark
+typedef struct bench_instruction {
+    char *mnemonic;
+    Operand op1, op2, op3;
+    int operand_count;
+} BenchInstruction;
+
+#define R(_type, _reg)         { .type = (_type), .reg = (_reg) }
+#define I(_type, _value)       { .type = (_type), .imm_or_mem_value = (_value) }
+#define D(_reg, _disp, _size)  { .type = REG64, .reg = (_reg), .indirect = 1, .displacement = (_disp), .displacement_size = (_size) }
+#define M(_type)               { .type = (_type) }
+
+// A mix of instructions typical of compiler output
+static BenchInstruction bench_instructions[] = {
+    { "movq",   R(REG64, 4),         R(REG64, 5),         {}, 2 }, // movq %rsp, %rbp
+    { "movq",   D(5, -8, SIZE08),    R(REG64, 0),         {}, 2 }, // movq -8(%rbp), %rax
+    { "movq",   R(REG64, 0),         D(5, -512, SIZE32),  {}, 2 }, // movq %rax, -512(%rbp)
+    { "movl",   I(IMM08, 1),         R(REG32, 0),         {}, 2 }, // movl $1, %eax
+    { "movabsq",I(IMM64, 1L << 40),  R(REG64, 0),         {}, 2 }, // movabsq $0x10000000000, %rax
+    { "addq",   I(IMM08, 16),        R(REG64, 4),         {}, 2 }, // addq $16, %rsp
+    { "subq",   I(IMM16, 1000),      R(REG64, 4),         {}, 2 }, // subq $1000, %rsp
+    { "leaq",   D(4, 16, SIZE08),    R(REG64, 7),         {}, 2 }, // leaq 16(%rsp), %rdi
+    { "pushq",  R(REG64, 5),         {},                  {}, 1 }, // pushq %rbp
+    { "popq",   R(REG64, 5),         {},                  {}, 1 }, // popq %rbp
+    { "cmpl",   R(REG32, 1),         R(REG32, 0),         {}, 2 }, // cmpl %ecx, %eax
+    { "sete",   R(REG08, 0),         {},                  {}, 1 }, // sete %al
+    { "movzbl", R(REG08, 0),         R(REG32, 0),         {}, 2 }, // movzbl %al, %eax
+    { "imulq",  I(IMM08, 24),        R(REG64, 0),         {}, 2 }, // imulq $24, %rax
+    { "movsd",  R(REGXM, 1),         D(5, -16, SIZE08),   {}, 2 }, // movsd %xmm1, -16(%rbp)
+    { "addsd",  R(REGXM, 1),         R(REGXM, 0),         {}, 2 }, // addsd %xmm1, %xmm0
+    { "jmp",    M(MEM32),            {},                  {}, 1 }, // jmp label
+    { "jne",    M(MEM32),            {},                  {}, 1 }, // jne label
+    { "call",   M(MEM32),            {},                  {}, 1 }, // call function
+    { "ret",    {},                  {},                  {}, 0 }, // ret
+};
+
+// Time how many instructions per second make_instructions() can encode
+static void bench_encode(void) {
+    int count = sizeof(bench_instructions) / sizeof(BenchInstruction);
+    int opcode_alias_groups[count];
+
+    for (int i = 0; i < count; i++) {
+        opcode_alias_groups[i] = lookup_opcode_alias_group(bench_instructions[i].mnemonic, strlen(bench_instructions[i].mnemonic));
+        if (opcode_alias_groups[i] == -1) panic("Unknown instruction %s", bench_instructions[i].mnemonic);
+    }
+
+    // make_instructions() may modify operands, so work on copies
+    Operand op1, op2, op3;
+    int encoded_size = 0;
+
+    double start = now();
+    for (int iteration = 0; iteration < ENCODE_ITERATIONS; iteration++) {
+        for (int i = 0; i < count; i++) {
+            BenchInstruction *bi = &bench_instructions[i];
+            op1 = bi->op1;
+            op2 = bi->op2;
+            op3 = bi->op3;
+
+            Instructions instr = make_instructions(opcode_alias_groups[i],
+                bi->operand_count > 0 ? &op1 : NULL,
+                bi->operand_count > 1 ? &op2 : NULL,
+                bi->operand_count > 2 ? &op3 : NULL);
+
+            encoded_size += instr.size;
+        }
+    }
+    double elapsed = now() - start;
+
+    printf("encode: %8.0f instructions/s (%d bytes)\n", (double) ENCODE_ITERATIONS * count / elapsed, encoded_size);
+}
+
+// Time inserting keys into a strmap and looking them up, both keys that are present
+// and ones that aren't. The keys look like the labels in compiler output. They are
+// shuffled, so that neighbouring keys landing in neighbouring slots doesn't flatter
+// a weak hash.
+static void bench_strmap_size(int key_count) {
+    int key_size = 16;
+    char *keys = malloc((long) key_count * key_size);
+    char *missing_keys = malloc((long) key_count * key_size);
+
+    for (int i = 0; i < key_count; i++) {
+        sprintf(keys + (long) i * key_size, ".L%d_%d", i / 64, i % 64);
+        sprintf(missing_keys + (long) i * key_size, ".L%d_%d", i / 64, 64 + i % 64);
+    }
+
+    char tmp[16];
+    srand(1);
+    for (int i = key_count - 1; i > 0; i--) {
+        long j = ((long) rand() * RAND_MAX + rand()) % (i + 1);
+        memcpy(tmp, keys + (long) i * key_size, key_size);
+        memcpy(keys + (long) i * key_size, keys + j * key_size, key_size);
+        memcpy(keys + j * key_size, tmp, key_size);
+    }
+
+    StrMap *map = new_strmap();
+
+    double start = now();
+    for (int i = 0; i < key_count; i++) strmap_put(map, keys + (long) i * key_size, (void *) 1);
+    double insert_time = now() - start;
+
+    long found = 0;
+    start = now();
+    for (int i = 0; i < key_count; i++) found += (long) strmap_get(map, keys + (long) i * key_size);
+    double lookup_time = now() - start;
+
+    start = now();
+    for (int i = 0; i < key_count; i++) found += (long) strmap_get(map, missing_keys + (long) i * key_size);
+    double missing_lookup_time = now() - start;
+
+    if (found != key_count) panic("Found %ld keys instead of %d", found, key_count);
+
+    printf("strmap: %8d keys: insert %6.1f M/s, lookup %6.1f M/s, missing lookup %6.1f M/s\n",
+        key_count,
+        key_count / insert_time / 1e6,
+        key_count / lookup_time / 1e6,
+        key_count / missing_lookup_time / 1e6);
+
+    free_strmap(map);
+    free(keys);
+    free(missing_keys);
+}
+
+static void bench_strmap(void) {
+    bench_strmap_size(10000);
+    bench_strmap_size(1000000);
+    bench_strmap_size(10000000);
+}
+
+// Assemble a chain of branches, where each branch only fits in the short form once
+// its neighbour does, and return the time in seconds.
+static double time_branch_chain(int branch_count, int backward) {
+    char filename[] = "/tmp/was-bench-XXXXXX.s";
+    int fd = mkstemps(filename, 2);
+    if (fd == -1) simple_error("Unable to create %s", filename);
+    FILE *f = fdopen(fd, "w");
+
+    if (backward) {
+        // Each branch jumps back to the one before it
+        for (int i = 0; i < branch_count; i++) {
+            fprintf(f, "b%d:\n", i);
+            fprintf(f, "jne b%d\n", i ? i - 1 : 0);
+            fprintf(f, ".zero 120\n");
+        }
+    }
+    else {
+        // Each branch jumps to just after the next one
+        for (int i = 0; i < branch_count; i++) {
+            fprintf(f, "jne f%d\n", i);
+            if (i) fprintf(f, "f%d:\n", i - 1);
+            if (i != branch_count - 1) fprintf(f, ".zero 125\n");
+        }
+        fprintf(f, "f%d:\n", branch_count - 1);
+    }
+
+    fprintf(f, "nop\n");
+    fclose(f);
+
+    double start = now();
+    assemble(filename, "/dev/null");
+    double result = now() - start;
+
+    unlink(filename);
+
+    return result;
+}
+
+// Time branch relaxation of long chains of forward and backward branches
+static void bench_branches(void) {
+    int branch_counts[] = {1000, 10000, 100000};
+
+    for (int i = 0; i < 3; i++) {
+        int branch_count = branch_counts[i];
+        printf("branches: %6d branch chain: forward %8.3f ms, backward %8.3f ms\n",
+            branch_count,
+            time_branch_chain(branch_count, 0) * 1000,
+            time_branch_chain(branch_count, 1) * 1000);
+    }
+}
+
+// Write a file that looks like compiler output
+static void write_lexer_corpus(char *filename) {
+    FILE *f = fopen(filename, "w");
+    if (!f) simple_error("Unable to create %s", filename);
+
+    for (int i = 0; i < LEXER_CORPUS_LINES / 8; i++) {
+        fprintf(f, ".L%d:\n", i);
+        fprintf(f, "    .loc 1 %d\n", i);
+        fprintf(f, "    movq    -8(%%rbp), %%rax        # load a local variable\n");
+        fprintf(f, "    addq    $16, %%rsp\n");
+        fprintf(f, "    leaq    .LC%d(%%rip), %%rdi\n", i);
+        fprintf(f, "    call    a_function_with_a_long_name_%d@PLT\n", i % 1000);
+        fprintf(f, "    .string \"hello, world\"\n");
+        fprintf(f, "// A comment on a line of its own\n");
+    }
+
+    fclose(f);
+}
+
+// Time how many bytes per second the lexer gets through with each of the scanners that
+// the CPU supports
+static void bench_lexer(void) {
+    char filename[] = "/tmp/was-bench-XXXXXX.s";
+    char *corpus = lexer_corpus_filename;
+
+    if (!corpus) {
+        int fd = mkstemps(filename, 2);
+        if (fd == -1) simple_error("Unable to create %s", filename);
+        close(fd);
+        write_lexer_corpus(filename);
+        corpus = filename;
+    }
+
+    FILE *f = fopen(corpus, "r");
+    if (!f) simple_error("Unable to open %s", corpus);
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fclose(f);
+
+    for (Scanner *s = scanners; s->name; s++) {
+        if (!scanner_is_supported(s)) continue;
+        scanner = s;
+
+        double best = 0;
+        long token_count = 0;
+
+        for (int i = 0; i < LEXER_ITERATIONS; i++) {
+            double start = now();
+            init_lexer(corpus);
+            for (token_count = 1; TOKEN_KIND(cur_token_index) != TOK_EOF; token_count++) next();
+            double elapsed = now() - start;
+            free_lexer();
+            free_arena();
+
+            if (!best || elapsed < best) best = elapsed;
+        }
+
+        printf("lexer: %-6s %8.1f MB/s (%ld tokens)\n", s->name, size / best / 1e6, token_count);
+    }
+
+    scanner = NULL;
+    if (!lexer_corpus_filename) unlink(filename);
+}
+
+typedef struct benchmark {
+    char *name;
+    void (*function)(void);
+} Benchmark;
+
+static Benchmark benchmarks[] = {
+    { "startup",  bench_startup  },
+    { "encode",   bench_encode   },
+    { "strmap",   bench_strmap   },
+    { "branches", bench_branches },
+    { "lexer",    bench_lexer    },
+};
+
+int main(int argc, char **argv) {
+    int count = sizeof(benchmarks) / sizeof(Benchmark);
+    int found = 0;
+
+    if (argc > 2) lexer_corpus_filename = argv[2];
+
+    for (int i = 0; i < count; i++) {
+        if (argc > 1 && strcmp(argv[1], benchmarks[i].name)) continue;
+        benchmarks[i].function();
+        found = 1;
+    }
+
+    if (!found) simple_error("Unknown benchmark %s", argv[1]);
+}
@@ -1,5 +1,6 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "branches.h"
 #include "elf.h"
@@ -7,255 +8,663 @@
 #include "parser.h"
 #include "utils.h"
 
-// Based on the approach in relax_segment in GNU GAS write.c The text chunks are grouped
-// into a list of frags. Each frag starts with a branch instruction and has zero or
-// more other instructions after it. All branches start with the larger
-// (primary) version of the branch instruction. First, all frags are made. Then, until
-// no changes are made, all frags are walked over, keeping track of how much the
-// running offset has been reduced. Instructions are reduced where possible and symbol
-// offsets are updated.
-// Typically, the process will stop after a couple of iterations. However, an upper limit
-// has been added just in case it goes on forever.
+// Branch relaxation. The text chunks are grouped into an array of fragments. Each
+// fragment starts with a branch instruction or an alignment and is followed by zero or
+// more fixed size instructions. All branches start with the larger (primary) version of
+// the branch instruction.
+//
+// The offsets of the fragments are kept in a Fenwick tree of fragment sizes, so that
+// the current offset of any fragment or label can be looked up in O(log n). A worklist
+// starts out with all branches. A branch that fits in the short form is shortened,
+// which can only bring the targets of branches that jump over it closer. Those
+// branches are within reach of a short branch of the shortened one, so only they
+// are put back on the worklist. Each shortening does a bounded amount of work, so the
+// whole process is close to linear in the number of branches, even for long chains of
+// branches that each depend on the next one.
+//
+// Alignments break this a little: code after an alignment may move back less than
+// code before it. Once the worklist is empty, any short branch that ended up out of
+// reach is switched back to the long form for good, and the worklist is run again.
+//
+// With -fthread-jumps, branches to a label that is followed by a jmp are first sent
+// straight to where the jmp goes, and branches to the next instruction are removed.
+//
+// With -mbranches-within-32B-boundaries, jumps, calls, rets and cmp/test + jcc pairs
+// that the CPU fuses get a branch padding chunk before them, which is laid out like an
+// alignment. Its padding also depends on the size of the jump, so it is updated along
+// with it.
 
 // #define DEBUG
 
+// Alignment of loop headers and function entries, zero if they aren't aligned. Set with
+// -falign-loops and -falign-functions.
+int align_loops;
+int align_loops_max_skip;
+int align_functions;
+int align_functions_max_skip;
+
+int aligned_loops;
+int aligned_functions;
+
+// Retarget branches through chains of jmps and remove jumps to the next instruction.
+// Set with -fthread-jumps or -O.
+int thread_jumps;
+
+int threaded_jumps;
+int removed_jumps;
+
+// Jumps don't cross or end on a multiple of this, zero if they may. Set with
+// -mbranches-within-32B-boundaries.
+int branch_boundary;
+
+int padded_branches;
+int branch_padding_bytes;
+
+// A chain of jumps isn't followed further than this, which also stops endless loops
+#define MAX_JUMP_CHAIN 16
+
+// Is the chunk a jmp or conditional jump
+#define IS_JUMP_CHUNK(chunk) (IS_BRANCH_CHUNK(chunk) || \
+    ((chunk)->type == CT_RELOCATED_CODE && ((RelocatedCodeChunk *) (chunk))->data[0] == 0xe9))
+
+// Is the chunk a jmp to a symbol
+#define IS_JMP_CHUNK(chunk) ((chunk)->type == CT_RELOCATED_CODE && ((RelocatedCodeChunk *) (chunk))->data[0] == 0xe9)
+
+#define IS_PADDING_CHUNK(chunk) ((chunk)->type == CT_ALIGN || (chunk)->type == CT_BRANCH_PADDING)
+
+// A short branch can't reach further than this, with some room for the branch itself
+#define SHORT_BRANCH_REACH 144
+
 typedef struct fragment {
-    int chunk_index;                // Index of the branch instruction in the chunks list
-    int offset;                     // Offset of the first instruction
-    int fixed_size;                 // The size of all the instructions except the first one
-    int branch_targets_index;       // Index in branch_target_list of the first symbol (if any) following the branch instruction. -1 if none
-    int target_symbol_is_before;    // Is the target of the branch instruction before the jump instruction
-    struct fragment *prev;          // Previous frag (if any)
-    struct fragment *next;          // Next frag (if any)
+    Chunk *chunk;           // The branch instruction or alignment
+    int size;               // The size of the branch instruction or the alignment padding
+    int fixed_size;         // The size of all the instructions after the first one
+    int next_alignment;     // Index of the next alignment or branch padding fragment. fragment_count if none
+    int max_alignment;      // The largest alignment or boundary of this fragment and all after it
+    int target;             // Index of the first fragment after the branch target. -1 if the branch can't be shortened
+    int target_back;        // Distance from the branch target to the start of that fragment
+    int queued;             // Is the fragment on the worklist
 } Fragment;
 
-Fragment *head;             // The first of the linked list of frags
-List *branch_target_list;   // A list of all symbols, in order of declaration
+static Fragment *fragments; // All fragments, in order
+static int fragment_count;
+static int start_offset;    // Offset of the first fragment
+static int *tree;           // Fenwick tree of fragment sizes, including their fixed sizes
+static int *worklist;       // Indexes of branches to check
+static int worklist_length;
+
+static void add_to_fragment_size(int index, int delta) {
+    for (int i = index + 1; i <= fragment_count; i += i & -i) tree[i] += delta;
+}
+
+// The current offset of a fragment. Index may be fragment_count, for the end.
+static int fragment_offset(int index) {
+    int result = start_offset;
+    for (int i = index; i > 0; i -= i & -i) result += tree[i];
+    return result;
+}
 
 #ifdef DEBUG
-// Dump all frags + symbols
-void dump_frags(List *chunks) {
-    printf("Frags:\n");
+// Dump all fragments
+static void dump_fragments(Chunks *chunks) {
+    printf("Fragments:\n");
 
-    for (Fragment *frag = head; frag; frag = frag->next) {
-        Chunk *chunk = chunks->elements[frag->chunk_index];
+    for (int i = 0; i < fragment_count; i++) {
+        Fragment *frag = &fragments[i];
+        Chunk *chunk = frag->chunk;
+        int position = (char *) chunk - chunks->data;
 
         if (chunk->type == CT_ALIGN)
-            printf("%5d %06x align %d\n",
-                frag->chunk_index, frag->offset, chunk->aic.alignment);
+            printf("%8d %06x align %d\n",
+                position, fragment_offset(i), ((AlignChunk *) chunk)->alignment);
+        else if (chunk->type == CT_BRANCH_PADDING)
+            printf("%8d %06x padding %d\n", position, fragment_offset(i), frag->size);
         else
-            printf("%5d %06x -> %s\n",
-                frag->chunk_index, frag->offset, chunk->coc.primary ? chunk->coc.primary->relocation.symbol->name: "(none)");
-
-        int start = frag->branch_targets_index;
-        int end = frag->next ? frag->next->branch_targets_index : branch_target_list->length;
-
-        if (start != -1 && end != -1) {
-            for (int j = start; j < end; j++) {
-                Symbol *symbol = branch_target_list->elements[j];
-                printf("  %06x %s\n", symbol->value, symbol->name);
-            }
-        }
+            printf("%8d %06x -> %s\n",
+                position, fragment_offset(i), ((RelocatedCodeChunk *) chunk)->relocation_symbol->name);
     }
 }
 #endif
 
-// Update all symbol offsets
-static void make_symbol_offsets(Section *section) {
-    List *chunks = section->chunks;
+// The padding of an alignment or branch padding chunk at offset
+static int padding_size(Chunk *chunk, int offset) {
+    if (chunk->type == CT_ALIGN)
+        return ALIGN_CHUNK_PADDING((AlignChunk *) chunk, offset);
+    else
+        return branch_padding((BranchPaddingChunk *) chunk, offset);
+}
 
+// Update all symbol offsets and the layout size of the section
+static void make_symbol_offsets(Section *section) {
     int offset = 0;
 
-    for (int i = 0; i < chunks->length; i++) {
-        Chunk *chunk = chunks->elements[i];
+    chunks_foreach(section->chunks, chunk) {
         if (chunk->type == CT_LABEL) {
-            chunk->lac.symbol->section = section;
-            chunk->lac.symbol->value = offset;
+            Symbol *symbol = ((LabelChunk *) chunk)->symbol;
+            symbol->section = section;
+            symbol->value = offset;
         }
 
-        chunk->offset = offset;
-
-        if (chunk->type == CT_ALIGN)
-            offset += PADDING_FOR_ALIGN_UP(offset, chunk->aic.alignment);
+        if (IS_PADDING_CHUNK(chunk))
+            offset += padding_size(chunk, offset);
         else
             offset += CHUNK_SIZE(chunk);
     }
+
+    section->layout_size = offset;
+}
+
+// Mark the labels that are jumped to from further down in the section as loop headers.
+// Labels get their section here already, so that a jump can tell if its target is
+// before it. make_symbol_offsets() sets it again.
+static void mark_loop_headers(Section *section) {
+    chunks_foreach(section->chunks, chunk) {
+        if (chunk->type == CT_LABEL) {
+            Symbol *symbol = ((LabelChunk *) chunk)->symbol;
+            symbol->section = section;
+            symbol->is_loop_header = 0;
+        }
+        else if (IS_JUMP_CHUNK(chunk)) {
+            Symbol *symbol = ((RelocatedCodeChunk *) chunk)->relocation_symbol;
+            if (symbol->section == section) symbol->is_loop_header = 1;
+        }
+    }
 }
 
-static void make_frags(List *chunks) {
-    head = NULL;
+// The final destination of a branch to symbol, following the jmps at the labels on the
+// way. Only local labels in the section are followed, the others may be interposed or
+// be in a section that isn't laid out yet.
+static Symbol *final_jump_target(Section *section, Symbol *symbol) {
+    for (int i = 0; i < MAX_JUMP_CHAIN; i++) {
+        Symbol *target = symbol->jump_target;
+        if (!target || target->section != section || target->binding == STB_GLOBAL) break;
+        symbol = target;
+    }
 
-    StrMap *branch_target_set = new_strmap(); // Branch targets
-    StrMap *seen_symbols = new_strmap(); // Declared symbols
-    char *chunk_target_symbol_is_before = malloc(chunks->length); // For branches, is the target before or after the instruction?
+    return symbol;
+}
 
-    // Make branch_target_set and chunk_target_symbol_is_before
-    for (int i = 0; i < chunks->length; i++) {
-        Chunk *chunk = chunks->elements[i];
+// Does the branch go to a local label before the next instruction
+static int jumps_to_next_instruction(Chunk *branch, Chunk *end) {
+    Symbol *symbol = ((RelocatedCodeChunk *) branch)->relocation_symbol;
+    if (((RelocatedCodeChunk *) branch)->relocation_addend || symbol->binding == STB_GLOBAL) return 0;
 
-        if (chunk->type == CT_LABEL)
-            strmap_put(seen_symbols, chunk->lac.symbol->name, (void *) 1);
+    for (Chunk *chunk = NEXT_CHUNK(branch); chunk < end && (chunk->type == CT_LABEL || chunk->type == CT_LOC); chunk = NEXT_CHUNK(chunk))
+        if (chunk->type == CT_LABEL && ((LabelChunk *) chunk)->symbol == symbol) return 1;
+
+    return 0;
+}
+
+// Remove the jumps to the next instruction, moving the rest of the chunks back. A jump
+// can end up at its target after the ones in between are removed, so this is repeated
+// until there are none left. Returns the number of jumps removed.
+static int remove_jumps_to_next_instruction(Chunks *chunks) {
+    Chunk *end = END_OF_CHUNKS(chunks);
+    char *write = chunks->data;
+    int result = 0;
+
+    for (Chunk *chunk = FIRST_CHUNK(chunks); chunk < end;) {
+        Chunk *next = NEXT_CHUNK(chunk);
+        int length = chunk->length;
+
+        if (IS_JUMP_CHUNK(chunk) && jumps_to_next_instruction(chunk, end))
+            result++;
+        else {
+            memmove(write, chunk, length);
+            write += length;
+        }
+
+        chunk = next;
+    }
+
+    chunks->size = write - chunks->data;
+    chunks->count -= result;
+    removed_jumps += result;
+
+    return result;
+}
+
+// Remove the branches to the next instruction, and retarget branches to labels that are
+// followed by a jmp to where the jmp goes. This is done before
+// any padding is inserted, so that the branches that got closer to their targets can
+// be shortened.
+static void thread_section_jumps(Section *section) {
+    Chunks *chunks = section->chunks;
+
+    // Threading would take these away from their next instruction
+    while (remove_jumps_to_next_instruction(chunks));
+
+    Chunk *end = END_OF_CHUNKS(chunks);
+
+    // Find the labels that are right before a jmp
+    chunks_foreach(chunks, chunk) {
+        if (chunk->type != CT_LABEL) continue;
+
+        Symbol *symbol = ((LabelChunk *) chunk)->symbol;
+        symbol->section = section;
+        symbol->jump_target = NULL;
+
+        Chunk *next = NEXT_CHUNK(chunk);
+        while (next < end && (next->type == CT_LABEL || next->type == CT_LOC)) next = NEXT_CHUNK(next);
+
+        if (next < end && IS_JMP_CHUNK(next) && !((RelocatedCodeChunk *) next)->relocation_addend)
+            symbol->jump_target = ((RelocatedCodeChunk *) next)->relocation_symbol;
+    }
+
+    chunks_foreach(chunks, chunk) {
+        if (!IS_JUMP_CHUNK(chunk)) continue;
+
+        RelocatedCodeChunk *branch = (RelocatedCodeChunk *) chunk;
+        Symbol *symbol = branch->relocation_symbol;
+        if (branch->relocation_addend || symbol->section != section || symbol->binding == STB_GLOBAL) continue;
+
+        Symbol *target = final_jump_target(section, symbol);
+        if (target != symbol) {
+            branch->relocation_symbol = target;
+            threaded_jumps++;
+        }
+    }
+
+    while (remove_jumps_to_next_instruction(chunks));
+}
+
+// Add an alignment if any of the labels starting at label is a loop header or a function
+static void append_label_alignment(Section *section, Chunks *result, Chunk *label, Chunk *end) {
+    int is_loop_header = 0;
+    int is_function = 0;
+
+    for (; label < end && label->type == CT_LABEL; label = NEXT_CHUNK(label)) {
+        Symbol *symbol = ((LabelChunk *) label)->symbol;
+        if (symbol->is_loop_header) is_loop_header = 1;
+        if (symbol->type == STT_FUNC) is_function = 1;
+    }
+
+    // Use the larger alignment if the label is both
+    int alignment = 0;
+    int max_skip = 0;
+
+    if (is_loop_header && align_loops > alignment) {
+        alignment = align_loops;
+        max_skip = align_loops_max_skip;
+    }
+
+    if (is_function && align_functions > alignment) {
+        alignment = align_functions;
+        max_skip = align_functions_max_skip;
+    }
+
+    if (alignment <= 1) return;
+
+    if (alignment > section->align) section->align = alignment;
+
+    AlignChunk *align_chunk = append_chunk(result, CT_ALIGN, sizeof(AlignChunk));
+    align_chunk->alignment = alignment;
+    align_chunk->max_skip = max_skip;
+    align_chunk->fill = -1;
+
+    if (alignment == align_functions && is_function) aligned_functions++; else aligned_loops++;
+}
+
+// Skip operand size and REX prefixes
+static uint8_t *skip_prefixes(uint8_t *data) {
+    while (*data == 0x66 || (*data & 0xf0) == 0x40) data++;
+    return data;
+}
 
-        if (chunk->type == CT_CODE && chunk->coc.secondary) {
-            chunk_target_symbol_is_before[i] = (char) (long) strmap_get(seen_symbols, chunk->coc.primary->relocation.symbol->name);
-            strmap_put(branch_target_set, chunk->coc.primary->relocation.symbol->name, (void *) 1);
+// The instructions in a chunk, NULL if it isn't code
+static uint8_t *chunk_instructions(Chunk *chunk) {
+    if (chunk->type == CT_CODE) return ((CodeChunk *) chunk)->data;
+    if (chunk->type == CT_RELOCATED_CODE) return ((RelocatedCodeChunk *) chunk)->data;
+    return NULL;
+}
+
+static int is_conditional_jump(uint8_t *data) {
+    data = skip_prefixes(data);
+    return (data[0] >= 0x70 && data[0] <= 0x7f) || (data[0] == 0x0f && data[1] >= 0x80 && data[1] <= 0x8f);
+}
+
+// Is it a jcc, jmp, call or ret, direct or indirect
+static int is_branch(uint8_t *data) {
+    if (is_conditional_jump(data)) return 1;
+    data = skip_prefixes(data);
+    int reg = (data[1] >> 3) & 7;
+
+    switch (data[0]) {
+        case 0xe9: case 0xeb:   return 1;                       // jmp
+        case 0xe8:              return 1;                       // call
+        case 0xc2: case 0xc3:   return 1;                       // ret
+        case 0xff:              return reg == 2 || reg == 4;    // indirect call or jmp
+        default:                return 0;
+    }
+}
+
+// Can the CPU fuse the instruction with a jcc after it? That's a cmp or test, unless
+// it has both a memory operand and an immediate.
+static int is_fusible(uint8_t *data) {
+    data = skip_prefixes(data);
+    int reg = (data[1] >> 3) & 7;
+    int mod = data[1] >> 6;
+
+    switch (data[0]) {
+        case 0x38: case 0x39: case 0x3a: case 0x3b: case 0x3c: case 0x3d:   // cmp
+        case 0x84: case 0x85: case 0xa8: case 0xa9:                         // test
+            return 1;
+
+        case 0x80: case 0x81: case 0x83: return reg == 7 && mod == 3;     // cmp $imm
+        case 0xf6: case 0xf7:            return reg == 0 && mod == 3;     // test $imm
+        default:                         return 0;
+    }
+}
+
+// Add a branch padding chunk if the chunk is a branch or a cmp or test that gets fused
+// with a jcc after it. Returns the branch, or NULL if there isn't one.
+static Chunk *append_branch_padding(Chunks *result, Chunk *chunk, Chunk *end) {
+    uint8_t *instructions = chunk_instructions(chunk);
+    if (!instructions) return NULL;
+
+    Chunk *jump = NULL;
+    int chunk_count = 1;
+
+    if (is_branch(instructions))
+        jump = chunk;
+    else if (chunk->type == CT_CODE && is_fusible(instructions)) {
+        // Only labels and .locs may come in between
+        Chunk *next = NEXT_CHUNK(chunk);
+        chunk_count++;
+        while (next < end && (next->type == CT_LOC || next->type == CT_LABEL)) {
+            next = NEXT_CHUNK(next);
+            chunk_count++;
+        }
+
+        uint8_t *next_instructions = next < end ? chunk_instructions(next) : NULL;
+        if (next_instructions && is_conditional_jump(next_instructions)) jump = next;
+    }
+
+    if (!jump) return NULL;
+
+    BranchPaddingChunk *padding_chunk = append_chunk(result, CT_BRANCH_PADDING, sizeof(BranchPaddingChunk));
+    padding_chunk->boundary = branch_boundary;
+    padding_chunk->chunk_count = chunk_count;
+    padded_branches++;
+
+    return jump;
+}
+
+// Insert alignments before loop headers and function entries, and padding before branches.
+// A loop header is a label that is jumped to from further down. The alignment goes
+// before the first of any labels at the same place, unless there already is one.
+static void insert_padding(Section *section) {
+    Chunks *chunks = section->chunks;
+    Chunk *end = END_OF_CHUNKS(chunks);
+
+    if (align_loops) mark_loop_headers(section);
+
+    // Branch padding only works if the section is aligned to the boundary
+    if (branch_boundary > section->align) section->align = branch_boundary;
+
+    Chunks result = {0};
+    Chunk *previous = NULL;
+    Chunk *padded_jump = NULL;
+
+    chunks_foreach(chunks, chunk) {
+        // The padding before a fused cmp or test counts the chunks up to its jcc, so
+        // labels in between don't get an alignment
+        int in_fused_pair = padded_jump && chunk < padded_jump;
+
+        if ((align_loops || align_functions) && chunk->type == CT_LABEL && !in_fused_pair &&
+                (!previous || (previous->type != CT_LABEL && previous->type != CT_ALIGN)))
+            append_label_alignment(section, &result, chunk, end);
+
+        // The jump of a fused pair is already taken care of
+        if (branch_boundary && chunk != padded_jump) {
+            Chunk *jump = append_branch_padding(&result, chunk, end);
+            if (jump) padded_jump = jump;
         }
+
+        memcpy(append_chunk(&result, chunk->type, chunk->length), chunk, chunk->length);
+        previous = chunk;
     }
 
-    free_strmap(seen_symbols);
+    free(chunks->data);
+    *chunks = result;
+}
+
+// Make the fragments and the Fenwick tree. The symbol offsets must be up to date.
+static void make_fragments(Section *section) {
+    Chunks *chunks = section->chunks;
+
+    fragment_count = 0;
+    chunks_foreach(chunks, chunk)
+        if (IS_PADDING_CHUNK(chunk) || IS_BRANCH_CHUNK(chunk)) fragment_count++;
+
+    if (!fragment_count) return;
+
+    fragments = calloc(fragment_count, sizeof(Fragment));
+    tree = calloc(fragment_count + 1, sizeof(int));
+    worklist = malloc(fragment_count * sizeof(int));
+    worklist_length = 0;
 
     int offset = 0;
+    int frag_offset = 0;
     Fragment *frag = NULL;
-    branch_target_list = new_list(1024);
 
-    // Make fragments: loop over all text chunks
-    for (int i = 0; i < chunks->length; i++) {
-        Chunk *chunk = chunks->elements[i];
+    chunks_foreach(chunks, chunk) {
+        // Labels point at the fragment after them
+        if (chunk->type == CT_LABEL)
+            ((LabelChunk *) chunk)->symbol->fragment_index = frag ? frag - fragments + 1 : 0;
 
-        // Addf labels branch_target_list if they are a branch target.
-        if (chunk->type == CT_LABEL) {
-            Symbol *symbol = chunk->lac.symbol;
-            if (strmap_get(branch_target_set, symbol->name)) {
-                // Set branch_targets_index unless there is no frag yet or it's
-                // already set.
-                if (frag && frag->branch_targets_index == -1)
-                    frag->branch_targets_index = branch_target_list->length;
-
-                append_to_list(branch_target_list, symbol);
-            }
+        int size = IS_PADDING_CHUNK(chunk) ? padding_size(chunk, offset) : CHUNK_SIZE(chunk);
+
+        // It's a branch or padding; anything that isn't a fixed size
+        if (IS_PADDING_CHUNK(chunk) || IS_BRANCH_CHUNK(chunk)) {
+            if (frag)
+                frag->fixed_size = offset - frag_offset - frag->size;
+            else
+                start_offset = offset;
+
+            frag = frag ? frag + 1 : fragments;
+            frag->chunk = chunk;
+            frag->size = size;
+            frag_offset = offset;
         }
 
-        // It's a branch or alignment; any instruction that isn't a fixed size
-        if (chunk->type == CT_ALIGN || (chunk->type == CT_CODE && chunk->coc.secondary)) {
-            // Create a new frag
-            if (!frag) {
-                head = calloc(1, sizeof(Fragment));
-                frag = head;
-            }
-            else {
-                frag->next = calloc(1, sizeof(Fragment));
-                frag->next->prev = frag;
-                frag = frag->next;
-            }
-
-            frag->chunk_index = i;
-            frag->offset = offset;
-            frag->branch_targets_index = -1; // The next instruction (if any) sets this
-            frag->target_symbol_is_before = chunk_target_symbol_is_before[i];
-
-            if (frag->prev)
-                frag->prev->fixed_size = offset - frag->prev->offset - CHUNK_SIZE((Chunk *) chunks->elements[frag->prev->chunk_index]);
+        offset += size;
+    }
+
+    frag->fixed_size = offset - frag_offset - frag->size;
+
+    // Build the tree in O(n) by pushing each partial sum up to its parent
+    for (int i = 0; i < fragment_count; i++) {
+        int j = i + 1;
+        tree[j] += fragments[i].size + fragments[i].fixed_size;
+        int parent = j + (j & -j);
+        if (parent <= fragment_count) tree[parent] += tree[j];
+    }
+
+    int next_alignment = fragment_count;
+    int max_alignment = 1;
+    for (int i = fragment_count - 1; i >= 0; i--) {
+        fragments[i].next_alignment = next_alignment;
+        Chunk *chunk = fragments[i].chunk;
+        if (IS_PADDING_CHUNK(chunk)) {
+            next_alignment = i;
+            int alignment = chunk->type == CT_ALIGN
+                ? ((AlignChunk *) chunk)->alignment
+                : ((BranchPaddingChunk *) chunk)->boundary;
+            if (alignment > max_alignment) max_alignment = alignment;
+            fragments[i].max_alignment = max_alignment;
         }
+    }
 
-        offset += CHUNK_SIZE(chunk);
+    // Only branches to local labels in this section can be shortened. Everything else
+    // is relocated with a 32 bit relocation.
+    for (int i = 0; i < fragment_count; i++) {
+        frag = &fragments[i];
+        frag->target = -1;
+        if (IS_PADDING_CHUNK(frag->chunk)) continue;
+
+        RelocatedCodeChunk *branch = (RelocatedCodeChunk *) frag->chunk;
+        Symbol *symbol = branch->relocation_symbol;
+        if (symbol->section != section || symbol->binding == STB_GLOBAL) continue;
+
+        frag->target = symbol->fragment_index;
+        frag->target_back = fragment_offset(frag->target) - symbol->value;
     }
+}
+
+static void free_fragments(void) {
+    free(fragments);
+    free(tree);
+    free(worklist);
+    fragments = NULL;
+    tree = NULL;
+    worklist = NULL;
+}
 
-    free_strmap(branch_target_set);
-    free(chunk_target_symbol_is_before);
+static void queue_branch(int index) {
+    Fragment *frag = &fragments[index];
+    if (frag->queued || frag->target == -1 || !((RelocatedCodeChunk *) frag->chunk)->using_primary) return;
 
-    if (!frag) return; // Do nothing if there are No branch instructions
+    frag->queued = 1;
+    worklist[worklist_length++] = index;
+}
 
-    // Patch up any branch_targets_index that are -1 going backwards. This happens in e.g.
-    // this case:
-    // jne foo          <- this frag ends up with -1 since no new labels have been defined
-    // nop
-    // jne foo
+// Would the short form of the branch reach its target? This assumes the target moves
+// back along with the end of the branch, which is exact for forward branches and
+// errs on the safe side for backward ones. An alignment in between a forward branch
+// and its target may keep the target in place, so then it isn't assumed to move.
+static int short_branch_fits(int index) {
+    Fragment *frag = &fragments[index];
+    RelocatedCodeChunk *branch = (RelocatedCodeChunk *) frag->chunk;
 
-    int branch_targets_index = frag->branch_targets_index;
-    frag = frag->prev;
-    while (frag) {
-        if (frag->branch_targets_index == -1)
-            frag->branch_targets_index = branch_targets_index;
-        else
-            branch_targets_index = frag->branch_targets_index;
+    int reduction = branch->size - branch->secondary_size;
+    if (frag->target > index && frag->next_alignment < frag->target) reduction = 0;
 
-        frag = frag->prev;
+    int target_offset = fragment_offset(frag->target) - frag->target_back + branch->relocation_addend;
+    int end_offset = fragment_offset(index) + branch->secondary_relocation_offset + 1;
+    int relative_offset = target_offset - (end_offset + reduction);
+
+    return relative_offset >= -128 && relative_offset <= 127;
+}
+
+// Queue all long branches within reach of a fragment that changed size. The ones that
+// jump over it are the only ones that can have got closer to their target.
+static void queue_nearby_branches(int index) {
+    int offset = fragment_offset(index);
+
+    int before = offset;
+    for (int i = index - 1; i >= 0; i--) {
+        before -= fragments[i].size + fragments[i].fixed_size;
+        if (offset - before > SHORT_BRANCH_REACH) break;
+        queue_branch(i);
     }
 
-    #ifdef DEBUG
-    printf("Branch target list:\n");
-    for (int i = 0; i < branch_target_list->length; i++) {
-        Symbol *symbol = branch_target_list->elements[i];
-        printf("%5d %s\n", i, symbol->name);
+    int after = offset;
+    for (int i = index + 1; i < fragment_count; i++) {
+        after += fragments[i - 1].size + fragments[i - 1].fixed_size;
+        if (after - offset > SHORT_BRANCH_REACH) break;
+        queue_branch(i);
     }
-    #endif
 }
 
-static void reduce(List *chunks) {
-    int iterations = 0;
-    const int max_iterations = chunks->length * chunks->length; // Don't go further than O(n^2)
-
-    int changed = 1;
-    while (iterations < max_iterations && changed) {
-        #ifdef DEBUG
-        printf("Branch reduction iteration %d\n", iterations);
-        #endif
-
-        changed = 0;
-
-        int offset = head->offset;
-        int compression = 0;
-
-        for (Fragment *frag = head; frag; frag = frag->next) {
-            Chunk *chunk = chunks->elements[frag->chunk_index];
-
-            // If it's a branch not already been reduced ...
-            if (chunk->type == CT_CODE && chunk->coc.secondary && chunk->coc.using_primary) {
-                int symbol_offset = chunk->coc.primary->relocation.symbol->value;
-
-                // Symbols in the past have had their offset set. Symbols in the
-                // future are displaced backwards as the iteration goes on
-                if (!frag->target_symbol_is_before) symbol_offset += compression;
-
-                int relative_offset = symbol_offset - (offset + chunk->coc.secondary->relocation.offset + 1 + 4);
-
-                if (relative_offset >= -128 && relative_offset <= 127) {
-                    chunk->coc.using_primary = 0;
-                    changed = 1;
-                    compression += chunk->coc.secondary->size - chunk->coc.primary->size;
-                }
-            }
-
-            // Add compression to all symbols in this fragment.
-            // In the next iteration, these are considered "before", and must have
-            // their offsets set.
-            int start = frag->branch_targets_index;
-            int end = frag->next ? frag->next->branch_targets_index : branch_target_list->length;
-            if (end == -1) end = branch_target_list->length;
-            if (start != -1) {
-                for (int j = start; j < end; j++) {
-                    Symbol *symbol = branch_target_list->elements[j];
-                    symbol->value += compression;
-                }
-            }
-
-            if (chunk->type == CT_ALIGN)
-                offset += PADDING_FOR_ALIGN_UP(offset, chunk->aic.alignment);
-            else
-                offset += frag->fixed_size + CHUNK_SIZE(chunk);
-        }
+// Recalculate the padding of an alignment or branch padding fragment. Returns the
+// change in size.
+static int update_padding(int index) {
+    Fragment *frag = &fragments[index];
+    int delta = padding_size(frag->chunk, fragment_offset(index)) - frag->size;
+    if (!delta) return 0;
+
+    frag->size += delta;
+    add_to_fragment_size(index, delta);
+    queue_nearby_branches(index);
+
+    return delta;
+}
 
-        iterations++;
+// Switch a branch to the short or long form and move everything after it. Alignments
+// after the branch change their padding, which stops the move once one of them takes
+// up all of it. A move by a multiple of all the alignments after it doesn't change
+// any padding, so that stops it too. Branches near anything that changed size are
+// queued.
+static void set_branch_form(int index, int using_primary) {
+    Fragment *frag = &fragments[index];
+    RelocatedCodeChunk *branch = (RelocatedCodeChunk *) frag->chunk;
+
+    branch->using_primary = using_primary;
+    int size = using_primary ? branch->size : branch->secondary_size;
+    int move = size - frag->size;
+    frag->size = size;
+    add_to_fragment_size(index, move);
+    queue_nearby_branches(index);
+
+    // The branch padding before the branch depends on its size
+    if (index > 0 && fragments[index - 1].chunk->type == CT_BRANCH_PADDING) move += update_padding(index - 1);
+
+    for (int i = frag->next_alignment; i < fragment_count && move % fragments[i].max_alignment; i = fragments[i].next_alignment)
+        move += update_padding(i);
+}
+
+// Shortening a branch can move an alignment's padding so that code after it moves back
+// less than code before it, which can take a short branch over the alignment out of
+// reach. Switch those back to the long form for good. Returns the number of branches
+// switched back.
+static int lengthen_unreachable_branches(void) {
+    int result = 0;
+
+    for (int i = 0; i < fragment_count; i++) {
+        Fragment *frag = &fragments[i];
+        RelocatedCodeChunk *branch = (RelocatedCodeChunk *) frag->chunk;
+        if (frag->target == -1 || branch->using_primary) continue;
+
+        int target_offset = fragment_offset(frag->target) - frag->target_back + branch->relocation_addend;
+        int relative_offset = target_offset - (fragment_offset(i) + branch->secondary_relocation_offset + 1);
+
+        if (relative_offset < -128 || relative_offset > 127) {
+            frag->target = -1;
+            set_branch_form(i, 1);
+            result++;
+        }
     }
 
-    #ifdef DEBUG
-    printf("Branch reduction with %d / %d iterations\n", iterations,  max_iterations);
-    #endif
+    return result;
+}
+
+static void reduce(void) {
+    // Queue all branches, last first, so that they are checked in order
+    for (int i = fragment_count - 1; i >= 0; i--) queue_branch(i);
+
+    do {
+        while (worklist_length) {
+            int index = worklist[--worklist_length];
+            fragments[index].queued = 0;
+            if (short_branch_fits(index)) set_branch_form(index, 0);
+        }
+    } while (lengthen_unreachable_branches());
 }
 
 void layout_section(Section *section) {
+    if (thread_jumps && (section->flags & SHF_EXECINSTR)) thread_section_jumps(section);
+
+    if ((align_loops || align_functions || branch_boundary) && (section->flags & SHF_EXECINSTR))
+        insert_padding(section);
+
     make_symbol_offsets(section);
 
-    if (!section->chunks->length) return;
+    if (!section->chunks->count) return;
 
-    make_frags(section->chunks);
+    make_fragments(section);
+
+    if (!fragment_count) return;
 
     #ifdef DEBUG
-    dump_frags(section->chunks);
+    dump_fragments(section->chunks);
     #endif
 
-    if (!head) return;
+    reduce();
+
+    for (int i = 0; i < fragment_count; i++)
+        if (fragments[i].chunk->type == CT_BRANCH_PADDING) branch_padding_bytes += fragments[i].size;
 
-    reduce(section->chunks);
+    free_fragments();
     make_symbol_offsets(section);
 }
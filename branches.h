@@ -4,6 +4,22 @@
 #include "elf.h"
 #include "list.h"
 
+extern int align_loops;
+extern int align_loops_max_skip;
+extern int align_functions;
+extern int align_functions_max_skip;
+
+extern int aligned_loops;
+extern int aligned_functions;
+
+extern int thread_jumps;
+extern int threaded_jumps;
+extern int removed_jumps;
+
+extern int branch_boundary;
+extern int padded_branches;
+extern int branch_padding_bytes;
+
 void layout_section(Section *section);
 
 #endif
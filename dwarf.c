@@ -6,6 +6,7 @@
 #include "dwarf.h"
 #include "elf.h"
 #include "list.h"
+#include "relocations.h"
 #include "utils.h"
 #include "symbols.h"
 
@@ -16,9 +17,12 @@
 #define MAX_LINE_INCREMENT (LINE_BASE + LINE_RANGE - 1)
 #define OP255_ADDRESS_INCREMENT ((255 - OPCODE_BASE) / LINE_RANGE) // Used by DW_LNS_const_add_pc
 
+static void add_dwarf_loc_advance_address(int address_advance);
+
 static List *dirs_list;
 static StrMap *dirs_map;
 static List *files;
+static List *sequences;
 static int next_dir_index;
 
 typedef struct file {
@@ -26,6 +30,13 @@ typedef struct file {
     int dir_index;
 } File;
 
+// Each code section with locs gets its own sequence in the line number program, which
+// starts with a DW_LNE_set_address that is relocated against the section.
+typedef struct sequence {
+    Section *section;
+    int address_offset;     // Offset of the address of DW_LNE_set_address in the program
+} Sequence;
+
 // State machine for the line nunmbers
 typedef struct state {
     // DWARF State machine
@@ -37,7 +48,7 @@ typedef struct state {
     char *data;             // Buffer
     int allocated;          // Allocated memory in buffer
     int size;               // Used size
-    int locs_present;       // 1 if any .locs are present (the normal case)
+    Section *section;       // Section of the current sequence, NULL if there are no locs
 } State;
 
 State state;
@@ -123,17 +134,46 @@ static int add_to_state_data(const void *src, int size) {
     return data - state.data;
 }
 
-static void make_dwarf_debug_line_section_program(Section *debug_line_section) {
-    if (!state.locs_present) return; // No debug line info
+// Start a sequence for the locs of a section. The state machine registers start over.
+static void start_sequence(Section *section) {
+    // Extended opcode 2: set Address to 0x0, relocated against the section
+    const char prologue[] = {0x00, 0x09, DW_LNE_set_address, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+    int offset = add_to_state_data(prologue, sizeof(prologue));
+
+    Sequence *sequence = malloc(sizeof(Sequence));
+    sequence->section = section;
+    sequence->address_offset = offset + 3;
+    append_to_list(sequences, sequence);
+
+    state.section = section;
+    state.address = 0;
+    state.file = 1;
+    state.line_number = 1;
+}
 
-    // Add final loc for the end of the file
-    add_dwarf_loc(state.file, state.line_number, section_text->size);
+// End the sequence at the end of its section, which must have been emitted by now
+static void end_sequence(void) {
+    // Move to the end of the code, without adding a row
+    add_dwarf_loc_advance_address(state.section->size - state.address);
 
     // Extended opcode 1: End of Sequence
     const char epilogue[] = {0x00, 0x01, DW_LNE_end_sequence};
     add_to_state_data(epilogue, sizeof(epilogue));
+}
+
+static void make_dwarf_debug_line_section_program(Section *debug_line_section) {
+    if (!state.section) return; // No debug line info
 
-    add_to_section(debug_line_section, state.data, state.size);
+    end_sequence();
+
+    int program_offset = add_to_section(debug_line_section, state.data, state.size);
+
+    Section *relocation_section = get_relocation_section(debug_line_section);
+    for (int i = 0; i < sequences->length; i++) {
+        Sequence *sequence = sequences->elements[i];
+        Symbol *section_symbol = get_symbol(sequence->section->name);
+        add_relocation(relocation_section, section_symbol, R_X86_64_64, program_offset + sequence->address_offset, 0);
+    }
 }
 
 void make_dwarf_debug_line_section(void) {
@@ -236,13 +276,14 @@ static void add_dwarf_loc_increment_line(int line_increment) {
     add_to_state_data(sleb128_data, size);
 }
 
-void add_dwarf_loc(int file_index, int line_number, int address) {
-    if (!state.locs_present) {
-        // Extended opcode 2: set Address to 0x0
-        const char prologue[] = {0x00, 0x09, DW_LNE_set_address, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
-        add_to_state_data(prologue, sizeof(prologue));
+// Add a row for a loc at address in section. All locs of a section must come
+// together, in order of address.
+void add_dwarf_loc(Section *section, int file_index, int line_number, int address) {
+    int is_first = section != state.section;
 
-        state.locs_present = 1;
+    if (is_first) {
+        if (state.section) end_sequence();
+        start_sequence(section);
     }
 
     if (file_index != state.file) {
@@ -262,36 +303,35 @@ void add_dwarf_loc(int file_index, int line_number, int address) {
     if (address_advance < 0) simple_error("DWARF line numbers going backwards in address");
 
     int line_increment = line_number - state.line_number;
-    unsigned int opcode = (line_increment - LINE_BASE) + (LINE_RANGE * address_advance) + OPCODE_BASE;
 
-    if (!line_increment && !address_advance) return;
+    // The first loc of a sequence always adds a row, even if it's for line 1 at address 0
+    if (!line_increment && !address_advance && !is_first) return;
 
-    if (line_increment >= MIN_LINE_INCREMENT && line_increment <= MAX_LINE_INCREMENT) {
-        if (opcode <= 255) {
-            add_to_state_data(&opcode, 1);
-        }
-        else if (address_advance <= 2 * OP255_ADDRESS_INCREMENT) {
-            // See if a DW_LNS_const_add_pc can be used, see page 101 of https://dwarfstd.org/doc/Dwarf3.pdf
-            opcode = (line_increment - LINE_BASE) + (LINE_RANGE * (address_advance - OP255_ADDRESS_INCREMENT)) + OPCODE_BASE;
-            if (opcode <= 255) {
-                char dw_lns_const_add_pc = DW_LNS_const_add_pc;
-                add_to_state_data(&dw_lns_const_add_pc, 1);
-                add_to_state_data(&opcode, 1);
-            }
-            else {
-                add_dwarf_loc_increment_line(line_increment);
-                add_dwarf_loc_advance_address(address_advance);
-            }
+    // A line increment that doesn't fit in a special opcode is done on its own
+    if (line_increment < MIN_LINE_INCREMENT || line_increment > MAX_LINE_INCREMENT) {
+        add_dwarf_loc_increment_line(line_increment);
+        state.line_number += line_increment;
+        line_increment = 0;
+    }
 
-        }
-        else {
-            add_dwarf_loc_increment_line(line_increment);
-            add_dwarf_loc_advance_address(address_advance);
-        }
+    // A special opcode advances both and adds a row
+    unsigned int opcode = (line_increment - LINE_BASE) + (LINE_RANGE * address_advance) + OPCODE_BASE;
+    unsigned int const_add_pc_opcode = (line_increment - LINE_BASE) + (LINE_RANGE * (address_advance - OP255_ADDRESS_INCREMENT)) + OPCODE_BASE;
+
+    if (opcode <= 255)
+        add_to_state_data(&opcode, 1);
+    else if (address_advance <= 2 * OP255_ADDRESS_INCREMENT && const_add_pc_opcode <= 255) {
+        // See if a DW_LNS_const_add_pc can be used, see page 101 of https://dwarfstd.org/doc/Dwarf3.pdf
+        char dw_lns_const_add_pc = DW_LNS_const_add_pc;
+        add_to_state_data(&dw_lns_const_add_pc, 1);
+        add_to_state_data(&const_add_pc_opcode, 1);
     }
     else {
         add_dwarf_loc_increment_line(line_increment);
         add_dwarf_loc_advance_address(address_advance);
+
+        char dw_lns_copy = DW_LNS_copy;
+        add_to_state_data(&dw_lns_copy, 1);
     }
 
     state.address += address_advance;
@@ -303,6 +343,7 @@ void init_dwarf(void) {
     dirs_list = new_list(16);
     dirs_map = new_strmap();
     files = new_list(0);
+    sequences = new_list(4);
 
     state.address = 0;
     state.file = 1;
@@ -310,5 +351,5 @@ void init_dwarf(void) {
     state.data = malloc(1024);
     state.allocated = 1024;
     state.size = 0;
-    state.locs_present = 0;
+    state.section = NULL;
 }
@@ -1,12 +1,15 @@
 #ifndef _DWARF_H
 #define _DWARF_H
 
+#include "elf.h"
+
 // Extended opcodes
 #define DW_LNE_end_sequence  1
 #define DW_LNE_set_address   2
 #define DW_LNE_define_file   3
 
 // Standard opcodes
+#define DW_LNS_copy          1
 #define DW_LNS_advance_pc    2
 #define DW_LNS_advance_line  3
 #define DW_LNS_set_file      4
@@ -27,7 +30,7 @@ typedef struct __attribute__ ((__packed__)) line_number_program_header {
 
 void make_dwarf_debug_line_section(void);
 void add_dwarf_file(int number, char *name);
-void add_dwarf_loc(int file_index, int line_number, int address);
+void add_dwarf_loc(Section *section, int file_index, int line_number, int address);
 void init_dwarf(void);
 
 #endif
@@ -85,6 +85,15 @@ static void *allocate_in_section(Section *section, int size) {
     return result;
 }
 
+// Make room for size more bytes in a section, without adding them
+void reserve_section_data(Section *section, int size) {
+    int new_section_size = section->size + size;
+    if (new_section_size > section->allocated) {
+        section->allocated = new_section_size;
+        section->data = realloc(section->data, section->allocated);
+    }
+}
+
 // Copy src to the end of a section and return the offset
 int add_to_section(Section *section, void *src, int size) {
     char *data = allocate_in_section(section, size);
@@ -99,6 +108,35 @@ int add_repeated_value_to_section(Section *section, char value, int size) {
     return data - section->data;
 }
 
+// The recommended multi-byte NOPs from the Intel SDM, indexed by size
+static const char nops[10][9] = {
+    {},
+    {0x90},
+    {0x66, 0x90},
+    {0x0f, 0x1f, 0x00},
+    {0x0f, 0x1f, 0x40, 0x00},
+    {0x0f, 0x1f, 0x44, 0x00, 0x00},
+    {0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00},
+    {0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00},
+    {0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x66, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00},
+};
+
+// Add size bytes of NOPs to the section, using as few instructions as possible, and
+// return the offset
+int add_nops_to_section(Section *section, int size) {
+    char *data = allocate_in_section(section, size);
+
+    for (char *p = data; size; ) {
+        int nop_size = size > 9 ? 9 : size;
+        memcpy(p, nops[nop_size], nop_size);
+        p += nop_size;
+        size -= nop_size;
+    }
+
+    return data - section->data;
+}
+
 // Add size zeros to the section and return the offset
 int add_zeros_to_section(Section *section, int size) {
     return add_repeated_value_to_section(section, 0, size);
@@ -122,7 +122,8 @@ typedef struct section {
     long entsize;                 // Contains the size, in bytes, of each entry, for sections that contain fixed-size entries. Otherwise, this field contains zero.
     long symtab_index;            // Index in the symbol table for this section
     struct section *rela_section; // Optional related relocation section
-    List *chunks;                 // Used by the parser
+    struct chunks *chunks;        // Used by the parser
+    int layout_size;              // Size of the section's chunks, set by layout_section()
 } Section;
 
 typedef struct elf_symbol {
@@ -154,9 +155,11 @@ extern int local_symbol_end;
 Section *add_elf_section(char *name, int type, int flags, int align);
 void init_sections(void);
 Section *get_section(char *name);
+void reserve_section_data(Section *section, int size);
 int add_to_section(Section *section, void *src, int size);
 int add_repeated_value_to_section(Section *section, char value, int size);
 int add_zeros_to_section(Section *section, int size);
+int add_nops_to_section(Section *section, int size);
 int add_elf_symbol(char *name, long value, long size, int binding, int type, int section_index);
 void add_file_symbol(char *filename);
 void add_elf_relocation(Section *section, int type, int symbol_index, long offset, long addend);
@@ -2,6 +2,7 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "arena.h"
 #include "expr.h"
 #include "lexer.h"
 #include "utils.h"
@@ -11,15 +12,9 @@
 
 static Node *parse(int level);
 
-static void free_node(Node *node) {
-    if (!node) return;
-    if (node->value) free(node->value);
-    free(node);
-}
-
 static Node *make_integer_node(long value) {
-    Node *node = calloc(1, sizeof(Node));
-    node->value = calloc(1, sizeof(Value));
+    Node *node = arena_alloc(sizeof(Node));
+    node->value = arena_alloc(sizeof(Value));
     node->value->number = value;
     return node;
 }
@@ -30,13 +25,13 @@ static Node *make_zero_node(void) {
 
 // Make a node with a value with a symbol in it
 static Node *make_symbol_node(void) {
-    Node *node = calloc(1, sizeof(Node));
-    node->value = calloc(1, sizeof(Value));
-    node->value->symbol = get_or_add_symbol(strdup(cur_identifier));
+    Node *node = arena_alloc(sizeof(Node));
+    node->value = arena_alloc(sizeof(Value));
+    node->value->symbol = get_or_add_identifier_symbol(TOKEN_IDENTIFIER(cur_token_index));
     return node;
 }
 
-// Returns a malloc'd node; left is freed.
+// Returns a node, which may be left.
 static Node *parse_binary_expression(Node *left, Operation operation, int token) {
     Node *node;
 
@@ -51,7 +46,7 @@ static Node *parse_binary_expression(Node *left, Operation operation, int token)
             error("Cannot subtract two symbols in different sections");
 
         // Create an operation node
-        node = calloc(1, sizeof(Node));
+        node = arena_alloc(sizeof(Node));
         node->operation = OP_SUBTRACT;
         node->left = left;
         node->right = right;
@@ -76,13 +71,11 @@ static Node *parse_binary_expression(Node *left, Operation operation, int token)
             default:
                 panic("Unknown operation %d", operation);
         }
-
-        free_node(right);
     }
 
     else {
         // Create an operation node
-        node = calloc(1, sizeof(Node));
+        node = arena_alloc(sizeof(Node));
         node->operation = operation;
         node->left = left;
         node->right = right;
@@ -91,11 +84,11 @@ static Node *parse_binary_expression(Node *left, Operation operation, int token)
     return node;
 }
 
-// Returns a malloc'd tree of nodes & values
+// Returns a tree of nodes & values
 static Node *parse(int level) {
     Node *node;
 
-    switch (cur_token) {
+    switch (TOKEN_KIND(cur_token_index)) {
         case TOK_PLUS:
             next();
             node = parse(level);
@@ -112,7 +105,7 @@ static Node *parse(int level) {
             }
             else {
                 // Return an operation node
-                node = calloc(1, sizeof(Node));
+                node = arena_alloc(sizeof(Node));
                 node->operation = OP_SUBTRACT;
                 node->left = make_zero_node();
                 node->right = subnode;
@@ -122,7 +115,7 @@ static Node *parse(int level) {
         }
 
         case TOK_INTEGER: {
-            node = make_integer_node(cur_long);
+            node = make_integer_node(TOKEN_INTEGER(cur_token_index));
             next();
             break;
         }
@@ -140,11 +133,11 @@ static Node *parse(int level) {
             break;
 
         default:
-            error("Unexpected token %d in expression", cur_token);
+            error("Unexpected token %d in expression", TOKEN_KIND(cur_token_index));
     }
 
-    while (cur_token >= level) {
-        switch (cur_token) {
+    while (TOKEN_KIND(cur_token_index) >= level) {
+        switch (TOKEN_KIND(cur_token_index)) {
             case TOK_PLUS:     node = parse_binary_expression(node, OP_ADD,      TOK_MULTIPLY); break;
             case TOK_MINUS:    node = parse_binary_expression(node, OP_SUBTRACT, TOK_MULTIPLY); break;
             case TOK_MULTIPLY: node = parse_binary_expression(node, OP_MULTIPLY, TOK_MULTIPLY); break;
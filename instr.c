@@ -51,12 +51,9 @@ void dump_instructions(Instructions *instr) {
 
 // Checks the amoung of argumenst matches the opcode.
 // Returns the amount of arguments or -1 if there is no match
-static int check_args(Opcode *opcode, Operand *op1, Operand *op2, Operand *op3) {
+static int check_args(OpcodeOperands *operands, Operand *op1, Operand *op2, Operand *op3) {
     // Check the number of arguments match
-    int opcode_arg_count = 0;
-    if (opcode->op1.am || opcode->op1.is_gen_reg) opcode_arg_count++;
-    if (opcode->op2.am || opcode->op2.is_gen_reg) opcode_arg_count++;
-    if (opcode->op3.am || opcode->op3.is_gen_reg) opcode_arg_count++;
+    int opcode_arg_count = operands->arg_count;
 
     int arg_count = 0;
     if (op1) arg_count++;
@@ -69,17 +66,17 @@ static int check_args(Opcode *opcode, Operand *op1, Operand *op2, Operand *op3)
 }
 
 // Determine the size of the instruction from the opcode definition and operands
-static int get_operation_size(Opcode *opcode, OpcodeAlias *opcode_alias, Operand *op1, Operand *op2, Operand *op3) {
+static int get_operation_size(OpcodeOperands *operands, OpcodeAlias *opcode_alias, Operand *op1, Operand *op2, Operand *op3) {
     int size = opcode_alias->op1_size; // Except for conversions, op1_size == op2_size
 
-    if (opcode->conver) {
+    if (operands->conver) {
         if (op1 && OP_HAS_SIZE(op1)) size = OP_TO_SIZE(op1);
         if (op2 && OP_HAS_SIZE(op2)) size = OP_TO_SIZE(op2);
     }
 
     // Determine size from register operands
     if (!size) {
-        if (opcode->branch && op1 && OP_TYPE_IS_MEM(op1))
+        if (operands->branch && op1 && OP_TYPE_IS_MEM(op1))
             size = OP_TO_SIZE(op1);
         else if (op1 && OP_TYPE_IS_REG(op1) && !op1->indirect)
             size = OP_TO_SIZE(op1);
@@ -89,7 +86,7 @@ static int get_operation_size(Opcode *opcode, OpcodeAlias *opcode_alias, Operand
             size = OP_TO_SIZE(op3);
 
         // Check operands are the same size unless they are conversions or one of them is an indirect
-        if (!opcode->conver && op1 && op2 && !op1->indirect && !op2->indirect) {
+        if (!operands->conver && op1 && op2 && !op1->indirect && !op2->indirect) {
             if (op1 && op2 && OP_TYPE_IS_REG(op1) && OP_TYPE_IS_REG(op2) && OP_TO_SIZE(op1) != OP_TO_SIZE(op2))
                 error("Size mismatch within oparands");
             if (op1 && op3 && OP_TYPE_IS_REG(op1) && OP_TYPE_IS_REG(op3) && OP_TO_SIZE(op1) != OP_TO_SIZE(op3))
@@ -103,7 +100,7 @@ static int get_operation_size(Opcode *opcode, OpcodeAlias *opcode_alias, Operand
 }
 
 // Check if an immediate operand matches the opcode operand
-static int imm_op_matches(Opcode *opcode, OpcodeOp *opcode_op, Operand *op, int size) {
+static int imm_op_matches(OpcodeOp *opcode_op, Operand *op, int size) {
     // If the imm value is negative then there is no need to check for operands that
     // would sign extend.
     if (op->imm_or_mem_value < 0) return 1;
@@ -127,7 +124,7 @@ static int imm_op_matches(Opcode *opcode, OpcodeOp *opcode_op, Operand *op, int
 }
 
 // Check if an opcode's operand matches an operand
-static int op_matches(Opcode *opcode, int opcode_alias_size, OpcodeOp *opcode_op, Operand *op, int size) {
+static int op_matches(OpcodeOperands *operands, int opcode_alias_size, OpcodeOp *opcode_op, Operand *op, int size) {
     if (!op) panic("op unexpectedly null");
 
     // If the operation size can be determined by the operand, use that, otherwise fall back too the
@@ -149,7 +146,7 @@ static int op_matches(Opcode *opcode, int opcode_alias_size, OpcodeOp *opcode_op
     if (opcode_op->is_gen_reg && OP_TYPE_IS_REG(op) && opcode_op->gen_reg_nr != op->reg) return 0;
 
     // The instruction dst is an al, ax, eax, rax in it, aka an accumulator
-    if (opcode->acc && (op->reg || op->indirect)) return 0;
+    if (operands->acc && (op->reg || op->indirect)) return 0;
 
     // Match addressing mode
     switch (opcode_op->am) {
@@ -180,10 +177,10 @@ static int op_matches(Opcode *opcode, int opcode_alias_size, OpcodeOp *opcode_op
 
             int org_size = OP_TO_SIZE(op);
 
-            if (org_size & (IMM08)                         && (opcode_op->sizes & SIZE08) && imm_op_matches(opcode, opcode_op, op, size)) return 1;
-            if (org_size & (IMM08 | IMM16)                 && (opcode_op->sizes & SIZE16) && imm_op_matches(opcode, opcode_op, op, size)) return 1;
-            if (org_size & (IMM08 | IMM16 | IMM32)         && (opcode_op->sizes & SIZE32) && imm_op_matches(opcode, opcode_op, op, size)) return 1;
-            if (org_size & (IMM08 | IMM16 | IMM32 | IMM64) && (opcode_op->sizes & SIZE64) && imm_op_matches(opcode, opcode_op, op, size)) return 1;
+            if (org_size & (IMM08)                         && (opcode_op->sizes & SIZE08) && imm_op_matches(opcode_op, op, size)) return 1;
+            if (org_size & (IMM08 | IMM16)                 && (opcode_op->sizes & SIZE16) && imm_op_matches(opcode_op, op, size)) return 1;
+            if (org_size & (IMM08 | IMM16 | IMM32)         && (opcode_op->sizes & SIZE32) && imm_op_matches(opcode_op, op, size)) return 1;
+            if (org_size & (IMM08 | IMM16 | IMM32 | IMM64) && (opcode_op->sizes & SIZE64) && imm_op_matches(opcode_op, op, size)) return 1;
 
             return 0;
 
@@ -381,17 +378,17 @@ static void encode_mod_rm(Operand *op, int am, Encoding *enc, int *pprimary_opco
 
 // Using the opcode and operands, figure out all that is needed to be able to generate
 // bytes for an instruction.
-static Encoding make_encoding(Operand *op1, Operand *op2, Operand *op3, Opcode *opcode, OpcodeAlias *opcode_alias, int opcode_arg_count, int size) {
+static Encoding make_encoding(Operand *op1, Operand *op2, Operand *op3, Opcode *opcode, OpcodeOperands *operands, OpcodeAlias *opcode_alias, int opcode_arg_count, int size) {
     Encoding enc = {0};
 
     // Some oddballs stored in enc.
     enc.size = size;
     enc.has_mod_rm = (opcode->needs_mod_rm || opcode->opcd_ext != -1);
-    enc.branch = opcode->branch;
+    enc.branch = operands->branch;
     enc.prefix = opcode->prefix;
     enc.ohf_prefix = opcode->ohf_prefix;
     int is_xmm = ((op1 && OP_TYPE_IS_XMM(op1)) || (op2 && OP_TYPE_IS_XMM(op2)) || (op3 && OP_TYPE_IS_XMM(op3)));
-    enc.need_size16 = (enc.size == SIZE16 && !is_xmm && !opcode->x87fpu);
+    enc.need_size16 = (enc.size == SIZE16 && !is_xmm && !operands->x87fpu);
 
     int primary_opcode = opcode->primary_opcode;
 
@@ -402,17 +399,17 @@ static Encoding make_encoding(Operand *op1, Operand *op2, Operand *op3, Opcode *
 
     if (opcode->opcd_ext != -1) enc.reg = opcode->opcd_ext;
 
-    if (op1) encode_mod_rm(op1, opcode->op1.am, &enc, &primary_opcode, &memory_op);
-    if (op2) encode_mod_rm(op2, opcode->op2.am, &enc, &primary_opcode, &memory_op);
-    if (op3) encode_mod_rm(op3, opcode->op3.am, &enc, &primary_opcode, &memory_op);
+    if (op1) encode_mod_rm(op1, operands->op1.am, &enc, &primary_opcode, &memory_op);
+    if (op2) encode_mod_rm(op2, operands->op2.am, &enc, &primary_opcode, &memory_op);
+    if (op3) encode_mod_rm(op3, operands->op3.am, &enc, &primary_opcode, &memory_op);
 
-    if (!opcode->op1.word_or_double_word_operand && !opcode->op2.word_or_double_word_operand && !opcode->x87fpu && !opcode->branch)
+    if (!operands->op1.word_or_double_word_operand && !operands->op2.word_or_double_word_operand && !operands->x87fpu && !operands->branch)
         enc.rex_w = enc.size == SIZE64;
 
     // Don't emit a rex prefix for some exceptions that default to be 64 bit in long mode
     // like push, pushq.
     // https://wiki.osdev.org/X86-64_Instruction_Encoding#Usage
-    if (!strcmp(opcode->mnem, "push")) {
+    if (opcode->default_64bit) {
         enc.need_rex = 0;
         enc.rex_w =0;
     }
@@ -429,11 +426,11 @@ static Encoding make_encoding(Operand *op1, Operand *op2, Operand *op3, Opcode *
     enc.sec_opcd = opcode->sec_opcd;
 
     // Store immediate/memory details
-    if (op1 && (OP_TYPE_IS_IMM(op1) || OP_TYPE_IS_MEM(op1))) make_imm_or_memory_size(&enc, &opcode->op1, op1);
-    if (op2 && (OP_TYPE_IS_IMM(op2) || OP_TYPE_IS_MEM(op2))) make_imm_or_memory_size(&enc, &opcode->op2, op2);
-    if (op3 && (OP_TYPE_IS_IMM(op3) || OP_TYPE_IS_MEM(op3))) make_imm_or_memory_size(&enc, &opcode->op3, op3);
+    if (op1 && (OP_TYPE_IS_IMM(op1) || OP_TYPE_IS_MEM(op1))) make_imm_or_memory_size(&enc, &operands->op1, op1);
+    if (op2 && (OP_TYPE_IS_IMM(op2) || OP_TYPE_IS_MEM(op2))) make_imm_or_memory_size(&enc, &operands->op2, op2);
+    if (op3 && (OP_TYPE_IS_IMM(op3) || OP_TYPE_IS_MEM(op3))) make_imm_or_memory_size(&enc, &operands->op3, op3);
 
-    if (opcode->op1.type == AT_1) enc.imm_or_mem_size = 0; // Disable emission of immediate 1
+    if (operands->op1.type == AT_1) enc.imm_or_mem_size = 0; // Disable emission of immediate 1
 
     return enc;
 }
@@ -564,7 +561,338 @@ static void emit_instructions(Instructions *instr, Encoding *enc) {
     instr->branch = enc->branch;
 }
 
-Instructions make_instructions(char *mnemonic, Operand *op1, Operand *op2, Operand *op3) {
+// Try to match an opcode against operands and encode it.
+// Returns the encoded size in bytes or -1 if the opcode doesn't match.
+static int try_opcode(OpcodeAlias *opcode_alias, int opcode_index, Operand *op1, Operand *op2, Operand *op3, Encoding *enc) {
+    OpcodeOperands *operands = &opcode_operands[opcode_index];
+
+    #ifdef DEBUG
+    printf("Checking: %s ", opcode_alias->alias_mnem);
+    print_opcode(opcode_index);
+    #endif
+
+    // Rewritten opcodes
+    Operand *rop1 = op1;
+    Operand *rop2 = op2;
+    Operand *rop3 = op3;
+
+    // Add an immediate one of the opcode defines it
+    if (operands->op1.type == AT_1) {
+        static Operand imm1_op;
+        imm1_op.type = IMM08;
+        imm1_op.imm_or_mem_value = 1;
+
+        rop1 = &imm1_op;
+        rop2 = op1;
+        rop3 = op2;
+    }
+
+    int opcode_arg_count = check_args(operands, rop1, rop2, rop3);
+    if (opcode_arg_count == -1) return -1; // The number of args mismatch
+
+    int size = get_operation_size(operands, opcode_alias, rop1, rop2, rop3);
+
+    int op1_size = size;
+    int op2_size = size;
+    int op3_size = size;
+
+    if (operands->conver) {
+        if (rop1 && !OP_HAS_SIZE(rop1)) op1_size = opcode_alias->op1_size;
+        if (rop2 && !OP_HAS_SIZE(rop2)) op2_size = opcode_alias->op2_size;
+    }
+
+    // Check for match
+    if (rop1 && !op_matches(operands, opcode_alias->op1_size, &operands->op1, rop1, op1_size)) return -1;
+    if (rop2 && !op_matches(operands, opcode_alias->op2_size, &operands->op2, rop2, op2_size)) return -1;
+    if (rop3 && !op_matches(operands, opcode_alias->op3_size, &operands->op3, rop3, op3_size)) return -1;
+
+    // At this point, the opcode can be used to generate code
+    #ifdef DEBUG
+    printf("  Matched\n");
+    #endif
+
+    // Encode instruction
+    *enc = make_encoding(rop1, rop2, rop3, &opcodes[opcode_index], operands, opcode_alias, opcode_arg_count, size);
+
+    return encoding_size(enc);
+}
+
+// A candidate index lists, for an opcode alias group and the kinds of its operands, the
+// opcodes that could possibly match. The kind of an operand is everything op_matches()
+// and get_operation_size() look at, apart from register numbers and immediate values.
+// Candidates are sorted by the smallest size their encoding can have, so that the search
+// can stop once no remaining candidate can beat the best encoding found so far.
+typedef struct candidate {
+    short alias;                // Index in opcode_aliases
+    short opcode;               // Index in opcodes
+    short position;             // Position in the unindexed search, used to break ties
+    short min_size;             // Lower bound of the encoding size
+} Candidate;
+
+typedef struct candidates {
+    uint64_t key;
+    int count;
+    Candidate *elements;
+} Candidates;
+
+static Candidates **candidate_index;
+static int candidate_index_size;
+static int candidate_index_count;
+
+static int operand_kind(Operand *op) {
+    if (!op) return 0;
+
+    return 0x400 | (op->type & ~ALT_8BIT) | (op->indirect ? 0x200 : 0);
+}
+
+static uint64_t candidates_key(int opcode_alias_group_index, Operand *op1, Operand *op2, Operand *op3) {
+    return ((uint64_t) opcode_alias_group_index << 33) | ((uint64_t) operand_kind(op1) << 22) | (operand_kind(op2) << 11) | operand_kind(op3);
+}
+
+// Make an operand of the same kind that matches as many opcodes as possible and encodes
+// in as few bytes as possible.
+static Operand *make_representative_operand(Operand *op, Operand *rep) {
+    if (!op) return NULL;
+
+    memset(rep, 0, sizeof(Operand));
+    rep->type = op->type & ~ALT_8BIT;
+    rep->indirect = op->indirect;
+    rep->imm_or_mem_value = -1; // imm_op_matches() accepts any negative value
+
+    return rep;
+}
+
+static int compare_candidates(const void *a, const void *b) {
+    const Candidate *ca = a;
+    const Candidate *cb = b;
+
+    if (ca->min_size != cb->min_size) return ca->min_size - cb->min_size;
+    return ca->position - cb->position;
+}
+
+static Candidates *make_candidates(int opcode_alias_group_index, Operand *op1, Operand *op2, Operand *op3) {
+    OpcodeAliasGroup *opcode_alias_group = &opcode_alias_groups[opcode_alias_group_index];
+
+    // encode_mod_rm_memory() rewrites memory operands without a register, which changes
+    // how the following opcodes match. Keep all opcodes in order for those.
+    int has_memory = (op1 && OP_TYPE_IS_MEM(op1)) || (op2 && OP_TYPE_IS_MEM(op2)) || (op3 && OP_TYPE_IS_MEM(op3));
+
+    Operand rep1, rep2, rep3;
+    Operand *rop1 = make_representative_operand(op1, &rep1);
+    Operand *rop2 = make_representative_operand(op2, &rep2);
+    Operand *rop3 = make_representative_operand(op3, &rep3);
+
+    int max_count = 0;
+    for (int alias_i = 0; alias_i < opcode_alias_group->aliases_count; alias_i++)
+        max_count += opcode_aliases[opcode_alias_group->aliases_start + alias_i].opcodes_count;
+
+    Candidates *candidates = malloc(sizeof(Candidates));
+    candidates->key = candidates_key(opcode_alias_group_index, op1, op2, op3);
+    candidates->count = 0;
+    candidates->elements = malloc(sizeof(Candidate) * max_count);
+
+    int position = 0;
+    for (int alias_i = 0; alias_i < opcode_alias_group->aliases_count; alias_i++) {
+        int alias_index = opcode_alias_group->aliases_start + alias_i;
+        OpcodeAlias *opcode_alias = &opcode_aliases[alias_index];
+
+        for (int i = 0; i < opcode_alias->opcodes_count; i++, position++) {
+            int opcode_index = OPCODE_ALIAS_OPCODE_INDEX(opcode_alias, i);
+            int min_size = 0;
+
+            if (!has_memory) {
+                // Let register operands match implied general registers
+                OpcodeOperands *operands = &opcode_operands[opcode_index];
+                int shift = operands->op1.type == AT_1;
+                if (rop1) rep1.reg = shift ? operands->op2.gen_reg_nr : operands->op1.gen_reg_nr;
+                if (rop2) rep2.reg = shift ? operands->op3.gen_reg_nr : operands->op2.gen_reg_nr;
+                if (rop3) rep3.reg = operands->op3.gen_reg_nr;
+
+                Encoding enc;
+                min_size = try_opcode(opcode_alias, opcode_index, rop1, rop2, rop3, &enc);
+                if (min_size == -1) continue;
+            }
+
+            Candidate *candidate = &candidates->elements[candidates->count++];
+            candidate->alias = alias_index;
+            candidate->opcode = opcode_index;
+            candidate->position = position;
+            candidate->min_size = min_size;
+        }
+    }
+
+    qsort(candidates->elements, candidates->count, sizeof(Candidate), compare_candidates);
+
+    return candidates;
+}
+
+// Look up candidate opcodes, adding them to the index if not already there
+static Candidates *get_candidates(int opcode_alias_group_index, Operand *op1, Operand *op2, Operand *op3) {
+    uint64_t key = candidates_key(opcode_alias_group_index, op1, op2, op3);
+
+    if (candidate_index_count * 2 >= candidate_index_size) {
+        // Grow the hash table
+        int old_size = candidate_index_size;
+        Candidates **old_index = candidate_index;
+
+        candidate_index_size = old_size ? old_size * 2 : 1024;
+        candidate_index = calloc(candidate_index_size, sizeof(Candidates *));
+
+        for (int i = 0; i < old_size; i++) {
+            if (!old_index[i]) continue;
+            int pos = (old_index[i]->key * 0x9e3779b97f4a7c15UL >> 32) & (candidate_index_size - 1);
+            while (candidate_index[pos]) pos = (pos + 1) & (candidate_index_size - 1);
+            candidate_index[pos] = old_index[i];
+        }
+
+        free(old_index);
+    }
+
+    int pos = (key * 0x9e3779b97f4a7c15UL >> 32) & (candidate_index_size - 1);
+    while (candidate_index[pos]) {
+        if (candidate_index[pos]->key == key) return candidate_index[pos];
+        pos = (pos + 1) & (candidate_index_size - 1);
+    }
+
+    candidate_index[pos] = make_candidates(opcode_alias_group_index, op1, op2, op3);
+    candidate_index_count++;
+
+    return candidate_index[pos];
+}
+
+// The encoding cache maps the shape of an instruction to the encoding that was chosen for
+// it. The shape is everything that determines the encoding, apart from immediate and
+// displacement values, which are patched into a copy of the cached encoding.
+typedef struct shape_operand {
+    short type;                 // Operand type, zero if there is no operand
+    uint8_t reg;
+    uint8_t base;
+    uint8_t index;
+    uint8_t scale;
+    uint8_t indirect;
+    uint8_t has_sib;
+    uint8_t displacement_size;  // Displacement size after encode_displacement()
+    uint8_t imm_class;          // What imm_op_matches() looks at
+} ShapeOperand;
+
+typedef struct instruction_shape {
+    int opcode_alias_group_index;
+    ShapeOperand ops[3];
+} InstructionShape;
+
+typedef struct cached_encoding {
+    InstructionShape shape;
+    int opcode;                 // Index in opcodes of the chosen opcode
+    int uncacheable;            // Set if the operands were modified while encoding
+    Encoding encoding;
+} CachedEncoding;
+
+static CachedEncoding **encoding_cache;
+static int encoding_cache_size;
+static int encoding_cache_count;
+
+int encoding_cache_hits;
+int encoding_cache_misses;
+int specialised_encodings;      // Number of instructions encoded by an opcode encoder
+int branch_forms_hits;          // Number of branches that used precomputed short and long forms
+int check_opcode_encoders;      // Set to compare opcode encoders with the generic encoding
+
+static void make_shape_operand(ShapeOperand *shape_op, Operand *op) {
+    if (!op) return;
+
+    shape_op->type = op->type;
+    shape_op->reg = op->reg;
+    shape_op->base = op->base;
+    shape_op->index = op->index;
+    shape_op->scale = op->scale;
+    shape_op->indirect = op->indirect;
+    shape_op->has_sib = op->has_sib;
+
+    shape_op->displacement_size = op->displacement_size == SIZE08 && op->displacement >= 0x80
+        ? SIZE32
+        : op->displacement_size;
+
+    long value = op->imm_or_mem_value;
+    shape_op->imm_class = value < 0 ? 0 : value < 0x80 ? 1 : value < 0x80000000L ? 2 : 3;
+}
+
+static uint32_t hash_shape(InstructionShape *shape) {
+    uint32_t result = 2166136261u;
+    char *data = (char *) shape;
+    for (int i = 0; i < sizeof(InstructionShape); i++) result = (result ^ (unsigned char) data[i]) * 16777619u;
+    return result;
+}
+
+// Look up an instruction shape. Returns the address of the slot where it is, or should go.
+static CachedEncoding **lookup_encoding_cache(InstructionShape *shape) {
+    if (encoding_cache_count * 2 >= encoding_cache_size) {
+        // Grow the hash table
+        int old_size = encoding_cache_size;
+        CachedEncoding **old_cache = encoding_cache;
+
+        encoding_cache_size = old_size ? old_size * 2 : 1024;
+        encoding_cache = calloc(encoding_cache_size, sizeof(CachedEncoding *));
+
+        for (int i = 0; i < old_size; i++) {
+            if (!old_cache[i]) continue;
+            int pos = hash_shape(&old_cache[i]->shape) & (encoding_cache_size - 1);
+            while (encoding_cache[pos]) pos = (pos + 1) & (encoding_cache_size - 1);
+            encoding_cache[pos] = old_cache[i];
+        }
+
+        free(old_cache);
+    }
+
+    int pos = hash_shape(shape) & (encoding_cache_size - 1);
+    while (encoding_cache[pos]) {
+        if (!memcmp(&encoding_cache[pos]->shape, shape, sizeof(InstructionShape))) break;
+        pos = (pos + 1) & (encoding_cache_size - 1);
+    }
+
+    return &encoding_cache[pos];
+}
+
+// Put the immediate and displacement values of the operands in a cached encoding
+static void patch_encoding(Encoding *enc, Operand *op1, Operand *op2, Operand *op3) {
+    Operand *ops[3] = { op1, op2, op3 };
+
+    for (int i = 0; i < 3; i++) {
+        Operand *op = ops[i];
+        if (!op) continue;
+
+        if (OP_TYPE_IS_IMM(op) || OP_TYPE_IS_MEM(op)) enc->imm_or_mem = op->imm_or_mem_value;
+        if (op->indirect && enc->has_displacement) enc->displacement = op->displacement;
+    }
+}
+
+// Encode an instruction with the specialised encoder for the opcode, if there is one, or
+// with the generic code.
+static void encode_instructions(Instructions *instr, int opcode_index, Encoding *enc, Operand *op1, Operand *op2, Operand *op3) {
+    OpcodeEncoder encoder = opcode_encoders[opcode_index];
+
+    if (!encoder || !encoder(instr, op1, op2, op3, enc->size)) {
+        emit_instructions(instr, enc);
+        return;
+    }
+
+    specialised_encodings++;
+
+    if (check_opcode_encoders) {
+        Instructions generic_instr;
+        emit_instructions(&generic_instr, enc);
+
+        if (memcmp(instr, &generic_instr, sizeof(Instructions))) {
+            dump_instructions(instr);
+            dump_instructions(&generic_instr);
+            panic("Mismatch between opcode encoder and generic encoding for %s", opcode_mnemonics[opcodes[opcode_index].mnem]);
+        }
+    }
+}
+
+Instructions make_instructions(int opcode_alias_group_index, Operand *op1, Operand *op2, Operand *op3) {
+    OpcodeAliasGroup *opcode_alias_group = &opcode_alias_groups[opcode_alias_group_index];
+    char *mnemonic = opcode_alias_group->name;
+
     #ifdef DEBUG
     printf("Assembling %s %#x %#x %#x\n", mnemonic, op1 ? op1->type : 0, op2 ? op2->type: 0, op3 ? op3->type: 0);
     #endif
@@ -578,84 +906,142 @@ Instructions make_instructions(char *mnemonic, Operand *op1, Operand *op2, Opera
     if (!strncmp("imul", mnemonic, 4) && OP_TYPE_IS_IMM(op1) && OP_TYPE_IS_REG(op2) && !op2->indirect && !op3)
         op3 = op2;
 
-    List *opcode_alias_list = strmap_get(opcode_alias_map, mnemonic);
+    InstructionShape shape;
+    memset(&shape, 0, sizeof(InstructionShape));
+    shape.opcode_alias_group_index = opcode_alias_group_index;
+    make_shape_operand(&shape.ops[0], op1);
+    make_shape_operand(&shape.ops[1], op2);
+    make_shape_operand(&shape.ops[2], op3);
 
-    if (!opcode_alias_list) error("Unknown instruction %s", mnemonic);
+    CachedEncoding **pcached_encoding = lookup_encoding_cache(&shape);
+    CachedEncoding *cached_encoding = *pcached_encoding;
 
-    // Loop over all possible encodings, picking the one that generates
-    // the smallest number of bytes.
-    Encoding best_enc;
-    int best_enc_size = -1;
+    if (cached_encoding && !cached_encoding->uncacheable) {
+        #ifdef DEBUG
+        printf("Cached: ");
+        print_opcode(cached_encoding->opcode);
+        #endif
 
-    for (int alias_i = 0; alias_i < opcode_alias_list->length; alias_i++) {
-        OpcodeAlias *opcode_alias = opcode_alias_list->elements[alias_i];
+        encoding_cache_hits++;
 
-        for (int i = 0; i < opcode_alias->opcodes->length; i++) {
-            Opcode *opcode = opcode_alias->opcodes->elements[i];
+        Encoding enc = cached_encoding->encoding;
+        patch_encoding(&enc, op1, op2, op3);
 
-            #ifdef DEBUG
-            printf("Checking: %s ", opcode_alias->alias_mnem);
-            print_opcode(opcode);
-            #endif
+        Instructions instr;
+        encode_instructions(&instr, cached_encoding->opcode, &enc, op1, op2, op3);
 
-            // Rewritten opcodes
-            Operand *rop1 = op1;
-            Operand *rop2 = op2;
-            Operand *rop3 = op3;
-
-            // Add an immediate one of the opcode defines it
-            if (opcode->op1.type == AT_1) {
-                static Operand imm1_op;
-                imm1_op.type = IMM08;
-                imm1_op.imm_or_mem_value = 1;
-
-                rop1 = &imm1_op;
-                rop2 = op1;
-                rop3 = op2;
-            }
-
-            int opcode_arg_count = check_args(opcode, rop1, rop2, rop3);
-            if (opcode_arg_count == -1) continue; // The number of args mismatch
+        return instr;
+    }
 
-            int size = get_operation_size(opcode, opcode_alias, rop1, rop2, rop3);
+    encoding_cache_misses++;
 
-            int op1_size = size;
-            int op2_size = size;
-            int op3_size = size;
+    // Encoding memory operands without a register modifies them, see encode_mod_rm_memory()
+    int op1_type = op1 ? op1->type : 0;
+    int op2_type = op2 ? op2->type : 0;
+    int op3_type = op3 ? op3->type : 0;
 
-            if (opcode->conver) {
-                if (rop1 && !OP_HAS_SIZE(rop1)) op1_size = opcode_alias->op1_size;
-                if (rop2 && !OP_HAS_SIZE(rop2)) op2_size = opcode_alias->op2_size;
-            }
+    // Loop over the candidate encodings, picking the one that generates the smallest number
+    // of bytes. If there is a tie, the opcode that comes first in the opcode aliases wins.
+    Encoding best_enc;
+    int best_enc_size = -1;
+    int best_enc_position = -1;
+    int best_enc_opcode = -1;
 
-            // Check for match
-            if (rop1 && !op_matches(opcode, opcode_alias->op1_size, &opcode->op1, rop1, op1_size)) continue;
-            if (rop2 && !op_matches(opcode, opcode_alias->op2_size, &opcode->op2, rop2, op2_size)) continue;
-            if (rop3 && !op_matches(opcode, opcode_alias->op3_size, &opcode->op3, rop3, op3_size)) continue;
+    Candidates *candidates = get_candidates(opcode_alias_group_index, op1, op2, op3);
 
-            // At this point, the opcode can be used to generate code
-            #ifdef DEBUG
-            printf("  Matched\n");
-            #endif
+    for (int i = 0; i < candidates->count; i++) {
+        Candidate *candidate = &candidates->elements[i];
 
-            // Encode instruction
-            Encoding enc = make_encoding(rop1, rop2, rop3, opcode, opcode_alias, opcode_arg_count, size);
+        // The remaining candidates can't be smaller than the best encoding found so far
+        if (best_enc_size != -1 && candidate->min_size > best_enc_size) break;
 
-            int enc_size = encoding_size(&enc);
+        Encoding enc;
+        int enc_size = try_opcode(&opcode_aliases[candidate->alias], candidate->opcode, op1, op2, op3, &enc);
+        if (enc_size == -1) continue;
 
-            // Store the encoding with the least number of bytes in best_enc.
-            if (enc_size < best_enc_size || best_enc_size == -1) {
-                best_enc = enc;
-                best_enc_size = enc_size;
-            }
+        // Store the encoding with the least number of bytes in best_enc.
+        if (best_enc_size == -1 || enc_size < best_enc_size || (enc_size == best_enc_size && candidate->position < best_enc_position)) {
+            best_enc = enc;
+            best_enc_size = enc_size;
+            best_enc_position = candidate->position;
+            best_enc_opcode = candidate->opcode;
         }
     }
 
     if (best_enc_size == -1) error("Unable to find encoding for instruction %s", mnemonic);
 
+    if (!cached_encoding) {
+        cached_encoding = malloc(sizeof(CachedEncoding));
+        cached_encoding->shape = shape;
+        cached_encoding->opcode = best_enc_opcode;
+        cached_encoding->encoding = best_enc;
+        cached_encoding->uncacheable =
+            (op1 && op1->type != op1_type) ||
+            (op2 && op2->type != op2_type) ||
+            (op3 && op3->type != op3_type);
+
+        *pcached_encoding = cached_encoding;
+        encoding_cache_count++;
+    }
+
     // Generate the instructions
     Instructions instr;
-    emit_instructions(&instr, &best_enc);
+    encode_instructions(&instr, best_enc_opcode, &best_enc, op1, op2, op3);
 
     return instr;
 }
+
+// The long (rel32) and short (rel8) forms of a relative branch to a symbol, by opcode
+// alias group. The forms don't depend on the target, since the value is filled in by
+// the relocation, so they only need to be encoded once per mnemonic.
+typedef struct branch_forms {
+    int done;                   // Set when the forms have been encoded
+    int is_branch;              // Set if the instruction is a branch with a short form
+    Instructions long_form;
+    Instructions short_form;
+} BranchForms;
+
+static BranchForms *branch_forms;
+
+// Encode an instruction and, if it is a relative branch, also its short form.
+// Returns 1 if the instruction has a short form, which is put in short_form.
+int make_branch_instructions(int opcode_alias_group_index, Operand *op1, Operand *op2, Operand *op3, Instructions *long_form, Instructions *short_form) {
+    int is_symbol_target = op1 && !op2 && !op3 && op1->type == MEM32 && !op1->indirect && op1->relocation_symbol && !op1->imm_or_mem_value;
+
+    if (is_symbol_target) {
+        if (!branch_forms) branch_forms = calloc(opcode_alias_groups_count, sizeof(BranchForms));
+        BranchForms *forms = &branch_forms[opcode_alias_group_index];
+
+        if (!forms->done) {
+            Operand op = *op1;
+            forms->long_form = make_instructions(opcode_alias_group_index, &op, NULL, NULL);
+            // Encoding can strip MEM from the operand, in which case there is no short form
+            forms->is_branch = forms->long_form.branch && op.type == MEM32;
+
+            if (forms->is_branch) {
+                op = *op1;
+                op.type = MEM08;
+                forms->short_form = make_instructions(opcode_alias_group_index, &op, NULL, NULL);
+            }
+
+            forms->done = 1;
+        }
+
+        if (forms->is_branch) {
+            branch_forms_hits++;
+            *long_form = forms->long_form;
+            *short_form = forms->short_form;
+            return 1;
+        }
+    }
+
+    *long_form = make_instructions(opcode_alias_group_index, op1, op2, op3);
+
+    if (long_form->branch && op1 && op1->type == MEM32) {
+        op1->type = MEM08;
+        *short_form = make_instructions(opcode_alias_group_index, op1, op2, op3);
+        return 1;
+    }
+
+    return 0;
+}
@@ -77,8 +77,21 @@ typedef struct instructions {
     int branch;                 // Is it a branch instruction?
 } Instructions;
 
+// A specialised encoder for an opcode, generated in opcodes-generated.c. It gets the
+// operation size and returns 0 if it can't encode the operands.
+typedef int (*OpcodeEncoder)(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size);
+
+extern OpcodeEncoder opcode_encoders[];
+
+extern int encoding_cache_hits;
+extern int encoding_cache_misses;
+extern int specialised_encodings;
+extern int branch_forms_hits;
+extern int check_opcode_encoders;
+
 void dump_instructions(Instructions *instr);
 
-Instructions make_instructions(char *mnemonic, Operand *op1, Operand *op2, Operand *op3);
+Instructions make_instructions(int opcode_alias_group_index, Operand *op1, Operand *op2, Operand *op3);
+int make_branch_instructions(int opcode_alias_group_index, Operand *op1, Operand *op2, Operand *op3, Instructions *long_form, Instructions *short_form);
 
 #endif
@@ -0,0 +1,125 @@
+#include "keywords.h"
+#include "lexer.h"
+
+// Generated by scripts/keywords.py
+
+uint64_t directive_hash_multiplier = 0xac05b0700429b32d;
+int directive_hash_bits = 5;
+
+Keyword directive_keywords[32] = {
+    [  0] = { { 0x00006e67696c612e, 0x0000000000000000 },  6, TOK_DIRECTIVE_ALIGN,  0, ".align" },
+    [  1] = { { 0x6e6f69746365732e, 0x0000000000000000 },  8, TOK_DIRECTIVE_SECTION, 0, ".section" },
+    [  2] = { { 0x0000006d6d6f632e, 0x0000000000000000 },  5, TOK_DIRECTIVE_COMM,   0, ".comm" },
+    [  3] = { { 0x000000646175712e, 0x0000000000000000 },  5, TOK_DIRECTIVE_QUAD,   0, ".quad" },
+    [  4] = { { 0x38323162656c732e, 0x0000000000000000 },  8, TOK_DIRECTIVE_SLEB128, 0, ".sleb128" },
+    [  5] = { { 0x38323162656c752e, 0x0000000000000000 },  8, TOK_DIRECTIVE_ULEB128, 0, ".uleb128" },
+    [  6] = { { 0x6e67696c6132702e, 0x0000000000000000 },  8, TOK_DIRECTIVE_P2ALIGN, 0, ".p2align" },
+    [  8] = { { 0x00006c61636f6c2e, 0x0000000000000000 },  6, TOK_DIRECTIVE_LOCAL,  0, ".local" },
+    [  9] = { { 0x000000617461642e, 0x0000000000000000 },  5, TOK_DIRECTIVE_DATA,   0, ".data" },
+    [ 10] = { { 0x006e67696c61622e, 0x0000000000000000 },  7, TOK_DIRECTIVE_BALIGN, 0, ".balign" },
+    [ 11] = { { 0x00006c626f6c672e, 0x0000000000000000 },  6, TOK_DIRECTIVE_GLOBL,  0, ".globl" },
+    [ 13] = { { 0x000000656c69662e, 0x0000000000000000 },  5, TOK_DIRECTIVE_FILE,   0, ".file" },
+    [ 14] = { { 0x00000000636f6c2e, 0x0000000000000000 },  4, TOK_DIRECTIVE_LOC,    0, ".loc" },
+    [ 15] = { { 0x000000747865742e, 0x0000000000000000 },  5, TOK_DIRECTIVE_TEXT,   0, ".text" },
+    [ 16] = { { 0x000000657079742e, 0x0000000000000000 },  5, TOK_DIRECTIVE_TYPE,   0, ".type" },
+    [ 17] = { { 0x00000064726f772e, 0x0000000000000000 },  5, TOK_DIRECTIVE_WORD,   0, ".word" },
+    [ 18] = { { 0x000000000000002e, 0x0000000000000000 },  1, TOK_DOT_SYMBOL,       0, "." },
+    [ 19] = { { 0x000000676e6f6c2e, 0x0000000000000000 },  5, TOK_DIRECTIVE_LONG,   0, ".long" },
+    [ 20] = { { 0x00676e697274732e, 0x0000000000000000 },  7, TOK_DIRECTIVE_STRING, 0, ".string" },
+    [ 26] = { { 0x000000657a69732e, 0x0000000000000000 },  5, TOK_DIRECTIVE_SIZE,   0, ".size" },
+    [ 27] = { { 0x000000657479622e, 0x0000000000000000 },  5, TOK_DIRECTIVE_BYTE,   0, ".byte" },
+    [ 28] = { { 0x0000006f72657a2e, 0x0000000000000000 },  5, TOK_DIRECTIVE_ZERO,   0, ".zero" },
+    [ 30] = { { 0x000065756c61762e, 0x0000000000000000 },  6, TOK_DIRECTIVE_VALUE,  0, ".value" },
+};
+
+uint64_t register_hash_multiplier = 0x3463ace0139d928d;
+int register_hash_bits = 9;
+
+Keyword register_keywords[512] = {
+    [  3] = { { 0x0000000000006973, 0x0000000000000000 },  2, REG_WORD + 6,         0, "si" },
+    [ 32] = { { 0x00000000336d6d78, 0x0000000000000000 },  4, REG_XMM + 3,          0, "xmm3" },
+    [ 33] = { { 0x0000000000786265, 0x0000000000000000 },  3, REG_LONG + 3,         0, "ebx" },
+    [ 48] = { { 0x0000000062313172, 0x0000000000000000 },  4, REG_BYTE + 11,        0, "r11b" },
+    [ 49] = { { 0x0000000000786472, 0x0000000000000000 },  3, REG_QUAD + 2,         0, "rdx" },
+    [ 55] = { { 0x0000000000623872, 0x0000000000000000 },  3, REG_BYTE + 8,         0, "r8b" },
+    [ 58] = { { 0x0000000000003972, 0x0000000000000000 },  2, REG_QUAD + 9,         0, "r9" },
+    [ 62] = { { 0x0000000062343172, 0x0000000000000000 },  4, REG_BYTE + 14,        0, "r14b" },
+    [ 71] = { { 0x0000000000006862, 0x0000000000000000 },  2, REG_BYTE + 7,         0, "bh" },
+    [ 77] = { { 0x0000000077323172, 0x0000000000000000 },  4, REG_WORD + 12,        0, "r12w" },
+    [ 87] = { { 0x0000000064303172, 0x0000000000000000 },  4, REG_LONG + 10,        0, "r10d" },
+    [ 91] = { { 0x0000000077353172, 0x0000000000000000 },  4, REG_WORD + 15,        0, "r15w" },
+    [ 96] = { { 0x00000000326d6d78, 0x0000000000000000 },  4, REG_XMM + 2,          0, "xmm2" },
+    [ 99] = { { 0x00000030316d6d78, 0x0000000000000000 },  5, REG_XMM + 10,         0, "xmm10" },
+    [100] = { { 0x0000000064333172, 0x0000000000000000 },  4, REG_LONG + 13,        0, "r13d" },
+    [130] = { { 0x0000000000007062, 0x0000000000000000 },  2, REG_WORD + 5,         0, "bp" },
+    [139] = { { 0x00000031316d6d78, 0x0000000000000000 },  5, REG_XMM + 11,         0, "xmm11" },
+    [144] = { { 0x0000000000707365, 0x0000000000000000 },  3, REG_LONG + 4,         0, "esp" },
+    [147] = { { 0x0000000000773872, 0x0000000000000000 },  3, REG_WORD + 8,         0, "r8w" },
+    [148] = { { 0x0000000000007473, 0x0000000000000000 },  2, REG_ST,               0, "st" },
+    [149] = { { 0x0000000000313172, 0x0000000000000000 },  3, REG_QUAD + 11,        0, "r11" },
+    [158] = { { 0x0000000000006c61, 0x0000000000000000 },  2, REG_BYTE,             0, "al" },
+    [160] = { { 0x00000000316d6d78, 0x0000000000000000 },  4, REG_XMM + 1,          0, "xmm1" },
+    [161] = { { 0x00000000396d6d78, 0x0000000000000000 },  4, REG_XMM + 9,          0, "xmm9" },
+    [162] = { { 0x0000000000786272, 0x0000000000000000 },  3, REG_QUAD + 3,         0, "rbx" },
+    [163] = { { 0x0000000000343172, 0x0000000000000000 },  3, REG_QUAD + 14,        0, "r14" },
+    [175] = { { 0x0000000000006863, 0x0000000000000000 },  2, REG_BYTE + 5,         0, "ch" },
+    [178] = { { 0x00000032316d6d78, 0x0000000000000000 },  5, REG_XMM + 12,         0, "xmm12" },
+    [187] = { { 0x0000000000006864, 0x0000000000000000 },  2, REG_BYTE + 6,         0, "dh" },
+    [188] = { { 0x0000000000007862, 0x0000000000000000 },  2, REG_WORD + 3,         0, "bx" },
+    [199] = { { 0x00000000006c7062, 0x0000000000000000 },  3, REG_BYTE + 5,         1, "bpl" },
+    [215] = { { 0x0000000062303172, 0x0000000000000000 },  4, REG_BYTE + 10,        0, "r10b" },
+    [217] = { { 0x00000033316d6d78, 0x0000000000000000 },  5, REG_XMM + 13,         0, "xmm13" },
+    [223] = { { 0x00000000306d6d78, 0x0000000000000000 },  4, REG_XMM,              0, "xmm0" },
+    [225] = { { 0x00000000386d6d78, 0x0000000000000000 },  4, REG_XMM + 8,          0, "xmm8" },
+    [228] = { { 0x0000000062333172, 0x0000000000000000 },  4, REG_BYTE + 13,        0, "r13b" },
+    [233] = { { 0x0000000000786365, 0x0000000000000000 },  3, REG_LONG + 1,         0, "ecx" },
+    [234] = { { 0x0000000000643872, 0x0000000000000000 },  3, REG_LONG + 8,         0, "r8d" },
+    [235] = { { 0x00000000006c7073, 0x0000000000000000 },  3, REG_BYTE + 4,         1, "spl" },
+    [244] = { { 0x0000000077313172, 0x0000000000000000 },  4, REG_WORD + 11,        0, "r11w" },
+    [254] = { { 0x0000000000623972, 0x0000000000000000 },  3, REG_BYTE + 9,         0, "r9b" },
+    [256] = { { 0x00000034316d6d78, 0x0000000000000000 },  5, REG_XMM + 14,         0, "xmm14" },
+    [257] = { { 0x0000000077343172, 0x0000000000000000 },  4, REG_WORD + 14,        0, "r14w" },
+    [266] = { { 0x0000000064323172, 0x0000000000000000 },  4, REG_LONG + 12,        0, "r12d" },
+    [273] = { { 0x0000000000707372, 0x0000000000000000 },  3, REG_QUAD + 4,         0, "rsp" },
+    [280] = { { 0x0000000064353172, 0x0000000000000000 },  4, REG_LONG + 15,        0, "r15d" },
+    [284] = { { 0x0000000000697365, 0x0000000000000000 },  3, REG_LONG + 6,         0, "esi" },
+    [289] = { { 0x00000000376d6d78, 0x0000000000000000 },  4, REG_XMM + 7,          0, "xmm7" },
+    [293] = { { 0x0000000000007863, 0x0000000000000000 },  2, REG_WORD + 1,         0, "cx" },
+    [296] = { { 0x00000035316d6d78, 0x0000000000000000 },  5, REG_XMM + 15,         0, "xmm15" },
+    [305] = { { 0x0000000000007864, 0x0000000000000000 },  2, REG_WORD + 2,         0, "dx" },
+    [316] = { { 0x0000000000303172, 0x0000000000000000 },  3, REG_QUAD + 10,        0, "r10" },
+    [327] = { { 0x0000000000706972, 0x0000000000000000 },  3, REG_RIP,              0, "rip" },
+    [329] = { { 0x0000000000333172, 0x0000000000000000 },  3, REG_QUAD + 13,        0, "r13" },
+    [339] = { { 0x0000000000706265, 0x0000000000000000 },  3, REG_LONG + 5,         0, "ebp" },
+    [346] = { { 0x0000000000786165, 0x0000000000000000 },  3, REG_LONG,             0, "eax" },
+    [347] = { { 0x0000000000773972, 0x0000000000000000 },  3, REG_WORD + 9,         0, "r9w" },
+    [352] = { { 0x00000000366d6d78, 0x0000000000000000 },  4, REG_XMM + 6,          0, "xmm6" },
+    [356] = { { 0x0000000000006c62, 0x0000000000000000 },  2, REG_BYTE + 3,         0, "bl" },
+    [361] = { { 0x0000000000786372, 0x0000000000000000 },  3, REG_QUAD + 1,         0, "rcx" },
+    [366] = { { 0x0000000000696465, 0x0000000000000000 },  3, REG_LONG + 7,         0, "edi" },
+    [370] = { { 0x0000000000003872, 0x0000000000000000 },  2, REG_QUAD + 8,         0, "r8" },
+    [375] = { { 0x0000000000007073, 0x0000000000000000 },  2, REG_WORD + 4,         0, "sp" },
+    [376] = { { 0x00000000006c6973, 0x0000000000000000 },  3, REG_BYTE + 6,         1, "sil" },
+    [385] = { { 0x0000000000006861, 0x0000000000000000 },  2, REG_BYTE + 4,         0, "ah" },
+    [387] = { { 0x0000000000006964, 0x0000000000000000 },  2, REG_WORD + 7,         0, "di" },
+    [394] = { { 0x0000000062323172, 0x0000000000000000 },  4, REG_BYTE + 12,        0, "r12b" },
+    [407] = { { 0x0000000062353172, 0x0000000000000000 },  4, REG_BYTE + 15,        0, "r15b" },
+    [410] = { { 0x0000000077303172, 0x0000000000000000 },  4, REG_WORD + 10,        0, "r10w" },
+    [413] = { { 0x0000000000697372, 0x0000000000000000 },  3, REG_QUAD + 6,         0, "rsi" },
+    [416] = { { 0x00000000356d6d78, 0x0000000000000000 },  4, REG_XMM + 5,          0, "xmm5" },
+    [423] = { { 0x0000000077333172, 0x0000000000000000 },  4, REG_WORD + 13,        0, "r13w" },
+    [432] = { { 0x0000000000786465, 0x0000000000000000 },  3, REG_LONG + 2,         0, "edx" },
+    [433] = { { 0x0000000064313172, 0x0000000000000000 },  4, REG_LONG + 11,        0, "r11d" },
+    [434] = { { 0x0000000000643972, 0x0000000000000000 },  3, REG_LONG + 9,         0, "r9d" },
+    [446] = { { 0x0000000064343172, 0x0000000000000000 },  4, REG_LONG + 14,        0, "r14d" },
+    [457] = { { 0x00000000006c6964, 0x0000000000000000 },  3, REG_BYTE + 7,         1, "dil" },
+    [461] = { { 0x0000000000006c63, 0x0000000000000000 },  2, REG_BYTE + 1,         0, "cl" },
+    [468] = { { 0x0000000000706272, 0x0000000000000000 },  3, REG_QUAD + 5,         0, "rbp" },
+    [473] = { { 0x0000000000006c64, 0x0000000000000000 },  2, REG_BYTE + 2,         0, "dl" },
+    [475] = { { 0x0000000000786172, 0x0000000000000000 },  3, REG_QUAD,             0, "rax" },
+    [480] = { { 0x00000000346d6d78, 0x0000000000000000 },  4, REG_XMM + 4,          0, "xmm4" },
+    [494] = { { 0x0000000000696472, 0x0000000000000000 },  3, REG_QUAD + 7,         0, "rdi" },
+    [495] = { { 0x0000000000323172, 0x0000000000000000 },  3, REG_QUAD + 12,        0, "r12" },
+    [503] = { { 0x0000000000007861, 0x0000000000000000 },  2, REG_WORD,             0, "ax" },
+    [508] = { { 0x0000000000353172, 0x0000000000000000 },  3, REG_QUAD + 15,        0, "r15" },
+};
@@ -0,0 +1,34 @@
+#ifndef _KEYWORDS_H
+#define _KEYWORDS_H
+
+#include <stdint.h>
+
+// Perfect hash tables of directives and registers, generated by scripts/keywords.py.
+// The key of a name is its first KEYWORD_PREFIX_SIZE characters packed into two
+// uint64_t words, the first character in the lowest byte, and its size. Names of any
+// size can be keywords; for longer ones the rest is compared with the name. Two
+// keywords can't have the same size and share their first KEYWORD_PREFIX_SIZE
+// characters. Empty slots have a zero size.
+#define KEYWORD_PREFIX_SIZE 16
+
+typedef struct keyword {
+    uint64_t key[2];
+    char size;
+    short value;                // TOK_DIRECTIVE_* or REG_*
+    char alt_8bit;              // Set for the spl, bpl, sil and dil registers
+    char *name;
+} Keyword;
+
+extern uint64_t directive_hash_multiplier;
+extern int directive_hash_bits;
+extern Keyword directive_keywords[];
+
+extern uint64_t register_hash_multiplier;
+extern int register_hash_bits;
+extern Keyword register_keywords[];
+
+// The slot of a key in a table
+#define KEYWORD_SLOT(key0, key1, size, multiplier, bits) \
+    ((((key0) ^ ((key1) * (multiplier)) ^ (uint64_t) (size)) * (multiplier)) >> (64 - (bits)))
+
+#endif
@@ -1,107 +1,278 @@
+#include <fcntl.h>
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
+#include "arena.h"
+#include "keywords.h"
 #include "lexer.h"
+#include "opcodes.h"
+#include "scan.h"
+#include "strmap.h"
 #include "utils.h"
 #include "was.h"
 
+// The input file is mapped read-only and tokens point into it, so that identifiers and
+// strings are only copied if they are kept, e.g. when an identifier is interned.
+
 static char *input;             // Input file data
 static char *input_end;         // Input file data
+static long input_mapping_size; // Size of the mapping of the input file, zero if it isn't mapped
+static char *string_literal_buffer; // Unescaped string literals
 static char *ip;                // Input pointer to currently lexed char.
 static int seen_instruction;    // Currently lexing labels or instructions
 static int seen_directive;      // Currently lexing a directive
+static char *statement_end;     // End of the current statement, set by get_canonical_operands()
+static StrMap *identifiers;     // Interned identifiers, by name
+static int line;                // Line being lexed
+static int lexed_token;         // Last lexed token
 
 char *cur_filename;
-int cur_line;                       // Current line
+int cur_line;
+
+int pretokenize;
+Tokens tokens;
+int cur_token_index;
 
-int cur_token;                      // Current token
-char *cur_identifier;               // Current identifier
-int cur_register;                   // Current register id
-int cur_register_alt_8bit;          // Set to 1 for spl, bpl, sil, dil 8-bit registers
-long cur_long;                      // Current integer
-StringLiteral cur_string_literal;   // Current string literal
+static void lex_token(void);
 
 void free_lexer(void) {
-    free(cur_identifier);
-    free(cur_string_literal.data);
-    free(input);
+    free_strmap(identifiers);
+    free(string_literal_buffer);
+    if (input_mapping_size) munmap(input, input_mapping_size);
+    input_mapping_size = 0;
+
+    free(tokens.kinds);
+    free(tokens.lines);
+    free(tokens.payloads);
+    free(tokens.integers);
+    free(tokens.identifiers);
+    free(tokens.string_literals);
+    free(tokens.instructions);
+    memset(&tokens, 0, sizeof(Tokens));
+}
+
+// Make room for one more element at the end of array
+#define GROW_ARRAY(array, count, allocated) \
+    if (count == allocated) { \
+        allocated = allocated ? allocated * 2 : 1024; \
+        array = realloc(array, allocated * sizeof(*array)); \
+    }
+
+// Append a token to tokens
+static void append_token(int token, int payload) {
+    if (tokens.count == tokens.allocated) {
+        tokens.allocated = tokens.allocated ? tokens.allocated * 2 : 1024;
+        tokens.kinds = realloc(tokens.kinds, tokens.allocated);
+        tokens.lines = realloc(tokens.lines, tokens.allocated * sizeof(int));
+        tokens.payloads = realloc(tokens.payloads, tokens.allocated * sizeof(int));
+    }
+
+    tokens.kinds[tokens.count] = token;
+    tokens.lines[tokens.count] = line;
+    tokens.payloads[tokens.count] = payload;
+    tokens.count++;
+    lexed_token = token;
+}
+
+static int add_integer(long value) {
+    GROW_ARRAY(tokens.integers, tokens.integer_count, tokens.integers_allocated);
+    tokens.integers[tokens.integer_count] = value;
+    return tokens.integer_count++;
+}
+
+static int add_identifier(Identifier *identifier) {
+    GROW_ARRAY(tokens.identifiers, tokens.identifier_count, tokens.identifiers_allocated);
+    tokens.identifiers[tokens.identifier_count] = identifier;
+    return tokens.identifier_count++;
+}
+
+static int add_string_literal(char *data, int size) {
+    GROW_ARRAY(tokens.string_literals, tokens.string_literal_count, tokens.string_literals_allocated);
+    tokens.string_literals[tokens.string_literal_count].data = data;
+    tokens.string_literals[tokens.string_literal_count].size = size;
+    return tokens.string_literal_count++;
+}
+
+static int add_instruction(int opcode_alias_group, char *mnemonic, int mnemonic_size, char *operands) {
+    GROW_ARRAY(tokens.instructions, tokens.instruction_count, tokens.instructions_allocated);
+    InstructionToken *instruction = &tokens.instructions[tokens.instruction_count];
+    instruction->opcode_alias_group = opcode_alias_group;
+    instruction->mnemonic = mnemonic;
+    instruction->mnemonic_size = mnemonic_size;
+    instruction->operands = operands;
+    return tokens.instruction_count++;
+}
+
+// Empty tokens, keeping the allocations
+static void clear_tokens(void) {
+    tokens.count = 0;
+    tokens.integer_count = 0;
+    tokens.identifier_count = 0;
+    tokens.string_literal_count = 0;
+    tokens.instruction_count = 0;
+}
+
+// Make token index the current one
+static void move_to_token(int index) {
+    cur_token_index = index;
+    cur_line = tokens.lines[index];
 }
 
 static void start_lexer(void) {
+    if (!scanner) select_scanner();
+
     ip = input;
-    cur_line = 1;
-    cur_identifier = malloc(MAX_IDENTIFIER_SIZE);
-    cur_string_literal.data = malloc(MAX_STRING_LITERAL_SIZE * 4);
+    line = 1;
+    lexed_token = 0;
+    identifiers = new_strmap();
+    string_literal_buffer = malloc(MAX_STRING_LITERAL_SIZE);
     seen_instruction = 0;
     seen_directive = 0;
-    cur_register = 0;
 
-    next();
+    clear_tokens();
+
+    // Lex the whole input, up to and including TOK_EOF, or just the first token
+    if (pretokenize)
+        while (lexed_token != TOK_EOF) lex_token();
+    else
+        lex_token();
+
+    move_to_token(0);
+}
+
+// Read all of fd into an anonymous mapping that is doubled in size when it fills up,
+// leaving at least one page of zeroes after the input. Returns the size of the input,
+// or -1 on an error.
+static long read_input(int fd, long page_size) {
+    long input_size = 0;
+    input_mapping_size = 2 * page_size;
+    input = mmap(NULL, input_mapping_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (input == MAP_FAILED) return -1;
+
+    while (1) {
+        if (input_size == input_mapping_size - page_size) {
+            char *new_input = mmap(NULL, input_mapping_size * 2, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (new_input == MAP_FAILED) return -1;
+            memcpy(new_input, input, input_size);
+            munmap(input, input_mapping_size);
+            input = new_input;
+            input_mapping_size *= 2;
+        }
+
+        long count = read(fd, input + input_size, input_mapping_size - page_size - input_size);
+        if (count == -1) return -1;
+        if (count == 0) return input_size;
+        input_size += count;
+    }
 }
 
 void init_lexer(char *filename) {
     cur_filename = filename;
 
-    FILE *f  = fopen(filename, "r");
+    int fd = open(filename, O_RDONLY);
+    struct stat st;
 
-    if (f == 0) {
+    if (fd == -1 || fstat(fd, &st) == -1) {
         perror(filename);
         exit(1);
     }
 
-    fseek(f, 0, SEEK_END);
-    int input_size = ftell(f);
-    fseek(f, 0, SEEK_SET);
+    long page_size = sysconf(_SC_PAGESIZE);
+    long input_size;
 
-    input = malloc(input_size + 1);
-    int read = fread(input, 1, input_size, f);
-    if (read != input_size) {
-        printf("Unable to read input file\n");
-        exit(1);
+    if (S_ISREG(st.st_mode)) {
+        // The lexer looks one character past the end, so the file is mapped over the start
+        // of a larger anonymous mapping that ends with at least one page of zeroes.
+        input_size = st.st_size;
+        input_mapping_size = ALIGN_UP(input_size, page_size) + page_size;
+
+        input = mmap(NULL, input_mapping_size, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (input == MAP_FAILED || (input_size && mmap(input, input_size, PROT_READ, MAP_PRIVATE | MAP_FIXED, fd, 0) == MAP_FAILED)) {
+            perror(filename);
+            exit(1);
+        }
+
+        madvise(input, input_size, MADV_SEQUENTIAL);
+    }
+    else {
+        // Pipes, FIFOs and character devices have no size and can't be mapped
+        input_size = read_input(fd, page_size);
+        if (input_size == -1) {
+            perror(filename);
+            exit(1);
+        }
     }
 
-    input[input_size] = 0;
+    close(fd);
+
     input_end = input + input_size;
-    fclose(f);
 
     start_lexer();
 }
 
 void init_lexer_from_string(char *string) {
     input = string;
+    input_mapping_size = 0;
     input_end = input + strlen(string);
 
     start_lexer();
 }
 
+// Return the Identifier for the size bytes at name, creating it if it doesn't exist
+// yet. The name doesn't need to be null terminated; it's only copied for a new one.
+Identifier *intern_identifier(char *name, int size) {
+    Identifier *identifier = strmap_get_slice(identifiers, name, size);
+    if (identifier) return identifier;
+
+    identifier = arena_alloc(sizeof(Identifier));
+    identifier->name = arena_alloc(size + 1);
+    memcpy(identifier->name, name, size);
+    strmap_put(identifiers, identifier->name, identifier);
+
+    return identifier;
+}
+
+// Copy a string literal to the arena, with a terminating zero
+char *copy_string_literal(StringLiteral *string_literal) {
+    char *result = arena_alloc(string_literal->size);
+    memcpy(result, string_literal->data, string_literal->size - 1);
+
+    return result;
+}
+
 static void skip_whitespace(void) {
-    while (ip < input_end) {
-        if (*ip == ' ' || *ip == '\t' || *ip == '\f' || *ip == '\v')
-            ip++;
-        else return;
-    }
+    ip = scanner->skip_whitespace(ip);
+}
+
+// Move to the newline at the end of the line, or to the end of the input. This steps
+// over any zeroes in the line.
+static void skip_to_end_of_line(void) {
+    ip = scanner->find_end_of_line(ip);
+    while (ip < input_end && *ip != '\n') ip = scanner->find_end_of_line(ip + 1);
 }
 
 static void skip_comments(void) {
-    if (*ip != '#') return;
-    while (*ip != '\n' && ip < input_end) ip++;
+    if (*ip == '#') skip_to_end_of_line();
 }
 
-static void lex_octal_literal(void) {
-    cur_long = 0;
+static long lex_octal_literal(void) {
+    long value = 0;
     int c = 0;
     while (*ip >= '0' && *ip <= '7') {
-        cur_long = cur_long * 8 + *ip - '0';
+        value = value * 8 + *ip - '0';
         ip++;
         c++;
         if (c == 3) break;
     }
+
+    return value;
 }
 
 static void lex_integer(void) {
-    cur_token = TOK_INTEGER;
-
     int is_octal = 0;
     int is_decimal = 0;
     int is_hex = 0;
@@ -124,7 +295,7 @@ static void lex_integer(void) {
         base = 10;
     }
 
-    cur_long = 0;
+    long value = 0;
     while (
         ip < input_end &&
             (is_octal && (*ip >= '0' && *ip <= '7')) ||
@@ -142,18 +313,35 @@ static void lex_integer(void) {
               )
             : *ip - '0';
 
-        cur_long = cur_long * base + digit;
+        value = value * base + digit;
 
         ip++;
     }
+
+    append_token(TOK_INTEGER, add_integer(value));
 }
 
+// A string without escapes points into the input. Others are unescaped into a buffer
+// and copied to the arena, since more than one can be in tokens.
 static void lex_string_literal(void) {
-    int size = 0;
-
     ip += 1;
-    char *data = cur_string_literal.data;
+    char *start = ip;
+    while (ip < input_end && *ip != '"' && *ip != '\\') ip++;
+
+    if (ip < input_end && *ip == '"') {
+        append_token(TOK_STRING_LITERAL, add_string_literal(start, ip - start + 1));
+        ip++;
+        return;
+    }
+
+    int size = ip - start;
+    char *data = string_literal_buffer;
+    if (size >= MAX_STRING_LITERAL_SIZE) panic("Exceeded maximum string literal size %d", MAX_STRING_LITERAL_SIZE);
+    memcpy(data, start, size);
+
     while (input_end - ip >= 1 && *ip != '"') {
+        if (size >= MAX_STRING_LITERAL_SIZE - 1) panic("Exceeded maximum string literal size %d", MAX_STRING_LITERAL_SIZE);
+
         if (*ip != '\\') data[(size)++] = *ip++;
         else if (input_end - ip >= 2 && *ip == '\\') {
                  if (ip[1] == '\'') { ip += 2; data[(size)++] = '\''; }
@@ -170,89 +358,60 @@ static void lex_string_literal(void) {
             else if (ip[1] == 'e' ) { ip += 2; data[(size)++] = 27; }
             else if (ip[1] >= '0' && ip[1] <= '7' ) {
                 ip++;
-                lex_octal_literal();
-                data[(size)++] = cur_long & 0xff;
+                data[(size)++] = lex_octal_literal() & 0xff;
             }
             else error("Unknown \\ escape in string literal");
         }
-
-        data[size] = 0;
     }
 
     if (*ip != '"') error("Expecting terminating \" in string literal");
     ip++;
 
-    if (size >= MAX_STRING_LITERAL_SIZE) panic("Exceeded maximum string literal size %d", MAX_STRING_LITERAL_SIZE);
+    StringLiteral string_literal = { data, size + 1 };
+    append_token(TOK_STRING_LITERAL, add_string_literal(copy_string_literal(&string_literal), size + 1));
+}
 
-    data[size] = 0;
+// Look up a name in a keyword table, returns the keyword or NULL
+static Keyword *lookup_keyword(char *name, int size, Keyword *keywords, uint64_t multiplier, int bits) {
+    if (!size) return NULL;
 
-    cur_token = TOK_STRING_LITERAL;
+    uint64_t key[2] = {0, 0};
+    int prefix_size = size < KEYWORD_PREFIX_SIZE ? size : KEYWORD_PREFIX_SIZE;
+    for (int i = 0; i < prefix_size; i++) key[i >> 3] |= (uint64_t) (unsigned char) name[i] << (8 * (i & 7));
 
-    cur_string_literal.size = size + 1;
-}
+    Keyword *keyword = &keywords[KEYWORD_SLOT(key[0], key[1], size, multiplier, bits)];
+    if (keyword->size != size || keyword->key[0] != key[0] || keyword->key[1] != key[1]) return NULL;
+    if (size > KEYWORD_PREFIX_SIZE &&
+            memcmp(name + KEYWORD_PREFIX_SIZE, keyword->name + KEYWORD_PREFIX_SIZE, size - KEYWORD_PREFIX_SIZE))
+        return NULL;
 
-#define FIND_REG(regs, outcome, alt) \
-    for (int i = 0; i < 16; i++) { \
-        if (!strcmp(name, regs[i])) { \
-            cur_register = outcome + i; \
-            cur_register_alt_8bit = alt; \
-           return; \
-        }  \
-    }
+    return keyword;
+}
 
 static void parse_register(void) {
-    char name[6];
+    char *name = ip;
+    while (((*ip >= 'a' && *ip <= 'z') || (*ip >= '0' && *ip <= '9')) && ip < input_end) ip++;
+    int size = ip - name;
 
-    #define MAX_REGISTER_SIZE sizeof(name) - 1
-    int j = 0;
-    while (((*ip >= 'a' && *ip <= 'z') || (*ip >= '0' && *ip <= '9')) && ip < input_end) {
-        if (j == MAX_REGISTER_SIZE) panic("Exceeded maximum register size %d", MAX_REGISTER_SIZE);
-        name[j] = *ip;
-        j++;
-        ip++;
-    }
-    name[j] = 0;
-
-    // https://wiki.osdev.org/X86-64_Instruction_Encoding#Registers
-    char *regs0a[16] = {"al",   "cl",   "dl",   "bl",   "ah",   "ch",   "dh",   "bh",   "r8b",  "r9b",  "r10b",  "r11b",  "r12b",  "r13b",  "r14b",  "r15b"};
-    char *regs0b[16] = {"",      "",    "",     "",     "spl",  "bpl",  "sil",  "dil",   "",    "",     "",      "",      "",      "",      "",      ""};
-    char *regs1[16]  = {"ax",   "cx",   "dx",   "bx",   "sp",   "bp",   "si",   "di",   "r8w",  "r9w",  "r10w",  "r11w",  "r12w",  "r13w",  "r14w",  "r15w"};
-    char *regs2[16]  = {"eax",  "ecx",  "edx",  "ebx",  "esp",  "ebp",  "esi",  "edi",  "r8d",  "r9d",  "r10d",  "r11d",  "r12d",  "r13d",  "r14d",  "r15d"};
-    char *regs3[16]  = {"rax",  "rcx",  "rdx",  "rbx",  "rsp",  "rbp",  "rsi",  "rdi",  "r8",   "r9",   "r10",   "r11",   "r12",   "r13",   "r14",   "r15"  };
-    char *regs4[16]  = {"xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5", "xmm6", "xmm7", "xmm8", "xmm9", "xmm10", "xmm11", "xmm12", "xmm13", "xmm14", "xmm15"};
-
-    FIND_REG(regs0a, REG_BYTE, 0);
-    FIND_REG(regs0b, REG_BYTE, 1);
-    FIND_REG(regs1,  REG_WORD, 0);
-    FIND_REG(regs1,  REG_WORD, 0);
-    FIND_REG(regs2,  REG_LONG, 0);
-    FIND_REG(regs3,  REG_QUAD, 0);
-    FIND_REG(regs4,  REG_XMM,  0);
-
-    if (!strcmp(name, "rip")) {
-        cur_register = REG_RIP;
-        return;
-    }
+    Keyword *keyword = lookup_keyword(name, size, register_keywords, register_hash_multiplier, register_hash_bits);
+    if (!keyword) error("Unknown register %%%.*s", size, name);
 
-    if (!strcmp(name, "st"))  {
-        if (ip < input_end - 2 && ip[0] == '(' && ip[2] == ')' && ip[1] >= '0' && ip[1] <= '7') {
-            cur_register = REG_ST + ip[1] - '0';
-            ip += 3;
-        }
-        else {
-            cur_register = REG_ST; // %ST is a shortcut for %ST(0)
-        }
+    int payload = keyword->value | (keyword->alt_8bit ? REGISTER_PAYLOAD_ALT_8BIT : 0);
 
-        return;
+    // %st is a shortcut for %st(0)
+    if (keyword->value == REG_ST && ip < input_end - 2 && ip[0] == '(' && ip[2] == ')' && ip[1] >= '0' && ip[1] <= '7') {
+        payload = REG_ST + ip[1] - '0';
+        ip += 3;
     }
 
-    error("Unknown register %%%s", name);
+    append_token(TOK_REGISTER, payload);
 }
 
-// Lexer. Lex a next token or TOK_EOF if the file is ended
-void next(void) {
+// Lex a next token, or TOK_EOF if the file is ended, and append it to tokens
+static void lex_token(void) {
     // Increment the line number after consuming a newline
-    if (cur_token == TOK_EOL) cur_line++;
+    if (lexed_token == TOK_EOL) line++;
+    cur_line = line; // For errors
 
     while (ip < input_end) {
         skip_whitespace();
@@ -265,23 +424,23 @@ void next(void) {
 
         if (c1 == '/' && c2 == '/') {
             // Skip comments
-            while (*ip != '\n' && ip < input_end) ip++;
+            skip_to_end_of_line();
             continue;
         }
 
-             if (c1 == '('  )  { ip += 1;  cur_token = TOK_LPAREN;   }
-        else if (c1 == ')'  )  { ip += 1;  cur_token = TOK_RPAREN;   }
-        else if (c1 == ','  )  { ip += 1;  cur_token = TOK_COMMA;    }
-        else if (c1 == '+'  )  { ip += 1;  cur_token = TOK_PLUS;     }
-        else if (c1 == '-'  )  { ip += 1;  cur_token = TOK_MINUS;    }
-        else if (c1 == '*'  )  { ip += 1;  cur_token = TOK_MULTIPLY; }
-        else if (c1 == '/'  )  { ip += 1;  cur_token = TOK_DIVIDE;   }
-        else if (c1 == '$'  )  { ip += 1;  cur_token = TOK_DOLLAR;   }
+             if (c1 == '('  )  { ip += 1;  append_token(TOK_LPAREN, 0);   }
+        else if (c1 == ')'  )  { ip += 1;  append_token(TOK_RPAREN, 0);   }
+        else if (c1 == ','  )  { ip += 1;  append_token(TOK_COMMA, 0);    }
+        else if (c1 == '+'  )  { ip += 1;  append_token(TOK_PLUS, 0);     }
+        else if (c1 == '-'  )  { ip += 1;  append_token(TOK_MINUS, 0);    }
+        else if (c1 == '*'  )  { ip += 1;  append_token(TOK_MULTIPLY, 0); }
+        else if (c1 == '/'  )  { ip += 1;  append_token(TOK_DIVIDE, 0);   }
+        else if (c1 == '$'  )  { ip += 1;  append_token(TOK_DOLLAR, 0);   }
 
         // Instruction separator
         else if (c1 == ';') {
             ip += 1;
-            cur_token = TOK_EOL;
+            append_token(TOK_EOL, 0);
             seen_instruction = 0;
             seen_directive = 0;
         }
@@ -289,7 +448,7 @@ void next(void) {
         // Newline
         else if (c1 == '\n') {
             ip += 1;
-            cur_token = TOK_EOL;
+            append_token(TOK_EOL, 0);
             seen_instruction = 0;
             seen_directive = 0;
         }
@@ -306,7 +465,6 @@ void next(void) {
 
         else if (c1 == '%') {
             // Register
-            cur_token = TOK_REGISTER;
             ip++;
             parse_register();
         }
@@ -314,71 +472,42 @@ void next(void) {
         // Label, instruction, directive or identifier
         else if (((c1 >= 'a' && c1 <= 'z') || (c1 >= 'A' && c1 <= 'Z') || c1 == '_' || c1 == '.') || c1 == '@') {
 
-            int j = 0;
-            while (
-                    ((*ip >= 'a' && *ip <= 'z') ||
-                        (*ip >= 'A' && *ip <= 'Z') ||
-                        (*ip >= '0' && *ip <= '9') ||
-                        (*ip == '_' ||
-                        (*ip == '@') ||
-                        (*ip == ':') ||
-                        (*ip == '.'))) && ip < input_end) {
-
-                if (j == MAX_IDENTIFIER_SIZE) panic("Exceeded maximum identifier size %d", MAX_IDENTIFIER_SIZE);
-                cur_identifier[j] = *ip;
-                j++;
-                ip++;
-            }
-
-            if (!j) panic("cur_identifier is unexpectedly empty");
+            char *identifier = ip;
+            ip = scanner->skip_identifier(ip);
 
-            int is_label = cur_identifier[j - 1] == ':';
+            int j = ip - identifier;
+            if (!j) panic("identifier is unexpectedly empty");
 
-            cur_identifier[j] = 0;
+            int is_label = identifier[j - 1] == ':';
 
-            if (!seen_directive && !is_label && cur_identifier[0] == '.') {
+            if (!seen_directive && !is_label && identifier[0] == '.') {
                 // Parse directive or identifier starting with dot
-                     if (!strcmp(cur_identifier, ".align"   )) { cur_token = TOK_DIRECTIVE_ALIGN;   seen_directive = 1; }
-                else if (!strcmp(cur_identifier, ".byte"    )) { cur_token = TOK_DIRECTIVE_BYTE;    seen_directive = 1; }
-                else if (!strcmp(cur_identifier, ".comm"    )) { cur_token = TOK_DIRECTIVE_COMM;    seen_directive = 1; }
-                else if (!strcmp(cur_identifier, ".data"    )) { cur_token = TOK_DIRECTIVE_DATA;    seen_directive = 1; }
-                else if (!strcmp(cur_identifier, ".file"    )) { cur_token = TOK_DIRECTIVE_FILE;    seen_directive = 1; }
-                else if (!strcmp(cur_identifier, ".globl"   )) { cur_token = TOK_DIRECTIVE_GLOBL;   seen_directive = 1; }
-                else if (!strcmp(cur_identifier, ".loc"     )) { cur_token = TOK_DIRECTIVE_LOC;     seen_directive = 1; }
-                else if (!strcmp(cur_identifier, ".local"   )) { cur_token = TOK_DIRECTIVE_LOCAL;   seen_directive = 1; }
-                else if (!strcmp(cur_identifier, ".long"    )) { cur_token = TOK_DIRECTIVE_LONG;    seen_directive = 1; }
-                else if (!strcmp(cur_identifier, ".quad"    )) { cur_token = TOK_DIRECTIVE_QUAD;    seen_directive = 1; }
-                else if (!strcmp(cur_identifier, ".section" )) { cur_token = TOK_DIRECTIVE_SECTION; seen_directive = 1; }
-                else if (!strcmp(cur_identifier, ".size"    )) { cur_token = TOK_DIRECTIVE_SIZE;    seen_directive = 1; }
-                else if (!strcmp(cur_identifier, ".sleb128" )) { cur_token = TOK_DIRECTIVE_SLEB128; seen_directive = 1; }
-                else if (!strcmp(cur_identifier, ".string"  )) { cur_token = TOK_DIRECTIVE_STRING;  seen_directive = 1; }
-                else if (!strcmp(cur_identifier, ".text"    )) { cur_token = TOK_DIRECTIVE_TEXT;    seen_directive = 1; }
-                else if (!strcmp(cur_identifier, ".type"    )) { cur_token = TOK_DIRECTIVE_TYPE;    seen_directive = 1; }
-                else if (!strcmp(cur_identifier, ".uleb128" )) { cur_token = TOK_DIRECTIVE_ULEB128; seen_directive = 1; }
-                else if (!strcmp(cur_identifier, ".word"    )) { cur_token = TOK_DIRECTIVE_WORD;    seen_directive = 1; }
-                else if (!strcmp(cur_identifier, ".value"   )) { cur_token = TOK_DIRECTIVE_VALUE;   seen_directive = 1; }
-                else if (!strcmp(cur_identifier, ".zero"    )) { cur_token = TOK_DIRECTIVE_ZERO;    seen_directive = 1; }
-                else if (!strcmp(cur_identifier, "."        )) { cur_token = TOK_DOT_SYMBOL;        seen_directive = 1; }
-                else {
-                    cur_token = TOK_IDENTIFIER;
+                Keyword *keyword = lookup_keyword(identifier, j,
+                    directive_keywords, directive_hash_multiplier, directive_hash_bits);
+
+                if (keyword) {
+                    append_token(keyword->value, 0);
+                    seen_directive = 1;
                 }
+                else
+                    append_token(TOK_IDENTIFIER, add_identifier(intern_identifier(identifier, j)));
             }
 
             else if (is_label) {
                 // Label
-                cur_token = TOK_LABEL;
-                cur_identifier[j - 1] = 0;
+                append_token(TOK_LABEL, add_identifier(intern_identifier(identifier, j - 1)));
             }
 
             else {
                 if (!seen_directive && !seen_instruction) {
                     // Instruction
-                    cur_token = TOK_INSTRUCTION;
+                    int opcode_alias_group = lookup_opcode_alias_group(identifier, j);
+                    append_token(TOK_INSTRUCTION, add_instruction(opcode_alias_group, identifier, j, ip));
                     seen_instruction = 1;
                 }
                 else {
                     // Identifier
-                    cur_token = TOK_IDENTIFIER;
+                    append_token(TOK_IDENTIFIER, add_identifier(intern_identifier(identifier, j)));
                 }
             }
         }
@@ -389,11 +518,70 @@ void next(void) {
         return;
     }
 
-    cur_token = TOK_EOF;
+    append_token(TOK_EOF, 0);
+}
+
+// Move to the next token. It stays at TOK_EOF once it's reached.
+void next(void) {
+    if (cur_token_index + 1 < tokens.count)
+        move_to_token(cur_token_index + 1);
+    else if (!pretokenize) {
+        // All tokens have been read, so start filling tokens again
+        clear_tokens();
+        lex_token();
+        move_to_token(0);
+    }
+}
+
+// Return the kind of the token offset tokens after the current one, TOK_EOF past the
+// end. Without pretokenize, this lexes up to that token.
+int peek_token(int offset) {
+    int index = cur_token_index + offset;
+    while (index >= tokens.count && lexed_token != TOK_EOF) lex_token();
+    cur_line = tokens.lines[cur_token_index];
+
+    return index < tokens.count ? tokens.kinds[index] : TOK_EOF;
+}
+
+// Copy the operands of the current instruction up to the end of the statement into
+// buffer, leaving out whitespace. Returns the size, or -1 if they don't fit.
+int get_canonical_operands(char *buffer, int size) {
+    int j = 0;
+    char *p = TOKEN_INSTRUCTION(cur_token_index)->operands;
+
+    while (p < input_end && *p != '\n' && *p != ';' && *p != '#' && !(p[0] == '/' && p[1] == '/')) {
+        if (*p != ' ' && *p != '\t' && *p != '\f' && *p != '\v') {
+            if (j == size - 1) return -1;
+            buffer[j++] = *p;
+        }
+        p++;
+    }
+
+    buffer[j] = 0;
+    statement_end = p;
+
+    return j;
+}
+
+// Skip the rest of the statement that get_canonical_operands() was called for.
+void skip_statement(void) {
+    int index = cur_token_index;
+    while (index + 1 < tokens.count && TOKEN_KIND(index) != TOK_EOL && TOKEN_KIND(index) != TOK_EOF) index++;
+
+    if (TOKEN_KIND(index) == TOK_EOL || TOKEN_KIND(index) == TOK_EOF) {
+        move_to_token(index);
+        return;
+    }
+
+    // The end of the statement hasn't been lexed yet
+    clear_tokens();
+    ip = statement_end;
+    lex_token();
+    move_to_token(0);
 }
 
 void expect(int token, char *what) {
-    if (cur_token != token) error("Expected %s", what);
+    if (TOKEN_KIND(cur_token_index) != token) error("Expected %s", what);
 }
 
 void consume(int token, char *what) {
@@ -1,12 +1,21 @@
 #ifndef _LEXER_H
 #define _LEXER_H
 
-#define MAX_IDENTIFIER_SIZE           1024
 #define MAX_STRING_LITERAL_SIZE       4095
 
+// Identifiers and labels are interned: every distinct name has a single Identifier,
+// which stays valid until the end of the assembly. The symbol is looked up on first
+// use, see get_or_add_identifier_symbol().
+typedef struct identifier {
+    char *name;
+    struct symbol *symbol;
+} Identifier;
+
+// A string literal points into the input if it doesn't have escapes, so it isn't null
+// terminated. Use copy_string_literal() to keep it.
 typedef struct string_literal {
     char *data;
-    int size;
+    int size;           // Size including a terminating zero
 } StringLiteral;
 
 enum {
@@ -18,18 +27,20 @@ enum {
     TOK_LABEL,
     TOK_IDENTIFIER,
     TOK_DIRECTIVE_ALIGN,
-    TOK_DIRECTIVE_BYTE,
-    TOK_DIRECTIVE_COMM,             // 10
+    TOK_DIRECTIVE_BALIGN,
+    TOK_DIRECTIVE_BYTE,             // 10
+    TOK_DIRECTIVE_COMM,
     TOK_DIRECTIVE_DATA,
     TOK_DIRECTIVE_FILE,
     TOK_DIRECTIVE_LOC,
     TOK_DIRECTIVE_GLOBL,
     TOK_DIRECTIVE_LOCAL,
     TOK_DIRECTIVE_LONG,
+    TOK_DIRECTIVE_P2ALIGN,
     TOK_DIRECTIVE_QUAD,
-    TOK_DIRECTIVE_SECTION,
+    TOK_DIRECTIVE_SECTION,          // 20
     TOK_DIRECTIVE_SIZE,
-    TOK_DIRECTIVE_STRING,           // 20
+    TOK_DIRECTIVE_STRING,
     TOK_DIRECTIVE_TEXT,
     TOK_DIRECTIVE_TYPE,
     TOK_DIRECTIVE_SLEB128,
@@ -37,9 +48,9 @@ enum {
     TOK_DIRECTIVE_WORD,
     TOK_DIRECTIVE_VALUE,
     TOK_DIRECTIVE_ZERO,
-    TOK_DOT_SYMBOL,
+    TOK_DOT_SYMBOL,                 // 30
     TOK_INSTRUCTION,
-    TOK_REGISTER,                   // 30
+    TOK_REGISTER,
     TOK_RPAREN,
     TOK_LPAREN,
     TOK_COMMA,
@@ -59,20 +70,73 @@ enum {
 #define REG_ST   0x50
 #define REG_RIP  0x60
 
-extern char *cur_filename;      // Current filename being lexed
-extern int cur_line;            // Current line number being lexed
+// The payload of an instruction token
+typedef struct instruction_token {
+    int opcode_alias_group;     // Opcode alias group index, -1 if unknown
+    char *mnemonic;             // Not null terminated
+    int mnemonic_size;
+    char *operands;             // Start of the operands in the input
+} InstructionToken;
+
+// The parser reads tokens from a structure of arrays with an entry per token, at
+// cur_token_index. The payload of a token is the index of its value in the array for
+// its kind. For registers it's the register id itself, with bit 8 set for the alt
+// 8-bit ones.
+//
+// With pretokenize set, the whole input is lexed into tokens up front. Otherwise
+// tokens are lexed into it as they're needed, and it's emptied once they've all been
+// read, so the payload of a token is only valid until the parser moves past it.
+typedef struct tokens {
+    int count;
+    int allocated;
+    char *kinds;                            // TOK_*
+    int *lines;                             // Line number of each token
+    int *payloads;                          // See above, zero for tokens without a payload
+
+    long *integers;                         // TOK_INTEGER
+    int integer_count;
+    int integers_allocated;
+
+    Identifier **identifiers;               // TOK_IDENTIFIER and TOK_LABEL
+    int identifier_count;
+    int identifiers_allocated;
+
+    StringLiteral *string_literals;         // TOK_STRING_LITERAL
+    int string_literal_count;
+    int string_literals_allocated;
 
-extern int cur_token;                       // Current token
-extern char *cur_identifier;                // Current identifier
-extern int cur_register;                    // Current register id
-extern int cur_register_alt_8bit;           // Set to 1 for spl, bpl, sil, dil 8-bit registers
-extern long cur_long;                       // Current integer
-extern StringLiteral cur_string_literal;    // Current string literal
+    InstructionToken *instructions;         // TOK_INSTRUCTION
+    int instruction_count;
+    int instructions_allocated;
+} Tokens;
+
+#define REGISTER_PAYLOAD_ALT_8BIT 0x100
+
+// The kind and payload of token i
+#define TOKEN_KIND(i)                   (tokens.kinds[i])
+#define TOKEN_INTEGER(i)                (tokens.integers[tokens.payloads[i]])
+#define TOKEN_IDENTIFIER(i)             (tokens.identifiers[tokens.payloads[i]])
+#define TOKEN_STRING_LITERAL(i)         (tokens.string_literals[tokens.payloads[i]])
+#define TOKEN_INSTRUCTION(i)            (&tokens.instructions[tokens.payloads[i]])
+#define TOKEN_REGISTER(i)               (tokens.payloads[i] & ~REGISTER_PAYLOAD_ALT_8BIT)
+#define TOKEN_REGISTER_IS_ALT_8BIT(i)   (!!(tokens.payloads[i] & REGISTER_PAYLOAD_ALT_8BIT))
+
+extern int pretokenize;         // Lex the whole input before parsing
+extern Tokens tokens;
+extern int cur_token_index;     // Index of the token the parser is at
+
+extern char *cur_filename;      // Current filename being lexed
+extern int cur_line;            // Line of the current token, or of the lexer while lexing
 
 void free_lexer(void);
 void init_lexer(char *filename);
 void init_lexer_from_string(char *string);
 void next(void);
+int peek_token(int offset);
+Identifier *intern_identifier(char *name, int size);
+char *copy_string_literal(StringLiteral *string_literal);
+int get_canonical_operands(char *buffer, int size);
+void skip_statement(void);
 void expect(int token, char *what);
 void consume(int token, char *what);
 
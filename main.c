@@ -2,15 +2,38 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "branches.h"
+#include "lexer.h"
+#include "ordering.h"
+#include "peephole.h"
 #include "was.h"
 #include "utils.h"
 
+// Parse the N[:M] of -falign-loops=N[:M] and -falign-functions=N[:M], like gcc does. The
+// alignment is N rounded up to a power of two, skipping at most M-1 bytes.
+static void parse_alignment_flag(char *flag, char *value, int *alignment, int *max_skip) {
+    char *end;
+    int n = strtol(value, &end, 10);
+    int m = n;
+    if (*end == ':') m = strtol(end + 1, &end, 10);
+
+    if (end == value || *end || n < 0 || m < 0 || n > 1 << 16) {
+        printf("Invalid value for %s: %s\n", flag, value);
+        exit(1);
+    }
+
+    *alignment = 1;
+    while (*alignment < n) *alignment <<= 1;
+    *max_skip = m > 0 ? m - 1 : *alignment - 1;
+}
+
 int main(int argc, char **argv) {
     int exit_code = 0;
     int help = 0;
     int verbose = 0;
     char *input_filename = NULL;
     char *output_filename = NULL;
+    int thread_jumps_flag = -1;
 
     argc--;
     argv++;
@@ -19,6 +42,38 @@ int main(int argc, char **argv) {
                  if (argc > 0 && !strcmp(argv[0], "-h"   )) { help = 1;    argc--; argv++; }
             else if (argc > 0 && !strcmp(argv[0], "-v"   )) { verbose = 1; argc--; argv++; }
             else if (argc > 0 && !strcmp(argv[0], "-64"  )) {              argc--; argv++; }
+            else if (argc > 0 && !strcmp(argv[0], "--statistics")) { print_statistics = 1; argc--; argv++; }
+            else if (argc > 0 && !strcmp(argv[0], "--pretokenize")) { pretokenize = 1; argc--; argv++; }
+            else if (argc > 0 && !strcmp(argv[0], "-O"   )) { optimize = 1; argc--; argv++; }
+            else if (argc > 0 && !strcmp(argv[0], "-fthread-jumps"   )) { thread_jumps_flag = 1; argc--; argv++; }
+            else if (argc > 0 && !strcmp(argv[0], "-fno-thread-jumps")) { thread_jumps_flag = 0; argc--; argv++; }
+            else if (argc > 0 && (!memcmp(argv[0], "-fpeephole-", 11) || !memcmp(argv[0], "-fno-peephole-", 14))) {
+                int enabled = argv[0][2] != 'n';
+                char *name = argv[0] + (enabled ? 11 : 14);
+                if (!set_peephole_rule(name, enabled)) {
+                    printf("Unknown peephole rule %s\n", name);
+                    exit(1);
+                }
+                argc--;
+                argv++;
+            }
+            else if (argc > 0 && !memcmp(argv[0], "--symbol-ordering-file=", 23)) {
+                symbol_ordering_filename = argv[0] + 23;
+                argc--;
+                argv++;
+            }
+            else if (argc > 0 && !strcmp(argv[0], "-ffunction-sections")) { function_sections = 1; argc--; argv++; }
+            else if (argc > 0 && !strcmp(argv[0], "-mbranches-within-32B-boundaries")) { branch_boundary = 32; argc--; argv++; }
+            else if (argc > 0 && !memcmp(argv[0], "-falign-loops=", 14)) {
+                parse_alignment_flag("-falign-loops", argv[0] + 14, &align_loops, &align_loops_max_skip);
+                argc--;
+                argv++;
+            }
+            else if (argc > 0 && !memcmp(argv[0], "-falign-functions=", 18)) {
+                parse_alignment_flag("-falign-functions", argv[0] + 18, &align_functions, &align_functions_max_skip);
+                argc--;
+                argv++;
+            }
             else if (argc > 1 && !memcmp(argv[0], "-o", 2)) {
                 output_filename = argv[1];
                 argc -= 2;
@@ -41,12 +96,37 @@ int main(int argc, char **argv) {
     }
 
     if (help) {
-        printf("Usage: was [-h -v] [-o OUTPUT-FILE] INPUT-FILE...\n\n");
+        printf("Usage: was [-h -v --statistics --pretokenize -falign-loops=N -falign-functions=N -mbranches-within-32B-boundaries]\n");
+        printf("           [-ffunction-sections --symbol-ordering-file=FILE]\n");
+        printf("           [-O -f[no-]peephole-RULE -f[no-]thread-jumps] [-o OUTPUT-FILE] INPUT-FILE...\n\n");
         printf("Flags\n");
         printf("-h      Help\n");
         printf("-v      Display the programs invoked by the compiler\n");
         printf("-o      Output filename\n");
         printf("-64     Select x86-64 architecture (for compatibility with gnu as)\n");
+        printf("-falign-loops=N[:M]\n");
+        printf("        Align the targets of backward jumps to N bytes, skipping at most M-1 bytes\n");
+        printf("-falign-functions=N[:M]\n");
+        printf("        Align functions to N bytes, skipping at most M-1 bytes\n");
+        printf("-mbranches-within-32B-boundaries\n");
+        printf("        Pad jumps, calls, rets and fused cmp/test and jumps with NOPs so that\n");
+        printf("        they don't cross or end on a 32 byte boundary\n");
+        printf("-ffunction-sections\n");
+        printf("        Put each function in .text in a .text.<function> section of its own\n");
+        printf("--symbol-ordering-file=FILE\n");
+        printf("        Put the functions in code sections in the order of the symbols in FILE,\n");
+        printf("        one per line. Functions that aren't in it go after the ones that are\n");
+        printf("-O      Rewrite instructions into shorter equivalents with all peephole rules\n");
+        printf("-fpeephole-RULE, -fno-peephole-RULE\n");
+        printf("        Switch a peephole rule on or off, with or without -O. The rules are\n");
+        printf("        self-move, redundant-move, store-reload, add-zero, zero-idiom and mov-imm32\n");
+        printf("-fthread-jumps, -fno-thread-jumps\n");
+        printf("        Send branches to a jmp straight to where the jmp goes, and remove jumps\n");
+        printf("        to the next instruction. -O switches this on\n");
+        printf("--pretokenize\n");
+        printf("        Lex the whole input before parsing it\n");
+        printf("--statistics\n");
+        printf("        Print statistics about the assembly on stderr\n");
         exit(1);
     }
 
@@ -55,6 +135,8 @@ int main(int argc, char **argv) {
         exit(1);
     }
 
+    thread_jumps = thread_jumps_flag == -1 ? optimize : thread_jumps_flag;
+
     if (!output_filename) output_filename = "a.out";
 
     if (!input_filename) {
@@ -1,17893 +1,19500 @@
+#include <string.h>
+
 #include "instr.h"
 #include "opcodes.h"
 
 // Generated by scripts/parse-x86reference.xml.py
 
+// Interned opcode mnemonics, indexed by Opcode.mnem
+char *opcode_mnemonics[] = {
+    "add", "or", "pop", "adc", "sbb", "and", "es", "sub",
+    "cs", "ntaken", "xor", "ss", "cmp", "ds", "taken", "inc",
+    "rex", "rex.b", "rex.x", "rex.xb", "rex.r", "rex.rb", "rex.rx", "rex.rxb",
+    "dec", "rex.w", "rex.wb", "rex.wx", "rex.wxb", "rex.wr", "rex.wrb", "rex.wrx",
+    "rex.wrxb", "push", "arpl", "movsxd", "fs", "alter", "gs", "imul",
+    "ins", "insb", "insw", "insd", "outs", "outsb", "outsw", "outsd",
+    "jo", "jno", "jb", "jnae", "jc", "jnb", "jae", "jnc",
+    "jz", "je", "jnz", "jne", "jbe", "jna", "jnbe", "ja",
+    "js", "jns", "jp", "jpe", "jnp", "jpo", "jl", "jnge",
+    "jnl", "jge", "jle", "jng", "jnle", "jg", "test", "mov",
+    "lea", "nop", "pause", "cbw", "cwde", "cdqe", "cwd", "cdq",
+    "cqo", "fwait", "wait", "pushf", "pushfd", "pushfq", "popf", "popfd",
+    "popfq", "sahf", "lahf", "movs", "movsb", "movsw", "movsd", "movsq",
+    "cmps", "cmpsb", "cmpsw", "cmpsd", "cmpsq", "stos", "stosb", "stosw",
+    "stosd", "stosq", "lods", "lodsb", "lodsw", "lodsd", "lodsq", "scas",
+    "scasb", "scasw", "scasd", "scasq", "rol", "ror", "rcl", "rcr",
+    "shl", "sal", "shr", "sar", "retn", "enter", "leave", "retf",
+    "int", "into", "iret", "iretd", "iretq", "xlat", "xlatb", "fadd",
+    "fmul", "fcom", "fcomp", "fsub", "fsubr", "fdiv", "fdivr", "fld",
+    "fxch", "fst", "fnop", "fstp", "fstp1", "fchs", "fabs", "ftst",
+    "fxam", "fldcw", "fld1", "fldl2t", "fldl2e", "fldpi", "fldlg2", "fldln2",
+    "fldz", "f2xm1", "fyl2x", "fptan", "fpatan", "fxtract", "fprem1", "fdecstp",
+    "fincstp", "fnstcw", "fstcw", "fprem", "fyl2xp1", "fsqrt", "fsincos", "frndint",
+    "fscale", "fsin", "fcos", "fiadd", "fcmovb", "fimul", "fcmove", "ficom",
+    "fcmovbe", "ficomp", "fcmovu", "fisub", "fisubr", "fucompp", "fidiv", "fidivr",
+    "fild", "fcmovnb", "fisttp", "fcmovne", "fist", "fcmovnbe", "fistp", "fcmovnu",
+    "fneni", "feni", "fndisi", "fdisi", "fnclex", "fclex", "fninit", "finit",
+    "fnsetpm", "fsetpm", "fucomi", "fcomi", "fcom2", "fcomp3", "ffree", "fxch4",
+    "fucom", "fucomp", "fnstsw", "fstsw", "faddp", "fmulp", "fcomp5", "fcompp",
+    "fsubrp", "fsubp", "fdivrp", "fdivp", "ffreep", "fxch7", "fstp8", "fstp9",
+    "fucomip", "fcomip", "loopnz", "loopne", "loopz", "loope", "loop", "jcxz",
+    "jecxz", "jrcxz", "in", "out", "call", "jmp", "lock", "int1",
+    "icebp", "repnz", "repne", "rep", "repz", "repe", "hlt", "cmc",
+    "not", "neg", "mul", "div", "idiv", "clc", "stc", "cli",
+    "sti", "cld", "std", "sldt", "str", "lldt", "ltr", "verr",
+    "verw", "jmpe", "vmcall", "vmlaunch", "vmresume", "vmxoff", "monitor", "mwait",
+    "xgetbv", "xsetbv", "smsw", "lmsw", "invlpg", "swapgs", "rdtscp", "lar",
+    "lsl", "loadall", "syscall", "clts", "sysret", "invd", "wbinvd", "ud2",
+    "movss", "movlps", "movlpd", "movddup", "movsldup", "movhps", "movhpd", "movshdup",
+    "hint_nop", "prefetchnta", "prefetcht0", "prefetcht1", "prefetcht2", "cvtsi2ss", "cvtsi2sd", "cvttss2si",
+    "cvttsd2si", "cvtss2si", "cvtsd2si", "ucomiss", "ucomisd", "comiss", "comisd", "wrmsr",
+    "rdtsc", "rdmsr", "rdpmc", "sysenter", "sysexit", "getsec", "pshufb", "phaddw",
+    "phaddd", "phaddsw", "pmaddubsw", "phsubw", "phsubd", "phsubsw", "psignb", "psignw",
+    "psignd", "pmulhrsw", "pblendvb", "ptest", "pabsb", "pabsw", "pabsd", "pmovsxbw",
+    "pmovsxbd", "pmovsxbq", "pmovsxwd", "pmovsxwq", "pmovsxdq", "pmuldq", "pcmpeqq", "movntdqa",
+    "packusdw", "pmovzxbw", "pmovzxbd", "pmovzxbq", "pmovzxwd", "pmovzxwq", "pmovzxdq", "pcmpgtq",
+    "pminsb", "pminsd", "pminuw", "pminud", "pmaxsb", "pmaxsd", "pmaxuw", "pmaxud",
+    "pmulld", "phminposuw", "invept", "invvpid", "movbe", "crc32", "roundss", "roundsd",
+    "pblendw", "palignr", "pextrb", "pextrw", "pextrd", "pextrq", "extractps", "pinsrb",
+    "pinsrd", "pinsrq", "mpsadbw", "cmovo", "cmovno", "cmovb", "cmovnae", "cmovc",
+    "cmovnb", "cmovae", "cmovnc", "cmovz", "cmove", "cmovnz", "cmovne", "cmovbe",
+    "cmovna", "cmovnbe", "cmova", "cmovs", "cmovns", "cmovp", "cmovpe", "cmovnp",
+    "cmovpo", "cmovl", "cmovnge", "cmovnl", "cmovge", "cmovle", "cmovng", "cmovnle",
+    "cmovg", "sqrtss", "sqrtsd", "rsqrtss", "rcpss", "addss", "addsd", "mulss",
+    "mulsd", "cvtss2sd", "cvtsd2ss", "subss", "subsd", "minss", "minsd", "divss",
+    "divsd", "maxss", "maxsd", "punpcklbw", "punpcklwd", "punpckldq", "packsswb", "pcmpgtb",
+    "pcmpgtw", "pcmpgtd", "packuswb", "punpckhbw", "punpckhwd", "punpckhdq", "packssdw", "punpcklqdq",
+    "punpckhqdq", "movd", "movq", "movdqa", "movdqu", "pshuflw", "pshufhw", "pshufd",
+    "pcmpeqb", "pcmpeqw", "pcmpeqd", "emms", "vmread", "vmwrite", "seto", "setno",
+    "setb", "setnae", "setc", "setnb", "setae", "setnc", "setz", "sete",
+    "setnz", "setne", "setbe", "setna", "setnbe", "seta", "sets", "setns",
+    "setp", "setpe", "setnp", "setpo", "setl", "setnge", "setnl", "setge",
+    "setle", "setng", "setnle", "setg", "cpuid", "bt", "shld", "rsm",
+    "bts", "shrd", "ldmxcsr", "stmxcsr", "xsave", "lfence", "xrstor", "mfence",
+    "sfence", "clflush", "cmpxchg", "btr", "movzx", "popcnt", "ud", "btc",
+    "bsf", "bsr", "movsx", "cmpss", "movnti", "pinsrw", "cmpxchg8b", "cmpxchg16b",
+    "vmptrld", "vmclear", "vmxon", "vmptrst", "bswap", "psrlw", "psrld", "psrlq",
+    "paddq", "pmullw", "psubusb", "psubusw", "pminub", "pand", "paddusb", "paddusw",
+    "pmaxub", "pandn", "pavgb", "psraw", "psrad", "pavgw", "pmulhuw", "pmulhw",
+    "movntdq", "psubsb", "psubsw", "pminsw", "por", "paddsb", "paddsw", "pmaxsw",
+    "pxor", "lddqu", "psllw", "pslld", "psllq", "pmuludq", "pmaddwd", "psadbw",
+    "psubb", "psubw", "psubd", "psubq", "paddb", "paddw", "paddd",
+};
+
+// Operands and flags of opcodes: addressing mode, type, sizes, flags, arg count, acc, branch, conver, x87fpu
+OpcodeOperands opcode_operands[] = {
+    { {AM_G,AT_B,SIZE08,0,0,0,0,0}, {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // add
+    { {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // add
+    { {AM_E,AT_B,SIZE08,0,0,0,0,0}, {AM_G,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // add
+    { {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // add
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {0,AT_B,SIZE08,0,0,0,1,0}, {0,0,0,0,0,0,0,0}, 2,1,0,0,0 }, // add
+    { {AM_I,AT_VDS,SIZE16|SIZE32,1,0,0,0,0}, {0,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,1,0}, {0,0,0,0,0,0,0,0}, 2,1,0,0,0 }, // add
+    { {AM_G,AT_B,SIZE08,0,0,0,0,0}, {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // or
+    { {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // or
+    { {AM_E,AT_B,SIZE08,0,0,0,0,0}, {AM_G,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // or
+    { {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // or
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {0,AT_B,SIZE08,0,0,0,1,0}, {0,0,0,0,0,0,0,0}, 2,1,0,0,0 }, // or
+    { {AM_I,AT_VDS,SIZE16|SIZE32,1,0,0,0,0}, {0,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,1,0}, {0,0,0,0,0,0,0,0}, 2,1,0,0,0 }, // or
+    { {0,AT_W,SIZE16,1,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // pop
+    { {AM_G,AT_B,SIZE08,0,0,0,0,0}, {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // adc
+    { {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // adc
+    { {AM_E,AT_B,SIZE08,0,0,0,0,0}, {AM_G,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // adc
+    { {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // adc
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {0,AT_B,SIZE08,0,0,0,1,0}, {0,0,0,0,0,0,0,0}, 2,1,0,0,0 }, // adc
+    { {AM_I,AT_VDS,SIZE16|SIZE32,1,0,0,0,0}, {0,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,1,0}, {0,0,0,0,0,0,0,0}, 2,1,0,0,0 }, // adc
+    { {AM_G,AT_B,SIZE08,0,0,0,0,0}, {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // sbb
+    { {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // sbb
+    { {AM_E,AT_B,SIZE08,0,0,0,0,0}, {AM_G,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // sbb
+    { {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // sbb
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {0,AT_B,SIZE08,0,0,0,1,0}, {0,0,0,0,0,0,0,0}, 2,1,0,0,0 }, // sbb
+    { {AM_I,AT_VDS,SIZE16|SIZE32,1,0,0,0,0}, {0,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,1,0}, {0,0,0,0,0,0,0,0}, 2,1,0,0,0 }, // sbb
+    { {AM_G,AT_B,SIZE08,0,0,0,0,0}, {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // and
+    { {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // and
+    { {AM_E,AT_B,SIZE08,0,0,0,0,0}, {AM_G,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // and
+    { {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // and
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {0,AT_B,SIZE08,0,0,0,1,0}, {0,0,0,0,0,0,0,0}, 2,1,0,0,0 }, // and
+    { {AM_I,AT_VDS,SIZE16|SIZE32,1,0,0,0,0}, {0,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,1,0}, {0,0,0,0,0,0,0,0}, 2,1,0,0,0 }, // and
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // es
+    { {AM_G,AT_B,SIZE08,0,0,0,0,0}, {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // sub
+    { {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // sub
+    { {AM_E,AT_B,SIZE08,0,0,0,0,0}, {AM_G,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // sub
+    { {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // sub
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {0,AT_B,SIZE08,0,0,0,1,0}, {0,0,0,0,0,0,0,0}, 2,1,0,0,0 }, // sub
+    { {AM_I,AT_VDS,SIZE16|SIZE32,1,0,0,0,0}, {0,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,1,0}, {0,0,0,0,0,0,0,0}, 2,1,0,0,0 }, // sub
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // cs
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,1,0,0 }, // ntaken
+    { {AM_G,AT_B,SIZE08,0,0,0,0,0}, {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // xor
+    { {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // xor
+    { {AM_E,AT_B,SIZE08,0,0,0,0,0}, {AM_G,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // xor
+    { {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // xor
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {0,AT_B,SIZE08,0,0,0,1,0}, {0,0,0,0,0,0,0,0}, 2,1,0,0,0 }, // xor
+    { {AM_I,AT_VDS,SIZE16|SIZE32,1,0,0,0,0}, {0,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,1,0}, {0,0,0,0,0,0,0,0}, 2,1,0,0,0 }, // xor
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // ss
+    { {AM_G,AT_B,SIZE08,0,0,0,0,0}, {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // cmp
+    { {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // cmp
+    { {AM_E,AT_B,SIZE08,0,0,0,0,0}, {AM_G,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // cmp
+    { {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // cmp
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {0,AT_B,SIZE08,0,0,0,1,0}, {0,0,0,0,0,0,0,0}, 2,1,0,0,0 }, // cmp
+    { {AM_I,AT_VDS,SIZE16|SIZE32,1,0,0,0,0}, {0,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,1,0}, {0,0,0,0,0,0,0,0}, 2,1,0,0,0 }, // cmp
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // ds
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,1,0,0 }, // taken
+    { {AM_Z,AT_V,SIZE16|SIZE32,1,0,1,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // inc
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // rex
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // rex.b
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // rex.x
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // rex.xb
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // rex.r
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // rex.rb
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // rex.rx
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // rex.rxb
+    { {AM_Z,AT_V,SIZE16|SIZE32,1,0,1,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // dec
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // rex.w
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // rex.wb
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // rex.wx
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // rex.wxb
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // rex.wr
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // rex.wrb
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // rex.wrx
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // rex.wrxb
+    { {AM_Z,AT_V,SIZE16|SIZE32,1,0,1,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // push
+    { {AM_Z,AT_VQ,SIZE16|SIZE64,1,0,1,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // push
+    { {AM_Z,AT_V,SIZE16|SIZE32,1,0,1,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // pop
+    { {AM_Z,AT_VQ,SIZE16|SIZE64,1,0,1,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // pop
+    { {AM_G,AT_W,SIZE16,1,0,0,0,0}, {AM_E,AT_W,SIZE16,1,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // arpl
+    { {AM_E,AT_D,SIZE32,0,0,0,0,0}, {AM_G,AT_DQP,SIZE32|SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,1,0 }, // movsxd
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // fs
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,1,0,0 }, // alter
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // gs
+    { {AM_I,AT_VS,SIZE16|SIZE32,1,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // push
+    { {AM_I,AT_VDS,SIZE16|SIZE32,1,0,0,0,0}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, 3,0,0,0,0 }, // imul
+    { {AM_I,AT_BSS,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // push
+    { {AM_I,AT_BS,SIZE08,0,0,0,0,0}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, 3,0,0,0,0 }, // imul
+    { {0,AT_W,SIZE16,1,0,0,1,2}, {0,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // ins
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // insb
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // insw
+    { {0,AT_W,SIZE16,1,0,0,1,2}, {0,AT_V,SIZE16|SIZE32,1,0,1,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // ins
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // insd
+    { {0,AT_B,SIZE08,0,0,0,0,0}, {0,AT_W,SIZE16,1,0,0,1,2}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // outs
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // outsb
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // outsw
+    { {0,AT_V,SIZE16|SIZE32,1,0,1,0,0}, {0,AT_W,SIZE16,1,0,0,1,2}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // outs
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // outsd
+    { {AM_J,AT_BS,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // jo
+    { {AM_J,AT_BS,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // jno
+    { {AM_J,AT_BS,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // jb
+    { {AM_J,AT_BS,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // jnae
+    { {AM_J,AT_BS,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // jc
+    { {AM_J,AT_BS,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // jnb
+    { {AM_J,AT_BS,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // jae
+    { {AM_J,AT_BS,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // jnc
+    { {AM_J,AT_BS,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // jz
+    { {AM_J,AT_BS,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // je
+    { {AM_J,AT_BS,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // jnz
+    { {AM_J,AT_BS,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // jne
+    { {AM_J,AT_BS,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // jbe
+    { {AM_J,AT_BS,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // jna
+    { {AM_J,AT_BS,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // jnbe
+    { {AM_J,AT_BS,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // ja
+    { {AM_J,AT_BS,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // js
+    { {AM_J,AT_BS,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // jns
+    { {AM_J,AT_BS,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // jp
+    { {AM_J,AT_BS,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // jpe
+    { {AM_J,AT_BS,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // jnp
+    { {AM_J,AT_BS,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // jpo
+    { {AM_J,AT_BS,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // jl
+    { {AM_J,AT_BS,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // jnge
+    { {AM_J,AT_BS,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // jnl
+    { {AM_J,AT_BS,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // jge
+    { {AM_J,AT_BS,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // jle
+    { {AM_J,AT_BS,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // jng
+    { {AM_J,AT_BS,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // jnle
+    { {AM_J,AT_BS,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // jg
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // add
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // or
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // adc
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // sbb
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // and
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // sub
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // xor
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // cmp
+    { {AM_I,AT_VDS,SIZE16|SIZE32,1,0,0,0,0}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // add
+    { {AM_I,AT_VDS,SIZE16|SIZE32,1,0,0,0,0}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // or
+    { {AM_I,AT_VDS,SIZE16|SIZE32,1,0,0,0,0}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // adc
+    { {AM_I,AT_VDS,SIZE16|SIZE32,1,0,0,0,0}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // sbb
+    { {AM_I,AT_VDS,SIZE16|SIZE32,1,0,0,0,0}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // and
+    { {AM_I,AT_VDS,SIZE16|SIZE32,1,0,0,0,0}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // sub
+    { {AM_I,AT_VDS,SIZE16|SIZE32,1,0,0,0,0}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // xor
+    { {AM_I,AT_VDS,SIZE16|SIZE32,1,0,0,0,0}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // cmp
+    { {AM_I,AT_BS,SIZE08,0,0,0,0,0}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // add
+    { {AM_I,AT_BS,SIZE08,0,0,0,0,0}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // or
+    { {AM_I,AT_BS,SIZE08,0,0,0,0,0}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // adc
+    { {AM_I,AT_BS,SIZE08,0,0,0,0,0}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // sbb
+    { {AM_I,AT_BS,SIZE08,0,0,0,0,0}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // and
+    { {AM_I,AT_BS,SIZE08,0,0,0,0,0}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // sub
+    { {AM_I,AT_BS,SIZE08,0,0,0,0,0}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // xor
+    { {AM_I,AT_BS,SIZE08,0,0,0,0,0}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // cmp
+    { {AM_G,AT_B,SIZE08,0,0,0,0,0}, {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // test
+    { {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // test
+    { {AM_G,AT_B,SIZE08,0,0,0,0,0}, {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // mov
+    { {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // mov
+    { {AM_E,AT_B,SIZE08,0,0,0,0,0}, {AM_G,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // mov
+    { {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // mov
+    { {AM_M,0,0,0,0,0,0,0}, {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // lea
+    { {AM_E,AT_V,SIZE16|SIZE32,1,0,1,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // pop
+    { {AM_E,AT_VQ,SIZE16|SIZE64,1,0,1,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // pop
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // nop
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // nop
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // pause
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,1,0 }, // cbw
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,1,0 }, // cwde
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,1,0 }, // cbw
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,1,0 }, // cwde
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,1,0 }, // cdqe
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,1,0 }, // cwd
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,1,0 }, // cdq
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,1,0 }, // cwd
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,1,0 }, // cdq
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,1,0 }, // cqo
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,1 }, // fwait
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,1 }, // wait
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // pushf
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // pushfd
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // pushf
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // pushfq
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // popf
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // popfd
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // popf
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // popfq
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // sahf
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // lahf
+    { {0,AT_B,SIZE08,0,0,0,0,0}, {0,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // movs
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // movsb
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // movsw
+    { {0,AT_V,SIZE16|SIZE32,1,0,1,0,0}, {0,AT_V,SIZE16|SIZE32,1,0,1,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // movs
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // movsd
+    { {0,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // movs
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // movsw
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // movsd
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // movsq
+    { {0,AT_B,SIZE08,0,0,0,0,0}, {0,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // cmps
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // cmpsb
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // cmpsw
+    { {0,AT_V,SIZE16|SIZE32,1,0,1,0,0}, {0,AT_V,SIZE16|SIZE32,1,0,1,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // cmps
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // cmpsd
+    { {0,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // cmps
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // cmpsw
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // cmpsd
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // cmpsq
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {0,AT_B,SIZE08,0,0,0,1,0}, {0,0,0,0,0,0,0,0}, 2,1,0,0,0 }, // test
+    { {AM_I,AT_VDS,SIZE16|SIZE32,1,0,0,0,0}, {0,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,1,0}, {0,0,0,0,0,0,0,0}, 2,1,0,0,0 }, // test
+    { {0,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // stos
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // stosb
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // stosw
+    { {0,AT_V,SIZE16|SIZE32,1,0,1,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // stos
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // stosd
+    { {0,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // stos
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // stosw
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // stosd
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // stosq
+    { {0,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // lods
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // lodsb
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // lodsw
+    { {0,AT_V,SIZE16|SIZE32,1,0,1,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // lods
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // lodsd
+    { {0,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // lods
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // lodsw
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // lodsd
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // lodsq
+    { {0,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // scas
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // scasb
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // scasw
+    { {0,AT_V,SIZE16|SIZE32,1,0,1,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // scas
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // scasd
+    { {0,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // scas
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // scasw
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // scasd
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // scasq
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {AM_Z,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // mov
+    { {AM_I,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_Z,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // mov
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // rol
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // ror
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // rcl
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // rcr
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // shl
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // sal
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // shr
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // sal
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // shl
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // sar
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // rol
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // ror
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // rcl
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // rcr
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // shl
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // sal
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // shr
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // sal
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // shl
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // sar
+    { {AM_I,AT_W,SIZE16,1,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // retn
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,1,0,0 }, // retn
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // mov
+    { {AM_I,AT_VDS,SIZE16|SIZE32,1,0,0,0,0}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // mov
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {AM_I,AT_W,SIZE16,1,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // enter
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {AM_I,AT_W,SIZE16,1,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // enter
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // leave
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // leave
+    { {AM_I,AT_W,SIZE16,1,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // retf
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,1,0,0 }, // retf
+    { {AM_I,AT_1,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // int
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // int
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // into
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // iret
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // iretd
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // iret
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // iretd
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // iretq
+    { {AM_I,AT_1,SIZE08,0,0,0,0,0}, {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // rol
+    { {AM_I,AT_1,SIZE08,0,0,0,0,0}, {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // ror
+    { {AM_I,AT_1,SIZE08,0,0,0,0,0}, {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // rcl
+    { {AM_I,AT_1,SIZE08,0,0,0,0,0}, {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // rcr
+    { {AM_I,AT_1,SIZE08,0,0,0,0,0}, {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // shl
+    { {AM_I,AT_1,SIZE08,0,0,0,0,0}, {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // sal
+    { {AM_I,AT_1,SIZE08,0,0,0,0,0}, {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // shr
+    { {AM_I,AT_1,SIZE08,0,0,0,0,0}, {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // sal
+    { {AM_I,AT_1,SIZE08,0,0,0,0,0}, {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // shl
+    { {AM_I,AT_1,SIZE08,0,0,0,0,0}, {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // sar
+    { {AM_I,AT_1,SIZE08,0,0,0,0,0}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // rol
+    { {AM_I,AT_1,SIZE08,0,0,0,0,0}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // ror
+    { {AM_I,AT_1,SIZE08,0,0,0,0,0}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // rcl
+    { {AM_I,AT_1,SIZE08,0,0,0,0,0}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // rcr
+    { {AM_I,AT_1,SIZE08,0,0,0,0,0}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // shl
+    { {AM_I,AT_1,SIZE08,0,0,0,0,0}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // sal
+    { {AM_I,AT_1,SIZE08,0,0,0,0,0}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // shr
+    { {AM_I,AT_1,SIZE08,0,0,0,0,0}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // sal
+    { {AM_I,AT_1,SIZE08,0,0,0,0,0}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // shl
+    { {AM_I,AT_1,SIZE08,0,0,0,0,0}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // sar
+    { {0,AT_B,SIZE08,0,0,0,1,1}, {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // rol
+    { {0,AT_B,SIZE08,0,0,0,1,1}, {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // ror
+    { {0,AT_B,SIZE08,0,0,0,1,1}, {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // rcl
+    { {0,AT_B,SIZE08,0,0,0,1,1}, {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // rcr
+    { {0,AT_B,SIZE08,0,0,0,1,1}, {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // shl
+    { {0,AT_B,SIZE08,0,0,0,1,1}, {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // sal
+    { {0,AT_B,SIZE08,0,0,0,1,1}, {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // shr
+    { {0,AT_B,SIZE08,0,0,0,1,1}, {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // sal
+    { {0,AT_B,SIZE08,0,0,0,1,1}, {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // shl
+    { {0,AT_B,SIZE08,0,0,0,1,1}, {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // sar
+    { {0,AT_B,SIZE08,0,0,0,1,1}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // rol
+    { {0,AT_B,SIZE08,0,0,0,1,1}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // ror
+    { {0,AT_B,SIZE08,0,0,0,1,1}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // rcl
+    { {0,AT_B,SIZE08,0,0,0,1,1}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // rcr
+    { {0,AT_B,SIZE08,0,0,0,1,1}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // shl
+    { {0,AT_B,SIZE08,0,0,0,1,1}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // sal
+    { {0,AT_B,SIZE08,0,0,0,1,1}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // shr
+    { {0,AT_B,SIZE08,0,0,0,1,1}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // sal
+    { {0,AT_B,SIZE08,0,0,0,1,1}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // shl
+    { {0,AT_B,SIZE08,0,0,0,1,1}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // sar
+    { {0,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // xlat
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // xlatb
+    { {AM_M,AT_SR,SIZE32,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fadd
+    { {AM_EST,0,0,0,0,0,0,0}, {AM_ST,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,1 }, // fadd
+    { {AM_M,AT_SR,SIZE32,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fmul
+    { {AM_EST,0,0,0,0,0,0,0}, {AM_ST,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,1 }, // fmul
+    { {AM_ES,AT_SR,SIZE32,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fcom
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,1 }, // fcom
+    { {AM_ES,AT_SR,SIZE32,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fcomp
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,1 }, // fcomp
+    { {AM_M,AT_SR,SIZE32,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fsub
+    { {AM_EST,0,0,0,0,0,0,0}, {AM_ST,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,1 }, // fsub
+    { {AM_M,AT_SR,SIZE32,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fsubr
+    { {AM_EST,0,0,0,0,0,0,0}, {AM_ST,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,1 }, // fsubr
+    { {AM_M,AT_SR,SIZE32,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fdiv
+    { {AM_EST,0,0,0,0,0,0,0}, {AM_ST,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,1 }, // fdiv
+    { {AM_M,AT_SR,SIZE32,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fdivr
+    { {AM_EST,0,0,0,0,0,0,0}, {AM_ST,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,1 }, // fdivr
+    { {AM_ES,AT_SR,SIZE32,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fld
+    { {AM_EST,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fxch
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,1 }, // fxch
+    { {AM_M,AT_SR,SIZE32,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fst
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,1 }, // fnop
+    { {AM_M,AT_SR,SIZE32,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fstp
+    { {AM_EST,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fstp1
+    { {AM_EST,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fstp1
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,1 }, // fchs
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,1 }, // fabs
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,1 }, // ftst
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,1 }, // fxam
+    { {AM_M,AT_W,SIZE16,1,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fldcw
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,1 }, // fld1
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,1 }, // fldl2t
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,1 }, // fldl2e
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,1 }, // fldpi
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,1 }, // fldlg2
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,1 }, // fldln2
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,1 }, // fldz
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,1 }, // f2xm1
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,1 }, // fyl2x
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,1 }, // fptan
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,1 }, // fpatan
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,1 }, // fxtract
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,1 }, // fprem1
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,1 }, // fdecstp
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,1 }, // fincstp
+    { {AM_M,AT_W,SIZE16,1,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fnstcw
+    { {AM_M,AT_W,SIZE16,1,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fstcw
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,1 }, // fprem
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,1 }, // fyl2xp1
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,1 }, // fsqrt
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,1 }, // fsincos
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,1 }, // frndint
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,1 }, // fscale
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,1 }, // fsin
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,1 }, // fcos
+    { {AM_M,AT_DI,SIZE32,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fiadd
+    { {AM_EST,0,0,0,0,0,0,0}, {AM_ST,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,1 }, // fcmovb
+    { {AM_M,AT_DI,SIZE32,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fimul
+    { {AM_EST,0,0,0,0,0,0,0}, {AM_ST,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,1 }, // fcmove
+    { {AM_M,AT_DI,SIZE32,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // ficom
+    { {AM_EST,0,0,0,0,0,0,0}, {AM_ST,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,1 }, // fcmovbe
+    { {AM_M,AT_DI,SIZE32,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // ficomp
+    { {AM_EST,0,0,0,0,0,0,0}, {AM_ST,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,1 }, // fcmovu
+    { {AM_M,AT_DI,SIZE32,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fisub
+    { {AM_M,AT_DI,SIZE32,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fisubr
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,1 }, // fucompp
+    { {AM_M,AT_DI,SIZE32,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fidiv
+    { {AM_M,AT_DI,SIZE32,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fidivr
+    { {AM_M,AT_DI,SIZE32,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fild
+    { {AM_EST,0,0,0,0,0,0,0}, {AM_ST,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,1 }, // fcmovnb
+    { {AM_M,AT_DI,SIZE32,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,1,1 }, // fisttp
+    { {AM_EST,0,0,0,0,0,0,0}, {AM_ST,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,1 }, // fcmovne
+    { {AM_M,AT_DI,SIZE32,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fist
+    { {AM_EST,0,0,0,0,0,0,0}, {AM_ST,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,1 }, // fcmovnbe
+    { {AM_M,AT_DI,SIZE32,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fistp
+    { {AM_EST,0,0,0,0,0,0,0}, {AM_ST,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,1 }, // fcmovnu
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,1 }, // fneni
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,1 }, // feni
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // fneni
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,1 }, // fndisi
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,1 }, // fdisi
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // fndisi
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,1 }, // fnclex
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,1 }, // fclex
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,1 }, // fninit
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,1 }, // finit
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,1 }, // fnsetpm
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,1 }, // fsetpm
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // fnsetpm
+    { {AM_M,AT_ER,SIZEST,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fld
+    { {AM_EST,0,0,0,0,0,0,0}, {AM_ST,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,1 }, // fucomi
+    { {AM_EST,0,0,0,0,0,0,0}, {AM_ST,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,1 }, // fcomi
+    { {AM_M,AT_ER,SIZEST,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fstp
+    { {AM_M,AT_DR,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fadd
+    { {AM_ST,0,0,0,0,0,0,0}, {AM_EST,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,1 }, // fadd
+    { {AM_M,AT_DR,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fmul
+    { {AM_ST,0,0,0,0,0,0,0}, {AM_EST,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,1 }, // fmul
+    { {AM_M,AT_DR,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fcom
+    { {AM_EST,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fcom2
+    { {AM_EST,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fcom2
+    { {AM_M,AT_DR,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fcomp
+    { {AM_EST,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fcomp3
+    { {AM_EST,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fcomp3
+    { {AM_M,AT_DR,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fsub
+    { {AM_ST,0,0,0,0,0,0,0}, {AM_EST,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,1 }, // fsubr
+    { {AM_M,AT_DR,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fsubr
+    { {AM_ST,0,0,0,0,0,0,0}, {AM_EST,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,1 }, // fsub
+    { {AM_M,AT_DR,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fdiv
+    { {AM_ST,0,0,0,0,0,0,0}, {AM_EST,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,1 }, // fdivr
+    { {AM_M,AT_DR,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fdivr
+    { {AM_ST,0,0,0,0,0,0,0}, {AM_EST,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,1 }, // fdiv
+    { {AM_M,AT_DR,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fld
+    { {AM_EST,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // ffree
+    { {AM_M,AT_QI,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,1,1 }, // fisttp
+    { {AM_EST,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fxch4
+    { {AM_EST,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fxch4
+    { {AM_M,AT_DR,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fst
+    { {AM_EST,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fst
+    { {AM_M,AT_DR,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fstp
+    { {AM_EST,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fstp
+    { {AM_EST,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fucom
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,1 }, // fucom
+    { {AM_EST,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fucomp
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,1 }, // fucomp
+    { {AM_M,AT_W,SIZE16,1,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fnstsw
+    { {AM_M,AT_W,SIZE16,1,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fstsw
+    { {AM_M,AT_WI,SIZE16,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fiadd
+    { {AM_ST,0,0,0,0,0,0,0}, {AM_EST,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,1 }, // faddp
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,1 }, // faddp
+    { {AM_M,AT_WI,SIZE16,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fimul
+    { {AM_ST,0,0,0,0,0,0,0}, {AM_EST,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,1 }, // fmulp
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,1 }, // fmulp
+    { {AM_M,AT_WI,SIZE16,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // ficom
+    { {AM_EST,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fcomp5
+    { {AM_EST,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fcomp5
+    { {AM_M,AT_WI,SIZE16,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // ficomp
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,1 }, // fcompp
+    { {AM_M,AT_WI,SIZE16,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fisub
+    { {AM_ST,0,0,0,0,0,0,0}, {AM_EST,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,1 }, // fsubrp
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,1 }, // fsubrp
+    { {AM_M,AT_WI,SIZE16,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fisubr
+    { {AM_ST,0,0,0,0,0,0,0}, {AM_EST,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,1 }, // fsubp
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,1 }, // fsubp
+    { {AM_M,AT_WI,SIZE16,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fidiv
+    { {AM_ST,0,0,0,0,0,0,0}, {AM_EST,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,1 }, // fdivrp
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,1 }, // fdivrp
+    { {AM_M,AT_WI,SIZE16,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fidivr
+    { {AM_ST,0,0,0,0,0,0,0}, {AM_EST,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,1 }, // fdivp
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,1 }, // fdivp
+    { {AM_M,AT_WI,SIZE16,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fild
+    { {AM_EST,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // ffreep
+    { {AM_M,AT_WI,SIZE16,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,1,1 }, // fisttp
+    { {AM_EST,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fxch7
+    { {AM_EST,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fxch7
+    { {AM_M,AT_WI,SIZE16,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fist
+    { {AM_EST,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fstp8
+    { {AM_EST,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fstp8
+    { {AM_M,AT_WI,SIZE16,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fistp
+    { {AM_EST,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fstp9
+    { {AM_EST,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fstp9
+    { {0,AT_W,SIZE16,1,0,0,1,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fnstsw
+    { {0,AT_W,SIZE16,1,0,0,1,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fstsw
+    { {AM_M,AT_QI,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fild
+    { {AM_EST,0,0,0,0,0,0,0}, {AM_ST,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,1 }, // fucomip
+    { {AM_EST,0,0,0,0,0,0,0}, {AM_ST,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,1 }, // fcomip
+    { {AM_M,AT_QI,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,1 }, // fistp
+    { {AM_J,AT_BS,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // loopnz
+    { {AM_J,AT_BS,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // loopne
+    { {AM_J,AT_BS,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // loopnz
+    { {AM_J,AT_BS,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // loopne
+    { {AM_J,AT_BS,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // loopz
+    { {AM_J,AT_BS,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // loope
+    { {AM_J,AT_BS,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // loopz
+    { {AM_J,AT_BS,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // loope
+    { {AM_J,AT_BS,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // loop
+    { {AM_J,AT_BS,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // loop
+    { {AM_J,AT_BS,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // jcxz
+    { {AM_J,AT_BS,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // jecxz
+    { {AM_J,AT_BS,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // jecxz
+    { {AM_J,AT_BS,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // jrcxz
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {0,AT_B,SIZE08,0,0,0,1,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // in
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {0,AT_V,SIZE16|SIZE32,1,0,1,1,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // in
+    { {0,AT_B,SIZE08,0,0,0,1,0}, {AM_I,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // out
+    { {0,AT_V,SIZE16|SIZE32,1,0,1,1,0}, {AM_I,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // out
+    { {AM_J,AT_VDS,SIZE16|SIZE32,1,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // call
+    { {AM_J,AT_VDS,SIZE16|SIZE32,1,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // jmp
+    { {AM_J,AT_BS,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // jmp
+    { {0,AT_W,SIZE16,1,0,0,1,2}, {0,AT_B,SIZE08,0,0,0,1,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // in
+    { {0,AT_W,SIZE16,1,0,0,1,2}, {0,AT_V,SIZE16|SIZE32,1,0,1,1,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // in
+    { {0,AT_B,SIZE08,0,0,0,1,0}, {0,AT_W,SIZE16,1,0,0,1,2}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // out
+    { {0,AT_V,SIZE16|SIZE32,1,0,1,1,0}, {0,AT_W,SIZE16,1,0,0,1,2}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // out
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // lock
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // int1
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // icebp
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // repnz
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // repne
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // rep
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // repnz
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // repne
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // rep
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // repz
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // repe
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // rep
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // repz
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // repe
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // rep
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // hlt
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // cmc
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // test
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // test
+    { {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // not
+    { {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // neg
+    { {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // mul
+    { {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // imul
+    { {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // div
+    { {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // idiv
+    { {AM_I,AT_VDS,SIZE16|SIZE32,1,0,0,0,0}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // test
+    { {AM_I,AT_VDS,SIZE16|SIZE32,1,0,0,0,0}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // test
+    { {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // not
+    { {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // neg
+    { {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // mul
+    { {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // imul
+    { {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // div
+    { {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // idiv
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // clc
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // stc
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // cli
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // sti
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // cld
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // std
+    { {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // inc
+    { {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // dec
+    { {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // inc
+    { {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // dec
+    { {AM_E,AT_V,SIZE16|SIZE32,1,0,1,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // call
+    { {AM_E,AT_Q,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // call
+    { {AM_E,AT_V,SIZE16|SIZE32,1,0,1,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // jmp
+    { {AM_E,AT_Q,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // jmp
+    { {AM_E,AT_V,SIZE16|SIZE32,1,0,1,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // push
+    { {AM_E,AT_VQ,SIZE16|SIZE64,1,0,1,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // push
+    { {AM_M,AT_W,SIZE16,1,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // sldt
+    { {AM_M,AT_W,SIZE16,1,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // str
+    { {AM_E,AT_W,SIZE16,1,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // lldt
+    { {AM_E,AT_W,SIZE16,1,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // ltr
+    { {AM_E,AT_W,SIZE16,1,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // verr
+    { {AM_E,AT_W,SIZE16,1,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // verw
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,1,0,0 }, // jmpe
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // vmcall
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // vmlaunch
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // vmresume
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // vmxoff
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // monitor
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // mwait
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // xgetbv
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // xsetbv
+    { {AM_M,AT_W,SIZE16,1,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // smsw
+    { {AM_E,AT_W,SIZE16,1,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // lmsw
+    { {AM_M,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // invlpg
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // swapgs
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // rdtscp
+    { {AM_M,AT_W,SIZE16,1,0,0,0,0}, {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // lar
+    { {AM_M,AT_W,SIZE16,1,0,0,0,0}, {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // lsl
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,1,0,0 }, // loadall
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,1,0,0 }, // syscall
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // clts
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,1,0,0 }, // loadall
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,1,0,0 }, // sysret
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // invd
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // wbinvd
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // ud2
+    { {AM_E,AT_V,SIZE16|SIZE32,1,0,1,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // nop
+    { {AM_W,AT_SS,SIZE16,0,0,0,0,0}, {AM_V,AT_SS,SIZE16,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // movss
+    { {AM_W,AT_SD,SIZE32,0,0,0,0,0}, {AM_V,AT_SD,SIZE32,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // movsd
+    { {AM_V,AT_SS,SIZE16,0,0,0,0,0}, {AM_W,AT_SS,SIZE16,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // movss
+    { {AM_V,AT_SD,SIZE32,0,0,0,0,0}, {AM_W,AT_SD,SIZE32,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // movsd
+    { {AM_M,AT_Q,SIZE64,0,0,0,0,0}, {AM_V,AT_Q,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // movlps
+    { {AM_M,AT_Q,SIZE64,0,0,0,0,0}, {AM_V,AT_Q,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // movlpd
+    { {AM_W,AT_Q,SIZE64,0,0,0,0,0}, {AM_V,AT_Q,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // movddup
+    { {AM_W,AT_Q,SIZE64,0,0,0,0,0}, {AM_V,AT_Q,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // movsldup
+    { {AM_V,AT_Q,SIZE64,0,0,0,0,0}, {AM_M,AT_Q,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // movlps
+    { {AM_V,AT_Q,SIZE64,0,0,0,0,0}, {AM_M,AT_Q,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // movlpd
+    { {AM_M,AT_Q,SIZE64,0,0,0,0,0}, {AM_V,AT_Q,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // movhps
+    { {AM_M,AT_Q,SIZE64,0,0,0,0,0}, {AM_V,AT_Q,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // movhpd
+    { {AM_W,AT_Q,SIZE64,0,0,0,0,0}, {AM_V,AT_Q,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // movshdup
+    { {AM_V,AT_Q,SIZE64,0,0,0,0,0}, {AM_M,AT_Q,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // movhps
+    { {AM_V,AT_Q,SIZE64,0,0,0,0,0}, {AM_M,AT_Q,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // movhpd
+    { {AM_E,AT_V,SIZE16|SIZE32,1,0,1,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // hint_nop
+    { {AM_M,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // prefetchnta
+    { {AM_M,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // prefetcht0
+    { {AM_M,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // prefetcht1
+    { {AM_M,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // prefetcht2
+    { {AM_E,AT_V,SIZE16|SIZE32,1,0,1,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // hint_nop
+    { {AM_E,AT_V,SIZE16|SIZE32,1,0,1,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // hint_nop
+    { {AM_E,AT_V,SIZE16|SIZE32,1,0,1,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // hint_nop
+    { {AM_E,AT_V,SIZE16|SIZE32,1,0,1,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // hint_nop
+    { {AM_E,AT_V,SIZE16|SIZE32,1,0,1,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // hint_nop
+    { {AM_E,AT_V,SIZE16|SIZE32,1,0,1,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // hint_nop
+    { {AM_E,AT_V,SIZE16|SIZE32,1,0,1,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // hint_nop
+    { {AM_E,AT_V,SIZE16|SIZE32,1,0,1,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // hint_nop
+    { {AM_E,AT_V,SIZE16|SIZE32,1,0,1,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // hint_nop
+    { {AM_E,AT_V,SIZE16|SIZE32,1,0,1,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // hint_nop
+    { {AM_E,AT_V,SIZE16|SIZE32,1,0,1,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // hint_nop
+    { {AM_E,AT_V,SIZE16|SIZE32,1,0,1,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // nop
+    { {AM_E,AT_V,SIZE16|SIZE32,1,0,1,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // hint_nop
+    { {AM_E,AT_V,SIZE16|SIZE32,1,0,1,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // hint_nop
+    { {AM_E,AT_V,SIZE16|SIZE32,1,0,1,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // hint_nop
+    { {AM_E,AT_V,SIZE16|SIZE32,1,0,1,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // hint_nop
+    { {AM_E,AT_V,SIZE16|SIZE32,1,0,1,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // hint_nop
+    { {AM_E,AT_V,SIZE16|SIZE32,1,0,1,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // hint_nop
+    { {AM_E,AT_V,SIZE16|SIZE32,1,0,1,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // hint_nop
+    { {AM_E,AT_DQP,SIZE32|SIZE64,0,0,0,0,0}, {AM_V,AT_SS,SIZE16,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,1,0 }, // cvtsi2ss
+    { {AM_E,AT_DQP,SIZE32|SIZE64,0,0,0,0,0}, {AM_V,AT_SD,SIZE32,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,1,0 }, // cvtsi2sd
+    { {AM_W,AT_SS,SIZE16,0,0,0,0,0}, {AM_G,AT_DQP,SIZE32|SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,1,0 }, // cvttss2si
+    { {AM_W,AT_SD,SIZE32,0,0,0,0,0}, {AM_G,AT_DQP,SIZE32|SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,1,0 }, // cvttsd2si
+    { {AM_W,AT_SS,SIZE16,0,0,0,0,0}, {AM_G,AT_DQP,SIZE32|SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,1,0 }, // cvtss2si
+    { {AM_W,AT_SD,SIZE32,0,0,0,0,0}, {AM_G,AT_DQP,SIZE32|SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,1,0 }, // cvtsd2si
+    { {AM_W,AT_SS,SIZE16,0,0,0,0,0}, {AM_V,AT_SS,SIZE16,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // ucomiss
+    { {AM_W,AT_SD,SIZE32,0,0,0,0,0}, {AM_V,AT_SD,SIZE32,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // ucomisd
+    { {AM_W,AT_SS,SIZE16,0,0,0,0,0}, {AM_V,AT_SS,SIZE16,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // comiss
+    { {AM_W,AT_SD,SIZE32,0,0,0,0,0}, {AM_V,AT_SD,SIZE32,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // comisd
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // wrmsr
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // rdtsc
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // rdmsr
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // rdpmc
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,1,0,0 }, // sysenter
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,1,0,0 }, // sysenter
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,1,0,0 }, // sysexit
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // getsec
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // pshufb
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // phaddw
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // phaddd
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // phaddsw
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // pmaddubsw
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // phsubw
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // phsubd
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // phsubsw
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // psignb
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // psignw
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // psignd
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // pmulhrsw
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // pblendvb
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // ptest
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // pabsb
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // pabsw
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // pabsd
+    { {AM_M,AT_Q,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,1,0 }, // pmovsxbw
+    { {AM_M,AT_D,SIZE32,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,1,0 }, // pmovsxbd
+    { {AM_M,AT_W,SIZE16,1,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,1,0 }, // pmovsxbq
+    { {AM_M,AT_Q,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,1,0 }, // pmovsxwd
+    { {AM_M,AT_D,SIZE32,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,1,0 }, // pmovsxwq
+    { {AM_M,AT_Q,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,1,0 }, // pmovsxdq
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // pmuldq
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // pcmpeqq
+    { {AM_M,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // movntdqa
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,1,0 }, // packusdw
+    { {AM_M,AT_Q,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,1,0 }, // pmovzxbw
+    { {AM_M,AT_D,SIZE32,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,1,0 }, // pmovzxbd
+    { {AM_M,AT_W,SIZE16,1,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,1,0 }, // pmovzxbq
+    { {AM_M,AT_Q,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,1,0 }, // pmovzxwd
+    { {AM_M,AT_D,SIZE32,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,1,0 }, // pmovzxwq
+    { {AM_M,AT_Q,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,1,0 }, // pmovzxdq
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // pcmpgtq
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // pminsb
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // pminsd
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // pminuw
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // pminud
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // pmaxsb
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // pmaxsd
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // pmaxuw
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // pmaxud
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // pmulld
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // phminposuw
+    { {AM_M,AT_DQ,SIZE64,0,0,0,0,0}, {AM_G,AT_D,SIZE32,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // invept
+    { {AM_M,AT_DQ,SIZE64,0,0,0,0,0}, {AM_G,AT_Q,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // invept
+    { {AM_M,AT_DQ,SIZE64,0,0,0,0,0}, {AM_G,AT_D,SIZE32,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // invvpid
+    { {AM_M,AT_DQ,SIZE64,0,0,0,0,0}, {AM_G,AT_Q,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // invvpid
+    { {AM_M,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // movbe
+    { {AM_E,AT_B,SIZE08,0,0,0,0,0}, {AM_G,AT_DQP,SIZE32|SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // crc32
+    { {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_M,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // movbe
+    { {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_G,AT_DQP,SIZE32|SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // crc32
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {AM_W,AT_SS,SIZE16,0,0,0,0,0}, {AM_V,AT_SS,SIZE16,0,0,0,0,0}, 3,0,0,1,0 }, // roundss
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {AM_W,AT_SD,SIZE32,0,0,0,0,0}, {AM_V,AT_SD,SIZE32,0,0,0,0,0}, 3,0,0,1,0 }, // roundsd
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, 3,0,0,0,0 }, // pblendw
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, 3,0,0,0,0 }, // palignr
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {AM_M,AT_B,SIZE08,0,0,0,0,0}, 3,0,0,0,0 }, // pextrb
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {AM_M,AT_W,SIZE16,1,0,0,0,0}, 3,0,0,0,0 }, // pextrw
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {AM_E,AT_D,SIZE32,0,0,0,0,0}, 3,0,0,0,0 }, // pextrd
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {AM_E,AT_QP,SIZE64,0,0,0,0,0}, 3,0,0,0,0 }, // pextrq
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {AM_E,AT_D,SIZE32,0,0,0,0,0}, 3,0,0,0,0 }, // extractps
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {AM_M,AT_B,SIZE08,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, 3,0,0,0,0 }, // pinsrb
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {AM_E,AT_D,SIZE32,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, 3,0,0,0,0 }, // pinsrd
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {AM_E,AT_QP,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, 3,0,0,0,0 }, // pinsrq
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, 3,0,0,0,0 }, // mpsadbw
+    { {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // cmovo
+    { {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // cmovno
+    { {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // cmovb
+    { {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // cmovnae
+    { {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // cmovc
+    { {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // cmovnb
+    { {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // cmovae
+    { {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // cmovnc
+    { {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // cmovz
+    { {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // cmove
+    { {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // cmovnz
+    { {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // cmovne
+    { {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // cmovbe
+    { {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // cmovna
+    { {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // cmovnbe
+    { {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // cmova
+    { {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // cmovs
+    { {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // cmovns
+    { {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // cmovp
+    { {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // cmovpe
+    { {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // cmovnp
+    { {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // cmovpo
+    { {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // cmovl
+    { {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // cmovnge
+    { {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // cmovnl
+    { {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // cmovge
+    { {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // cmovle
+    { {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // cmovng
+    { {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // cmovnle
+    { {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // cmovg
+    { {AM_W,AT_SS,SIZE16,0,0,0,0,0}, {AM_V,AT_SS,SIZE16,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // sqrtss
+    { {AM_W,AT_SD,SIZE32,0,0,0,0,0}, {AM_V,AT_SD,SIZE32,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // sqrtsd
+    { {AM_W,AT_SS,SIZE16,0,0,0,0,0}, {AM_V,AT_SS,SIZE16,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // rsqrtss
+    { {AM_W,AT_SS,SIZE16,0,0,0,0,0}, {AM_V,AT_SS,SIZE16,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // rcpss
+    { {AM_W,AT_SS,SIZE16,0,0,0,0,0}, {AM_V,AT_SS,SIZE16,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // addss
+    { {AM_W,AT_SD,SIZE32,0,0,0,0,0}, {AM_V,AT_SD,SIZE32,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // addsd
+    { {AM_W,AT_SS,SIZE16,0,0,0,0,0}, {AM_V,AT_SS,SIZE16,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // mulss
+    { {AM_W,AT_SD,SIZE32,0,0,0,0,0}, {AM_V,AT_SD,SIZE32,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // mulsd
+    { {AM_W,AT_SS,SIZE16,0,0,0,0,0}, {AM_V,AT_SD,SIZE32,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,1,0 }, // cvtss2sd
+    { {AM_W,AT_SD,SIZE32,0,0,0,0,0}, {AM_V,AT_SS,SIZE16,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,1,0 }, // cvtsd2ss
+    { {AM_W,AT_SS,SIZE16,0,0,0,0,0}, {AM_V,AT_SS,SIZE16,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // subss
+    { {AM_W,AT_SD,SIZE32,0,0,0,0,0}, {AM_V,AT_SD,SIZE32,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // subsd
+    { {AM_W,AT_SS,SIZE16,0,0,0,0,0}, {AM_V,AT_SS,SIZE16,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // minss
+    { {AM_W,AT_SD,SIZE32,0,0,0,0,0}, {AM_V,AT_SD,SIZE32,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // minsd
+    { {AM_W,AT_SS,SIZE16,0,0,0,0,0}, {AM_V,AT_SS,SIZE16,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // divss
+    { {AM_W,AT_SD,SIZE32,0,0,0,0,0}, {AM_V,AT_SD,SIZE32,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // divsd
+    { {AM_W,AT_SS,SIZE16,0,0,0,0,0}, {AM_V,AT_SS,SIZE16,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // maxss
+    { {AM_W,AT_SD,SIZE32,0,0,0,0,0}, {AM_V,AT_SD,SIZE32,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // maxsd
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // punpcklbw
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // punpcklwd
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // punpckldq
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,1,0 }, // packsswb
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // pcmpgtb
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // pcmpgtw
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // pcmpgtd
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,1,0 }, // packuswb
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // punpckhbw
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // punpckhwd
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // punpckhdq
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,1,0 }, // packssdw
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // punpcklqdq
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // punpckhqdq
+    { {AM_E,AT_D,SIZE32,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // movd
+    { {AM_E,AT_D,SIZE32,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // movd
+    { {AM_E,AT_QP,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // movq
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // movdqa
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // movdqu
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, 3,0,0,0,0 }, // pshuflw
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, 3,0,0,0,0 }, // pshufhw
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, 3,0,0,0,0 }, // pshufd
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // pcmpeqb
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // pcmpeqw
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // pcmpeqd
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,1 }, // emms
+    { {AM_G,AT_D,SIZE32,0,0,0,0,0}, {AM_E,AT_D,SIZE32,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // vmread
+    { {AM_G,AT_Q,SIZE64,0,0,0,0,0}, {AM_E,AT_Q,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // vmread
+    { {AM_E,AT_D,SIZE32,0,0,0,0,0}, {AM_G,AT_D,SIZE32,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // vmwrite
+    { {AM_E,AT_Q,SIZE64,0,0,0,0,0}, {AM_G,AT_Q,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // vmwrite
+    { {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {AM_E,AT_D,SIZE32,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // movd
+    { {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {AM_E,AT_D,SIZE32,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // movd
+    { {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {AM_E,AT_QP,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // movq
+    { {AM_W,AT_Q,SIZE64,0,0,0,0,0}, {AM_V,AT_Q,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // movq
+    { {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // movdqa
+    { {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // movdqu
+    { {AM_J,AT_VDS,SIZE16|SIZE32,1,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // jo
+    { {AM_J,AT_VDS,SIZE16|SIZE32,1,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // jno
+    { {AM_J,AT_VDS,SIZE16|SIZE32,1,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // jb
+    { {AM_J,AT_VDS,SIZE16|SIZE32,1,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // jnae
+    { {AM_J,AT_VDS,SIZE16|SIZE32,1,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // jc
+    { {AM_J,AT_VDS,SIZE16|SIZE32,1,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // jnb
+    { {AM_J,AT_VDS,SIZE16|SIZE32,1,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // jae
+    { {AM_J,AT_VDS,SIZE16|SIZE32,1,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // jnc
+    { {AM_J,AT_VDS,SIZE16|SIZE32,1,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // jz
+    { {AM_J,AT_VDS,SIZE16|SIZE32,1,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // je
+    { {AM_J,AT_VDS,SIZE16|SIZE32,1,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // jnz
+    { {AM_J,AT_VDS,SIZE16|SIZE32,1,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // jne
+    { {AM_J,AT_VDS,SIZE16|SIZE32,1,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // jbe
+    { {AM_J,AT_VDS,SIZE16|SIZE32,1,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // jna
+    { {AM_J,AT_VDS,SIZE16|SIZE32,1,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // jnbe
+    { {AM_J,AT_VDS,SIZE16|SIZE32,1,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // ja
+    { {AM_J,AT_VDS,SIZE16|SIZE32,1,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // js
+    { {AM_J,AT_VDS,SIZE16|SIZE32,1,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // jns
+    { {AM_J,AT_VDS,SIZE16|SIZE32,1,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // jp
+    { {AM_J,AT_VDS,SIZE16|SIZE32,1,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // jpe
+    { {AM_J,AT_VDS,SIZE16|SIZE32,1,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // jnp
+    { {AM_J,AT_VDS,SIZE16|SIZE32,1,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // jpo
+    { {AM_J,AT_VDS,SIZE16|SIZE32,1,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // jl
+    { {AM_J,AT_VDS,SIZE16|SIZE32,1,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // jnge
+    { {AM_J,AT_VDS,SIZE16|SIZE32,1,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // jnl
+    { {AM_J,AT_VDS,SIZE16|SIZE32,1,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // jge
+    { {AM_J,AT_VDS,SIZE16|SIZE32,1,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // jle
+    { {AM_J,AT_VDS,SIZE16|SIZE32,1,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // jng
+    { {AM_J,AT_VDS,SIZE16|SIZE32,1,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // jnle
+    { {AM_J,AT_VDS,SIZE16|SIZE32,1,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,1,0,0 }, // jg
+    { {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // seto
+    { {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // setno
+    { {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // setb
+    { {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // setnae
+    { {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // setc
+    { {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // setnb
+    { {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // setae
+    { {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // setnc
+    { {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // setz
+    { {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // sete
+    { {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // setnz
+    { {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // setne
+    { {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // setbe
+    { {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // setna
+    { {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // setnbe
+    { {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // seta
+    { {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // sets
+    { {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // setns
+    { {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // setp
+    { {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // setpe
+    { {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // setnp
+    { {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // setpo
+    { {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // setl
+    { {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // setnge
+    { {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // setnl
+    { {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // setge
+    { {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // setle
+    { {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // setng
+    { {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // setnle
+    { {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // setg
+    { {0,AT_W,SIZE16,1,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // push
+    { {0,AT_W,SIZE16,1,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // pop
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // cpuid
+    { {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // bt
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, 3,0,0,0,0 }, // shld
+    { {0,AT_B,SIZE08,0,0,0,1,1}, {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, 3,0,0,0,0 }, // shld
+    { {0,AT_W,SIZE16,1,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // push
+    { {0,AT_W,SIZE16,1,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // pop
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,1,0,0 }, // rsm
+    { {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // bts
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, 3,0,0,0,0 }, // shrd
+    { {0,AT_B,SIZE08,0,0,0,1,1}, {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, 3,0,0,0,0 }, // shrd
+    { {AM_M,AT_D,SIZE32,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // ldmxcsr
+    { {AM_M,AT_D,SIZE32,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // stmxcsr
+    { {AM_M,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // xsave
+    { {AM_M,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // xsave
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // lfence
+    { {AM_M,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // xrstor
+    { {AM_M,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // xrstor
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // mfence
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,0,0,0 }, // sfence
+    { {AM_M,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // clflush
+    { {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // imul
+    { {AM_G,AT_B,SIZE08,0,0,0,0,0}, {AM_E,AT_B,SIZE08,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // cmpxchg
+    { {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // cmpxchg
+    { {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // btr
+    { {AM_E,AT_B,SIZE08,0,0,0,0,0}, {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,1,0 }, // movzx
+    { {AM_E,AT_W,SIZE16,1,0,0,0,0}, {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,1,0 }, // movzx
+    { {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 0,0,1,0,0 }, // jmpe
+    { {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // popcnt
+    { {AM_E,0,0,0,0,0,0,0}, {AM_G,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // ud
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // bt
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // bts
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // btr
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // btc
+    { {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // btc
+    { {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // bsf
+    { {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // bsr
+    { {AM_E,AT_B,SIZE08,0,0,0,0,0}, {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,1,0 }, // movsx
+    { {AM_E,AT_W,SIZE16,1,0,0,0,0}, {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,1,0 }, // movsx
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {AM_W,AT_SS,SIZE16,0,0,0,0,0}, {AM_V,AT_SS,SIZE16,0,0,0,0,0}, 3,0,0,0,0 }, // cmpss
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {AM_W,AT_SD,SIZE32,0,0,0,0,0}, {AM_V,AT_SD,SIZE32,0,0,0,0,0}, 3,0,0,0,0 }, // cmpsd
+    { {AM_G,AT_DQP,SIZE32|SIZE64,0,0,0,0,0}, {AM_M,AT_DQP,SIZE32|SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // movnti
+    { {AM_I,AT_B,SIZE08,0,0,0,0,0}, {AM_M,AT_W,SIZE16,1,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, 3,0,0,0,0 }, // pinsrw
+    { {AM_M,AT_Q,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // cmpxchg8b
+    { {AM_M,AT_Q,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // cmpxchg8b
+    { {AM_M,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // cmpxchg16b
+    { {AM_M,AT_Q,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // vmptrld
+    { {AM_M,AT_Q,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // vmclear
+    { {AM_M,AT_Q,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // vmxon
+    { {AM_M,AT_Q,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // vmptrst
+    { {AM_Z,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 1,0,0,0,0 }, // bswap
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // psrlw
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // psrld
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // psrlq
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // paddq
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // pmullw
+    { {AM_V,AT_Q,SIZE64,0,0,0,0,0}, {AM_W,AT_Q,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // movq
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // psubusb
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // psubusw
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // pminub
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // pand
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // paddusb
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // paddusw
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // pmaxub
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // pandn
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // pavgb
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // psraw
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // psrad
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // pavgw
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // pmulhuw
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // pmulhw
+    { {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {AM_M,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // movntdq
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // psubsb
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // psubsw
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // pminsw
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // por
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // paddsb
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // paddsw
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // pmaxsw
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // pxor
+    { {AM_M,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // lddqu
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // psllw
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // pslld
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // psllq
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // pmuludq
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // pmaddwd
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // psadbw
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // psubb
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // psubw
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // psubd
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // psubq
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // paddb
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // paddw
+    { {AM_W,AT_DQ,SIZE64,0,0,0,0,0}, {AM_V,AT_DQ,SIZE64,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, 2,0,0,0,0 }, // paddd
+};
+
+// Encoding details of opcodes: mnemonic, prefix, 0x0f prefix, primary opcode, secondary opcode,
+// opcode extension, op size, direction, needs mod r/m, default 64 bit
 Opcode opcodes[] = {
-    {
-        "add",
-        0x00,
-        0x00,
-        0x00,
-        0x0,
-        -1,
-        1,
-        {AM_G,AT_B,SIZE08,0,0,0,0,0},
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        0,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "add",
-        0x00,
-        0x00,
-        0x01,
-        0x0,
-        -1,
-        1,
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        0,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "add",
-        0x00,
-        0x00,
-        0x02,
-        0x0,
-        -1,
-        1,
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {AM_G,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "add",
-        0x00,
-        0x00,
-        0x03,
-        0x0,
-        -1,
-        1,
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "add",
-        0x00,
-        0x00,
-        0x04,
-        0x0,
-        -1,
-        0,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {0,AT_B,SIZE08,0,0,0,1,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        1,
-        0,
-        0,
-        0
-    },
-    {
-        "add",
-        0x00,
-        0x00,
-        0x05,
-        0x0,
-        -1,
-        0,
-        {AM_I,AT_VDS,SIZE16|SIZE32,1,0,0,0,0},
-        {0,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,1,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        1,
-        0,
-        0,
-        0
-    },
-    {
-        "or",
-        0x00,
-        0x00,
-        0x08,
-        0x0,
-        -1,
-        1,
-        {AM_G,AT_B,SIZE08,0,0,0,0,0},
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        0,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "or",
-        0x00,
-        0x00,
-        0x09,
-        0x0,
-        -1,
-        1,
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        0,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "or",
-        0x00,
-        0x00,
-        0x0a,
-        0x0,
-        -1,
-        1,
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {AM_G,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "or",
-        0x00,
-        0x00,
-        0x0b,
-        0x0,
-        -1,
-        1,
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "or",
-        0x00,
-        0x00,
-        0x0c,
-        0x0,
-        -1,
-        0,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {0,AT_B,SIZE08,0,0,0,1,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        1,
-        0,
-        0,
-        0
-    },
-    {
-        "or",
-        0x00,
-        0x00,
-        0x0d,
-        0x0,
-        -1,
-        0,
-        {AM_I,AT_VDS,SIZE16|SIZE32,1,0,0,0,0},
-        {0,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,1,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        1,
-        0,
-        0,
-        0
-    },
-    {
-        "pop",
-        0x00,
-        0x00,
-        0x0f,
-        0x0,
-        -1,
-        0,
-        {0,AT_W,SIZE16,1,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "adc",
-        0x00,
-        0x00,
-        0x10,
-        0x0,
-        -1,
-        1,
-        {AM_G,AT_B,SIZE08,0,0,0,0,0},
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        0,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "adc",
-        0x00,
-        0x00,
-        0x11,
-        0x0,
-        -1,
-        1,
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        0,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "adc",
-        0x00,
-        0x00,
-        0x12,
-        0x0,
-        -1,
-        1,
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {AM_G,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "adc",
-        0x00,
-        0x00,
-        0x13,
-        0x0,
-        -1,
-        1,
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "adc",
-        0x00,
-        0x00,
-        0x14,
-        0x0,
-        -1,
-        0,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {0,AT_B,SIZE08,0,0,0,1,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        1,
-        0,
-        0,
-        0
-    },
-    {
-        "adc",
-        0x00,
-        0x00,
-        0x15,
-        0x0,
-        -1,
-        0,
-        {AM_I,AT_VDS,SIZE16|SIZE32,1,0,0,0,0},
-        {0,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,1,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        1,
-        0,
-        0,
-        0
-    },
-    {
-        "sbb",
-        0x00,
-        0x00,
-        0x18,
-        0x0,
-        -1,
-        1,
-        {AM_G,AT_B,SIZE08,0,0,0,0,0},
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        0,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "sbb",
-        0x00,
-        0x00,
-        0x19,
-        0x0,
-        -1,
-        1,
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        0,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "sbb",
-        0x00,
-        0x00,
-        0x1a,
-        0x0,
-        -1,
-        1,
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {AM_G,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "sbb",
-        0x00,
-        0x00,
-        0x1b,
-        0x0,
-        -1,
-        1,
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "sbb",
-        0x00,
-        0x00,
-        0x1c,
-        0x0,
-        -1,
-        0,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {0,AT_B,SIZE08,0,0,0,1,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        1,
-        0,
-        0,
-        0
-    },
-    {
-        "sbb",
-        0x00,
-        0x00,
-        0x1d,
-        0x0,
-        -1,
-        0,
-        {AM_I,AT_VDS,SIZE16|SIZE32,1,0,0,0,0},
-        {0,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,1,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        1,
-        0,
-        0,
-        0
-    },
-    {
-        "and",
-        0x00,
-        0x00,
-        0x20,
-        0x0,
-        -1,
-        1,
-        {AM_G,AT_B,SIZE08,0,0,0,0,0},
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        0,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "and",
-        0x00,
-        0x00,
-        0x21,
-        0x0,
-        -1,
-        1,
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        0,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "and",
-        0x00,
-        0x00,
-        0x22,
-        0x0,
-        -1,
-        1,
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {AM_G,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "and",
-        0x00,
-        0x00,
-        0x23,
-        0x0,
-        -1,
-        1,
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "and",
-        0x00,
-        0x00,
-        0x24,
-        0x0,
-        -1,
-        0,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {0,AT_B,SIZE08,0,0,0,1,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        1,
-        0,
-        0,
-        0
-    },
-    {
-        "and",
-        0x00,
-        0x00,
-        0x25,
-        0x0,
-        -1,
-        0,
-        {AM_I,AT_VDS,SIZE16|SIZE32,1,0,0,0,0},
-        {0,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,1,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        1,
-        0,
-        0,
-        0
-    },
-    {
-        "es",
-        0x00,
-        0x00,
-        0x26,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "sub",
-        0x00,
-        0x00,
-        0x28,
-        0x0,
-        -1,
-        1,
-        {AM_G,AT_B,SIZE08,0,0,0,0,0},
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        0,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "sub",
-        0x00,
-        0x00,
-        0x29,
-        0x0,
-        -1,
-        1,
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        0,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "sub",
-        0x00,
-        0x00,
-        0x2a,
-        0x0,
-        -1,
-        1,
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {AM_G,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "sub",
-        0x00,
-        0x00,
-        0x2b,
-        0x0,
-        -1,
-        1,
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "sub",
-        0x00,
-        0x00,
-        0x2c,
-        0x0,
-        -1,
-        0,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {0,AT_B,SIZE08,0,0,0,1,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        1,
-        0,
-        0,
-        0
-    },
-    {
-        "sub",
-        0x00,
-        0x00,
-        0x2d,
-        0x0,
-        -1,
-        0,
-        {AM_I,AT_VDS,SIZE16|SIZE32,1,0,0,0,0},
-        {0,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,1,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        1,
-        0,
-        0,
-        0
-    },
-    {
-        "cs",
-        0x00,
-        0x00,
-        0x2e,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "ntaken",
-        0x00,
-        0x00,
-        0x2e,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "xor",
-        0x00,
-        0x00,
-        0x30,
-        0x0,
-        -1,
-        1,
-        {AM_G,AT_B,SIZE08,0,0,0,0,0},
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        0,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "xor",
-        0x00,
-        0x00,
-        0x31,
-        0x0,
-        -1,
-        1,
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        0,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "xor",
-        0x00,
-        0x00,
-        0x32,
-        0x0,
-        -1,
-        1,
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {AM_G,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "xor",
-        0x00,
-        0x00,
-        0x33,
-        0x0,
-        -1,
-        1,
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "xor",
-        0x00,
-        0x00,
-        0x34,
-        0x0,
-        -1,
-        0,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {0,AT_B,SIZE08,0,0,0,1,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        1,
-        0,
-        0,
-        0
-    },
-    {
-        "xor",
-        0x00,
-        0x00,
-        0x35,
-        0x0,
-        -1,
-        0,
-        {AM_I,AT_VDS,SIZE16|SIZE32,1,0,0,0,0},
-        {0,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,1,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        1,
-        0,
-        0,
-        0
-    },
-    {
-        "ss",
-        0x00,
-        0x00,
-        0x36,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "cmp",
-        0x00,
-        0x00,
-        0x38,
-        0x0,
-        -1,
-        1,
-        {AM_G,AT_B,SIZE08,0,0,0,0,0},
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        0,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "cmp",
-        0x00,
-        0x00,
-        0x39,
-        0x0,
-        -1,
-        1,
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        0,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "cmp",
-        0x00,
-        0x00,
-        0x3a,
-        0x0,
-        -1,
-        1,
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {AM_G,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "cmp",
-        0x00,
-        0x00,
-        0x3b,
-        0x0,
-        -1,
-        1,
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "cmp",
-        0x00,
-        0x00,
-        0x3c,
-        0x0,
-        -1,
-        0,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {0,AT_B,SIZE08,0,0,0,1,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        1,
-        0,
-        0,
-        0
-    },
-    {
-        "cmp",
-        0x00,
-        0x00,
-        0x3d,
-        0x0,
-        -1,
-        0,
-        {AM_I,AT_VDS,SIZE16|SIZE32,1,0,0,0,0},
-        {0,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,1,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        1,
-        0,
-        0,
-        0
-    },
-    {
-        "ds",
-        0x00,
-        0x00,
-        0x3e,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "taken",
-        0x00,
-        0x00,
-        0x3e,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "inc",
-        0x00,
-        0x00,
-        0x40,
-        0x0,
-        -1,
-        0,
-        {AM_Z,AT_V,SIZE16|SIZE32,1,0,1,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "rex",
-        0x00,
-        0x00,
-        0x40,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "rex.b",
-        0x00,
-        0x00,
-        0x41,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "rex.x",
-        0x00,
-        0x00,
-        0x42,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "rex.xb",
-        0x00,
-        0x00,
-        0x43,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "rex.r",
-        0x00,
-        0x00,
-        0x44,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "rex.rb",
-        0x00,
-        0x00,
-        0x45,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "rex.rx",
-        0x00,
-        0x00,
-        0x46,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "rex.rxb",
-        0x00,
-        0x00,
-        0x47,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "dec",
-        0x00,
-        0x00,
-        0x48,
-        0x0,
-        -1,
-        0,
-        {AM_Z,AT_V,SIZE16|SIZE32,1,0,1,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "rex.w",
-        0x00,
-        0x00,
-        0x48,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "rex.wb",
-        0x00,
-        0x00,
-        0x49,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "rex.wx",
-        0x00,
-        0x00,
-        0x4a,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "rex.wxb",
-        0x00,
-        0x00,
-        0x4b,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "rex.wr",
-        0x00,
-        0x00,
-        0x4c,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "rex.wrb",
-        0x00,
-        0x00,
-        0x4d,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "rex.wrx",
-        0x00,
-        0x00,
-        0x4e,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "rex.wrxb",
-        0x00,
-        0x00,
-        0x4f,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "push",
-        0x00,
-        0x00,
-        0x50,
-        0x0,
-        -1,
-        0,
-        {AM_Z,AT_V,SIZE16|SIZE32,1,0,1,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "push",
-        0x00,
-        0x00,
-        0x50,
-        0x0,
-        -1,
-        0,
-        {AM_Z,AT_VQ,SIZE16|SIZE64,1,0,1,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "pop",
-        0x00,
-        0x00,
-        0x58,
-        0x0,
-        -1,
-        0,
-        {AM_Z,AT_V,SIZE16|SIZE32,1,0,1,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "pop",
-        0x00,
-        0x00,
-        0x58,
-        0x0,
-        -1,
-        0,
-        {AM_Z,AT_VQ,SIZE16|SIZE64,1,0,1,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "arpl",
-        0x00,
-        0x00,
-        0x63,
-        0x0,
-        -1,
-        1,
-        {AM_G,AT_W,SIZE16,1,0,0,0,0},
-        {AM_E,AT_W,SIZE16,1,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "movsxd",
-        0x00,
-        0x00,
-        0x63,
-        0x0,
-        -1,
-        1,
-        {AM_E,AT_D,SIZE32,0,0,0,0,0},
-        {AM_G,AT_DQP,SIZE32|SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        1,
-        0,
-        0,
-        1,
-        0
-    },
-    {
-        "fs",
-        0x00,
-        0x00,
-        0x64,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "alter",
-        0x00,
-        0x00,
-        0x64,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "gs",
-        0x00,
-        0x00,
-        0x65,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "push",
-        0x00,
-        0x00,
-        0x68,
-        0x0,
-        -1,
-        0,
-        {AM_I,AT_VS,SIZE16|SIZE32,1,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "imul",
-        0x00,
-        0x00,
-        0x69,
-        0x0,
-        -1,
-        1,
-        {AM_I,AT_VDS,SIZE16|SIZE32,1,0,0,0,0},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "push",
-        0x00,
-        0x00,
-        0x6a,
-        0x0,
-        -1,
-        0,
-        {AM_I,AT_BSS,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "imul",
-        0x00,
-        0x00,
-        0x6b,
-        0x0,
-        -1,
-        1,
-        {AM_I,AT_BS,SIZE08,0,0,0,0,0},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "ins",
-        0x00,
-        0x00,
-        0x6c,
-        0x0,
-        -1,
-        0,
-        {0,AT_W,SIZE16,1,0,0,1,2},
-        {0,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "insb",
-        0x00,
-        0x00,
-        0x6c,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "insw",
-        0x00,
-        0x00,
-        0x6d,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "ins",
-        0x00,
-        0x00,
-        0x6d,
-        0x0,
-        -1,
-        0,
-        {0,AT_W,SIZE16,1,0,0,1,2},
-        {0,AT_V,SIZE16|SIZE32,1,0,1,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "insd",
-        0x00,
-        0x00,
-        0x6d,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "outs",
-        0x00,
-        0x00,
-        0x6e,
-        0x0,
-        -1,
-        0,
-        {0,AT_B,SIZE08,0,0,0,0,0},
-        {0,AT_W,SIZE16,1,0,0,1,2},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "outsb",
-        0x00,
-        0x00,
-        0x6e,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "outsw",
-        0x00,
-        0x00,
-        0x6f,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "outs",
-        0x00,
-        0x00,
-        0x6f,
-        0x0,
-        -1,
-        0,
-        {0,AT_V,SIZE16|SIZE32,1,0,1,0,0},
-        {0,AT_W,SIZE16,1,0,0,1,2},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "outsd",
-        0x00,
-        0x00,
-        0x6f,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "jo",
-        0x00,
-        0x00,
-        0x70,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_BS,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "jno",
-        0x00,
-        0x00,
-        0x71,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_BS,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "jb",
-        0x00,
-        0x00,
-        0x72,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_BS,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "jnae",
-        0x00,
-        0x00,
-        0x72,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_BS,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "jc",
-        0x00,
-        0x00,
-        0x72,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_BS,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "jnb",
-        0x00,
-        0x00,
-        0x73,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_BS,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "jae",
-        0x00,
-        0x00,
-        0x73,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_BS,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "jnc",
-        0x00,
-        0x00,
-        0x73,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_BS,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "jz",
-        0x00,
-        0x00,
-        0x74,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_BS,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "je",
-        0x00,
-        0x00,
-        0x74,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_BS,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "jnz",
-        0x00,
-        0x00,
-        0x75,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_BS,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "jne",
-        0x00,
-        0x00,
-        0x75,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_BS,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "jbe",
-        0x00,
-        0x00,
-        0x76,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_BS,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "jna",
-        0x00,
-        0x00,
-        0x76,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_BS,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "jnbe",
-        0x00,
-        0x00,
-        0x77,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_BS,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "ja",
-        0x00,
-        0x00,
-        0x77,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_BS,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "js",
-        0x00,
-        0x00,
-        0x78,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_BS,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "jns",
-        0x00,
-        0x00,
-        0x79,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_BS,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "jp",
-        0x00,
-        0x00,
-        0x7a,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_BS,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "jpe",
-        0x00,
-        0x00,
-        0x7a,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_BS,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "jnp",
-        0x00,
-        0x00,
-        0x7b,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_BS,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "jpo",
-        0x00,
-        0x00,
-        0x7b,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_BS,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "jl",
-        0x00,
-        0x00,
-        0x7c,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_BS,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "jnge",
-        0x00,
-        0x00,
-        0x7c,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_BS,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "jnl",
-        0x00,
-        0x00,
-        0x7d,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_BS,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "jge",
-        0x00,
-        0x00,
-        0x7d,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_BS,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "jle",
-        0x00,
-        0x00,
-        0x7e,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_BS,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "jng",
-        0x00,
-        0x00,
-        0x7e,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_BS,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "jnle",
-        0x00,
-        0x00,
-        0x7f,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_BS,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "jg",
-        0x00,
-        0x00,
-        0x7f,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_BS,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "add",
-        0x00,
-        0x00,
-        0x80,
-        0x0,
-        0,
-        0,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "or",
-        0x00,
-        0x00,
-        0x80,
-        0x0,
-        1,
-        0,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "adc",
-        0x00,
-        0x00,
-        0x80,
-        0x0,
-        2,
-        0,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "sbb",
-        0x00,
-        0x00,
-        0x80,
-        0x0,
-        3,
-        0,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "and",
-        0x00,
-        0x00,
-        0x80,
-        0x0,
-        4,
-        0,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "sub",
-        0x00,
-        0x00,
-        0x80,
-        0x0,
-        5,
-        0,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "xor",
-        0x00,
-        0x00,
-        0x80,
-        0x0,
-        6,
-        0,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "cmp",
-        0x00,
-        0x00,
-        0x80,
-        0x0,
-        7,
-        0,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "add",
-        0x00,
-        0x00,
-        0x81,
-        0x0,
-        0,
-        0,
-        {AM_I,AT_VDS,SIZE16|SIZE32,1,0,0,0,0},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "or",
-        0x00,
-        0x00,
-        0x81,
-        0x0,
-        1,
-        0,
-        {AM_I,AT_VDS,SIZE16|SIZE32,1,0,0,0,0},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "adc",
-        0x00,
-        0x00,
-        0x81,
-        0x0,
-        2,
-        0,
-        {AM_I,AT_VDS,SIZE16|SIZE32,1,0,0,0,0},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "sbb",
-        0x00,
-        0x00,
-        0x81,
-        0x0,
-        3,
-        0,
-        {AM_I,AT_VDS,SIZE16|SIZE32,1,0,0,0,0},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "and",
-        0x00,
-        0x00,
-        0x81,
-        0x0,
-        4,
-        0,
-        {AM_I,AT_VDS,SIZE16|SIZE32,1,0,0,0,0},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "sub",
-        0x00,
-        0x00,
-        0x81,
-        0x0,
-        5,
-        0,
-        {AM_I,AT_VDS,SIZE16|SIZE32,1,0,0,0,0},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "xor",
-        0x00,
-        0x00,
-        0x81,
-        0x0,
-        6,
-        0,
-        {AM_I,AT_VDS,SIZE16|SIZE32,1,0,0,0,0},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "cmp",
-        0x00,
-        0x00,
-        0x81,
-        0x0,
-        7,
-        0,
-        {AM_I,AT_VDS,SIZE16|SIZE32,1,0,0,0,0},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "add",
-        0x00,
-        0x00,
-        0x83,
-        0x0,
-        0,
-        0,
-        {AM_I,AT_BS,SIZE08,0,0,0,0,0},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "or",
-        0x00,
-        0x00,
-        0x83,
-        0x0,
-        1,
-        0,
-        {AM_I,AT_BS,SIZE08,0,0,0,0,0},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "adc",
-        0x00,
-        0x00,
-        0x83,
-        0x0,
-        2,
-        0,
-        {AM_I,AT_BS,SIZE08,0,0,0,0,0},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "sbb",
-        0x00,
-        0x00,
-        0x83,
-        0x0,
-        3,
-        0,
-        {AM_I,AT_BS,SIZE08,0,0,0,0,0},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "and",
-        0x00,
-        0x00,
-        0x83,
-        0x0,
-        4,
-        0,
-        {AM_I,AT_BS,SIZE08,0,0,0,0,0},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "sub",
-        0x00,
-        0x00,
-        0x83,
-        0x0,
-        5,
-        0,
-        {AM_I,AT_BS,SIZE08,0,0,0,0,0},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "xor",
-        0x00,
-        0x00,
-        0x83,
-        0x0,
-        6,
-        0,
-        {AM_I,AT_BS,SIZE08,0,0,0,0,0},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "cmp",
-        0x00,
-        0x00,
-        0x83,
-        0x0,
-        7,
-        0,
-        {AM_I,AT_BS,SIZE08,0,0,0,0,0},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "test",
-        0x00,
-        0x00,
-        0x84,
-        0x0,
-        -1,
-        1,
-        {AM_G,AT_B,SIZE08,0,0,0,0,0},
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        0,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "test",
-        0x00,
-        0x00,
-        0x85,
-        0x0,
-        -1,
-        1,
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        0,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "mov",
-        0x00,
-        0x00,
-        0x88,
-        0x0,
-        -1,
-        1,
-        {AM_G,AT_B,SIZE08,0,0,0,0,0},
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        0,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "mov",
-        0x00,
-        0x00,
-        0x89,
-        0x0,
-        -1,
-        1,
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        0,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "mov",
-        0x00,
-        0x00,
-        0x8a,
-        0x0,
-        -1,
-        1,
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {AM_G,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "mov",
-        0x00,
-        0x00,
-        0x8b,
-        0x0,
-        -1,
-        1,
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "lea",
-        0x00,
-        0x00,
-        0x8d,
-        0x0,
-        -1,
-        1,
-        {AM_M,0,0,0,0,0,0,0},
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "pop",
-        0x00,
-        0x00,
-        0x8f,
-        0x0,
-        0,
-        0,
-        {AM_E,AT_V,SIZE16|SIZE32,1,0,1,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "pop",
-        0x00,
-        0x00,
-        0x8f,
-        0x0,
-        0,
-        0,
-        {AM_E,AT_VQ,SIZE16|SIZE64,1,0,1,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "nop",
-        0x00,
-        0x00,
-        0x90,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "nop",
-        0xf3,
-        0x00,
-        0x90,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "pause",
-        0xf3,
-        0x00,
-        0x90,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "cbw",
-        0x00,
-        0x00,
-        0x98,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        1,
-        0
-    },
-    {
-        "cwde",
-        0x00,
-        0x00,
-        0x98,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        1,
-        0
-    },
-    {
-        "cbw",
-        0x00,
-        0x00,
-        0x98,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        1,
-        0
-    },
-    {
-        "cwde",
-        0x00,
-        0x00,
-        0x98,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        1,
-        0
-    },
-    {
-        "cdqe",
-        0x00,
-        0x00,
-        0x98,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        1,
-        0
-    },
-    {
-        "cwd",
-        0x00,
-        0x00,
-        0x99,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        1,
-        0
-    },
-    {
-        "cdq",
-        0x00,
-        0x00,
-        0x99,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        1,
-        0
-    },
-    {
-        "cwd",
-        0x00,
-        0x00,
-        0x99,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        1,
-        0
-    },
-    {
-        "cdq",
-        0x00,
-        0x00,
-        0x99,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        1,
-        0
-    },
-    {
-        "cqo",
-        0x00,
-        0x00,
-        0x99,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        1,
-        0
-    },
-    {
-        "fwait",
-        0x00,
-        0x00,
-        0x9b,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "wait",
-        0x00,
-        0x00,
-        0x9b,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "pushf",
-        0x00,
-        0x00,
-        0x9c,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "pushfd",
-        0x00,
-        0x00,
-        0x9c,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "pushf",
-        0x00,
-        0x00,
-        0x9c,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "pushfq",
-        0x00,
-        0x00,
-        0x9c,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "popf",
-        0x00,
-        0x00,
-        0x9d,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "popfd",
-        0x00,
-        0x00,
-        0x9d,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "popf",
-        0x00,
-        0x00,
-        0x9d,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "popfq",
-        0x00,
-        0x00,
-        0x9d,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "sahf",
-        0x00,
-        0x00,
-        0x9e,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "lahf",
-        0x00,
-        0x00,
-        0x9f,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "movs",
-        0x00,
-        0x00,
-        0xa4,
-        0x0,
-        -1,
-        0,
-        {0,AT_B,SIZE08,0,0,0,0,0},
-        {0,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "movsb",
-        0x00,
-        0x00,
-        0xa4,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "movsw",
-        0x00,
-        0x00,
-        0xa5,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "movs",
-        0x00,
-        0x00,
-        0xa5,
-        0x0,
-        -1,
-        0,
-        {0,AT_V,SIZE16|SIZE32,1,0,1,0,0},
-        {0,AT_V,SIZE16|SIZE32,1,0,1,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "movsd",
-        0x00,
-        0x00,
-        0xa5,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "movs",
-        0x00,
-        0x00,
-        0xa5,
-        0x0,
-        -1,
-        0,
-        {0,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "movsw",
-        0x00,
-        0x00,
-        0xa5,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "movsd",
-        0x00,
-        0x00,
-        0xa5,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "movsq",
-        0x00,
-        0x00,
-        0xa5,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "cmps",
-        0x00,
-        0x00,
-        0xa6,
-        0x0,
-        -1,
-        0,
-        {0,AT_B,SIZE08,0,0,0,0,0},
-        {0,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "cmpsb",
-        0x00,
-        0x00,
-        0xa6,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "cmpsw",
-        0x00,
-        0x00,
-        0xa7,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "cmps",
-        0x00,
-        0x00,
-        0xa7,
-        0x0,
-        -1,
-        0,
-        {0,AT_V,SIZE16|SIZE32,1,0,1,0,0},
-        {0,AT_V,SIZE16|SIZE32,1,0,1,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "cmpsd",
-        0x00,
-        0x00,
-        0xa7,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "cmps",
-        0x00,
-        0x00,
-        0xa7,
-        0x0,
-        -1,
-        0,
-        {0,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "cmpsw",
-        0x00,
-        0x00,
-        0xa7,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "cmpsd",
-        0x00,
-        0x00,
-        0xa7,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "cmpsq",
-        0x00,
-        0x00,
-        0xa7,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "test",
-        0x00,
-        0x00,
-        0xa8,
-        0x0,
-        -1,
-        0,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {0,AT_B,SIZE08,0,0,0,1,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        1,
-        0,
-        0,
-        0
-    },
-    {
-        "test",
-        0x00,
-        0x00,
-        0xa9,
-        0x0,
-        -1,
-        0,
-        {AM_I,AT_VDS,SIZE16|SIZE32,1,0,0,0,0},
-        {0,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,1,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        1,
-        0,
-        0,
-        0
-    },
-    {
-        "stos",
-        0x00,
-        0x00,
-        0xaa,
-        0x0,
-        -1,
-        0,
-        {0,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "stosb",
-        0x00,
-        0x00,
-        0xaa,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "stosw",
-        0x00,
-        0x00,
-        0xab,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "stos",
-        0x00,
-        0x00,
-        0xab,
-        0x0,
-        -1,
-        0,
-        {0,AT_V,SIZE16|SIZE32,1,0,1,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "stosd",
-        0x00,
-        0x00,
-        0xab,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "stos",
-        0x00,
-        0x00,
-        0xab,
-        0x0,
-        -1,
-        0,
-        {0,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "stosw",
-        0x00,
-        0x00,
-        0xab,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "stosd",
-        0x00,
-        0x00,
-        0xab,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "stosq",
-        0x00,
-        0x00,
-        0xab,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "lods",
-        0x00,
-        0x00,
-        0xac,
-        0x0,
-        -1,
-        0,
-        {0,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "lodsb",
-        0x00,
-        0x00,
-        0xac,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "lodsw",
-        0x00,
-        0x00,
-        0xad,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "lods",
-        0x00,
-        0x00,
-        0xad,
-        0x0,
-        -1,
-        0,
-        {0,AT_V,SIZE16|SIZE32,1,0,1,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "lodsd",
-        0x00,
-        0x00,
-        0xad,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "lods",
-        0x00,
-        0x00,
-        0xad,
-        0x0,
-        -1,
-        0,
-        {0,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "lodsw",
-        0x00,
-        0x00,
-        0xad,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "lodsd",
-        0x00,
-        0x00,
-        0xad,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "lodsq",
-        0x00,
-        0x00,
-        0xad,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "scas",
-        0x00,
-        0x00,
-        0xae,
-        0x0,
-        -1,
-        0,
-        {0,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "scasb",
-        0x00,
-        0x00,
-        0xae,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "scasw",
-        0x00,
-        0x00,
-        0xaf,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "scas",
-        0x00,
-        0x00,
-        0xaf,
-        0x0,
-        -1,
-        0,
-        {0,AT_V,SIZE16|SIZE32,1,0,1,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "scasd",
-        0x00,
-        0x00,
-        0xaf,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "scas",
-        0x00,
-        0x00,
-        0xaf,
-        0x0,
-        -1,
-        0,
-        {0,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "scasw",
-        0x00,
-        0x00,
-        0xaf,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "scasd",
-        0x00,
-        0x00,
-        0xaf,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "scasq",
-        0x00,
-        0x00,
-        0xaf,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "mov",
-        0x00,
-        0x00,
-        0xb0,
-        0x0,
-        -1,
-        0,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {AM_Z,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "mov",
-        0x00,
-        0x00,
-        0xb8,
-        0x0,
-        -1,
-        0,
-        {AM_I,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_Z,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "rol",
-        0x00,
-        0x00,
-        0xc0,
-        0x0,
-        0,
-        0,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "ror",
-        0x00,
-        0x00,
-        0xc0,
-        0x0,
-        1,
-        0,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "rcl",
-        0x00,
-        0x00,
-        0xc0,
-        0x0,
-        2,
-        0,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "rcr",
-        0x00,
-        0x00,
-        0xc0,
-        0x0,
-        3,
-        0,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "shl",
-        0x00,
-        0x00,
-        0xc0,
-        0x0,
-        4,
-        0,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "sal",
-        0x00,
-        0x00,
-        0xc0,
-        0x0,
-        4,
-        0,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "shr",
-        0x00,
-        0x00,
-        0xc0,
-        0x0,
-        5,
-        0,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "sal",
-        0x00,
-        0x00,
-        0xc0,
-        0x0,
-        6,
-        0,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "shl",
-        0x00,
-        0x00,
-        0xc0,
-        0x0,
-        6,
-        0,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "sar",
-        0x00,
-        0x00,
-        0xc0,
-        0x0,
-        7,
-        0,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "rol",
-        0x00,
-        0x00,
-        0xc1,
-        0x0,
-        0,
-        0,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "ror",
-        0x00,
-        0x00,
-        0xc1,
-        0x0,
-        1,
-        0,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "rcl",
-        0x00,
-        0x00,
-        0xc1,
-        0x0,
-        2,
-        0,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "rcr",
-        0x00,
-        0x00,
-        0xc1,
-        0x0,
-        3,
-        0,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "shl",
-        0x00,
-        0x00,
-        0xc1,
-        0x0,
-        4,
-        0,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "sal",
-        0x00,
-        0x00,
-        0xc1,
-        0x0,
-        4,
-        0,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "shr",
-        0x00,
-        0x00,
-        0xc1,
-        0x0,
-        5,
-        0,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "sal",
-        0x00,
-        0x00,
-        0xc1,
-        0x0,
-        6,
-        0,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "shl",
-        0x00,
-        0x00,
-        0xc1,
-        0x0,
-        6,
-        0,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "sar",
-        0x00,
-        0x00,
-        0xc1,
-        0x0,
-        7,
-        0,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "retn",
-        0x00,
-        0x00,
-        0xc2,
-        0x0,
-        -1,
-        0,
-        {AM_I,AT_W,SIZE16,1,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "retn",
-        0x00,
-        0x00,
-        0xc3,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "mov",
-        0x00,
-        0x00,
-        0xc6,
-        0x0,
-        0,
-        0,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "mov",
-        0x00,
-        0x00,
-        0xc7,
-        0x0,
-        0,
-        0,
-        {AM_I,AT_VDS,SIZE16|SIZE32,1,0,0,0,0},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "enter",
-        0x00,
-        0x00,
-        0xc8,
-        0x0,
-        -1,
-        0,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {AM_I,AT_W,SIZE16,1,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "enter",
-        0x00,
-        0x00,
-        0xc8,
-        0x0,
-        -1,
-        0,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {AM_I,AT_W,SIZE16,1,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "leave",
-        0x00,
-        0x00,
-        0xc9,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "leave",
-        0x00,
-        0x00,
-        0xc9,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "retf",
-        0x00,
-        0x00,
-        0xca,
-        0x0,
-        -1,
-        0,
-        {AM_I,AT_W,SIZE16,1,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "retf",
-        0x00,
-        0x00,
-        0xcb,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "int",
-        0x00,
-        0x00,
-        0xcc,
-        0x0,
-        -1,
-        0,
-        {AM_I,AT_1,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "int",
-        0x00,
-        0x00,
-        0xcd,
-        0x0,
-        -1,
-        0,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "into",
-        0x00,
-        0x00,
-        0xce,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "iret",
-        0x00,
-        0x00,
-        0xcf,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "iretd",
-        0x00,
-        0x00,
-        0xcf,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "iret",
-        0x00,
-        0x00,
-        0xcf,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "iretd",
-        0x00,
-        0x00,
-        0xcf,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "iretq",
-        0x00,
-        0x00,
-        0xcf,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "rol",
-        0x00,
-        0x00,
-        0xd0,
-        0x0,
-        0,
-        0,
-        {AM_I,AT_1,SIZE08,0,0,0,0,0},
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "ror",
-        0x00,
-        0x00,
-        0xd0,
-        0x0,
-        1,
-        0,
-        {AM_I,AT_1,SIZE08,0,0,0,0,0},
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "rcl",
-        0x00,
-        0x00,
-        0xd0,
-        0x0,
-        2,
-        0,
-        {AM_I,AT_1,SIZE08,0,0,0,0,0},
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "rcr",
-        0x00,
-        0x00,
-        0xd0,
-        0x0,
-        3,
-        0,
-        {AM_I,AT_1,SIZE08,0,0,0,0,0},
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "shl",
-        0x00,
-        0x00,
-        0xd0,
-        0x0,
-        4,
-        0,
-        {AM_I,AT_1,SIZE08,0,0,0,0,0},
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "sal",
-        0x00,
-        0x00,
-        0xd0,
-        0x0,
-        4,
-        0,
-        {AM_I,AT_1,SIZE08,0,0,0,0,0},
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "shr",
-        0x00,
-        0x00,
-        0xd0,
-        0x0,
-        5,
-        0,
-        {AM_I,AT_1,SIZE08,0,0,0,0,0},
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "sal",
-        0x00,
-        0x00,
-        0xd0,
-        0x0,
-        6,
-        0,
-        {AM_I,AT_1,SIZE08,0,0,0,0,0},
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "shl",
-        0x00,
-        0x00,
-        0xd0,
-        0x0,
-        6,
-        0,
-        {AM_I,AT_1,SIZE08,0,0,0,0,0},
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "sar",
-        0x00,
-        0x00,
-        0xd0,
-        0x0,
-        7,
-        0,
-        {AM_I,AT_1,SIZE08,0,0,0,0,0},
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "rol",
-        0x00,
-        0x00,
-        0xd1,
-        0x0,
-        0,
-        0,
-        {AM_I,AT_1,SIZE08,0,0,0,0,0},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "ror",
-        0x00,
-        0x00,
-        0xd1,
-        0x0,
-        1,
-        0,
-        {AM_I,AT_1,SIZE08,0,0,0,0,0},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "rcl",
-        0x00,
-        0x00,
-        0xd1,
-        0x0,
-        2,
-        0,
-        {AM_I,AT_1,SIZE08,0,0,0,0,0},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "rcr",
-        0x00,
-        0x00,
-        0xd1,
-        0x0,
-        3,
-        0,
-        {AM_I,AT_1,SIZE08,0,0,0,0,0},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "shl",
-        0x00,
-        0x00,
-        0xd1,
-        0x0,
-        4,
-        0,
-        {AM_I,AT_1,SIZE08,0,0,0,0,0},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "sal",
-        0x00,
-        0x00,
-        0xd1,
-        0x0,
-        4,
-        0,
-        {AM_I,AT_1,SIZE08,0,0,0,0,0},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "shr",
-        0x00,
-        0x00,
-        0xd1,
-        0x0,
-        5,
-        0,
-        {AM_I,AT_1,SIZE08,0,0,0,0,0},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "sal",
-        0x00,
-        0x00,
-        0xd1,
-        0x0,
-        6,
-        0,
-        {AM_I,AT_1,SIZE08,0,0,0,0,0},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "shl",
-        0x00,
-        0x00,
-        0xd1,
-        0x0,
-        6,
-        0,
-        {AM_I,AT_1,SIZE08,0,0,0,0,0},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "sar",
-        0x00,
-        0x00,
-        0xd1,
-        0x0,
-        7,
-        0,
-        {AM_I,AT_1,SIZE08,0,0,0,0,0},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "rol",
-        0x00,
-        0x00,
-        0xd2,
-        0x0,
-        0,
-        0,
-        {0,AT_B,SIZE08,0,0,0,1,1},
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "ror",
-        0x00,
-        0x00,
-        0xd2,
-        0x0,
-        1,
-        0,
-        {0,AT_B,SIZE08,0,0,0,1,1},
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "rcl",
-        0x00,
-        0x00,
-        0xd2,
-        0x0,
-        2,
-        0,
-        {0,AT_B,SIZE08,0,0,0,1,1},
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "rcr",
-        0x00,
-        0x00,
-        0xd2,
-        0x0,
-        3,
-        0,
-        {0,AT_B,SIZE08,0,0,0,1,1},
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "shl",
-        0x00,
-        0x00,
-        0xd2,
-        0x0,
-        4,
-        0,
-        {0,AT_B,SIZE08,0,0,0,1,1},
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "sal",
-        0x00,
-        0x00,
-        0xd2,
-        0x0,
-        4,
-        0,
-        {0,AT_B,SIZE08,0,0,0,1,1},
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "shr",
-        0x00,
-        0x00,
-        0xd2,
-        0x0,
-        5,
-        0,
-        {0,AT_B,SIZE08,0,0,0,1,1},
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "sal",
-        0x00,
-        0x00,
-        0xd2,
-        0x0,
-        6,
-        0,
-        {0,AT_B,SIZE08,0,0,0,1,1},
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "shl",
-        0x00,
-        0x00,
-        0xd2,
-        0x0,
-        6,
-        0,
-        {0,AT_B,SIZE08,0,0,0,1,1},
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "sar",
-        0x00,
-        0x00,
-        0xd2,
-        0x0,
-        7,
-        0,
-        {0,AT_B,SIZE08,0,0,0,1,1},
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "rol",
-        0x00,
-        0x00,
-        0xd3,
-        0x0,
-        0,
-        0,
-        {0,AT_B,SIZE08,0,0,0,1,1},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "ror",
-        0x00,
-        0x00,
-        0xd3,
-        0x0,
-        1,
-        0,
-        {0,AT_B,SIZE08,0,0,0,1,1},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "rcl",
-        0x00,
-        0x00,
-        0xd3,
-        0x0,
-        2,
-        0,
-        {0,AT_B,SIZE08,0,0,0,1,1},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "rcr",
-        0x00,
-        0x00,
-        0xd3,
-        0x0,
-        3,
-        0,
-        {0,AT_B,SIZE08,0,0,0,1,1},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "shl",
-        0x00,
-        0x00,
-        0xd3,
-        0x0,
-        4,
-        0,
-        {0,AT_B,SIZE08,0,0,0,1,1},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "sal",
-        0x00,
-        0x00,
-        0xd3,
-        0x0,
-        4,
-        0,
-        {0,AT_B,SIZE08,0,0,0,1,1},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "shr",
-        0x00,
-        0x00,
-        0xd3,
-        0x0,
-        5,
-        0,
-        {0,AT_B,SIZE08,0,0,0,1,1},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "sal",
-        0x00,
-        0x00,
-        0xd3,
-        0x0,
-        6,
-        0,
-        {0,AT_B,SIZE08,0,0,0,1,1},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "shl",
-        0x00,
-        0x00,
-        0xd3,
-        0x0,
-        6,
-        0,
-        {0,AT_B,SIZE08,0,0,0,1,1},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "sar",
-        0x00,
-        0x00,
-        0xd3,
-        0x0,
-        7,
-        0,
-        {0,AT_B,SIZE08,0,0,0,1,1},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "xlat",
-        0x00,
-        0x00,
-        0xd7,
-        0x0,
-        -1,
-        0,
-        {0,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "xlatb",
-        0x00,
-        0x00,
-        0xd7,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "fadd",
-        0x00,
-        0x00,
-        0xd8,
-        0x0,
-        0,
-        0,
-        {AM_M,AT_SR,SIZE32,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fadd",
-        0x00,
-        0x00,
-        0xd8,
-        0x0,
-        0,
-        0,
-        {AM_EST,0,0,0,0,0,0,0},
-        {AM_ST,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fmul",
-        0x00,
-        0x00,
-        0xd8,
-        0x0,
-        1,
-        0,
-        {AM_M,AT_SR,SIZE32,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fmul",
-        0x00,
-        0x00,
-        0xd8,
-        0x0,
-        1,
-        0,
-        {AM_EST,0,0,0,0,0,0,0},
-        {AM_ST,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fcom",
-        0x00,
-        0x00,
-        0xd8,
-        0x0,
-        2,
-        0,
-        {AM_ES,AT_SR,SIZE32,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fcom",
-        0x00,
-        0x00,
-        0xd8,
-        0xd1,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fcomp",
-        0x00,
-        0x00,
-        0xd8,
-        0x0,
-        3,
-        0,
-        {AM_ES,AT_SR,SIZE32,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fcomp",
-        0x00,
-        0x00,
-        0xd8,
-        0xd9,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fsub",
-        0x00,
-        0x00,
-        0xd8,
-        0x0,
-        4,
-        0,
-        {AM_M,AT_SR,SIZE32,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fsub",
-        0x00,
-        0x00,
-        0xd8,
-        0x0,
-        4,
-        0,
-        {AM_EST,0,0,0,0,0,0,0},
-        {AM_ST,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fsubr",
-        0x00,
-        0x00,
-        0xd8,
-        0x0,
-        5,
-        0,
-        {AM_M,AT_SR,SIZE32,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fsubr",
-        0x00,
-        0x00,
-        0xd8,
-        0x0,
-        5,
-        0,
-        {AM_EST,0,0,0,0,0,0,0},
-        {AM_ST,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fdiv",
-        0x00,
-        0x00,
-        0xd8,
-        0x0,
-        6,
-        0,
-        {AM_M,AT_SR,SIZE32,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fdiv",
-        0x00,
-        0x00,
-        0xd8,
-        0x0,
-        6,
-        0,
-        {AM_EST,0,0,0,0,0,0,0},
-        {AM_ST,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fdivr",
-        0x00,
-        0x00,
-        0xd8,
-        0x0,
-        7,
-        0,
-        {AM_M,AT_SR,SIZE32,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fdivr",
-        0x00,
-        0x00,
-        0xd8,
-        0x0,
-        7,
-        0,
-        {AM_EST,0,0,0,0,0,0,0},
-        {AM_ST,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fld",
-        0x00,
-        0x00,
-        0xd9,
-        0x0,
-        0,
-        0,
-        {AM_ES,AT_SR,SIZE32,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fxch",
-        0x00,
-        0x00,
-        0xd9,
-        0x0,
-        1,
-        0,
-        {AM_EST,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fxch",
-        0x00,
-        0x00,
-        0xd9,
-        0xc9,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fst",
-        0x00,
-        0x00,
-        0xd9,
-        0x0,
-        2,
-        0,
-        {AM_M,AT_SR,SIZE32,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fnop",
-        0x00,
-        0x00,
-        0xd9,
-        0xd0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fstp",
-        0x00,
-        0x00,
-        0xd9,
-        0x0,
-        3,
-        0,
-        {AM_M,AT_SR,SIZE32,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fstp1",
-        0x00,
-        0x00,
-        0xd9,
-        0x0,
-        3,
-        0,
-        {AM_EST,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fstp1",
-        0x00,
-        0x00,
-        0xd9,
-        0x0,
-        3,
-        0,
-        {AM_EST,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fchs",
-        0x00,
-        0x00,
-        0xd9,
-        0xe0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fabs",
-        0x00,
-        0x00,
-        0xd9,
-        0xe1,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "ftst",
-        0x00,
-        0x00,
-        0xd9,
-        0xe4,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fxam",
-        0x00,
-        0x00,
-        0xd9,
-        0xe5,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fldcw",
-        0x00,
-        0x00,
-        0xd9,
-        0x0,
-        5,
-        0,
-        {AM_M,AT_W,SIZE16,1,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fld1",
-        0x00,
-        0x00,
-        0xd9,
-        0xe8,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fldl2t",
-        0x00,
-        0x00,
-        0xd9,
-        0xe9,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fldl2e",
-        0x00,
-        0x00,
-        0xd9,
-        0xea,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fldpi",
-        0x00,
-        0x00,
-        0xd9,
-        0xeb,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fldlg2",
-        0x00,
-        0x00,
-        0xd9,
-        0xec,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fldln2",
-        0x00,
-        0x00,
-        0xd9,
-        0xed,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fldz",
-        0x00,
-        0x00,
-        0xd9,
-        0xee,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "f2xm1",
-        0x00,
-        0x00,
-        0xd9,
-        0xf0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fyl2x",
-        0x00,
-        0x00,
-        0xd9,
-        0xf1,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fptan",
-        0x00,
-        0x00,
-        0xd9,
-        0xf2,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fpatan",
-        0x00,
-        0x00,
-        0xd9,
-        0xf3,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fxtract",
-        0x00,
-        0x00,
-        0xd9,
-        0xf4,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fprem1",
-        0x00,
-        0x00,
-        0xd9,
-        0xf5,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fdecstp",
-        0x00,
-        0x00,
-        0xd9,
-        0xf6,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fincstp",
-        0x00,
-        0x00,
-        0xd9,
-        0xf7,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fnstcw",
-        0x00,
-        0x00,
-        0xd9,
-        0x0,
-        7,
-        0,
-        {AM_M,AT_W,SIZE16,1,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fstcw",
-        0x9b,
-        0x00,
-        0xd9,
-        0x0,
-        7,
-        0,
-        {AM_M,AT_W,SIZE16,1,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fprem",
-        0x00,
-        0x00,
-        0xd9,
-        0xf8,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fyl2xp1",
-        0x00,
-        0x00,
-        0xd9,
-        0xf9,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fsqrt",
-        0x00,
-        0x00,
-        0xd9,
-        0xfa,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fsincos",
-        0x00,
-        0x00,
-        0xd9,
-        0xfb,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "frndint",
-        0x00,
-        0x00,
-        0xd9,
-        0xfc,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fscale",
-        0x00,
-        0x00,
-        0xd9,
-        0xfd,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fsin",
-        0x00,
-        0x00,
-        0xd9,
-        0xfe,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fcos",
-        0x00,
-        0x00,
-        0xd9,
-        0xff,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fiadd",
-        0x00,
-        0x00,
-        0xda,
-        0x0,
-        0,
-        0,
-        {AM_M,AT_DI,SIZE32,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fcmovb",
-        0x00,
-        0x00,
-        0xda,
-        0x0,
-        0,
-        0,
-        {AM_EST,0,0,0,0,0,0,0},
-        {AM_ST,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fimul",
-        0x00,
-        0x00,
-        0xda,
-        0x0,
-        1,
-        0,
-        {AM_M,AT_DI,SIZE32,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fcmove",
-        0x00,
-        0x00,
-        0xda,
-        0x0,
-        1,
-        0,
-        {AM_EST,0,0,0,0,0,0,0},
-        {AM_ST,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "ficom",
-        0x00,
-        0x00,
-        0xda,
-        0x0,
-        2,
-        0,
-        {AM_M,AT_DI,SIZE32,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fcmovbe",
-        0x00,
-        0x00,
-        0xda,
-        0x0,
-        2,
-        0,
-        {AM_EST,0,0,0,0,0,0,0},
-        {AM_ST,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "ficomp",
-        0x00,
-        0x00,
-        0xda,
-        0x0,
-        3,
-        0,
-        {AM_M,AT_DI,SIZE32,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fcmovu",
-        0x00,
-        0x00,
-        0xda,
-        0x0,
-        3,
-        0,
-        {AM_EST,0,0,0,0,0,0,0},
-        {AM_ST,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fisub",
-        0x00,
-        0x00,
-        0xda,
-        0x0,
-        4,
-        0,
-        {AM_M,AT_DI,SIZE32,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fisubr",
-        0x00,
-        0x00,
-        0xda,
-        0x0,
-        5,
-        0,
-        {AM_M,AT_DI,SIZE32,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fucompp",
-        0x00,
-        0x00,
-        0xda,
-        0xe9,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fidiv",
-        0x00,
-        0x00,
-        0xda,
-        0x0,
-        6,
-        0,
-        {AM_M,AT_DI,SIZE32,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fidivr",
-        0x00,
-        0x00,
-        0xda,
-        0x0,
-        7,
-        0,
-        {AM_M,AT_DI,SIZE32,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fild",
-        0x00,
-        0x00,
-        0xdb,
-        0x0,
-        0,
-        0,
-        {AM_M,AT_DI,SIZE32,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fcmovnb",
-        0x00,
-        0x00,
-        0xdb,
-        0x0,
-        0,
-        0,
-        {AM_EST,0,0,0,0,0,0,0},
-        {AM_ST,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fisttp",
-        0x00,
-        0x00,
-        0xdb,
-        0x0,
-        1,
-        0,
-        {AM_M,AT_DI,SIZE32,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        1,
-        1
-    },
-    {
-        "fcmovne",
-        0x00,
-        0x00,
-        0xdb,
-        0x0,
-        1,
-        0,
-        {AM_EST,0,0,0,0,0,0,0},
-        {AM_ST,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fist",
-        0x00,
-        0x00,
-        0xdb,
-        0x0,
-        2,
-        0,
-        {AM_M,AT_DI,SIZE32,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fcmovnbe",
-        0x00,
-        0x00,
-        0xdb,
-        0x0,
-        2,
-        0,
-        {AM_EST,0,0,0,0,0,0,0},
-        {AM_ST,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fistp",
-        0x00,
-        0x00,
-        0xdb,
-        0x0,
-        3,
-        0,
-        {AM_M,AT_DI,SIZE32,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fcmovnu",
-        0x00,
-        0x00,
-        0xdb,
-        0x0,
-        3,
-        0,
-        {AM_EST,0,0,0,0,0,0,0},
-        {AM_ST,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fneni",
-        0x00,
-        0x00,
-        0xdb,
-        0xe0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "feni",
-        0x9b,
-        0x00,
-        0xdb,
-        0xe0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fneni",
-        0x00,
-        0x00,
-        0xdb,
-        0xe0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "fndisi",
-        0x00,
-        0x00,
-        0xdb,
-        0xe1,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fdisi",
-        0x9b,
-        0x00,
-        0xdb,
-        0xe1,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fndisi",
-        0x00,
-        0x00,
-        0xdb,
-        0xe1,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "fnclex",
-        0x00,
-        0x00,
-        0xdb,
-        0xe2,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fclex",
-        0x9b,
-        0x00,
-        0xdb,
-        0xe2,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fninit",
-        0x00,
-        0x00,
-        0xdb,
-        0xe3,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "finit",
-        0x9b,
-        0x00,
-        0xdb,
-        0xe3,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fnsetpm",
-        0x00,
-        0x00,
-        0xdb,
-        0xe4,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fsetpm",
-        0x9b,
-        0x00,
-        0xdb,
-        0xe4,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fnsetpm",
-        0x00,
-        0x00,
-        0xdb,
-        0xe4,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "fld",
-        0x00,
-        0x00,
-        0xdb,
-        0x0,
-        5,
-        0,
-        {AM_M,AT_ER,SIZEST,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fucomi",
-        0x00,
-        0x00,
-        0xdb,
-        0x0,
-        5,
-        0,
-        {AM_EST,0,0,0,0,0,0,0},
-        {AM_ST,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fcomi",
-        0x00,
-        0x00,
-        0xdb,
-        0x0,
-        6,
-        0,
-        {AM_EST,0,0,0,0,0,0,0},
-        {AM_ST,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fstp",
-        0x00,
-        0x00,
-        0xdb,
-        0x0,
-        7,
-        0,
-        {AM_M,AT_ER,SIZEST,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fadd",
-        0x00,
-        0x00,
-        0xdc,
-        0x0,
-        0,
-        0,
-        {AM_M,AT_DR,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fadd",
-        0x00,
-        0x00,
-        0xdc,
-        0x0,
-        0,
-        0,
-        {AM_ST,0,0,0,0,0,0,0},
-        {AM_EST,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fmul",
-        0x00,
-        0x00,
-        0xdc,
-        0x0,
-        1,
-        0,
-        {AM_M,AT_DR,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fmul",
-        0x00,
-        0x00,
-        0xdc,
-        0x0,
-        1,
-        0,
-        {AM_ST,0,0,0,0,0,0,0},
-        {AM_EST,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fcom",
-        0x00,
-        0x00,
-        0xdc,
-        0x0,
-        2,
-        0,
-        {AM_M,AT_DR,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fcom2",
-        0x00,
-        0x00,
-        0xdc,
-        0x0,
-        2,
-        0,
-        {AM_EST,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fcom2",
-        0x00,
-        0x00,
-        0xdc,
-        0x0,
-        2,
-        0,
-        {AM_EST,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fcomp",
-        0x00,
-        0x00,
-        0xdc,
-        0x0,
-        3,
-        0,
-        {AM_M,AT_DR,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fcomp3",
-        0x00,
-        0x00,
-        0xdc,
-        0x0,
-        3,
-        0,
-        {AM_EST,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fcomp3",
-        0x00,
-        0x00,
-        0xdc,
-        0x0,
-        3,
-        0,
-        {AM_EST,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fsub",
-        0x00,
-        0x00,
-        0xdc,
-        0x0,
-        4,
-        0,
-        {AM_M,AT_DR,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fsubr",
-        0x00,
-        0x00,
-        0xdc,
-        0x0,
-        4,
-        0,
-        {AM_ST,0,0,0,0,0,0,0},
-        {AM_EST,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fsubr",
-        0x00,
-        0x00,
-        0xdc,
-        0x0,
-        5,
-        0,
-        {AM_M,AT_DR,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fsub",
-        0x00,
-        0x00,
-        0xdc,
-        0x0,
-        5,
-        0,
-        {AM_ST,0,0,0,0,0,0,0},
-        {AM_EST,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fdiv",
-        0x00,
-        0x00,
-        0xdc,
-        0x0,
-        6,
-        0,
-        {AM_M,AT_DR,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fdivr",
-        0x00,
-        0x00,
-        0xdc,
-        0x0,
-        6,
-        0,
-        {AM_ST,0,0,0,0,0,0,0},
-        {AM_EST,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fdivr",
-        0x00,
-        0x00,
-        0xdc,
-        0x0,
-        7,
-        0,
-        {AM_M,AT_DR,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fdiv",
-        0x00,
-        0x00,
-        0xdc,
-        0x0,
-        7,
-        0,
-        {AM_ST,0,0,0,0,0,0,0},
-        {AM_EST,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fld",
-        0x00,
-        0x00,
-        0xdd,
-        0x0,
-        0,
-        0,
-        {AM_M,AT_DR,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "ffree",
-        0x00,
-        0x00,
-        0xdd,
-        0x0,
-        0,
-        0,
-        {AM_EST,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fisttp",
-        0x00,
-        0x00,
-        0xdd,
-        0x0,
-        1,
-        0,
-        {AM_M,AT_QI,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        1,
-        1
-    },
-    {
-        "fxch4",
-        0x00,
-        0x00,
-        0xdd,
-        0x0,
-        1,
-        0,
-        {AM_EST,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fxch4",
-        0x00,
-        0x00,
-        0xdd,
-        0x0,
-        1,
-        0,
-        {AM_EST,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fst",
-        0x00,
-        0x00,
-        0xdd,
-        0x0,
-        2,
-        0,
-        {AM_M,AT_DR,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fst",
-        0x00,
-        0x00,
-        0xdd,
-        0x0,
-        2,
-        0,
-        {AM_EST,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fstp",
-        0x00,
-        0x00,
-        0xdd,
-        0x0,
-        3,
-        0,
-        {AM_M,AT_DR,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fstp",
-        0x00,
-        0x00,
-        0xdd,
-        0x0,
-        3,
-        0,
-        {AM_EST,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fucom",
-        0x00,
-        0x00,
-        0xdd,
-        0x0,
-        4,
-        0,
-        {AM_EST,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fucom",
-        0x00,
-        0x00,
-        0xdd,
-        0xe1,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fucomp",
-        0x00,
-        0x00,
-        0xdd,
-        0x0,
-        5,
-        0,
-        {AM_EST,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fucomp",
-        0x00,
-        0x00,
-        0xdd,
-        0xe9,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fnstsw",
-        0x00,
-        0x00,
-        0xdd,
-        0x0,
-        7,
-        0,
-        {AM_M,AT_W,SIZE16,1,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fstsw",
-        0x9b,
-        0x00,
-        0xdd,
-        0x0,
-        7,
-        0,
-        {AM_M,AT_W,SIZE16,1,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fiadd",
-        0x00,
-        0x00,
-        0xde,
-        0x0,
-        0,
-        0,
-        {AM_M,AT_WI,SIZE16,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "faddp",
-        0x00,
-        0x00,
-        0xde,
-        0x0,
-        0,
-        0,
-        {AM_ST,0,0,0,0,0,0,0},
-        {AM_EST,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "faddp",
-        0x00,
-        0x00,
-        0xde,
-        0xc1,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fimul",
-        0x00,
-        0x00,
-        0xde,
-        0x0,
-        1,
-        0,
-        {AM_M,AT_WI,SIZE16,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fmulp",
-        0x00,
-        0x00,
-        0xde,
-        0x0,
-        1,
-        0,
-        {AM_ST,0,0,0,0,0,0,0},
-        {AM_EST,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fmulp",
-        0x00,
-        0x00,
-        0xde,
-        0xc9,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "ficom",
-        0x00,
-        0x00,
-        0xde,
-        0x0,
-        2,
-        0,
-        {AM_M,AT_WI,SIZE16,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fcomp5",
-        0x00,
-        0x00,
-        0xde,
-        0x0,
-        2,
-        0,
-        {AM_EST,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fcomp5",
-        0x00,
-        0x00,
-        0xde,
-        0x0,
-        2,
-        0,
-        {AM_EST,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "ficomp",
-        0x00,
-        0x00,
-        0xde,
-        0x0,
-        3,
-        0,
-        {AM_M,AT_WI,SIZE16,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fcompp",
-        0x00,
-        0x00,
-        0xde,
-        0xd9,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fisub",
-        0x00,
-        0x00,
-        0xde,
-        0x0,
-        5,
-        0,
-        {AM_M,AT_WI,SIZE16,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fsubrp",
-        0x00,
-        0x00,
-        0xde,
-        0x0,
-        5,
-        0,
-        {AM_ST,0,0,0,0,0,0,0},
-        {AM_EST,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fsubrp",
-        0x00,
-        0x00,
-        0xde,
-        0xe1,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fisubr",
-        0x00,
-        0x00,
-        0xde,
-        0x0,
-        4,
-        0,
-        {AM_M,AT_WI,SIZE16,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fsubp",
-        0x00,
-        0x00,
-        0xde,
-        0x0,
-        4,
-        0,
-        {AM_ST,0,0,0,0,0,0,0},
-        {AM_EST,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fsubp",
-        0x00,
-        0x00,
-        0xde,
-        0xe9,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fidiv",
-        0x00,
-        0x00,
-        0xde,
-        0x0,
-        7,
-        0,
-        {AM_M,AT_WI,SIZE16,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fdivrp",
-        0x00,
-        0x00,
-        0xde,
-        0x0,
-        7,
-        0,
-        {AM_ST,0,0,0,0,0,0,0},
-        {AM_EST,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fdivrp",
-        0x00,
-        0x00,
-        0xde,
-        0xf1,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fidivr",
-        0x00,
-        0x00,
-        0xde,
-        0x0,
-        6,
-        0,
-        {AM_M,AT_WI,SIZE16,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fdivp",
-        0x00,
-        0x00,
-        0xde,
-        0x0,
-        6,
-        0,
-        {AM_ST,0,0,0,0,0,0,0},
-        {AM_EST,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fdivp",
-        0x00,
-        0x00,
-        0xde,
-        0xf9,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fild",
-        0x00,
-        0x00,
-        0xdf,
-        0x0,
-        0,
-        0,
-        {AM_M,AT_WI,SIZE16,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "ffreep",
-        0x00,
-        0x00,
-        0xdf,
-        0x0,
-        0,
-        0,
-        {AM_EST,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fisttp",
-        0x00,
-        0x00,
-        0xdf,
-        0x0,
-        1,
-        0,
-        {AM_M,AT_WI,SIZE16,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        1,
-        1
-    },
-    {
-        "fxch7",
-        0x00,
-        0x00,
-        0xdf,
-        0x0,
-        1,
-        0,
-        {AM_EST,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fxch7",
-        0x00,
-        0x00,
-        0xdf,
-        0x0,
-        1,
-        0,
-        {AM_EST,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fist",
-        0x00,
-        0x00,
-        0xdf,
-        0x0,
-        2,
-        0,
-        {AM_M,AT_WI,SIZE16,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fstp8",
-        0x00,
-        0x00,
-        0xdf,
-        0x0,
-        2,
-        0,
-        {AM_EST,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fstp8",
-        0x00,
-        0x00,
-        0xdf,
-        0x0,
-        2,
-        0,
-        {AM_EST,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fistp",
-        0x00,
-        0x00,
-        0xdf,
-        0x0,
-        3,
-        0,
-        {AM_M,AT_WI,SIZE16,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fstp9",
-        0x00,
-        0x00,
-        0xdf,
-        0x0,
-        3,
-        0,
-        {AM_EST,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fstp9",
-        0x00,
-        0x00,
-        0xdf,
-        0x0,
-        3,
-        0,
-        {AM_EST,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fnstsw",
-        0x00,
-        0x00,
-        0xdf,
-        0xe0,
-        -1,
-        0,
-        {0,AT_W,SIZE16,1,0,0,1,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fstsw",
-        0x9b,
-        0x00,
-        0xdf,
-        0xe0,
-        -1,
-        0,
-        {0,AT_W,SIZE16,1,0,0,1,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fild",
-        0x00,
-        0x00,
-        0xdf,
-        0x0,
-        5,
-        0,
-        {AM_M,AT_QI,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fucomip",
-        0x00,
-        0x00,
-        0xdf,
-        0x0,
-        5,
-        0,
-        {AM_EST,0,0,0,0,0,0,0},
-        {AM_ST,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fcomip",
-        0x00,
-        0x00,
-        0xdf,
-        0x0,
-        6,
-        0,
-        {AM_EST,0,0,0,0,0,0,0},
-        {AM_ST,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "fistp",
-        0x00,
-        0x00,
-        0xdf,
-        0x0,
-        7,
-        0,
-        {AM_M,AT_QI,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "loopnz",
-        0x00,
-        0x00,
-        0xe0,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_BS,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "loopne",
-        0x00,
-        0x00,
-        0xe0,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_BS,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "loopnz",
-        0x00,
-        0x00,
-        0xe0,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_BS,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "loopne",
-        0x00,
-        0x00,
-        0xe0,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_BS,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "loopz",
-        0x00,
-        0x00,
-        0xe1,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_BS,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "loope",
-        0x00,
-        0x00,
-        0xe1,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_BS,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "loopz",
-        0x00,
-        0x00,
-        0xe1,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_BS,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "loope",
-        0x00,
-        0x00,
-        0xe1,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_BS,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "loop",
-        0x00,
-        0x00,
-        0xe2,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_BS,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "loop",
-        0x00,
-        0x00,
-        0xe2,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_BS,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "jcxz",
-        0x00,
-        0x00,
-        0xe3,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_BS,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "jecxz",
-        0x00,
-        0x00,
-        0xe3,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_BS,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "jecxz",
-        0x00,
-        0x00,
-        0xe3,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_BS,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "jrcxz",
-        0x00,
-        0x00,
-        0xe3,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_BS,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "in",
-        0x00,
-        0x00,
-        0xe4,
-        0x0,
-        -1,
-        0,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {0,AT_B,SIZE08,0,0,0,1,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "in",
-        0x00,
-        0x00,
-        0xe5,
-        0x0,
-        -1,
-        0,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {0,AT_V,SIZE16|SIZE32,1,0,1,1,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "out",
-        0x00,
-        0x00,
-        0xe6,
-        0x0,
-        -1,
-        0,
-        {0,AT_B,SIZE08,0,0,0,1,0},
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "out",
-        0x00,
-        0x00,
-        0xe7,
-        0x0,
-        -1,
-        0,
-        {0,AT_V,SIZE16|SIZE32,1,0,1,1,0},
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "call",
-        0x00,
-        0x00,
-        0xe8,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_VDS,SIZE16|SIZE32,1,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "jmp",
-        0x00,
-        0x00,
-        0xe9,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_VDS,SIZE16|SIZE32,1,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "jmp",
-        0x00,
-        0x00,
-        0xeb,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_BS,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "in",
-        0x00,
-        0x00,
-        0xec,
-        0x0,
-        -1,
-        0,
-        {0,AT_W,SIZE16,1,0,0,1,2},
-        {0,AT_B,SIZE08,0,0,0,1,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "in",
-        0x00,
-        0x00,
-        0xed,
-        0x0,
-        -1,
-        0,
-        {0,AT_W,SIZE16,1,0,0,1,2},
-        {0,AT_V,SIZE16|SIZE32,1,0,1,1,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "out",
-        0x00,
-        0x00,
-        0xee,
-        0x0,
-        -1,
-        0,
-        {0,AT_B,SIZE08,0,0,0,1,0},
-        {0,AT_W,SIZE16,1,0,0,1,2},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "out",
-        0x00,
-        0x00,
-        0xef,
-        0x0,
-        -1,
-        0,
-        {0,AT_V,SIZE16|SIZE32,1,0,1,1,0},
-        {0,AT_W,SIZE16,1,0,0,1,2},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "lock",
-        0x00,
-        0x00,
-        0xf0,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "int1",
-        0x00,
-        0x00,
-        0xf1,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "icebp",
-        0x00,
-        0x00,
-        0xf1,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "repnz",
-        0x00,
-        0x00,
-        0xf2,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "repne",
-        0x00,
-        0x00,
-        0xf2,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "rep",
-        0x00,
-        0x00,
-        0xf2,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "repnz",
-        0x00,
-        0x00,
-        0xf2,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "repne",
-        0x00,
-        0x00,
-        0xf2,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "rep",
-        0x00,
-        0x00,
-        0xf2,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "repz",
-        0x00,
-        0x00,
-        0xf3,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "repe",
-        0x00,
-        0x00,
-        0xf3,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "rep",
-        0x00,
-        0x00,
-        0xf3,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "repz",
-        0x00,
-        0x00,
-        0xf3,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "repe",
-        0x00,
-        0x00,
-        0xf3,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "rep",
-        0x00,
-        0x00,
-        0xf3,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "hlt",
-        0x00,
-        0x00,
-        0xf4,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "cmc",
-        0x00,
-        0x00,
-        0xf5,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "test",
-        0x00,
-        0x00,
-        0xf6,
-        0x0,
-        0,
-        0,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "test",
-        0x00,
-        0x00,
-        0xf6,
-        0x0,
-        1,
-        0,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "not",
-        0x00,
-        0x00,
-        0xf6,
-        0x0,
-        2,
-        0,
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "neg",
-        0x00,
-        0x00,
-        0xf6,
-        0x0,
-        3,
-        0,
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "mul",
-        0x00,
-        0x00,
-        0xf6,
-        0x0,
-        4,
-        0,
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "imul",
-        0x00,
-        0x00,
-        0xf6,
-        0x0,
-        5,
-        0,
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "div",
-        0x00,
-        0x00,
-        0xf6,
-        0x0,
-        6,
-        0,
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "idiv",
-        0x00,
-        0x00,
-        0xf6,
-        0x0,
-        7,
-        0,
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "test",
-        0x00,
-        0x00,
-        0xf7,
-        0x0,
-        0,
-        0,
-        {AM_I,AT_VDS,SIZE16|SIZE32,1,0,0,0,0},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "test",
-        0x00,
-        0x00,
-        0xf7,
-        0x0,
-        1,
-        0,
-        {AM_I,AT_VDS,SIZE16|SIZE32,1,0,0,0,0},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "not",
-        0x00,
-        0x00,
-        0xf7,
-        0x0,
-        2,
-        0,
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "neg",
-        0x00,
-        0x00,
-        0xf7,
-        0x0,
-        3,
-        0,
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "mul",
-        0x00,
-        0x00,
-        0xf7,
-        0x0,
-        4,
-        0,
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "imul",
-        0x00,
-        0x00,
-        0xf7,
-        0x0,
-        5,
-        0,
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "div",
-        0x00,
-        0x00,
-        0xf7,
-        0x0,
-        6,
-        0,
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "idiv",
-        0x00,
-        0x00,
-        0xf7,
-        0x0,
-        7,
-        0,
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "clc",
-        0x00,
-        0x00,
-        0xf8,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "stc",
-        0x00,
-        0x00,
-        0xf9,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "cli",
-        0x00,
-        0x00,
-        0xfa,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "sti",
-        0x00,
-        0x00,
-        0xfb,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "cld",
-        0x00,
-        0x00,
-        0xfc,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "std",
-        0x00,
-        0x00,
-        0xfd,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "inc",
-        0x00,
-        0x00,
-        0xfe,
-        0x0,
-        0,
-        0,
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "dec",
-        0x00,
-        0x00,
-        0xfe,
-        0x0,
-        1,
-        0,
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "inc",
-        0x00,
-        0x00,
-        0xff,
-        0x0,
-        0,
-        0,
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "dec",
-        0x00,
-        0x00,
-        0xff,
-        0x0,
-        1,
-        0,
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "call",
-        0x00,
-        0x00,
-        0xff,
-        0x0,
-        2,
-        0,
-        {AM_E,AT_V,SIZE16|SIZE32,1,0,1,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "call",
-        0x00,
-        0x00,
-        0xff,
-        0x0,
-        2,
-        0,
-        {AM_E,AT_Q,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "jmp",
-        0x00,
-        0x00,
-        0xff,
-        0x0,
-        4,
-        0,
-        {AM_E,AT_V,SIZE16|SIZE32,1,0,1,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "jmp",
-        0x00,
-        0x00,
-        0xff,
-        0x0,
-        4,
-        0,
-        {AM_E,AT_Q,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "push",
-        0x00,
-        0x00,
-        0xff,
-        0x0,
-        6,
-        0,
-        {AM_E,AT_V,SIZE16|SIZE32,1,0,1,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "push",
-        0x00,
-        0x00,
-        0xff,
-        0x0,
-        6,
-        0,
-        {AM_E,AT_VQ,SIZE16|SIZE64,1,0,1,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "sldt",
-        0x00,
-        0x0f,
-        0x00,
-        0x0,
-        0,
-        0,
-        {AM_M,AT_W,SIZE16,1,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "str",
-        0x00,
-        0x0f,
-        0x00,
-        0x0,
-        1,
-        0,
-        {AM_M,AT_W,SIZE16,1,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "lldt",
-        0x00,
-        0x0f,
-        0x00,
-        0x0,
-        2,
-        0,
-        {AM_E,AT_W,SIZE16,1,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "ltr",
-        0x00,
-        0x0f,
-        0x00,
-        0x0,
-        3,
-        0,
-        {AM_E,AT_W,SIZE16,1,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "verr",
-        0x00,
-        0x0f,
-        0x00,
-        0x0,
-        4,
-        0,
-        {AM_E,AT_W,SIZE16,1,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "verw",
-        0x00,
-        0x0f,
-        0x00,
-        0x0,
-        5,
-        0,
-        {AM_E,AT_W,SIZE16,1,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "jmpe",
-        0x00,
-        0x0f,
-        0x00,
-        0x0,
-        6,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "vmcall",
-        0x00,
-        0x0f,
-        0x01,
-        0xc1,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "vmlaunch",
-        0x00,
-        0x0f,
-        0x01,
-        0xc2,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "vmresume",
-        0x00,
-        0x0f,
-        0x01,
-        0xc3,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "vmxoff",
-        0x00,
-        0x0f,
-        0x01,
-        0xc4,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "monitor",
-        0x00,
-        0x0f,
-        0x01,
-        0xc8,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "mwait",
-        0x00,
-        0x0f,
-        0x01,
-        0xc9,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "xgetbv",
-        0x00,
-        0x0f,
-        0x01,
-        0xd0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "xsetbv",
-        0x00,
-        0x0f,
-        0x01,
-        0xd1,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "smsw",
-        0x00,
-        0x0f,
-        0x01,
-        0x0,
-        4,
-        0,
-        {AM_M,AT_W,SIZE16,1,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "lmsw",
-        0x00,
-        0x0f,
-        0x01,
-        0x0,
-        6,
-        0,
-        {AM_E,AT_W,SIZE16,1,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "invlpg",
-        0x00,
-        0x0f,
-        0x01,
-        0x0,
-        7,
-        0,
-        {AM_M,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "swapgs",
-        0x00,
-        0x0f,
-        0x01,
-        0xf8,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "rdtscp",
-        0x00,
-        0x0f,
-        0x01,
-        0xf9,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "lar",
-        0x00,
-        0x0f,
-        0x02,
-        0x0,
-        -1,
-        1,
-        {AM_M,AT_W,SIZE16,1,0,0,0,0},
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "lsl",
-        0x00,
-        0x0f,
-        0x03,
-        0x0,
-        -1,
-        1,
-        {AM_M,AT_W,SIZE16,1,0,0,0,0},
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "loadall",
-        0x00,
-        0x0f,
-        0x05,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "syscall",
-        0x00,
-        0x0f,
-        0x05,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "clts",
-        0x00,
-        0x0f,
-        0x06,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "loadall",
-        0x00,
-        0x0f,
-        0x07,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "sysret",
-        0x00,
-        0x0f,
-        0x07,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "invd",
-        0x00,
-        0x0f,
-        0x08,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "wbinvd",
-        0x00,
-        0x0f,
-        0x09,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "ud2",
-        0x00,
-        0x0f,
-        0x0b,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "nop",
-        0x00,
-        0x0f,
-        0x0d,
-        0x0,
-        -1,
-        0,
-        {AM_E,AT_V,SIZE16|SIZE32,1,0,1,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "movss",
-        0xf3,
-        0x0f,
-        0x10,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_SS,SIZE16,0,0,0,0,0},
-        {AM_V,AT_SS,SIZE16,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "movsd",
-        0xf2,
-        0x0f,
-        0x10,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_SD,SIZE32,0,0,0,0,0},
-        {AM_V,AT_SD,SIZE32,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "movss",
-        0xf3,
-        0x0f,
-        0x11,
-        0x0,
-        -1,
-        1,
-        {AM_V,AT_SS,SIZE16,0,0,0,0,0},
-        {AM_W,AT_SS,SIZE16,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "movsd",
-        0xf2,
-        0x0f,
-        0x11,
-        0x0,
-        -1,
-        1,
-        {AM_V,AT_SD,SIZE32,0,0,0,0,0},
-        {AM_W,AT_SD,SIZE32,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "movlps",
-        0x00,
-        0x0f,
-        0x12,
-        0x0,
-        -1,
-        1,
-        {AM_M,AT_Q,SIZE64,0,0,0,0,0},
-        {AM_V,AT_Q,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "movlpd",
-        0x66,
-        0x0f,
-        0x12,
-        0x0,
-        -1,
-        1,
-        {AM_M,AT_Q,SIZE64,0,0,0,0,0},
-        {AM_V,AT_Q,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "movddup",
-        0xf2,
-        0x0f,
-        0x12,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_Q,SIZE64,0,0,0,0,0},
-        {AM_V,AT_Q,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "movsldup",
-        0xf3,
-        0x0f,
-        0x12,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_Q,SIZE64,0,0,0,0,0},
-        {AM_V,AT_Q,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "movlps",
-        0x00,
-        0x0f,
-        0x13,
-        0x0,
-        -1,
-        1,
-        {AM_V,AT_Q,SIZE64,0,0,0,0,0},
-        {AM_M,AT_Q,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "movlpd",
-        0x66,
-        0x0f,
-        0x13,
-        0x0,
-        -1,
-        1,
-        {AM_V,AT_Q,SIZE64,0,0,0,0,0},
-        {AM_M,AT_Q,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "movhps",
-        0x00,
-        0x0f,
-        0x16,
-        0x0,
-        -1,
-        1,
-        {AM_M,AT_Q,SIZE64,0,0,0,0,0},
-        {AM_V,AT_Q,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "movhpd",
-        0x66,
-        0x0f,
-        0x16,
-        0x0,
-        -1,
-        1,
-        {AM_M,AT_Q,SIZE64,0,0,0,0,0},
-        {AM_V,AT_Q,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "movshdup",
-        0xf3,
-        0x0f,
-        0x16,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_Q,SIZE64,0,0,0,0,0},
-        {AM_V,AT_Q,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "movhps",
-        0x00,
-        0x0f,
-        0x17,
-        0x0,
-        -1,
-        1,
-        {AM_V,AT_Q,SIZE64,0,0,0,0,0},
-        {AM_M,AT_Q,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "movhpd",
-        0x66,
-        0x0f,
-        0x17,
-        0x0,
-        -1,
-        1,
-        {AM_V,AT_Q,SIZE64,0,0,0,0,0},
-        {AM_M,AT_Q,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "hint_nop",
-        0x00,
-        0x0f,
-        0x18,
-        0x0,
-        -1,
-        0,
-        {AM_E,AT_V,SIZE16|SIZE32,1,0,1,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "prefetchnta",
-        0x00,
-        0x0f,
-        0x18,
-        0x0,
-        0,
-        0,
-        {AM_M,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "prefetcht0",
-        0x00,
-        0x0f,
-        0x18,
-        0x0,
-        1,
-        0,
-        {AM_M,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "prefetcht1",
-        0x00,
-        0x0f,
-        0x18,
-        0x0,
-        2,
-        0,
-        {AM_M,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "prefetcht2",
-        0x00,
-        0x0f,
-        0x18,
-        0x0,
-        3,
-        0,
-        {AM_M,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "hint_nop",
-        0x00,
-        0x0f,
-        0x18,
-        0x0,
-        4,
-        0,
-        {AM_E,AT_V,SIZE16|SIZE32,1,0,1,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "hint_nop",
-        0x00,
-        0x0f,
-        0x18,
-        0x0,
-        5,
-        0,
-        {AM_E,AT_V,SIZE16|SIZE32,1,0,1,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "hint_nop",
-        0x00,
-        0x0f,
-        0x18,
-        0x0,
-        6,
-        0,
-        {AM_E,AT_V,SIZE16|SIZE32,1,0,1,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "hint_nop",
-        0x00,
-        0x0f,
-        0x18,
-        0x0,
-        7,
-        0,
-        {AM_E,AT_V,SIZE16|SIZE32,1,0,1,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "hint_nop",
-        0x00,
-        0x0f,
-        0x19,
-        0x0,
-        -1,
-        0,
-        {AM_E,AT_V,SIZE16|SIZE32,1,0,1,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "hint_nop",
-        0x00,
-        0x0f,
-        0x1a,
-        0x0,
-        -1,
-        0,
-        {AM_E,AT_V,SIZE16|SIZE32,1,0,1,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "hint_nop",
-        0x00,
-        0x0f,
-        0x1b,
-        0x0,
-        -1,
-        0,
-        {AM_E,AT_V,SIZE16|SIZE32,1,0,1,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "hint_nop",
-        0x00,
-        0x0f,
-        0x1c,
-        0x0,
-        -1,
-        0,
-        {AM_E,AT_V,SIZE16|SIZE32,1,0,1,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "hint_nop",
-        0x00,
-        0x0f,
-        0x1d,
-        0x0,
-        -1,
-        0,
-        {AM_E,AT_V,SIZE16|SIZE32,1,0,1,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "hint_nop",
-        0x00,
-        0x0f,
-        0x1e,
-        0x0,
-        -1,
-        0,
-        {AM_E,AT_V,SIZE16|SIZE32,1,0,1,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "hint_nop",
-        0x00,
-        0x0f,
-        0x1f,
-        0x0,
-        -1,
-        0,
-        {AM_E,AT_V,SIZE16|SIZE32,1,0,1,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "nop",
-        0x00,
-        0x0f,
-        0x1f,
-        0x0,
-        0,
-        0,
-        {AM_E,AT_V,SIZE16|SIZE32,1,0,1,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "hint_nop",
-        0x00,
-        0x0f,
-        0x1f,
-        0x0,
-        1,
-        0,
-        {AM_E,AT_V,SIZE16|SIZE32,1,0,1,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "hint_nop",
-        0x00,
-        0x0f,
-        0x1f,
-        0x0,
-        2,
-        0,
-        {AM_E,AT_V,SIZE16|SIZE32,1,0,1,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "hint_nop",
-        0x00,
-        0x0f,
-        0x1f,
-        0x0,
-        3,
-        0,
-        {AM_E,AT_V,SIZE16|SIZE32,1,0,1,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "hint_nop",
-        0x00,
-        0x0f,
-        0x1f,
-        0x0,
-        4,
-        0,
-        {AM_E,AT_V,SIZE16|SIZE32,1,0,1,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "hint_nop",
-        0x00,
-        0x0f,
-        0x1f,
-        0x0,
-        5,
-        0,
-        {AM_E,AT_V,SIZE16|SIZE32,1,0,1,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "hint_nop",
-        0x00,
-        0x0f,
-        0x1f,
-        0x0,
-        6,
-        0,
-        {AM_E,AT_V,SIZE16|SIZE32,1,0,1,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "hint_nop",
-        0x00,
-        0x0f,
-        0x1f,
-        0x0,
-        7,
-        0,
-        {AM_E,AT_V,SIZE16|SIZE32,1,0,1,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "cvtsi2ss",
-        0xf3,
-        0x0f,
-        0x2a,
-        0x0,
-        -1,
-        1,
-        {AM_E,AT_DQP,SIZE32|SIZE64,0,0,0,0,0},
-        {AM_V,AT_SS,SIZE16,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        1,
-        0
-    },
-    {
-        "cvtsi2sd",
-        0xf2,
-        0x0f,
-        0x2a,
-        0x0,
-        -1,
-        1,
-        {AM_E,AT_DQP,SIZE32|SIZE64,0,0,0,0,0},
-        {AM_V,AT_SD,SIZE32,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        1,
-        0
-    },
-    {
-        "cvttss2si",
-        0xf3,
-        0x0f,
-        0x2c,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_SS,SIZE16,0,0,0,0,0},
-        {AM_G,AT_DQP,SIZE32|SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        1,
-        0
-    },
-    {
-        "cvttsd2si",
-        0xf2,
-        0x0f,
-        0x2c,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_SD,SIZE32,0,0,0,0,0},
-        {AM_G,AT_DQP,SIZE32|SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        1,
-        0
-    },
-    {
-        "cvtss2si",
-        0xf3,
-        0x0f,
-        0x2d,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_SS,SIZE16,0,0,0,0,0},
-        {AM_G,AT_DQP,SIZE32|SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        1,
-        0
-    },
-    {
-        "cvtsd2si",
-        0xf2,
-        0x0f,
-        0x2d,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_SD,SIZE32,0,0,0,0,0},
-        {AM_G,AT_DQP,SIZE32|SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        1,
-        0
-    },
-    {
-        "ucomiss",
-        0x00,
-        0x0f,
-        0x2e,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_SS,SIZE16,0,0,0,0,0},
-        {AM_V,AT_SS,SIZE16,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "ucomisd",
-        0x66,
-        0x0f,
-        0x2e,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_SD,SIZE32,0,0,0,0,0},
-        {AM_V,AT_SD,SIZE32,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "comiss",
-        0x00,
-        0x0f,
-        0x2f,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_SS,SIZE16,0,0,0,0,0},
-        {AM_V,AT_SS,SIZE16,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "comisd",
-        0x66,
-        0x0f,
-        0x2f,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_SD,SIZE32,0,0,0,0,0},
-        {AM_V,AT_SD,SIZE32,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "wrmsr",
-        0x00,
-        0x0f,
-        0x30,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "rdtsc",
-        0x00,
-        0x0f,
-        0x31,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "rdmsr",
-        0x00,
-        0x0f,
-        0x32,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "rdpmc",
-        0x00,
-        0x0f,
-        0x33,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "sysenter",
-        0x00,
-        0x0f,
-        0x34,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "sysenter",
-        0x00,
-        0x0f,
-        0x34,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "sysexit",
-        0x00,
-        0x0f,
-        0x35,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "getsec",
-        0x00,
-        0x0f,
-        0x37,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "pshufb",
-        0x66,
-        0x0f,
-        0x38,
-        0x00,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "phaddw",
-        0x66,
-        0x0f,
-        0x38,
-        0x01,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "phaddd",
-        0x66,
-        0x0f,
-        0x38,
-        0x02,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "phaddsw",
-        0x66,
-        0x0f,
-        0x38,
-        0x03,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "pmaddubsw",
-        0x66,
-        0x0f,
-        0x38,
-        0x04,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "phsubw",
-        0x66,
-        0x0f,
-        0x38,
-        0x05,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "phsubd",
-        0x66,
-        0x0f,
-        0x38,
-        0x06,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "phsubsw",
-        0x66,
-        0x0f,
-        0x38,
-        0x07,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "psignb",
-        0x66,
-        0x0f,
-        0x38,
-        0x08,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "psignw",
-        0x66,
-        0x0f,
-        0x38,
-        0x09,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "psignd",
-        0x66,
-        0x0f,
-        0x38,
-        0x0a,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "pmulhrsw",
-        0x66,
-        0x0f,
-        0x38,
-        0x0b,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "pblendvb",
-        0x66,
-        0x0f,
-        0x38,
-        0x10,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "ptest",
-        0x66,
-        0x0f,
-        0x38,
-        0x17,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "pabsb",
-        0x66,
-        0x0f,
-        0x38,
-        0x1c,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "pabsw",
-        0x66,
-        0x0f,
-        0x38,
-        0x1d,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "pabsd",
-        0x66,
-        0x0f,
-        0x38,
-        0x1e,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "pmovsxbw",
-        0x66,
-        0x0f,
-        0x38,
-        0x20,
-        -1,
-        1,
-        {AM_M,AT_Q,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        1,
-        0
-    },
-    {
-        "pmovsxbd",
-        0x66,
-        0x0f,
-        0x38,
-        0x21,
-        -1,
-        1,
-        {AM_M,AT_D,SIZE32,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        1,
-        0
-    },
-    {
-        "pmovsxbq",
-        0x66,
-        0x0f,
-        0x38,
-        0x22,
-        -1,
-        1,
-        {AM_M,AT_W,SIZE16,1,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        1,
-        0
-    },
-    {
-        "pmovsxwd",
-        0x66,
-        0x0f,
-        0x38,
-        0x23,
-        -1,
-        1,
-        {AM_M,AT_Q,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        1,
-        0
-    },
-    {
-        "pmovsxwq",
-        0x66,
-        0x0f,
-        0x38,
-        0x24,
-        -1,
-        1,
-        {AM_M,AT_D,SIZE32,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        1,
-        0
-    },
-    {
-        "pmovsxdq",
-        0x66,
-        0x0f,
-        0x38,
-        0x25,
-        -1,
-        1,
-        {AM_M,AT_Q,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        1,
-        0
-    },
-    {
-        "pmuldq",
-        0x66,
-        0x0f,
-        0x38,
-        0x28,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "pcmpeqq",
-        0x66,
-        0x0f,
-        0x38,
-        0x29,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "movntdqa",
-        0x66,
-        0x0f,
-        0x38,
-        0x2a,
-        -1,
-        1,
-        {AM_M,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "packusdw",
-        0x66,
-        0x0f,
-        0x38,
-        0x2b,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        1,
-        0
-    },
-    {
-        "pmovzxbw",
-        0x66,
-        0x0f,
-        0x38,
-        0x30,
-        -1,
-        1,
-        {AM_M,AT_Q,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        1,
-        0
-    },
-    {
-        "pmovzxbd",
-        0x66,
-        0x0f,
-        0x38,
-        0x31,
-        -1,
-        1,
-        {AM_M,AT_D,SIZE32,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        1,
-        0
-    },
-    {
-        "pmovzxbq",
-        0x66,
-        0x0f,
-        0x38,
-        0x32,
-        -1,
-        1,
-        {AM_M,AT_W,SIZE16,1,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        1,
-        0
-    },
-    {
-        "pmovzxwd",
-        0x66,
-        0x0f,
-        0x38,
-        0x33,
-        -1,
-        1,
-        {AM_M,AT_Q,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        1,
-        0
-    },
-    {
-        "pmovzxwq",
-        0x66,
-        0x0f,
-        0x38,
-        0x34,
-        -1,
-        1,
-        {AM_M,AT_D,SIZE32,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        1,
-        0
-    },
-    {
-        "pmovzxdq",
-        0x66,
-        0x0f,
-        0x38,
-        0x35,
-        -1,
-        1,
-        {AM_M,AT_Q,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        1,
-        0
-    },
-    {
-        "pcmpgtq",
-        0x66,
-        0x0f,
-        0x38,
-        0x37,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "pminsb",
-        0x66,
-        0x0f,
-        0x38,
-        0x38,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "pminsd",
-        0x66,
-        0x0f,
-        0x38,
-        0x39,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "pminuw",
-        0x66,
-        0x0f,
-        0x38,
-        0x3a,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "pminud",
-        0x66,
-        0x0f,
-        0x38,
-        0x3b,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "pmaxsb",
-        0x66,
-        0x0f,
-        0x38,
-        0x3c,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "pmaxsd",
-        0x66,
-        0x0f,
-        0x38,
-        0x3d,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "pmaxuw",
-        0x66,
-        0x0f,
-        0x38,
-        0x3e,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "pmaxud",
-        0x66,
-        0x0f,
-        0x38,
-        0x3f,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "pmulld",
-        0x66,
-        0x0f,
-        0x38,
-        0x40,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "phminposuw",
-        0x66,
-        0x0f,
-        0x38,
-        0x41,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "invept",
-        0x66,
-        0x0f,
-        0x38,
-        0x80,
-        -1,
-        1,
-        {AM_M,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_G,AT_D,SIZE32,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "invept",
-        0x66,
-        0x0f,
-        0x38,
-        0x80,
-        -1,
-        1,
-        {AM_M,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_G,AT_Q,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "invvpid",
-        0x66,
-        0x0f,
-        0x38,
-        0x81,
-        -1,
-        1,
-        {AM_M,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_G,AT_D,SIZE32,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "invvpid",
-        0x66,
-        0x0f,
-        0x38,
-        0x81,
-        -1,
-        1,
-        {AM_M,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_G,AT_Q,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "movbe",
-        0x00,
-        0x0f,
-        0x38,
-        0xf0,
-        -1,
-        1,
-        {AM_M,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "crc32",
-        0xf2,
-        0x0f,
-        0x38,
-        0xf0,
-        -1,
-        1,
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {AM_G,AT_DQP,SIZE32|SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "movbe",
-        0x00,
-        0x0f,
-        0x38,
-        0xf1,
-        -1,
-        1,
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_M,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "crc32",
-        0xf2,
-        0x0f,
-        0x38,
-        0xf1,
-        -1,
-        1,
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_G,AT_DQP,SIZE32|SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "roundss",
-        0x66,
-        0x0f,
-        0x3a,
-        0x0a,
-        -1,
-        1,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {AM_W,AT_SS,SIZE16,0,0,0,0,0},
-        {AM_V,AT_SS,SIZE16,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        1,
-        0
-    },
-    {
-        "roundsd",
-        0x66,
-        0x0f,
-        0x3a,
-        0x0b,
-        -1,
-        1,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {AM_W,AT_SD,SIZE32,0,0,0,0,0},
-        {AM_V,AT_SD,SIZE32,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        1,
-        0
-    },
-    {
-        "pblendw",
-        0x66,
-        0x0f,
-        0x3a,
-        0x0e,
-        -1,
-        1,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "palignr",
-        0x66,
-        0x0f,
-        0x3a,
-        0x0f,
-        -1,
-        1,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "pextrb",
-        0x66,
-        0x0f,
-        0x3a,
-        0x14,
-        -1,
-        1,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_M,AT_B,SIZE08,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "pextrw",
-        0x66,
-        0x0f,
-        0x3a,
-        0x15,
-        -1,
-        1,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_M,AT_W,SIZE16,1,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "pextrd",
-        0x66,
-        0x0f,
-        0x3a,
-        0x16,
-        -1,
-        1,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_E,AT_D,SIZE32,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "pextrq",
-        0x66,
-        0x0f,
-        0x3a,
-        0x16,
-        -1,
-        1,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_E,AT_QP,SIZE64,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "extractps",
-        0x66,
-        0x0f,
-        0x3a,
-        0x17,
-        -1,
-        1,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_E,AT_D,SIZE32,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "pinsrb",
-        0x66,
-        0x0f,
-        0x3a,
-        0x20,
-        -1,
-        1,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {AM_M,AT_B,SIZE08,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "pinsrd",
-        0x66,
-        0x0f,
-        0x3a,
-        0x22,
-        -1,
-        1,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {AM_E,AT_D,SIZE32,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "pinsrq",
-        0x66,
-        0x0f,
-        0x3a,
-        0x22,
-        -1,
-        1,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {AM_E,AT_QP,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "mpsadbw",
-        0x66,
-        0x0f,
-        0x3a,
-        0x42,
-        -1,
-        1,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "cmovo",
-        0x00,
-        0x0f,
-        0x40,
-        0x0,
-        -1,
-        1,
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "cmovno",
-        0x00,
-        0x0f,
-        0x41,
-        0x0,
-        -1,
-        1,
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "cmovb",
-        0x00,
-        0x0f,
-        0x42,
-        0x0,
-        -1,
-        1,
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "cmovnae",
-        0x00,
-        0x0f,
-        0x42,
-        0x0,
-        -1,
-        1,
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "cmovc",
-        0x00,
-        0x0f,
-        0x42,
-        0x0,
-        -1,
-        1,
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "cmovnb",
-        0x00,
-        0x0f,
-        0x43,
-        0x0,
-        -1,
-        1,
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "cmovae",
-        0x00,
-        0x0f,
-        0x43,
-        0x0,
-        -1,
-        1,
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "cmovnc",
-        0x00,
-        0x0f,
-        0x43,
-        0x0,
-        -1,
-        1,
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "cmovz",
-        0x00,
-        0x0f,
-        0x44,
-        0x0,
-        -1,
-        1,
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "cmove",
-        0x00,
-        0x0f,
-        0x44,
-        0x0,
-        -1,
-        1,
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "cmovnz",
-        0x00,
-        0x0f,
-        0x45,
-        0x0,
-        -1,
-        1,
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "cmovne",
-        0x00,
-        0x0f,
-        0x45,
-        0x0,
-        -1,
-        1,
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "cmovbe",
-        0x00,
-        0x0f,
-        0x46,
-        0x0,
-        -1,
-        1,
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "cmovna",
-        0x00,
-        0x0f,
-        0x46,
-        0x0,
-        -1,
-        1,
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "cmovnbe",
-        0x00,
-        0x0f,
-        0x47,
-        0x0,
-        -1,
-        1,
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "cmova",
-        0x00,
-        0x0f,
-        0x47,
-        0x0,
-        -1,
-        1,
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "cmovs",
-        0x00,
-        0x0f,
-        0x48,
-        0x0,
-        -1,
-        1,
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "cmovns",
-        0x00,
-        0x0f,
-        0x49,
-        0x0,
-        -1,
-        1,
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "cmovp",
-        0x00,
-        0x0f,
-        0x4a,
-        0x0,
-        -1,
-        1,
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "cmovpe",
-        0x00,
-        0x0f,
-        0x4a,
-        0x0,
-        -1,
-        1,
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "cmovnp",
-        0x00,
-        0x0f,
-        0x4b,
-        0x0,
-        -1,
-        1,
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "cmovpo",
-        0x00,
-        0x0f,
-        0x4b,
-        0x0,
-        -1,
-        1,
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "cmovl",
-        0x00,
-        0x0f,
-        0x4c,
-        0x0,
-        -1,
-        1,
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "cmovnge",
-        0x00,
-        0x0f,
-        0x4c,
-        0x0,
-        -1,
-        1,
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "cmovnl",
-        0x00,
-        0x0f,
-        0x4d,
-        0x0,
-        -1,
-        1,
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "cmovge",
-        0x00,
-        0x0f,
-        0x4d,
-        0x0,
-        -1,
-        1,
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "cmovle",
-        0x00,
-        0x0f,
-        0x4e,
-        0x0,
-        -1,
-        1,
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "cmovng",
-        0x00,
-        0x0f,
-        0x4e,
-        0x0,
-        -1,
-        1,
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "cmovnle",
-        0x00,
-        0x0f,
-        0x4f,
-        0x0,
-        -1,
-        1,
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "cmovg",
-        0x00,
-        0x0f,
-        0x4f,
-        0x0,
-        -1,
-        1,
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "sqrtss",
-        0xf3,
-        0x0f,
-        0x51,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_SS,SIZE16,0,0,0,0,0},
-        {AM_V,AT_SS,SIZE16,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "sqrtsd",
-        0xf2,
-        0x0f,
-        0x51,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_SD,SIZE32,0,0,0,0,0},
-        {AM_V,AT_SD,SIZE32,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "rsqrtss",
-        0xf3,
-        0x0f,
-        0x52,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_SS,SIZE16,0,0,0,0,0},
-        {AM_V,AT_SS,SIZE16,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "rcpss",
-        0xf3,
-        0x0f,
-        0x53,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_SS,SIZE16,0,0,0,0,0},
-        {AM_V,AT_SS,SIZE16,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "addss",
-        0xf3,
-        0x0f,
-        0x58,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_SS,SIZE16,0,0,0,0,0},
-        {AM_V,AT_SS,SIZE16,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "addsd",
-        0xf2,
-        0x0f,
-        0x58,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_SD,SIZE32,0,0,0,0,0},
-        {AM_V,AT_SD,SIZE32,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "mulss",
-        0xf3,
-        0x0f,
-        0x59,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_SS,SIZE16,0,0,0,0,0},
-        {AM_V,AT_SS,SIZE16,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "mulsd",
-        0xf2,
-        0x0f,
-        0x59,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_SD,SIZE32,0,0,0,0,0},
-        {AM_V,AT_SD,SIZE32,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "cvtss2sd",
-        0xf3,
-        0x0f,
-        0x5a,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_SS,SIZE16,0,0,0,0,0},
-        {AM_V,AT_SD,SIZE32,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        1,
-        0
-    },
-    {
-        "cvtsd2ss",
-        0xf2,
-        0x0f,
-        0x5a,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_SD,SIZE32,0,0,0,0,0},
-        {AM_V,AT_SS,SIZE16,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        1,
-        0
-    },
-    {
-        "subss",
-        0xf3,
-        0x0f,
-        0x5c,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_SS,SIZE16,0,0,0,0,0},
-        {AM_V,AT_SS,SIZE16,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "subsd",
-        0xf2,
-        0x0f,
-        0x5c,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_SD,SIZE32,0,0,0,0,0},
-        {AM_V,AT_SD,SIZE32,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "minss",
-        0xf3,
-        0x0f,
-        0x5d,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_SS,SIZE16,0,0,0,0,0},
-        {AM_V,AT_SS,SIZE16,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "minsd",
-        0xf2,
-        0x0f,
-        0x5d,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_SD,SIZE32,0,0,0,0,0},
-        {AM_V,AT_SD,SIZE32,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "divss",
-        0xf3,
-        0x0f,
-        0x5e,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_SS,SIZE16,0,0,0,0,0},
-        {AM_V,AT_SS,SIZE16,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "divsd",
-        0xf2,
-        0x0f,
-        0x5e,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_SD,SIZE32,0,0,0,0,0},
-        {AM_V,AT_SD,SIZE32,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "maxss",
-        0xf3,
-        0x0f,
-        0x5f,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_SS,SIZE16,0,0,0,0,0},
-        {AM_V,AT_SS,SIZE16,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "maxsd",
-        0xf2,
-        0x0f,
-        0x5f,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_SD,SIZE32,0,0,0,0,0},
-        {AM_V,AT_SD,SIZE32,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "punpcklbw",
-        0x66,
-        0x0f,
-        0x60,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "punpcklwd",
-        0x66,
-        0x0f,
-        0x61,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "punpckldq",
-        0x66,
-        0x0f,
-        0x62,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "packsswb",
-        0x66,
-        0x0f,
-        0x63,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        1,
-        0
-    },
-    {
-        "pcmpgtb",
-        0x66,
-        0x0f,
-        0x64,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "pcmpgtw",
-        0x66,
-        0x0f,
-        0x65,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "pcmpgtd",
-        0x66,
-        0x0f,
-        0x66,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "packuswb",
-        0x66,
-        0x0f,
-        0x67,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        1,
-        0
-    },
-    {
-        "punpckhbw",
-        0x66,
-        0x0f,
-        0x68,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "punpckhwd",
-        0x66,
-        0x0f,
-        0x69,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "punpckhdq",
-        0x66,
-        0x0f,
-        0x6a,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "packssdw",
-        0x66,
-        0x0f,
-        0x6b,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        1,
-        0
-    },
-    {
-        "punpcklqdq",
-        0x66,
-        0x0f,
-        0x6c,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "punpckhqdq",
-        0x66,
-        0x0f,
-        0x6d,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "movd",
-        0x66,
-        0x0f,
-        0x6e,
-        0x0,
-        -1,
-        1,
-        {AM_E,AT_D,SIZE32,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "movd",
-        0x66,
-        0x0f,
-        0x6e,
-        0x0,
-        -1,
-        1,
-        {AM_E,AT_D,SIZE32,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "movq",
-        0x66,
-        0x0f,
-        0x6e,
-        0x0,
-        -1,
-        1,
-        {AM_E,AT_QP,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "movdqa",
-        0x66,
-        0x0f,
-        0x6f,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "movdqu",
-        0xf3,
-        0x0f,
-        0x6f,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "pshuflw",
-        0xf2,
-        0x0f,
-        0x70,
-        0x0,
-        -1,
-        1,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "pshufhw",
-        0xf3,
-        0x0f,
-        0x70,
-        0x0,
-        -1,
-        1,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "pshufd",
-        0x66,
-        0x0f,
-        0x70,
-        0x0,
-        -1,
-        1,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "pcmpeqb",
-        0x66,
-        0x0f,
-        0x74,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "pcmpeqw",
-        0x66,
-        0x0f,
-        0x75,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "pcmpeqd",
-        0x66,
-        0x0f,
-        0x76,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "emms",
-        0x00,
-        0x0f,
-        0x77,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        1
-    },
-    {
-        "vmread",
-        0x00,
-        0x0f,
-        0x78,
-        0x0,
-        -1,
-        1,
-        {AM_G,AT_D,SIZE32,0,0,0,0,0},
-        {AM_E,AT_D,SIZE32,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "vmread",
-        0x00,
-        0x0f,
-        0x78,
-        0x0,
-        -1,
-        1,
-        {AM_G,AT_Q,SIZE64,0,0,0,0,0},
-        {AM_E,AT_Q,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "vmwrite",
-        0x00,
-        0x0f,
-        0x79,
-        0x0,
-        -1,
-        1,
-        {AM_E,AT_D,SIZE32,0,0,0,0,0},
-        {AM_G,AT_D,SIZE32,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "vmwrite",
-        0x00,
-        0x0f,
-        0x79,
-        0x0,
-        -1,
-        1,
-        {AM_E,AT_Q,SIZE64,0,0,0,0,0},
-        {AM_G,AT_Q,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "movd",
-        0x66,
-        0x0f,
-        0x7e,
-        0x0,
-        -1,
-        1,
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_E,AT_D,SIZE32,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "movd",
-        0x66,
-        0x0f,
-        0x7e,
-        0x0,
-        -1,
-        1,
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_E,AT_D,SIZE32,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "movq",
-        0x66,
-        0x0f,
-        0x7e,
-        0x0,
-        -1,
-        1,
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_E,AT_QP,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "movq",
-        0xf3,
-        0x0f,
-        0x7e,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_Q,SIZE64,0,0,0,0,0},
-        {AM_V,AT_Q,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "movdqa",
-        0x66,
-        0x0f,
-        0x7f,
-        0x0,
-        -1,
-        1,
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "movdqu",
-        0xf3,
-        0x0f,
-        0x7f,
-        0x0,
-        -1,
-        1,
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "jo",
-        0x00,
-        0x0f,
-        0x80,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_VDS,SIZE16|SIZE32,1,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "jno",
-        0x00,
-        0x0f,
-        0x81,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_VDS,SIZE16|SIZE32,1,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "jb",
-        0x00,
-        0x0f,
-        0x82,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_VDS,SIZE16|SIZE32,1,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "jnae",
-        0x00,
-        0x0f,
-        0x82,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_VDS,SIZE16|SIZE32,1,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "jc",
-        0x00,
-        0x0f,
-        0x82,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_VDS,SIZE16|SIZE32,1,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "jnb",
-        0x00,
-        0x0f,
-        0x83,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_VDS,SIZE16|SIZE32,1,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "jae",
-        0x00,
-        0x0f,
-        0x83,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_VDS,SIZE16|SIZE32,1,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "jnc",
-        0x00,
-        0x0f,
-        0x83,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_VDS,SIZE16|SIZE32,1,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "jz",
-        0x00,
-        0x0f,
-        0x84,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_VDS,SIZE16|SIZE32,1,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "je",
-        0x00,
-        0x0f,
-        0x84,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_VDS,SIZE16|SIZE32,1,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "jnz",
-        0x00,
-        0x0f,
-        0x85,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_VDS,SIZE16|SIZE32,1,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "jne",
-        0x00,
-        0x0f,
-        0x85,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_VDS,SIZE16|SIZE32,1,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "jbe",
-        0x00,
-        0x0f,
-        0x86,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_VDS,SIZE16|SIZE32,1,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "jna",
-        0x00,
-        0x0f,
-        0x86,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_VDS,SIZE16|SIZE32,1,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "jnbe",
-        0x00,
-        0x0f,
-        0x87,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_VDS,SIZE16|SIZE32,1,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "ja",
-        0x00,
-        0x0f,
-        0x87,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_VDS,SIZE16|SIZE32,1,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "js",
-        0x00,
-        0x0f,
-        0x88,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_VDS,SIZE16|SIZE32,1,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "jns",
-        0x00,
-        0x0f,
-        0x89,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_VDS,SIZE16|SIZE32,1,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "jp",
-        0x00,
-        0x0f,
-        0x8a,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_VDS,SIZE16|SIZE32,1,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "jpe",
-        0x00,
-        0x0f,
-        0x8a,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_VDS,SIZE16|SIZE32,1,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "jnp",
-        0x00,
-        0x0f,
-        0x8b,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_VDS,SIZE16|SIZE32,1,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "jpo",
-        0x00,
-        0x0f,
-        0x8b,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_VDS,SIZE16|SIZE32,1,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "jl",
-        0x00,
-        0x0f,
-        0x8c,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_VDS,SIZE16|SIZE32,1,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "jnge",
-        0x00,
-        0x0f,
-        0x8c,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_VDS,SIZE16|SIZE32,1,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "jnl",
-        0x00,
-        0x0f,
-        0x8d,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_VDS,SIZE16|SIZE32,1,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "jge",
-        0x00,
-        0x0f,
-        0x8d,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_VDS,SIZE16|SIZE32,1,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "jle",
-        0x00,
-        0x0f,
-        0x8e,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_VDS,SIZE16|SIZE32,1,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "jng",
-        0x00,
-        0x0f,
-        0x8e,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_VDS,SIZE16|SIZE32,1,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "jnle",
-        0x00,
-        0x0f,
-        0x8f,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_VDS,SIZE16|SIZE32,1,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "jg",
-        0x00,
-        0x0f,
-        0x8f,
-        0x0,
-        -1,
-        0,
-        {AM_J,AT_VDS,SIZE16|SIZE32,1,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "seto",
-        0x00,
-        0x0f,
-        0x90,
-        0x0,
-        0,
-        0,
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "setno",
-        0x00,
-        0x0f,
-        0x91,
-        0x0,
-        0,
-        0,
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "setb",
-        0x00,
-        0x0f,
-        0x92,
-        0x0,
-        0,
-        0,
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "setnae",
-        0x00,
-        0x0f,
-        0x92,
-        0x0,
-        0,
-        0,
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "setc",
-        0x00,
-        0x0f,
-        0x92,
-        0x0,
-        0,
-        0,
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "setnb",
-        0x00,
-        0x0f,
-        0x93,
-        0x0,
-        0,
-        0,
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "setae",
-        0x00,
-        0x0f,
-        0x93,
-        0x0,
-        0,
-        0,
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "setnc",
-        0x00,
-        0x0f,
-        0x93,
-        0x0,
-        0,
-        0,
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "setz",
-        0x00,
-        0x0f,
-        0x94,
-        0x0,
-        0,
-        0,
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "sete",
-        0x00,
-        0x0f,
-        0x94,
-        0x0,
-        0,
-        0,
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "setnz",
-        0x00,
-        0x0f,
-        0x95,
-        0x0,
-        0,
-        0,
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "setne",
-        0x00,
-        0x0f,
-        0x95,
-        0x0,
-        0,
-        0,
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "setbe",
-        0x00,
-        0x0f,
-        0x96,
-        0x0,
-        0,
-        0,
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "setna",
-        0x00,
-        0x0f,
-        0x96,
-        0x0,
-        0,
-        0,
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "setnbe",
-        0x00,
-        0x0f,
-        0x97,
-        0x0,
-        0,
-        0,
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "seta",
-        0x00,
-        0x0f,
-        0x97,
-        0x0,
-        0,
-        0,
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "sets",
-        0x00,
-        0x0f,
-        0x98,
-        0x0,
-        0,
-        0,
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "setns",
-        0x00,
-        0x0f,
-        0x99,
-        0x0,
-        0,
-        0,
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "setp",
-        0x00,
-        0x0f,
-        0x9a,
-        0x0,
-        0,
-        0,
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "setpe",
-        0x00,
-        0x0f,
-        0x9a,
-        0x0,
-        0,
-        0,
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "setnp",
-        0x00,
-        0x0f,
-        0x9b,
-        0x0,
-        0,
-        0,
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "setpo",
-        0x00,
-        0x0f,
-        0x9b,
-        0x0,
-        0,
-        0,
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "setl",
-        0x00,
-        0x0f,
-        0x9c,
-        0x0,
-        0,
-        0,
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "setnge",
-        0x00,
-        0x0f,
-        0x9c,
-        0x0,
-        0,
-        0,
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "setnl",
-        0x00,
-        0x0f,
-        0x9d,
-        0x0,
-        0,
-        0,
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "setge",
-        0x00,
-        0x0f,
-        0x9d,
-        0x0,
-        0,
-        0,
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "setle",
-        0x00,
-        0x0f,
-        0x9e,
-        0x0,
-        0,
-        0,
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "setng",
-        0x00,
-        0x0f,
-        0x9e,
-        0x0,
-        0,
-        0,
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "setnle",
-        0x00,
-        0x0f,
-        0x9f,
-        0x0,
-        0,
-        0,
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "setg",
-        0x00,
-        0x0f,
-        0x9f,
-        0x0,
-        0,
-        0,
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "push",
-        0x00,
-        0x0f,
-        0xa0,
-        0x0,
-        -1,
-        0,
-        {0,AT_W,SIZE16,1,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "pop",
-        0x00,
-        0x0f,
-        0xa1,
-        0x0,
-        -1,
-        0,
-        {0,AT_W,SIZE16,1,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "cpuid",
-        0x00,
-        0x0f,
-        0xa2,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "bt",
-        0x00,
-        0x0f,
-        0xa3,
-        0x0,
-        -1,
-        1,
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "shld",
-        0x00,
-        0x0f,
-        0xa4,
-        0x0,
-        -1,
-        1,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        -1,
-        0,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "shld",
-        0x00,
-        0x0f,
-        0xa5,
-        0x0,
-        -1,
-        1,
-        {0,AT_B,SIZE08,0,0,0,1,1},
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        -1,
-        0,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "push",
-        0x00,
-        0x0f,
-        0xa8,
-        0x0,
-        -1,
-        0,
-        {0,AT_W,SIZE16,1,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "pop",
-        0x00,
-        0x0f,
-        0xa9,
-        0x0,
-        -1,
-        0,
-        {0,AT_W,SIZE16,1,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "rsm",
-        0x00,
-        0x0f,
-        0xaa,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "bts",
-        0x00,
-        0x0f,
-        0xab,
-        0x0,
-        -1,
-        1,
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "shrd",
-        0x00,
-        0x0f,
-        0xac,
-        0x0,
-        -1,
-        1,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        -1,
-        0,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "shrd",
-        0x00,
-        0x0f,
-        0xad,
-        0x0,
-        -1,
-        1,
-        {0,AT_B,SIZE08,0,0,0,1,1},
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        -1,
-        0,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "ldmxcsr",
-        0x00,
-        0x0f,
-        0xae,
-        0x0,
-        2,
-        0,
-        {AM_M,AT_D,SIZE32,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "stmxcsr",
-        0x00,
-        0x0f,
-        0xae,
-        0x0,
-        3,
-        0,
-        {AM_M,AT_D,SIZE32,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "xsave",
-        0x00,
-        0x0f,
-        0xae,
-        0x0,
-        4,
-        0,
-        {AM_M,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "xsave",
-        0x00,
-        0x0f,
-        0xae,
-        0x0,
-        4,
-        0,
-        {AM_M,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "lfence",
-        0x00,
-        0x0f,
-        0xae,
-        0x0,
-        5,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "xrstor",
-        0x00,
-        0x0f,
-        0xae,
-        0x0,
-        5,
-        0,
-        {AM_M,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "xrstor",
-        0x00,
-        0x0f,
-        0xae,
-        0x0,
-        5,
-        0,
-        {AM_M,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "mfence",
-        0x00,
-        0x0f,
-        0xae,
-        0x0,
-        6,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "sfence",
-        0x00,
-        0x0f,
-        0xae,
-        0x0,
-        7,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "clflush",
-        0x00,
-        0x0f,
-        0xae,
-        0x0,
-        7,
-        0,
-        {AM_M,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "imul",
-        0x00,
-        0x0f,
-        0xaf,
-        0x0,
-        -1,
-        1,
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "cmpxchg",
-        0x00,
-        0x0f,
-        0xb0,
-        0x0,
-        -1,
-        1,
-        {AM_G,AT_B,SIZE08,0,0,0,0,0},
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        0,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "cmpxchg",
-        0x00,
-        0x0f,
-        0xb1,
-        0x0,
-        -1,
-        1,
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        0,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "btr",
-        0x00,
-        0x0f,
-        0xb3,
-        0x0,
-        -1,
-        1,
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "movzx",
-        0x00,
-        0x0f,
-        0xb6,
-        0x0,
-        -1,
-        1,
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        1,
-        0,
-        0,
-        1,
-        0
-    },
-    {
-        "movzx",
-        0x00,
-        0x0f,
-        0xb7,
-        0x0,
-        -1,
-        1,
-        {AM_E,AT_W,SIZE16,1,0,0,0,0},
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        1,
-        0,
-        0,
-        1,
-        0
-    },
-    {
-        "jmpe",
-        0x00,
-        0x0f,
-        0xb8,
-        0x0,
-        -1,
-        0,
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        1,
-        0,
-        0
-    },
-    {
-        "popcnt",
-        0xf3,
-        0x0f,
-        0xb8,
-        0x0,
-        -1,
-        1,
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "ud",
-        0x00,
-        0x0f,
-        0xb9,
-        0x0,
-        -1,
-        1,
-        {AM_E,0,0,0,0,0,0,0},
-        {AM_G,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "bt",
-        0x00,
-        0x0f,
-        0xba,
-        0x0,
-        4,
-        0,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "bts",
-        0x00,
-        0x0f,
-        0xba,
-        0x0,
-        5,
-        0,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "btr",
-        0x00,
-        0x0f,
-        0xba,
-        0x0,
-        6,
-        0,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "btc",
-        0x00,
-        0x0f,
-        0xba,
-        0x0,
-        7,
-        0,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "btc",
-        0x00,
-        0x0f,
-        0xbb,
-        0x0,
-        -1,
-        1,
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "bsf",
-        0x00,
-        0x0f,
-        0xbc,
-        0x0,
-        -1,
-        1,
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "bsr",
-        0x00,
-        0x0f,
-        0xbd,
-        0x0,
-        -1,
-        1,
-        {AM_E,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "movsx",
-        0x00,
-        0x0f,
-        0xbe,
-        0x0,
-        -1,
-        1,
-        {AM_E,AT_B,SIZE08,0,0,0,0,0},
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        0,
-        1,
-        0,
-        0,
-        1,
-        0
-    },
-    {
-        "movsx",
-        0x00,
-        0x0f,
-        0xbf,
-        0x0,
-        -1,
-        1,
-        {AM_E,AT_W,SIZE16,1,0,0,0,0},
-        {AM_G,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        1,
-        1,
-        0,
-        0,
-        1,
-        0
-    },
-    {
-        "cmpss",
-        0xf3,
-        0x0f,
-        0xc2,
-        0x0,
-        -1,
-        1,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {AM_W,AT_SS,SIZE16,0,0,0,0,0},
-        {AM_V,AT_SS,SIZE16,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "cmpsd",
-        0xf2,
-        0x0f,
-        0xc2,
-        0x0,
-        -1,
-        1,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {AM_W,AT_SD,SIZE32,0,0,0,0,0},
-        {AM_V,AT_SD,SIZE32,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "movnti",
-        0x00,
-        0x0f,
-        0xc3,
-        0x0,
-        -1,
-        1,
-        {AM_G,AT_DQP,SIZE32|SIZE64,0,0,0,0,0},
-        {AM_M,AT_DQP,SIZE32|SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "pinsrw",
-        0x66,
-        0x0f,
-        0xc4,
-        0x0,
-        -1,
-        1,
-        {AM_I,AT_B,SIZE08,0,0,0,0,0},
-        {AM_M,AT_W,SIZE16,1,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "cmpxchg8b",
-        0x00,
-        0x0f,
-        0xc7,
-        0x0,
-        1,
-        0,
-        {AM_M,AT_Q,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "cmpxchg8b",
-        0x00,
-        0x0f,
-        0xc7,
-        0x0,
-        1,
-        0,
-        {AM_M,AT_Q,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "cmpxchg16b",
-        0x00,
-        0x0f,
-        0xc7,
-        0x0,
-        1,
-        0,
-        {AM_M,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "vmptrld",
-        0x00,
-        0x0f,
-        0xc7,
-        0x0,
-        6,
-        0,
-        {AM_M,AT_Q,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "vmclear",
-        0x66,
-        0x0f,
-        0xc7,
-        0x0,
-        6,
-        0,
-        {AM_M,AT_Q,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "vmxon",
-        0xf3,
-        0x0f,
-        0xc7,
-        0x0,
-        6,
-        0,
-        {AM_M,AT_Q,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "vmptrst",
-        0x00,
-        0x0f,
-        0xc7,
-        0x0,
-        7,
-        0,
-        {AM_M,AT_Q,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "bswap",
-        0x00,
-        0x0f,
-        0xc8,
-        0x0,
-        -1,
-        0,
-        {AM_Z,AT_VQP,SIZE16|SIZE32|SIZE64,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "psrlw",
-        0x66,
-        0x0f,
-        0xd1,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "psrld",
-        0x66,
-        0x0f,
-        0xd2,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "psrlq",
-        0x66,
-        0x0f,
-        0xd3,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "paddq",
-        0x66,
-        0x0f,
-        0xd4,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "pmullw",
-        0x66,
-        0x0f,
-        0xd5,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "movq",
-        0x66,
-        0x0f,
-        0xd6,
-        0x0,
-        -1,
-        1,
-        {AM_V,AT_Q,SIZE64,0,0,0,0,0},
-        {AM_W,AT_Q,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "psubusb",
-        0x66,
-        0x0f,
-        0xd8,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "psubusw",
-        0x66,
-        0x0f,
-        0xd9,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "pminub",
-        0x66,
-        0x0f,
-        0xda,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "pand",
-        0x66,
-        0x0f,
-        0xdb,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "paddusb",
-        0x66,
-        0x0f,
-        0xdc,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "paddusw",
-        0x66,
-        0x0f,
-        0xdd,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "pmaxub",
-        0x66,
-        0x0f,
-        0xde,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "pandn",
-        0x66,
-        0x0f,
-        0xdf,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "pavgb",
-        0x66,
-        0x0f,
-        0xe0,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "psraw",
-        0x66,
-        0x0f,
-        0xe1,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "psrad",
-        0x66,
-        0x0f,
-        0xe2,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "pavgw",
-        0x66,
-        0x0f,
-        0xe3,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "pmulhuw",
-        0x66,
-        0x0f,
-        0xe4,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "pmulhw",
-        0x66,
-        0x0f,
-        0xe5,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "movntdq",
-        0x66,
-        0x0f,
-        0xe7,
-        0x0,
-        -1,
-        1,
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_M,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "psubsb",
-        0x66,
-        0x0f,
-        0xe8,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "psubsw",
-        0x66,
-        0x0f,
-        0xe9,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "pminsw",
-        0x66,
-        0x0f,
-        0xea,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "por",
-        0x66,
-        0x0f,
-        0xeb,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "paddsb",
-        0x66,
-        0x0f,
-        0xec,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "paddsw",
-        0x66,
-        0x0f,
-        0xed,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "pmaxsw",
-        0x66,
-        0x0f,
-        0xee,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "pxor",
-        0x66,
-        0x0f,
-        0xef,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "lddqu",
-        0xf2,
-        0x0f,
-        0xf0,
-        0x0,
-        -1,
-        1,
-        {AM_M,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "psllw",
-        0x66,
-        0x0f,
-        0xf1,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "pslld",
-        0x66,
-        0x0f,
-        0xf2,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "psllq",
-        0x66,
-        0x0f,
-        0xf3,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "pmuludq",
-        0x66,
-        0x0f,
-        0xf4,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "pmaddwd",
-        0x66,
-        0x0f,
-        0xf5,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "psadbw",
-        0x66,
-        0x0f,
-        0xf6,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "psubb",
-        0x66,
-        0x0f,
-        0xf8,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "psubw",
-        0x66,
-        0x0f,
-        0xf9,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "psubd",
-        0x66,
-        0x0f,
-        0xfa,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "psubq",
-        0x66,
-        0x0f,
-        0xfb,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "paddb",
-        0x66,
-        0x0f,
-        0xfc,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "paddw",
-        0x66,
-        0x0f,
-        0xfd,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
-    {
-        "paddd",
-        0x66,
-        0x0f,
-        0xfe,
-        0x0,
-        -1,
-        1,
-        {AM_W,AT_DQ,SIZE64,0,0,0,0,0},
-        {AM_V,AT_DQ,SIZE64,0,0,0,0,0},
-        {0,0,0,0,0,0,0,0},
-        -1,
-        -1,
-        0,
-        0,
-        0,
-        0
-    },
+    { 0,0x00,0x00,0x00,0x0,-1,0,0,1,0 }, // add
+    { 0,0x00,0x00,0x01,0x0,-1,1,0,1,0 }, // add
+    { 0,0x00,0x00,0x02,0x0,-1,0,1,1,0 }, // add
+    { 0,0x00,0x00,0x03,0x0,-1,1,1,1,0 }, // add
+    { 0,0x00,0x00,0x04,0x0,-1,0,-1,0,0 }, // add
+    { 0,0x00,0x00,0x05,0x0,-1,1,-1,0,0 }, // add
+    { 1,0x00,0x00,0x08,0x0,-1,0,0,1,0 }, // or
+    { 1,0x00,0x00,0x09,0x0,-1,1,0,1,0 }, // or
+    { 1,0x00,0x00,0x0a,0x0,-1,0,1,1,0 }, // or
+    { 1,0x00,0x00,0x0b,0x0,-1,1,1,1,0 }, // or
+    { 1,0x00,0x00,0x0c,0x0,-1,0,-1,0,0 }, // or
+    { 1,0x00,0x00,0x0d,0x0,-1,1,-1,0,0 }, // or
+    { 2,0x00,0x00,0x0f,0x0,-1,-1,-1,0,0 }, // pop
+    { 3,0x00,0x00,0x10,0x0,-1,0,0,1,0 }, // adc
+    { 3,0x00,0x00,0x11,0x0,-1,1,0,1,0 }, // adc
+    { 3,0x00,0x00,0x12,0x0,-1,0,1,1,0 }, // adc
+    { 3,0x00,0x00,0x13,0x0,-1,1,1,1,0 }, // adc
+    { 3,0x00,0x00,0x14,0x0,-1,0,-1,0,0 }, // adc
+    { 3,0x00,0x00,0x15,0x0,-1,1,-1,0,0 }, // adc
+    { 4,0x00,0x00,0x18,0x0,-1,0,0,1,0 }, // sbb
+    { 4,0x00,0x00,0x19,0x0,-1,1,0,1,0 }, // sbb
+    { 4,0x00,0x00,0x1a,0x0,-1,0,1,1,0 }, // sbb
+    { 4,0x00,0x00,0x1b,0x0,-1,1,1,1,0 }, // sbb
+    { 4,0x00,0x00,0x1c,0x0,-1,0,-1,0,0 }, // sbb
+    { 4,0x00,0x00,0x1d,0x0,-1,1,-1,0,0 }, // sbb
+    { 5,0x00,0x00,0x20,0x0,-1,0,0,1,0 }, // and
+    { 5,0x00,0x00,0x21,0x0,-1,1,0,1,0 }, // and
+    { 5,0x00,0x00,0x22,0x0,-1,0,1,1,0 }, // and
+    { 5,0x00,0x00,0x23,0x0,-1,1,1,1,0 }, // and
+    { 5,0x00,0x00,0x24,0x0,-1,0,-1,0,0 }, // and
+    { 5,0x00,0x00,0x25,0x0,-1,1,-1,0,0 }, // and
+    { 6,0x00,0x00,0x26,0x0,-1,-1,-1,0,0 }, // es
+    { 7,0x00,0x00,0x28,0x0,-1,0,0,1,0 }, // sub
+    { 7,0x00,0x00,0x29,0x0,-1,1,0,1,0 }, // sub
+    { 7,0x00,0x00,0x2a,0x0,-1,0,1,1,0 }, // sub
+    { 7,0x00,0x00,0x2b,0x0,-1,1,1,1,0 }, // sub
+    { 7,0x00,0x00,0x2c,0x0,-1,0,-1,0,0 }, // sub
+    { 7,0x00,0x00,0x2d,0x0,-1,1,-1,0,0 }, // sub
+    { 8,0x00,0x00,0x2e,0x0,-1,-1,-1,0,0 }, // cs
+    { 9,0x00,0x00,0x2e,0x0,-1,-1,-1,0,0 }, // ntaken
+    { 10,0x00,0x00,0x30,0x0,-1,0,0,1,0 }, // xor
+    { 10,0x00,0x00,0x31,0x0,-1,1,0,1,0 }, // xor
+    { 10,0x00,0x00,0x32,0x0,-1,0,1,1,0 }, // xor
+    { 10,0x00,0x00,0x33,0x0,-1,1,1,1,0 }, // xor
+    { 10,0x00,0x00,0x34,0x0,-1,0,-1,0,0 }, // xor
+    { 10,0x00,0x00,0x35,0x0,-1,1,-1,0,0 }, // xor
+    { 11,0x00,0x00,0x36,0x0,-1,-1,-1,0,0 }, // ss
+    { 12,0x00,0x00,0x38,0x0,-1,0,0,1,0 }, // cmp
+    { 12,0x00,0x00,0x39,0x0,-1,1,0,1,0 }, // cmp
+    { 12,0x00,0x00,0x3a,0x0,-1,0,1,1,0 }, // cmp
+    { 12,0x00,0x00,0x3b,0x0,-1,1,1,1,0 }, // cmp
+    { 12,0x00,0x00,0x3c,0x0,-1,0,-1,0,0 }, // cmp
+    { 12,0x00,0x00,0x3d,0x0,-1,1,-1,0,0 }, // cmp
+    { 13,0x00,0x00,0x3e,0x0,-1,-1,-1,0,0 }, // ds
+    { 14,0x00,0x00,0x3e,0x0,-1,-1,-1,0,0 }, // taken
+    { 15,0x00,0x00,0x40,0x0,-1,-1,-1,0,0 }, // inc
+    { 16,0x00,0x00,0x40,0x0,-1,-1,-1,0,0 }, // rex
+    { 17,0x00,0x00,0x41,0x0,-1,-1,-1,0,0 }, // rex.b
+    { 18,0x00,0x00,0x42,0x0,-1,-1,-1,0,0 }, // rex.x
+    { 19,0x00,0x00,0x43,0x0,-1,-1,-1,0,0 }, // rex.xb
+    { 20,0x00,0x00,0x44,0x0,-1,-1,-1,0,0 }, // rex.r
+    { 21,0x00,0x00,0x45,0x0,-1,-1,-1,0,0 }, // rex.rb
+    { 22,0x00,0x00,0x46,0x0,-1,-1,-1,0,0 }, // rex.rx
+    { 23,0x00,0x00,0x47,0x0,-1,-1,-1,0,0 }, // rex.rxb
+    { 24,0x00,0x00,0x48,0x0,-1,-1,-1,0,0 }, // dec
+    { 25,0x00,0x00,0x48,0x0,-1,-1,-1,0,0 }, // rex.w
+    { 26,0x00,0x00,0x49,0x0,-1,-1,-1,0,0 }, // rex.wb
+    { 27,0x00,0x00,0x4a,0x0,-1,-1,-1,0,0 }, // rex.wx
+    { 28,0x00,0x00,0x4b,0x0,-1,-1,-1,0,0 }, // rex.wxb
+    { 29,0x00,0x00,0x4c,0x0,-1,-1,-1,0,0 }, // rex.wr
+    { 30,0x00,0x00,0x4d,0x0,-1,-1,-1,0,0 }, // rex.wrb
+    { 31,0x00,0x00,0x4e,0x0,-1,-1,-1,0,0 }, // rex.wrx
+    { 32,0x00,0x00,0x4f,0x0,-1,-1,-1,0,0 }, // rex.wrxb
+    { 33,0x00,0x00,0x50,0x0,-1,-1,-1,0,1 }, // push
+    { 33,0x00,0x00,0x50,0x0,-1,-1,-1,0,1 }, // push
+    { 2,0x00,0x00,0x58,0x0,-1,-1,-1,0,0 }, // pop
+    { 2,0x00,0x00,0x58,0x0,-1,-1,-1,0,0 }, // pop
+    { 34,0x00,0x00,0x63,0x0,-1,-1,-1,1,0 }, // arpl
+    { 35,0x00,0x00,0x63,0x0,-1,-1,1,1,0 }, // movsxd
+    { 36,0x00,0x00,0x64,0x0,-1,-1,-1,0,0 }, // fs
+    { 37,0x00,0x00,0x64,0x0,-1,-1,-1,0,0 }, // alter
+    { 38,0x00,0x00,0x65,0x0,-1,-1,-1,0,0 }, // gs
+    { 33,0x00,0x00,0x68,0x0,-1,-1,-1,0,1 }, // push
+    { 39,0x00,0x00,0x69,0x0,-1,-1,-1,1,0 }, // imul
+    { 33,0x00,0x00,0x6a,0x0,-1,-1,-1,0,1 }, // push
+    { 39,0x00,0x00,0x6b,0x0,-1,-1,-1,1,0 }, // imul
+    { 40,0x00,0x00,0x6c,0x0,-1,0,-1,0,0 }, // ins
+    { 41,0x00,0x00,0x6c,0x0,-1,0,-1,0,0 }, // insb
+    { 42,0x00,0x00,0x6d,0x0,-1,1,-1,0,0 }, // insw
+    { 40,0x00,0x00,0x6d,0x0,-1,1,-1,0,0 }, // ins
+    { 43,0x00,0x00,0x6d,0x0,-1,1,-1,0,0 }, // insd
+    { 44,0x00,0x00,0x6e,0x0,-1,0,-1,0,0 }, // outs
+    { 45,0x00,0x00,0x6e,0x0,-1,0,-1,0,0 }, // outsb
+    { 46,0x00,0x00,0x6f,0x0,-1,1,-1,0,0 }, // outsw
+    { 44,0x00,0x00,0x6f,0x0,-1,1,-1,0,0 }, // outs
+    { 47,0x00,0x00,0x6f,0x0,-1,1,-1,0,0 }, // outsd
+    { 48,0x00,0x00,0x70,0x0,-1,-1,-1,0,0 }, // jo
+    { 49,0x00,0x00,0x71,0x0,-1,-1,-1,0,0 }, // jno
+    { 50,0x00,0x00,0x72,0x0,-1,-1,-1,0,0 }, // jb
+    { 51,0x00,0x00,0x72,0x0,-1,-1,-1,0,0 }, // jnae
+    { 52,0x00,0x00,0x72,0x0,-1,-1,-1,0,0 }, // jc
+    { 53,0x00,0x00,0x73,0x0,-1,-1,-1,0,0 }, // jnb
+    { 54,0x00,0x00,0x73,0x0,-1,-1,-1,0,0 }, // jae
+    { 55,0x00,0x00,0x73,0x0,-1,-1,-1,0,0 }, // jnc
+    { 56,0x00,0x00,0x74,0x0,-1,-1,-1,0,0 }, // jz
+    { 57,0x00,0x00,0x74,0x0,-1,-1,-1,0,0 }, // je
+    { 58,0x00,0x00,0x75,0x0,-1,-1,-1,0,0 }, // jnz
+    { 59,0x00,0x00,0x75,0x0,-1,-1,-1,0,0 }, // jne
+    { 60,0x00,0x00,0x76,0x0,-1,-1,-1,0,0 }, // jbe
+    { 61,0x00,0x00,0x76,0x0,-1,-1,-1,0,0 }, // jna
+    { 62,0x00,0x00,0x77,0x0,-1,-1,-1,0,0 }, // jnbe
+    { 63,0x00,0x00,0x77,0x0,-1,-1,-1,0,0 }, // ja
+    { 64,0x00,0x00,0x78,0x0,-1,-1,-1,0,0 }, // js
+    { 65,0x00,0x00,0x79,0x0,-1,-1,-1,0,0 }, // jns
+    { 66,0x00,0x00,0x7a,0x0,-1,-1,-1,0,0 }, // jp
+    { 67,0x00,0x00,0x7a,0x0,-1,-1,-1,0,0 }, // jpe
+    { 68,0x00,0x00,0x7b,0x0,-1,-1,-1,0,0 }, // jnp
+    { 69,0x00,0x00,0x7b,0x0,-1,-1,-1,0,0 }, // jpo
+    { 70,0x00,0x00,0x7c,0x0,-1,-1,-1,0,0 }, // jl
+    { 71,0x00,0x00,0x7c,0x0,-1,-1,-1,0,0 }, // jnge
+    { 72,0x00,0x00,0x7d,0x0,-1,-1,-1,0,0 }, // jnl
+    { 73,0x00,0x00,0x7d,0x0,-1,-1,-1,0,0 }, // jge
+    { 74,0x00,0x00,0x7e,0x0,-1,-1,-1,0,0 }, // jle
+    { 75,0x00,0x00,0x7e,0x0,-1,-1,-1,0,0 }, // jng
+    { 76,0x00,0x00,0x7f,0x0,-1,-1,-1,0,0 }, // jnle
+    { 77,0x00,0x00,0x7f,0x0,-1,-1,-1,0,0 }, // jg
+    { 0,0x00,0x00,0x80,0x0,0,0,-1,0,0 }, // add
+    { 1,0x00,0x00,0x80,0x0,1,0,-1,0,0 }, // or
+    { 3,0x00,0x00,0x80,0x0,2,0,-1,0,0 }, // adc
+    { 4,0x00,0x00,0x80,0x0,3,0,-1,0,0 }, // sbb
+    { 5,0x00,0x00,0x80,0x0,4,0,-1,0,0 }, // and
+    { 7,0x00,0x00,0x80,0x0,5,0,-1,0,0 }, // sub
+    { 10,0x00,0x00,0x80,0x0,6,0,-1,0,0 }, // xor
+    { 12,0x00,0x00,0x80,0x0,7,0,-1,0,0 }, // cmp
+    { 0,0x00,0x00,0x81,0x0,0,1,-1,0,0 }, // add
+    { 1,0x00,0x00,0x81,0x0,1,1,-1,0,0 }, // or
+    { 3,0x00,0x00,0x81,0x0,2,1,-1,0,0 }, // adc
+    { 4,0x00,0x00,0x81,0x0,3,1,-1,0,0 }, // sbb
+    { 5,0x00,0x00,0x81,0x0,4,1,-1,0,0 }, // and
+    { 7,0x00,0x00,0x81,0x0,5,1,-1,0,0 }, // sub
+    { 10,0x00,0x00,0x81,0x0,6,1,-1,0,0 }, // xor
+    { 12,0x00,0x00,0x81,0x0,7,1,-1,0,0 }, // cmp
+    { 0,0x00,0x00,0x83,0x0,0,1,-1,0,0 }, // add
+    { 1,0x00,0x00,0x83,0x0,1,1,-1,0,0 }, // or
+    { 3,0x00,0x00,0x83,0x0,2,1,-1,0,0 }, // adc
+    { 4,0x00,0x00,0x83,0x0,3,1,-1,0,0 }, // sbb
+    { 5,0x00,0x00,0x83,0x0,4,1,-1,0,0 }, // and
+    { 7,0x00,0x00,0x83,0x0,5,1,-1,0,0 }, // sub
+    { 10,0x00,0x00,0x83,0x0,6,1,-1,0,0 }, // xor
+    { 12,0x00,0x00,0x83,0x0,7,1,-1,0,0 }, // cmp
+    { 78,0x00,0x00,0x84,0x0,-1,0,0,1,0 }, // test
+    { 78,0x00,0x00,0x85,0x0,-1,1,0,1,0 }, // test
+    { 79,0x00,0x00,0x88,0x0,-1,0,0,1,0 }, // mov
+    { 79,0x00,0x00,0x89,0x0,-1,1,0,1,0 }, // mov
+    { 79,0x00,0x00,0x8a,0x0,-1,0,1,1,0 }, // mov
+    { 79,0x00,0x00,0x8b,0x0,-1,1,1,1,0 }, // mov
+    { 80,0x00,0x00,0x8d,0x0,-1,-1,-1,1,0 }, // lea
+    { 2,0x00,0x00,0x8f,0x0,0,1,-1,0,0 }, // pop
+    { 2,0x00,0x00,0x8f,0x0,0,1,-1,0,0 }, // pop
+    { 81,0x00,0x00,0x90,0x0,-1,-1,-1,0,0 }, // nop
+    { 81,0xf3,0x00,0x90,0x0,-1,-1,-1,0,0 }, // nop
+    { 82,0xf3,0x00,0x90,0x0,-1,-1,-1,0,0 }, // pause
+    { 83,0x00,0x00,0x98,0x0,-1,-1,-1,0,0 }, // cbw
+    { 84,0x00,0x00,0x98,0x0,-1,-1,-1,0,0 }, // cwde
+    { 83,0x00,0x00,0x98,0x0,-1,-1,-1,0,0 }, // cbw
+    { 84,0x00,0x00,0x98,0x0,-1,-1,-1,0,0 }, // cwde
+    { 85,0x00,0x00,0x98,0x0,-1,-1,-1,0,0 }, // cdqe
+    { 86,0x00,0x00,0x99,0x0,-1,-1,-1,0,0 }, // cwd
+    { 87,0x00,0x00,0x99,0x0,-1,-1,-1,0,0 }, // cdq
+    { 86,0x00,0x00,0x99,0x0,-1,-1,-1,0,0 }, // cwd
+    { 87,0x00,0x00,0x99,0x0,-1,-1,-1,0,0 }, // cdq
+    { 88,0x00,0x00,0x99,0x0,-1,-1,-1,0,0 }, // cqo
+    { 89,0x00,0x00,0x9b,0x0,-1,-1,-1,0,0 }, // fwait
+    { 90,0x00,0x00,0x9b,0x0,-1,-1,-1,0,0 }, // wait
+    { 91,0x00,0x00,0x9c,0x0,-1,-1,-1,0,0 }, // pushf
+    { 92,0x00,0x00,0x9c,0x0,-1,-1,-1,0,0 }, // pushfd
+    { 91,0x00,0x00,0x9c,0x0,-1,-1,-1,0,0 }, // pushf
+    { 93,0x00,0x00,0x9c,0x0,-1,-1,-1,0,0 }, // pushfq
+    { 94,0x00,0x00,0x9d,0x0,-1,-1,-1,0,0 }, // popf
+    { 95,0x00,0x00,0x9d,0x0,-1,-1,-1,0,0 }, // popfd
+    { 94,0x00,0x00,0x9d,0x0,-1,-1,-1,0,0 }, // popf
+    { 96,0x00,0x00,0x9d,0x0,-1,-1,-1,0,0 }, // popfq
+    { 97,0x00,0x00,0x9e,0x0,-1,-1,-1,0,0 }, // sahf
+    { 98,0x00,0x00,0x9f,0x0,-1,-1,-1,0,0 }, // lahf
+    { 99,0x00,0x00,0xa4,0x0,-1,0,-1,0,0 }, // movs
+    { 100,0x00,0x00,0xa4,0x0,-1,0,-1,0,0 }, // movsb
+    { 101,0x00,0x00,0xa5,0x0,-1,1,-1,0,0 }, // movsw
+    { 99,0x00,0x00,0xa5,0x0,-1,1,-1,0,0 }, // movs
+    { 102,0x00,0x00,0xa5,0x0,-1,1,-1,0,0 }, // movsd
+    { 99,0x00,0x00,0xa5,0x0,-1,1,-1,0,0 }, // movs
+    { 101,0x00,0x00,0xa5,0x0,-1,1,-1,0,0 }, // movsw
+    { 102,0x00,0x00,0xa5,0x0,-1,1,-1,0,0 }, // movsd
+    { 103,0x00,0x00,0xa5,0x0,-1,1,-1,0,0 }, // movsq
+    { 104,0x00,0x00,0xa6,0x0,-1,0,-1,0,0 }, // cmps
+    { 105,0x00,0x00,0xa6,0x0,-1,0,-1,0,0 }, // cmpsb
+    { 106,0x00,0x00,0xa7,0x0,-1,1,-1,0,0 }, // cmpsw
+    { 104,0x00,0x00,0xa7,0x0,-1,1,-1,0,0 }, // cmps
+    { 107,0x00,0x00,0xa7,0x0,-1,1,-1,0,0 }, // cmpsd
+    { 104,0x00,0x00,0xa7,0x0,-1,1,-1,0,0 }, // cmps
+    { 106,0x00,0x00,0xa7,0x0,-1,1,-1,0,0 }, // cmpsw
+    { 107,0x00,0x00,0xa7,0x0,-1,1,-1,0,0 }, // cmpsd
+    { 108,0x00,0x00,0xa7,0x0,-1,1,-1,0,0 }, // cmpsq
+    { 78,0x00,0x00,0xa8,0x0,-1,0,-1,0,0 }, // test
+    { 78,0x00,0x00,0xa9,0x0,-1,1,-1,0,0 }, // test
+    { 109,0x00,0x00,0xaa,0x0,-1,0,-1,0,0 }, // stos
+    { 110,0x00,0x00,0xaa,0x0,-1,0,-1,0,0 }, // stosb
+    { 111,0x00,0x00,0xab,0x0,-1,1,-1,0,0 }, // stosw
+    { 109,0x00,0x00,0xab,0x0,-1,1,-1,0,0 }, // stos
+    { 112,0x00,0x00,0xab,0x0,-1,1,-1,0,0 }, // stosd
+    { 109,0x00,0x00,0xab,0x0,-1,1,-1,0,0 }, // stos
+    { 111,0x00,0x00,0xab,0x0,-1,1,-1,0,0 }, // stosw
+    { 112,0x00,0x00,0xab,0x0,-1,1,-1,0,0 }, // stosd
+    { 113,0x00,0x00,0xab,0x0,-1,1,-1,0,0 }, // stosq
+    { 114,0x00,0x00,0xac,0x0,-1,0,-1,0,0 }, // lods
+    { 115,0x00,0x00,0xac,0x0,-1,0,-1,0,0 }, // lodsb
+    { 116,0x00,0x00,0xad,0x0,-1,1,-1,0,0 }, // lodsw
+    { 114,0x00,0x00,0xad,0x0,-1,1,-1,0,0 }, // lods
+    { 117,0x00,0x00,0xad,0x0,-1,1,-1,0,0 }, // lodsd
+    { 114,0x00,0x00,0xad,0x0,-1,1,-1,0,0 }, // lods
+    { 116,0x00,0x00,0xad,0x0,-1,1,-1,0,0 }, // lodsw
+    { 117,0x00,0x00,0xad,0x0,-1,1,-1,0,0 }, // lodsd
+    { 118,0x00,0x00,0xad,0x0,-1,1,-1,0,0 }, // lodsq
+    { 119,0x00,0x00,0xae,0x0,-1,0,-1,0,0 }, // scas
+    { 120,0x00,0x00,0xae,0x0,-1,0,-1,0,0 }, // scasb
+    { 121,0x00,0x00,0xaf,0x0,-1,1,-1,0,0 }, // scasw
+    { 119,0x00,0x00,0xaf,0x0,-1,1,-1,0,0 }, // scas
+    { 122,0x00,0x00,0xaf,0x0,-1,1,-1,0,0 }, // scasd
+    { 119,0x00,0x00,0xaf,0x0,-1,1,-1,0,0 }, // scas
+    { 121,0x00,0x00,0xaf,0x0,-1,1,-1,0,0 }, // scasw
+    { 122,0x00,0x00,0xaf,0x0,-1,1,-1,0,0 }, // scasd
+    { 123,0x00,0x00,0xaf,0x0,-1,1,-1,0,0 }, // scasq
+    { 79,0x00,0x00,0xb0,0x0,-1,-1,-1,0,0 }, // mov
+    { 79,0x00,0x00,0xb8,0x0,-1,-1,-1,0,0 }, // mov
+    { 124,0x00,0x00,0xc0,0x0,0,0,-1,0,0 }, // rol
+    { 125,0x00,0x00,0xc0,0x0,1,0,-1,0,0 }, // ror
+    { 126,0x00,0x00,0xc0,0x0,2,0,-1,0,0 }, // rcl
+    { 127,0x00,0x00,0xc0,0x0,3,0,-1,0,0 }, // rcr
+    { 128,0x00,0x00,0xc0,0x0,4,0,-1,0,0 }, // shl
+    { 129,0x00,0x00,0xc0,0x0,4,0,-1,0,0 }, // sal
+    { 130,0x00,0x00,0xc0,0x0,5,0,-1,0,0 }, // shr
+    { 129,0x00,0x00,0xc0,0x0,6,0,-1,0,0 }, // sal
+    { 128,0x00,0x00,0xc0,0x0,6,0,-1,0,0 }, // shl
+    { 131,0x00,0x00,0xc0,0x0,7,0,-1,0,0 }, // sar
+    { 124,0x00,0x00,0xc1,0x0,0,1,-1,0,0 }, // rol
+    { 125,0x00,0x00,0xc1,0x0,1,1,-1,0,0 }, // ror
+    { 126,0x00,0x00,0xc1,0x0,2,1,-1,0,0 }, // rcl
+    { 127,0x00,0x00,0xc1,0x0,3,1,-1,0,0 }, // rcr
+    { 128,0x00,0x00,0xc1,0x0,4,1,-1,0,0 }, // shl
+    { 129,0x00,0x00,0xc1,0x0,4,1,-1,0,0 }, // sal
+    { 130,0x00,0x00,0xc1,0x0,5,1,-1,0,0 }, // shr
+    { 129,0x00,0x00,0xc1,0x0,6,1,-1,0,0 }, // sal
+    { 128,0x00,0x00,0xc1,0x0,6,1,-1,0,0 }, // shl
+    { 131,0x00,0x00,0xc1,0x0,7,1,-1,0,0 }, // sar
+    { 132,0x00,0x00,0xc2,0x0,-1,-1,-1,0,0 }, // retn
+    { 132,0x00,0x00,0xc3,0x0,-1,-1,-1,0,0 }, // retn
+    { 79,0x00,0x00,0xc6,0x0,0,0,-1,0,0 }, // mov
+    { 79,0x00,0x00,0xc7,0x0,0,1,-1,0,0 }, // mov
+    { 133,0x00,0x00,0xc8,0x0,-1,-1,-1,0,0 }, // enter
+    { 133,0x00,0x00,0xc8,0x0,-1,-1,-1,0,0 }, // enter
+    { 134,0x00,0x00,0xc9,0x0,-1,-1,-1,0,0 }, // leave
+    { 134,0x00,0x00,0xc9,0x0,-1,-1,-1,0,0 }, // leave
+    { 135,0x00,0x00,0xca,0x0,-1,-1,-1,0,0 }, // retf
+    { 135,0x00,0x00,0xcb,0x0,-1,-1,-1,0,0 }, // retf
+    { 136,0x00,0x00,0xcc,0x0,-1,-1,-1,0,0 }, // int
+    { 136,0x00,0x00,0xcd,0x0,-1,-1,-1,0,0 }, // int
+    { 137,0x00,0x00,0xce,0x0,-1,-1,-1,0,0 }, // into
+    { 138,0x00,0x00,0xcf,0x0,-1,-1,-1,0,0 }, // iret
+    { 139,0x00,0x00,0xcf,0x0,-1,-1,-1,0,0 }, // iretd
+    { 138,0x00,0x00,0xcf,0x0,-1,-1,-1,0,0 }, // iret
+    { 139,0x00,0x00,0xcf,0x0,-1,-1,-1,0,0 }, // iretd
+    { 140,0x00,0x00,0xcf,0x0,-1,-1,-1,0,0 }, // iretq
+    { 124,0x00,0x00,0xd0,0x0,0,0,-1,0,0 }, // rol
+    { 125,0x00,0x00,0xd0,0x0,1,0,-1,0,0 }, // ror
+    { 126,0x00,0x00,0xd0,0x0,2,0,-1,0,0 }, // rcl
+    { 127,0x00,0x00,0xd0,0x0,3,0,-1,0,0 }, // rcr
+    { 128,0x00,0x00,0xd0,0x0,4,0,-1,0,0 }, // shl
+    { 129,0x00,0x00,0xd0,0x0,4,0,-1,0,0 }, // sal
+    { 130,0x00,0x00,0xd0,0x0,5,0,-1,0,0 }, // shr
+    { 129,0x00,0x00,0xd0,0x0,6,0,-1,0,0 }, // sal
+    { 128,0x00,0x00,0xd0,0x0,6,0,-1,0,0 }, // shl
+    { 131,0x00,0x00,0xd0,0x0,7,0,-1,0,0 }, // sar
+    { 124,0x00,0x00,0xd1,0x0,0,1,-1,0,0 }, // rol
+    { 125,0x00,0x00,0xd1,0x0,1,1,-1,0,0 }, // ror
+    { 126,0x00,0x00,0xd1,0x0,2,1,-1,0,0 }, // rcl
+    { 127,0x00,0x00,0xd1,0x0,3,1,-1,0,0 }, // rcr
+    { 128,0x00,0x00,0xd1,0x0,4,1,-1,0,0 }, // shl
+    { 129,0x00,0x00,0xd1,0x0,4,1,-1,0,0 }, // sal
+    { 130,0x00,0x00,0xd1,0x0,5,1,-1,0,0 }, // shr
+    { 129,0x00,0x00,0xd1,0x0,6,1,-1,0,0 }, // sal
+    { 128,0x00,0x00,0xd1,0x0,6,1,-1,0,0 }, // shl
+    { 131,0x00,0x00,0xd1,0x0,7,1,-1,0,0 }, // sar
+    { 124,0x00,0x00,0xd2,0x0,0,0,-1,0,0 }, // rol
+    { 125,0x00,0x00,0xd2,0x0,1,0,-1,0,0 }, // ror
+    { 126,0x00,0x00,0xd2,0x0,2,0,-1,0,0 }, // rcl
+    { 127,0x00,0x00,0xd2,0x0,3,0,-1,0,0 }, // rcr
+    { 128,0x00,0x00,0xd2,0x0,4,0,-1,0,0 }, // shl
+    { 129,0x00,0x00,0xd2,0x0,4,0,-1,0,0 }, // sal
+    { 130,0x00,0x00,0xd2,0x0,5,0,-1,0,0 }, // shr
+    { 129,0x00,0x00,0xd2,0x0,6,0,-1,0,0 }, // sal
+    { 128,0x00,0x00,0xd2,0x0,6,0,-1,0,0 }, // shl
+    { 131,0x00,0x00,0xd2,0x0,7,0,-1,0,0 }, // sar
+    { 124,0x00,0x00,0xd3,0x0,0,1,-1,0,0 }, // rol
+    { 125,0x00,0x00,0xd3,0x0,1,1,-1,0,0 }, // ror
+    { 126,0x00,0x00,0xd3,0x0,2,1,-1,0,0 }, // rcl
+    { 127,0x00,0x00,0xd3,0x0,3,1,-1,0,0 }, // rcr
+    { 128,0x00,0x00,0xd3,0x0,4,1,-1,0,0 }, // shl
+    { 129,0x00,0x00,0xd3,0x0,4,1,-1,0,0 }, // sal
+    { 130,0x00,0x00,0xd3,0x0,5,1,-1,0,0 }, // shr
+    { 129,0x00,0x00,0xd3,0x0,6,1,-1,0,0 }, // sal
+    { 128,0x00,0x00,0xd3,0x0,6,1,-1,0,0 }, // shl
+    { 131,0x00,0x00,0xd3,0x0,7,1,-1,0,0 }, // sar
+    { 141,0x00,0x00,0xd7,0x0,-1,-1,-1,0,0 }, // xlat
+    { 142,0x00,0x00,0xd7,0x0,-1,-1,-1,0,0 }, // xlatb
+    { 143,0x00,0x00,0xd8,0x0,0,-1,-1,0,0 }, // fadd
+    { 143,0x00,0x00,0xd8,0x0,0,-1,-1,0,0 }, // fadd
+    { 144,0x00,0x00,0xd8,0x0,1,-1,-1,0,0 }, // fmul
+    { 144,0x00,0x00,0xd8,0x0,1,-1,-1,0,0 }, // fmul
+    { 145,0x00,0x00,0xd8,0x0,2,-1,-1,0,0 }, // fcom
+    { 145,0x00,0x00,0xd8,0xd1,-1,-1,-1,0,0 }, // fcom
+    { 146,0x00,0x00,0xd8,0x0,3,-1,-1,0,0 }, // fcomp
+    { 146,0x00,0x00,0xd8,0xd9,-1,-1,-1,0,0 }, // fcomp
+    { 147,0x00,0x00,0xd8,0x0,4,-1,-1,0,0 }, // fsub
+    { 147,0x00,0x00,0xd8,0x0,4,-1,-1,0,0 }, // fsub
+    { 148,0x00,0x00,0xd8,0x0,5,-1,-1,0,0 }, // fsubr
+    { 148,0x00,0x00,0xd8,0x0,5,-1,-1,0,0 }, // fsubr
+    { 149,0x00,0x00,0xd8,0x0,6,-1,-1,0,0 }, // fdiv
+    { 149,0x00,0x00,0xd8,0x0,6,-1,-1,0,0 }, // fdiv
+    { 150,0x00,0x00,0xd8,0x0,7,-1,-1,0,0 }, // fdivr
+    { 150,0x00,0x00,0xd8,0x0,7,-1,-1,0,0 }, // fdivr
+    { 151,0x00,0x00,0xd9,0x0,0,-1,-1,0,0 }, // fld
+    { 152,0x00,0x00,0xd9,0x0,1,-1,-1,0,0 }, // fxch
+    { 152,0x00,0x00,0xd9,0xc9,-1,-1,-1,0,0 }, // fxch
+    { 153,0x00,0x00,0xd9,0x0,2,-1,-1,0,0 }, // fst
+    { 154,0x00,0x00,0xd9,0xd0,-1,-1,-1,0,0 }, // fnop
+    { 155,0x00,0x00,0xd9,0x0,3,-1,-1,0,0 }, // fstp
+    { 156,0x00,0x00,0xd9,0x0,3,-1,-1,0,0 }, // fstp1
+    { 156,0x00,0x00,0xd9,0x0,3,-1,-1,0,0 }, // fstp1
+    { 157,0x00,0x00,0xd9,0xe0,-1,-1,-1,0,0 }, // fchs
+    { 158,0x00,0x00,0xd9,0xe1,-1,-1,-1,0,0 }, // fabs
+    { 159,0x00,0x00,0xd9,0xe4,-1,-1,-1,0,0 }, // ftst
+    { 160,0x00,0x00,0xd9,0xe5,-1,-1,-1,0,0 }, // fxam
+    { 161,0x00,0x00,0xd9,0x0,5,-1,-1,0,0 }, // fldcw
+    { 162,0x00,0x00,0xd9,0xe8,-1,-1,-1,0,0 }, // fld1
+    { 163,0x00,0x00,0xd9,0xe9,-1,-1,-1,0,0 }, // fldl2t
+    { 164,0x00,0x00,0xd9,0xea,-1,-1,-1,0,0 }, // fldl2e
+    { 165,0x00,0x00,0xd9,0xeb,-1,-1,-1,0,0 }, // fldpi
+    { 166,0x00,0x00,0xd9,0xec,-1,-1,-1,0,0 }, // fldlg2
+    { 167,0x00,0x00,0xd9,0xed,-1,-1,-1,0,0 }, // fldln2
+    { 168,0x00,0x00,0xd9,0xee,-1,-1,-1,0,0 }, // fldz
+    { 169,0x00,0x00,0xd9,0xf0,-1,-1,-1,0,0 }, // f2xm1
+    { 170,0x00,0x00,0xd9,0xf1,-1,-1,-1,0,0 }, // fyl2x
+    { 171,0x00,0x00,0xd9,0xf2,-1,-1,-1,0,0 }, // fptan
+    { 172,0x00,0x00,0xd9,0xf3,-1,-1,-1,0,0 }, // fpatan
+    { 173,0x00,0x00,0xd9,0xf4,-1,-1,-1,0,0 }, // fxtract
+    { 174,0x00,0x00,0xd9,0xf5,-1,-1,-1,0,0 }, // fprem1
+    { 175,0x00,0x00,0xd9,0xf6,-1,-1,-1,0,0 }, // fdecstp
+    { 176,0x00,0x00,0xd9,0xf7,-1,-1,-1,0,0 }, // fincstp
+    { 177,0x00,0x00,0xd9,0x0,7,-1,-1,0,0 }, // fnstcw
+    { 178,0x9b,0x00,0xd9,0x0,7,-1,-1,0,0 }, // fstcw
+    { 179,0x00,0x00,0xd9,0xf8,-1,-1,-1,0,0 }, // fprem
+    { 180,0x00,0x00,0xd9,0xf9,-1,-1,-1,0,0 }, // fyl2xp1
+    { 181,0x00,0x00,0xd9,0xfa,-1,-1,-1,0,0 }, // fsqrt
+    { 182,0x00,0x00,0xd9,0xfb,-1,-1,-1,0,0 }, // fsincos
+    { 183,0x00,0x00,0xd9,0xfc,-1,-1,-1,0,0 }, // frndint
+    { 184,0x00,0x00,0xd9,0xfd,-1,-1,-1,0,0 }, // fscale
+    { 185,0x00,0x00,0xd9,0xfe,-1,-1,-1,0,0 }, // fsin
+    { 186,0x00,0x00,0xd9,0xff,-1,-1,-1,0,0 }, // fcos
+    { 187,0x00,0x00,0xda,0x0,0,-1,-1,0,0 }, // fiadd
+    { 188,0x00,0x00,0xda,0x0,0,-1,-1,0,0 }, // fcmovb
+    { 189,0x00,0x00,0xda,0x0,1,-1,-1,0,0 }, // fimul
+    { 190,0x00,0x00,0xda,0x0,1,-1,-1,0,0 }, // fcmove
+    { 191,0x00,0x00,0xda,0x0,2,-1,-1,0,0 }, // ficom
+    { 192,0x00,0x00,0xda,0x0,2,-1,-1,0,0 }, // fcmovbe
+    { 193,0x00,0x00,0xda,0x0,3,-1,-1,0,0 }, // ficomp
+    { 194,0x00,0x00,0xda,0x0,3,-1,-1,0,0 }, // fcmovu
+    { 195,0x00,0x00,0xda,0x0,4,-1,-1,0,0 }, // fisub
+    { 196,0x00,0x00,0xda,0x0,5,-1,-1,0,0 }, // fisubr
+    { 197,0x00,0x00,0xda,0xe9,-1,-1,-1,0,0 }, // fucompp
+    { 198,0x00,0x00,0xda,0x0,6,-1,-1,0,0 }, // fidiv
+    { 199,0x00,0x00,0xda,0x0,7,-1,-1,0,0 }, // fidivr
+    { 200,0x00,0x00,0xdb,0x0,0,-1,-1,0,0 }, // fild
+    { 201,0x00,0x00,0xdb,0x0,0,-1,-1,0,0 }, // fcmovnb
+    { 202,0x00,0x00,0xdb,0x0,1,-1,-1,0,0 }, // fisttp
+    { 203,0x00,0x00,0xdb,0x0,1,-1,-1,0,0 }, // fcmovne
+    { 204,0x00,0x00,0xdb,0x0,2,-1,-1,0,0 }, // fist
+    { 205,0x00,0x00,0xdb,0x0,2,-1,-1,0,0 }, // fcmovnbe
+    { 206,0x00,0x00,0xdb,0x0,3,-1,-1,0,0 }, // fistp
+    { 207,0x00,0x00,0xdb,0x0,3,-1,-1,0,0 }, // fcmovnu
+    { 208,0x00,0x00,0xdb,0xe0,-1,-1,-1,0,0 }, // fneni
+    { 209,0x9b,0x00,0xdb,0xe0,-1,-1,-1,0,0 }, // feni
+    { 208,0x00,0x00,0xdb,0xe0,-1,-1,-1,0,0 }, // fneni
+    { 210,0x00,0x00,0xdb,0xe1,-1,-1,-1,0,0 }, // fndisi
+    { 211,0x9b,0x00,0xdb,0xe1,-1,-1,-1,0,0 }, // fdisi
+    { 210,0x00,0x00,0xdb,0xe1,-1,-1,-1,0,0 }, // fndisi
+    { 212,0x00,0x00,0xdb,0xe2,-1,-1,-1,0,0 }, // fnclex
+    { 213,0x9b,0x00,0xdb,0xe2,-1,-1,-1,0,0 }, // fclex
+    { 214,0x00,0x00,0xdb,0xe3,-1,-1,-1,0,0 }, // fninit
+    { 215,0x9b,0x00,0xdb,0xe3,-1,-1,-1,0,0 }, // finit
+    { 216,0x00,0x00,0xdb,0xe4,-1,-1,-1,0,0 }, // fnsetpm
+    { 217,0x9b,0x00,0xdb,0xe4,-1,-1,-1,0,0 }, // fsetpm
+    { 216,0x00,0x00,0xdb,0xe4,-1,-1,-1,0,0 }, // fnsetpm
+    { 151,0x00,0x00,0xdb,0x0,5,-1,-1,0,0 }, // fld
+    { 218,0x00,0x00,0xdb,0x0,5,-1,-1,0,0 }, // fucomi
+    { 219,0x00,0x00,0xdb,0x0,6,-1,-1,0,0 }, // fcomi
+    { 155,0x00,0x00,0xdb,0x0,7,-1,-1,0,0 }, // fstp
+    { 143,0x00,0x00,0xdc,0x0,0,-1,-1,0,0 }, // fadd
+    { 143,0x00,0x00,0xdc,0x0,0,-1,-1,0,0 }, // fadd
+    { 144,0x00,0x00,0xdc,0x0,1,-1,-1,0,0 }, // fmul
+    { 144,0x00,0x00,0xdc,0x0,1,-1,-1,0,0 }, // fmul
+    { 145,0x00,0x00,0xdc,0x0,2,-1,-1,0,0 }, // fcom
+    { 220,0x00,0x00,0xdc,0x0,2,-1,-1,0,0 }, // fcom2
+    { 220,0x00,0x00,0xdc,0x0,2,-1,-1,0,0 }, // fcom2
+    { 146,0x00,0x00,0xdc,0x0,3,-1,-1,0,0 }, // fcomp
+    { 221,0x00,0x00,0xdc,0x0,3,-1,-1,0,0 }, // fcomp3
+    { 221,0x00,0x00,0xdc,0x0,3,-1,-1,0,0 }, // fcomp3
+    { 147,0x00,0x00,0xdc,0x0,4,-1,-1,0,0 }, // fsub
+    { 148,0x00,0x00,0xdc,0x0,4,-1,-1,0,0 }, // fsubr
+    { 148,0x00,0x00,0xdc,0x0,5,-1,-1,0,0 }, // fsubr
+    { 147,0x00,0x00,0xdc,0x0,5,-1,-1,0,0 }, // fsub
+    { 149,0x00,0x00,0xdc,0x0,6,-1,-1,0,0 }, // fdiv
+    { 150,0x00,0x00,0xdc,0x0,6,-1,-1,0,0 }, // fdivr
+    { 150,0x00,0x00,0xdc,0x0,7,-1,-1,0,0 }, // fdivr
+    { 149,0x00,0x00,0xdc,0x0,7,-1,-1,0,0 }, // fdiv
+    { 151,0x00,0x00,0xdd,0x0,0,-1,-1,0,0 }, // fld
+    { 222,0x00,0x00,0xdd,0x0,0,-1,-1,0,0 }, // ffree
+    { 202,0x00,0x00,0xdd,0x0,1,-1,-1,0,0 }, // fisttp
+    { 223,0x00,0x00,0xdd,0x0,1,-1,-1,0,0 }, // fxch4
+    { 223,0x00,0x00,0xdd,0x0,1,-1,-1,0,0 }, // fxch4
+    { 153,0x00,0x00,0xdd,0x0,2,-1,-1,0,0 }, // fst
+    { 153,0x00,0x00,0xdd,0x0,2,-1,-1,0,0 }, // fst
+    { 155,0x00,0x00,0xdd,0x0,3,-1,-1,0,0 }, // fstp
+    { 155,0x00,0x00,0xdd,0x0,3,-1,-1,0,0 }, // fstp
+    { 224,0x00,0x00,0xdd,0x0,4,-1,-1,0,0 }, // fucom
+    { 224,0x00,0x00,0xdd,0xe1,-1,-1,-1,0,0 }, // fucom
+    { 225,0x00,0x00,0xdd,0x0,5,-1,-1,0,0 }, // fucomp
+    { 225,0x00,0x00,0xdd,0xe9,-1,-1,-1,0,0 }, // fucomp
+    { 226,0x00,0x00,0xdd,0x0,7,-1,-1,0,0 }, // fnstsw
+    { 227,0x9b,0x00,0xdd,0x0,7,-1,-1,0,0 }, // fstsw
+    { 187,0x00,0x00,0xde,0x0,0,-1,-1,0,0 }, // fiadd
+    { 228,0x00,0x00,0xde,0x0,0,-1,-1,0,0 }, // faddp
+    { 228,0x00,0x00,0xde,0xc1,-1,-1,-1,0,0 }, // faddp
+    { 189,0x00,0x00,0xde,0x0,1,-1,-1,0,0 }, // fimul
+    { 229,0x00,0x00,0xde,0x0,1,-1,-1,0,0 }, // fmulp
+    { 229,0x00,0x00,0xde,0xc9,-1,-1,-1,0,0 }, // fmulp
+    { 191,0x00,0x00,0xde,0x0,2,-1,-1,0,0 }, // ficom
+    { 230,0x00,0x00,0xde,0x0,2,-1,-1,0,0 }, // fcomp5
+    { 230,0x00,0x00,0xde,0x0,2,-1,-1,0,0 }, // fcomp5
+    { 193,0x00,0x00,0xde,0x0,3,-1,-1,0,0 }, // ficomp
+    { 231,0x00,0x00,0xde,0xd9,-1,-1,-1,0,0 }, // fcompp
+    { 195,0x00,0x00,0xde,0x0,5,-1,-1,0,0 }, // fisub
+    { 232,0x00,0x00,0xde,0x0,5,-1,-1,0,0 }, // fsubrp
+    { 232,0x00,0x00,0xde,0xe1,-1,-1,-1,0,0 }, // fsubrp
+    { 196,0x00,0x00,0xde,0x0,4,-1,-1,0,0 }, // fisubr
+    { 233,0x00,0x00,0xde,0x0,4,-1,-1,0,0 }, // fsubp
+    { 233,0x00,0x00,0xde,0xe9,-1,-1,-1,0,0 }, // fsubp
+    { 198,0x00,0x00,0xde,0x0,7,-1,-1,0,0 }, // fidiv
+    { 234,0x00,0x00,0xde,0x0,7,-1,-1,0,0 }, // fdivrp
+    { 234,0x00,0x00,0xde,0xf1,-1,-1,-1,0,0 }, // fdivrp
+    { 199,0x00,0x00,0xde,0x0,6,-1,-1,0,0 }, // fidivr
+    { 235,0x00,0x00,0xde,0x0,6,-1,-1,0,0 }, // fdivp
+    { 235,0x00,0x00,0xde,0xf9,-1,-1,-1,0,0 }, // fdivp
+    { 200,0x00,0x00,0xdf,0x0,0,-1,-1,0,0 }, // fild
+    { 236,0x00,0x00,0xdf,0x0,0,-1,-1,0,0 }, // ffreep
+    { 202,0x00,0x00,0xdf,0x0,1,-1,-1,0,0 }, // fisttp
+    { 237,0x00,0x00,0xdf,0x0,1,-1,-1,0,0 }, // fxch7
+    { 237,0x00,0x00,0xdf,0x0,1,-1,-1,0,0 }, // fxch7
+    { 204,0x00,0x00,0xdf,0x0,2,-1,-1,0,0 }, // fist
+    { 238,0x00,0x00,0xdf,0x0,2,-1,-1,0,0 }, // fstp8
+    { 238,0x00,0x00,0xdf,0x0,2,-1,-1,0,0 }, // fstp8
+    { 206,0x00,0x00,0xdf,0x0,3,-1,-1,0,0 }, // fistp
+    { 239,0x00,0x00,0xdf,0x0,3,-1,-1,0,0 }, // fstp9
+    { 239,0x00,0x00,0xdf,0x0,3,-1,-1,0,0 }, // fstp9
+    { 226,0x00,0x00,0xdf,0xe0,-1,-1,-1,0,0 }, // fnstsw
+    { 227,0x9b,0x00,0xdf,0xe0,-1,-1,-1,0,0 }, // fstsw
+    { 200,0x00,0x00,0xdf,0x0,5,-1,-1,0,0 }, // fild
+    { 240,0x00,0x00,0xdf,0x0,5,-1,-1,0,0 }, // fucomip
+    { 241,0x00,0x00,0xdf,0x0,6,-1,-1,0,0 }, // fcomip
+    { 206,0x00,0x00,0xdf,0x0,7,-1,-1,0,0 }, // fistp
+    { 242,0x00,0x00,0xe0,0x0,-1,-1,-1,0,0 }, // loopnz
+    { 243,0x00,0x00,0xe0,0x0,-1,-1,-1,0,0 }, // loopne
+    { 242,0x00,0x00,0xe0,0x0,-1,-1,-1,0,0 }, // loopnz
+    { 243,0x00,0x00,0xe0,0x0,-1,-1,-1,0,0 }, // loopne
+    { 244,0x00,0x00,0xe1,0x0,-1,-1,-1,0,0 }, // loopz
+    { 245,0x00,0x00,0xe1,0x0,-1,-1,-1,0,0 }, // loope
+    { 244,0x00,0x00,0xe1,0x0,-1,-1,-1,0,0 }, // loopz
+    { 245,0x00,0x00,0xe1,0x0,-1,-1,-1,0,0 }, // loope
+    { 246,0x00,0x00,0xe2,0x0,-1,-1,-1,0,0 }, // loop
+    { 246,0x00,0x00,0xe2,0x0,-1,-1,-1,0,0 }, // loop
+    { 247,0x00,0x00,0xe3,0x0,-1,-1,-1,0,0 }, // jcxz
+    { 248,0x00,0x00,0xe3,0x0,-1,-1,-1,0,0 }, // jecxz
+    { 248,0x00,0x00,0xe3,0x0,-1,-1,-1,0,0 }, // jecxz
+    { 249,0x00,0x00,0xe3,0x0,-1,-1,-1,0,0 }, // jrcxz
+    { 250,0x00,0x00,0xe4,0x0,-1,0,-1,0,0 }, // in
+    { 250,0x00,0x00,0xe5,0x0,-1,1,-1,0,0 }, // in
+    { 251,0x00,0x00,0xe6,0x0,-1,0,-1,0,0 }, // out
+    { 251,0x00,0x00,0xe7,0x0,-1,1,-1,0,0 }, // out
+    { 252,0x00,0x00,0xe8,0x0,-1,-1,-1,0,0 }, // call
+    { 253,0x00,0x00,0xe9,0x0,-1,-1,-1,0,0 }, // jmp
+    { 253,0x00,0x00,0xeb,0x0,-1,-1,-1,0,0 }, // jmp
+    { 250,0x00,0x00,0xec,0x0,-1,0,-1,0,0 }, // in
+    { 250,0x00,0x00,0xed,0x0,-1,1,-1,0,0 }, // in
+    { 251,0x00,0x00,0xee,0x0,-1,0,-1,0,0 }, // out
+    { 251,0x00,0x00,0xef,0x0,-1,1,-1,0,0 }, // out
+    { 254,0x00,0x00,0xf0,0x0,-1,-1,-1,0,0 }, // lock
+    { 255,0x00,0x00,0xf1,0x0,-1,-1,-1,0,0 }, // int1
+    { 256,0x00,0x00,0xf1,0x0,-1,-1,-1,0,0 }, // icebp
+    { 257,0x00,0x00,0xf2,0x0,-1,-1,-1,0,0 }, // repnz
+    { 258,0x00,0x00,0xf2,0x0,-1,-1,-1,0,0 }, // repne
+    { 259,0x00,0x00,0xf2,0x0,-1,-1,-1,0,0 }, // rep
+    { 257,0x00,0x00,0xf2,0x0,-1,-1,-1,0,0 }, // repnz
+    { 258,0x00,0x00,0xf2,0x0,-1,-1,-1,0,0 }, // repne
+    { 259,0x00,0x00,0xf2,0x0,-1,-1,-1,0,0 }, // rep
+    { 260,0x00,0x00,0xf3,0x0,-1,-1,-1,0,0 }, // repz
+    { 261,0x00,0x00,0xf3,0x0,-1,-1,-1,0,0 }, // repe
+    { 259,0x00,0x00,0xf3,0x0,-1,-1,-1,0,0 }, // rep
+    { 260,0x00,0x00,0xf3,0x0,-1,-1,-1,0,0 }, // repz
+    { 261,0x00,0x00,0xf3,0x0,-1,-1,-1,0,0 }, // repe
+    { 259,0x00,0x00,0xf3,0x0,-1,-1,-1,0,0 }, // rep
+    { 262,0x00,0x00,0xf4,0x0,-1,-1,-1,0,0 }, // hlt
+    { 263,0x00,0x00,0xf5,0x0,-1,-1,-1,0,0 }, // cmc
+    { 78,0x00,0x00,0xf6,0x0,0,0,-1,0,0 }, // test
+    { 78,0x00,0x00,0xf6,0x0,1,0,-1,0,0 }, // test
+    { 264,0x00,0x00,0xf6,0x0,2,0,-1,0,0 }, // not
+    { 265,0x00,0x00,0xf6,0x0,3,0,-1,0,0 }, // neg
+    { 266,0x00,0x00,0xf6,0x0,4,0,-1,0,0 }, // mul
+    { 39,0x00,0x00,0xf6,0x0,5,0,-1,0,0 }, // imul
+    { 267,0x00,0x00,0xf6,0x0,6,0,-1,0,0 }, // div
+    { 268,0x00,0x00,0xf6,0x0,7,0,-1,0,0 }, // idiv
+    { 78,0x00,0x00,0xf7,0x0,0,1,-1,0,0 }, // test
+    { 78,0x00,0x00,0xf7,0x0,1,1,-1,0,0 }, // test
+    { 264,0x00,0x00,0xf7,0x0,2,1,-1,0,0 }, // not
+    { 265,0x00,0x00,0xf7,0x0,3,1,-1,0,0 }, // neg
+    { 266,0x00,0x00,0xf7,0x0,4,1,-1,0,0 }, // mul
+    { 39,0x00,0x00,0xf7,0x0,5,1,-1,0,0 }, // imul
+    { 267,0x00,0x00,0xf7,0x0,6,1,-1,0,0 }, // div
+    { 268,0x00,0x00,0xf7,0x0,7,1,-1,0,0 }, // idiv
+    { 269,0x00,0x00,0xf8,0x0,-1,-1,-1,0,0 }, // clc
+    { 270,0x00,0x00,0xf9,0x0,-1,-1,-1,0,0 }, // stc
+    { 271,0x00,0x00,0xfa,0x0,-1,-1,-1,0,0 }, // cli
+    { 272,0x00,0x00,0xfb,0x0,-1,-1,-1,0,0 }, // sti
+    { 273,0x00,0x00,0xfc,0x0,-1,-1,-1,0,0 }, // cld
+    { 274,0x00,0x00,0xfd,0x0,-1,-1,-1,0,0 }, // std
+    { 15,0x00,0x00,0xfe,0x0,0,0,-1,0,0 }, // inc
+    { 24,0x00,0x00,0xfe,0x0,1,0,-1,0,0 }, // dec
+    { 15,0x00,0x00,0xff,0x0,0,1,-1,0,0 }, // inc
+    { 24,0x00,0x00,0xff,0x0,1,1,-1,0,0 }, // dec
+    { 252,0x00,0x00,0xff,0x0,2,-1,-1,0,0 }, // call
+    { 252,0x00,0x00,0xff,0x0,2,-1,-1,0,0 }, // call
+    { 253,0x00,0x00,0xff,0x0,4,-1,-1,0,0 }, // jmp
+    { 253,0x00,0x00,0xff,0x0,4,-1,-1,0,0 }, // jmp
+    { 33,0x00,0x00,0xff,0x0,6,-1,-1,0,1 }, // push
+    { 33,0x00,0x00,0xff,0x0,6,-1,-1,0,1 }, // push
+    { 275,0x00,0x0f,0x00,0x0,0,-1,-1,0,0 }, // sldt
+    { 276,0x00,0x0f,0x00,0x0,1,-1,-1,0,0 }, // str
+    { 277,0x00,0x0f,0x00,0x0,2,-1,-1,0,0 }, // lldt
+    { 278,0x00,0x0f,0x00,0x0,3,-1,-1,0,0 }, // ltr
+    { 279,0x00,0x0f,0x00,0x0,4,-1,-1,0,0 }, // verr
+    { 280,0x00,0x0f,0x00,0x0,5,-1,-1,0,0 }, // verw
+    { 281,0x00,0x0f,0x00,0x0,6,-1,-1,0,0 }, // jmpe
+    { 282,0x00,0x0f,0x01,0xc1,-1,-1,-1,0,0 }, // vmcall
+    { 283,0x00,0x0f,0x01,0xc2,-1,-1,-1,0,0 }, // vmlaunch
+    { 284,0x00,0x0f,0x01,0xc3,-1,-1,-1,0,0 }, // vmresume
+    { 285,0x00,0x0f,0x01,0xc4,-1,-1,-1,0,0 }, // vmxoff
+    { 286,0x00,0x0f,0x01,0xc8,-1,-1,-1,0,0 }, // monitor
+    { 287,0x00,0x0f,0x01,0xc9,-1,-1,-1,0,0 }, // mwait
+    { 288,0x00,0x0f,0x01,0xd0,-1,-1,-1,0,0 }, // xgetbv
+    { 289,0x00,0x0f,0x01,0xd1,-1,-1,-1,0,0 }, // xsetbv
+    { 290,0x00,0x0f,0x01,0x0,4,-1,-1,0,0 }, // smsw
+    { 291,0x00,0x0f,0x01,0x0,6,-1,-1,0,0 }, // lmsw
+    { 292,0x00,0x0f,0x01,0x0,7,-1,-1,0,0 }, // invlpg
+    { 293,0x00,0x0f,0x01,0xf8,-1,-1,-1,0,0 }, // swapgs
+    { 294,0x00,0x0f,0x01,0xf9,-1,-1,-1,0,0 }, // rdtscp
+    { 295,0x00,0x0f,0x02,0x0,-1,-1,-1,1,0 }, // lar
+    { 296,0x00,0x0f,0x03,0x0,-1,-1,-1,1,0 }, // lsl
+    { 297,0x00,0x0f,0x05,0x0,-1,-1,-1,0,0 }, // loadall
+    { 298,0x00,0x0f,0x05,0x0,-1,-1,-1,0,0 }, // syscall
+    { 299,0x00,0x0f,0x06,0x0,-1,-1,-1,0,0 }, // clts
+    { 297,0x00,0x0f,0x07,0x0,-1,-1,-1,0,0 }, // loadall
+    { 300,0x00,0x0f,0x07,0x0,-1,-1,-1,0,0 }, // sysret
+    { 301,0x00,0x0f,0x08,0x0,-1,-1,-1,0,0 }, // invd
+    { 302,0x00,0x0f,0x09,0x0,-1,-1,-1,0,0 }, // wbinvd
+    { 303,0x00,0x0f,0x0b,0x0,-1,-1,-1,0,0 }, // ud2
+    { 81,0x00,0x0f,0x0d,0x0,-1,-1,-1,0,0 }, // nop
+    { 304,0xf3,0x0f,0x10,0x0,-1,-1,-1,1,0 }, // movss
+    { 102,0xf2,0x0f,0x10,0x0,-1,-1,-1,1,0 }, // movsd
+    { 304,0xf3,0x0f,0x11,0x0,-1,-1,-1,1,0 }, // movss
+    { 102,0xf2,0x0f,0x11,0x0,-1,-1,-1,1,0 }, // movsd
+    { 305,0x00,0x0f,0x12,0x0,-1,-1,-1,1,0 }, // movlps
+    { 306,0x66,0x0f,0x12,0x0,-1,-1,-1,1,0 }, // movlpd
+    { 307,0xf2,0x0f,0x12,0x0,-1,-1,-1,1,0 }, // movddup
+    { 308,0xf3,0x0f,0x12,0x0,-1,-1,-1,1,0 }, // movsldup
+    { 305,0x00,0x0f,0x13,0x0,-1,-1,-1,1,0 }, // movlps
+    { 306,0x66,0x0f,0x13,0x0,-1,-1,-1,1,0 }, // movlpd
+    { 309,0x00,0x0f,0x16,0x0,-1,-1,-1,1,0 }, // movhps
+    { 310,0x66,0x0f,0x16,0x0,-1,-1,-1,1,0 }, // movhpd
+    { 311,0xf3,0x0f,0x16,0x0,-1,-1,-1,1,0 }, // movshdup
+    { 309,0x00,0x0f,0x17,0x0,-1,-1,-1,1,0 }, // movhps
+    { 310,0x66,0x0f,0x17,0x0,-1,-1,-1,1,0 }, // movhpd
+    { 312,0x00,0x0f,0x18,0x0,-1,-1,-1,0,0 }, // hint_nop
+    { 313,0x00,0x0f,0x18,0x0,0,-1,-1,0,0 }, // prefetchnta
+    { 314,0x00,0x0f,0x18,0x0,1,-1,-1,0,0 }, // prefetcht0
+    { 315,0x00,0x0f,0x18,0x0,2,-1,-1,0,0 }, // prefetcht1
+    { 316,0x00,0x0f,0x18,0x0,3,-1,-1,0,0 }, // prefetcht2
+    { 312,0x00,0x0f,0x18,0x0,4,-1,-1,0,0 }, // hint_nop
+    { 312,0x00,0x0f,0x18,0x0,5,-1,-1,0,0 }, // hint_nop
+    { 312,0x00,0x0f,0x18,0x0,6,-1,-1,0,0 }, // hint_nop
+    { 312,0x00,0x0f,0x18,0x0,7,-1,-1,0,0 }, // hint_nop
+    { 312,0x00,0x0f,0x19,0x0,-1,-1,-1,0,0 }, // hint_nop
+    { 312,0x00,0x0f,0x1a,0x0,-1,-1,-1,0,0 }, // hint_nop
+    { 312,0x00,0x0f,0x1b,0x0,-1,-1,-1,0,0 }, // hint_nop
+    { 312,0x00,0x0f,0x1c,0x0,-1,-1,-1,0,0 }, // hint_nop
+    { 312,0x00,0x0f,0x1d,0x0,-1,-1,-1,0,0 }, // hint_nop
+    { 312,0x00,0x0f,0x1e,0x0,-1,-1,-1,0,0 }, // hint_nop
+    { 312,0x00,0x0f,0x1f,0x0,-1,-1,-1,0,0 }, // hint_nop
+    { 81,0x00,0x0f,0x1f,0x0,0,-1,-1,0,0 }, // nop
+    { 312,0x00,0x0f,0x1f,0x0,1,-1,-1,0,0 }, // hint_nop
+    { 312,0x00,0x0f,0x1f,0x0,2,-1,-1,0,0 }, // hint_nop
+    { 312,0x00,0x0f,0x1f,0x0,3,-1,-1,0,0 }, // hint_nop
+    { 312,0x00,0x0f,0x1f,0x0,4,-1,-1,0,0 }, // hint_nop
+    { 312,0x00,0x0f,0x1f,0x0,5,-1,-1,0,0 }, // hint_nop
+    { 312,0x00,0x0f,0x1f,0x0,6,-1,-1,0,0 }, // hint_nop
+    { 312,0x00,0x0f,0x1f,0x0,7,-1,-1,0,0 }, // hint_nop
+    { 317,0xf3,0x0f,0x2a,0x0,-1,-1,-1,1,0 }, // cvtsi2ss
+    { 318,0xf2,0x0f,0x2a,0x0,-1,-1,-1,1,0 }, // cvtsi2sd
+    { 319,0xf3,0x0f,0x2c,0x0,-1,-1,-1,1,0 }, // cvttss2si
+    { 320,0xf2,0x0f,0x2c,0x0,-1,-1,-1,1,0 }, // cvttsd2si
+    { 321,0xf3,0x0f,0x2d,0x0,-1,-1,-1,1,0 }, // cvtss2si
+    { 322,0xf2,0x0f,0x2d,0x0,-1,-1,-1,1,0 }, // cvtsd2si
+    { 323,0x00,0x0f,0x2e,0x0,-1,-1,-1,1,0 }, // ucomiss
+    { 324,0x66,0x0f,0x2e,0x0,-1,-1,-1,1,0 }, // ucomisd
+    { 325,0x00,0x0f,0x2f,0x0,-1,-1,-1,1,0 }, // comiss
+    { 326,0x66,0x0f,0x2f,0x0,-1,-1,-1,1,0 }, // comisd
+    { 327,0x00,0x0f,0x30,0x0,-1,-1,-1,0,0 }, // wrmsr
+    { 328,0x00,0x0f,0x31,0x0,-1,-1,-1,0,0 }, // rdtsc
+    { 329,0x00,0x0f,0x32,0x0,-1,-1,-1,0,0 }, // rdmsr
+    { 330,0x00,0x0f,0x33,0x0,-1,-1,-1,0,0 }, // rdpmc
+    { 331,0x00,0x0f,0x34,0x0,-1,-1,-1,0,0 }, // sysenter
+    { 331,0x00,0x0f,0x34,0x0,-1,-1,-1,0,0 }, // sysenter
+    { 332,0x00,0x0f,0x35,0x0,-1,-1,-1,0,0 }, // sysexit
+    { 333,0x00,0x0f,0x37,0x0,-1,-1,-1,0,0 }, // getsec
+    { 334,0x66,0x0f,0x38,0x00,-1,-1,-1,1,0 }, // pshufb
+    { 335,0x66,0x0f,0x38,0x01,-1,-1,-1,1,0 }, // phaddw
+    { 336,0x66,0x0f,0x38,0x02,-1,-1,-1,1,0 }, // phaddd
+    { 337,0x66,0x0f,0x38,0x03,-1,-1,-1,1,0 }, // phaddsw
+    { 338,0x66,0x0f,0x38,0x04,-1,-1,-1,1,0 }, // pmaddubsw
+    { 339,0x66,0x0f,0x38,0x05,-1,-1,-1,1,0 }, // phsubw
+    { 340,0x66,0x0f,0x38,0x06,-1,-1,-1,1,0 }, // phsubd
+    { 341,0x66,0x0f,0x38,0x07,-1,-1,-1,1,0 }, // phsubsw
+    { 342,0x66,0x0f,0x38,0x08,-1,-1,-1,1,0 }, // psignb
+    { 343,0x66,0x0f,0x38,0x09,-1,-1,-1,1,0 }, // psignw
+    { 344,0x66,0x0f,0x38,0x0a,-1,-1,-1,1,0 }, // psignd
+    { 345,0x66,0x0f,0x38,0x0b,-1,-1,-1,1,0 }, // pmulhrsw
+    { 346,0x66,0x0f,0x38,0x10,-1,-1,-1,1,0 }, // pblendvb
+    { 347,0x66,0x0f,0x38,0x17,-1,-1,-1,1,0 }, // ptest
+    { 348,0x66,0x0f,0x38,0x1c,-1,-1,-1,1,0 }, // pabsb
+    { 349,0x66,0x0f,0x38,0x1d,-1,-1,-1,1,0 }, // pabsw
+    { 350,0x66,0x0f,0x38,0x1e,-1,-1,-1,1,0 }, // pabsd
+    { 351,0x66,0x0f,0x38,0x20,-1,-1,-1,1,0 }, // pmovsxbw
+    { 352,0x66,0x0f,0x38,0x21,-1,-1,-1,1,0 }, // pmovsxbd
+    { 353,0x66,0x0f,0x38,0x22,-1,-1,-1,1,0 }, // pmovsxbq
+    { 354,0x66,0x0f,0x38,0x23,-1,-1,-1,1,0 }, // pmovsxwd
+    { 355,0x66,0x0f,0x38,0x24,-1,-1,-1,1,0 }, // pmovsxwq
+    { 356,0x66,0x0f,0x38,0x25,-1,-1,-1,1,0 }, // pmovsxdq
+    { 357,0x66,0x0f,0x38,0x28,-1,-1,-1,1,0 }, // pmuldq
+    { 358,0x66,0x0f,0x38,0x29,-1,-1,-1,1,0 }, // pcmpeqq
+    { 359,0x66,0x0f,0x38,0x2a,-1,-1,-1,1,0 }, // movntdqa
+    { 360,0x66,0x0f,0x38,0x2b,-1,-1,-1,1,0 }, // packusdw
+    { 361,0x66,0x0f,0x38,0x30,-1,-1,-1,1,0 }, // pmovzxbw
+    { 362,0x66,0x0f,0x38,0x31,-1,-1,-1,1,0 }, // pmovzxbd
+    { 363,0x66,0x0f,0x38,0x32,-1,-1,-1,1,0 }, // pmovzxbq
+    { 364,0x66,0x0f,0x38,0x33,-1,-1,-1,1,0 }, // pmovzxwd
+    { 365,0x66,0x0f,0x38,0x34,-1,-1,-1,1,0 }, // pmovzxwq
+    { 366,0x66,0x0f,0x38,0x35,-1,-1,-1,1,0 }, // pmovzxdq
+    { 367,0x66,0x0f,0x38,0x37,-1,-1,-1,1,0 }, // pcmpgtq
+    { 368,0x66,0x0f,0x38,0x38,-1,-1,-1,1,0 }, // pminsb
+    { 369,0x66,0x0f,0x38,0x39,-1,-1,-1,1,0 }, // pminsd
+    { 370,0x66,0x0f,0x38,0x3a,-1,-1,-1,1,0 }, // pminuw
+    { 371,0x66,0x0f,0x38,0x3b,-1,-1,-1,1,0 }, // pminud
+    { 372,0x66,0x0f,0x38,0x3c,-1,-1,-1,1,0 }, // pmaxsb
+    { 373,0x66,0x0f,0x38,0x3d,-1,-1,-1,1,0 }, // pmaxsd
+    { 374,0x66,0x0f,0x38,0x3e,-1,-1,-1,1,0 }, // pmaxuw
+    { 375,0x66,0x0f,0x38,0x3f,-1,-1,-1,1,0 }, // pmaxud
+    { 376,0x66,0x0f,0x38,0x40,-1,-1,-1,1,0 }, // pmulld
+    { 377,0x66,0x0f,0x38,0x41,-1,-1,-1,1,0 }, // phminposuw
+    { 378,0x66,0x0f,0x38,0x80,-1,-1,-1,1,0 }, // invept
+    { 378,0x66,0x0f,0x38,0x80,-1,-1,-1,1,0 }, // invept
+    { 379,0x66,0x0f,0x38,0x81,-1,-1,-1,1,0 }, // invvpid
+    { 379,0x66,0x0f,0x38,0x81,-1,-1,-1,1,0 }, // invvpid
+    { 380,0x00,0x0f,0x38,0xf0,-1,-1,-1,1,0 }, // movbe
+    { 381,0xf2,0x0f,0x38,0xf0,-1,-1,-1,1,0 }, // crc32
+    { 380,0x00,0x0f,0x38,0xf1,-1,-1,-1,1,0 }, // movbe
+    { 381,0xf2,0x0f,0x38,0xf1,-1,-1,-1,1,0 }, // crc32
+    { 382,0x66,0x0f,0x3a,0x0a,-1,-1,-1,1,0 }, // roundss
+    { 383,0x66,0x0f,0x3a,0x0b,-1,-1,-1,1,0 }, // roundsd
+    { 384,0x66,0x0f,0x3a,0x0e,-1,-1,-1,1,0 }, // pblendw
+    { 385,0x66,0x0f,0x3a,0x0f,-1,-1,-1,1,0 }, // palignr
+    { 386,0x66,0x0f,0x3a,0x14,-1,-1,-1,1,0 }, // pextrb
+    { 387,0x66,0x0f,0x3a,0x15,-1,-1,-1,1,0 }, // pextrw
+    { 388,0x66,0x0f,0x3a,0x16,-1,-1,-1,1,0 }, // pextrd
+    { 389,0x66,0x0f,0x3a,0x16,-1,-1,-1,1,0 }, // pextrq
+    { 390,0x66,0x0f,0x3a,0x17,-1,-1,-1,1,0 }, // extractps
+    { 391,0x66,0x0f,0x3a,0x20,-1,-1,-1,1,0 }, // pinsrb
+    { 392,0x66,0x0f,0x3a,0x22,-1,-1,-1,1,0 }, // pinsrd
+    { 393,0x66,0x0f,0x3a,0x22,-1,-1,-1,1,0 }, // pinsrq
+    { 394,0x66,0x0f,0x3a,0x42,-1,-1,-1,1,0 }, // mpsadbw
+    { 395,0x00,0x0f,0x40,0x0,-1,-1,-1,1,0 }, // cmovo
+    { 396,0x00,0x0f,0x41,0x0,-1,-1,-1,1,0 }, // cmovno
+    { 397,0x00,0x0f,0x42,0x0,-1,-1,-1,1,0 }, // cmovb
+    { 398,0x00,0x0f,0x42,0x0,-1,-1,-1,1,0 }, // cmovnae
+    { 399,0x00,0x0f,0x42,0x0,-1,-1,-1,1,0 }, // cmovc
+    { 400,0x00,0x0f,0x43,0x0,-1,-1,-1,1,0 }, // cmovnb
+    { 401,0x00,0x0f,0x43,0x0,-1,-1,-1,1,0 }, // cmovae
+    { 402,0x00,0x0f,0x43,0x0,-1,-1,-1,1,0 }, // cmovnc
+    { 403,0x00,0x0f,0x44,0x0,-1,-1,-1,1,0 }, // cmovz
+    { 404,0x00,0x0f,0x44,0x0,-1,-1,-1,1,0 }, // cmove
+    { 405,0x00,0x0f,0x45,0x0,-1,-1,-1,1,0 }, // cmovnz
+    { 406,0x00,0x0f,0x45,0x0,-1,-1,-1,1,0 }, // cmovne
+    { 407,0x00,0x0f,0x46,0x0,-1,-1,-1,1,0 }, // cmovbe
+    { 408,0x00,0x0f,0x46,0x0,-1,-1,-1,1,0 }, // cmovna
+    { 409,0x00,0x0f,0x47,0x0,-1,-1,-1,1,0 }, // cmovnbe
+    { 410,0x00,0x0f,0x47,0x0,-1,-1,-1,1,0 }, // cmova
+    { 411,0x00,0x0f,0x48,0x0,-1,-1,-1,1,0 }, // cmovs
+    { 412,0x00,0x0f,0x49,0x0,-1,-1,-1,1,0 }, // cmovns
+    { 413,0x00,0x0f,0x4a,0x0,-1,-1,-1,1,0 }, // cmovp
+    { 414,0x00,0x0f,0x4a,0x0,-1,-1,-1,1,0 }, // cmovpe
+    { 415,0x00,0x0f,0x4b,0x0,-1,-1,-1,1,0 }, // cmovnp
+    { 416,0x00,0x0f,0x4b,0x0,-1,-1,-1,1,0 }, // cmovpo
+    { 417,0x00,0x0f,0x4c,0x0,-1,-1,-1,1,0 }, // cmovl
+    { 418,0x00,0x0f,0x4c,0x0,-1,-1,-1,1,0 }, // cmovnge
+    { 419,0x00,0x0f,0x4d,0x0,-1,-1,-1,1,0 }, // cmovnl
+    { 420,0x00,0x0f,0x4d,0x0,-1,-1,-1,1,0 }, // cmovge
+    { 421,0x00,0x0f,0x4e,0x0,-1,-1,-1,1,0 }, // cmovle
+    { 422,0x00,0x0f,0x4e,0x0,-1,-1,-1,1,0 }, // cmovng
+    { 423,0x00,0x0f,0x4f,0x0,-1,-1,-1,1,0 }, // cmovnle
+    { 424,0x00,0x0f,0x4f,0x0,-1,-1,-1,1,0 }, // cmovg
+    { 425,0xf3,0x0f,0x51,0x0,-1,-1,-1,1,0 }, // sqrtss
+    { 426,0xf2,0x0f,0x51,0x0,-1,-1,-1,1,0 }, // sqrtsd
+    { 427,0xf3,0x0f,0x52,0x0,-1,-1,-1,1,0 }, // rsqrtss
+    { 428,0xf3,0x0f,0x53,0x0,-1,-1,-1,1,0 }, // rcpss
+    { 429,0xf3,0x0f,0x58,0x0,-1,-1,-1,1,0 }, // addss
+    { 430,0xf2,0x0f,0x58,0x0,-1,-1,-1,1,0 }, // addsd
+    { 431,0xf3,0x0f,0x59,0x0,-1,-1,-1,1,0 }, // mulss
+    { 432,0xf2,0x0f,0x59,0x0,-1,-1,-1,1,0 }, // mulsd
+    { 433,0xf3,0x0f,0x5a,0x0,-1,-1,-1,1,0 }, // cvtss2sd
+    { 434,0xf2,0x0f,0x5a,0x0,-1,-1,-1,1,0 }, // cvtsd2ss
+    { 435,0xf3,0x0f,0x5c,0x0,-1,-1,-1,1,0 }, // subss
+    { 436,0xf2,0x0f,0x5c,0x0,-1,-1,-1,1,0 }, // subsd
+    { 437,0xf3,0x0f,0x5d,0x0,-1,-1,-1,1,0 }, // minss
+    { 438,0xf2,0x0f,0x5d,0x0,-1,-1,-1,1,0 }, // minsd
+    { 439,0xf3,0x0f,0x5e,0x0,-1,-1,-1,1,0 }, // divss
+    { 440,0xf2,0x0f,0x5e,0x0,-1,-1,-1,1,0 }, // divsd
+    { 441,0xf3,0x0f,0x5f,0x0,-1,-1,-1,1,0 }, // maxss
+    { 442,0xf2,0x0f,0x5f,0x0,-1,-1,-1,1,0 }, // maxsd
+    { 443,0x66,0x0f,0x60,0x0,-1,-1,-1,1,0 }, // punpcklbw
+    { 444,0x66,0x0f,0x61,0x0,-1,-1,-1,1,0 }, // punpcklwd
+    { 445,0x66,0x0f,0x62,0x0,-1,-1,-1,1,0 }, // punpckldq
+    { 446,0x66,0x0f,0x63,0x0,-1,-1,-1,1,0 }, // packsswb
+    { 447,0x66,0x0f,0x64,0x0,-1,-1,-1,1,0 }, // pcmpgtb
+    { 448,0x66,0x0f,0x65,0x0,-1,-1,-1,1,0 }, // pcmpgtw
+    { 449,0x66,0x0f,0x66,0x0,-1,-1,-1,1,0 }, // pcmpgtd
+    { 450,0x66,0x0f,0x67,0x0,-1,-1,-1,1,0 }, // packuswb
+    { 451,0x66,0x0f,0x68,0x0,-1,-1,-1,1,0 }, // punpckhbw
+    { 452,0x66,0x0f,0x69,0x0,-1,-1,-1,1,0 }, // punpckhwd
+    { 453,0x66,0x0f,0x6a,0x0,-1,-1,-1,1,0 }, // punpckhdq
+    { 454,0x66,0x0f,0x6b,0x0,-1,-1,-1,1,0 }, // packssdw
+    { 455,0x66,0x0f,0x6c,0x0,-1,-1,-1,1,0 }, // punpcklqdq
+    { 456,0x66,0x0f,0x6d,0x0,-1,-1,-1,1,0 }, // punpckhqdq
+    { 457,0x66,0x0f,0x6e,0x0,-1,-1,-1,1,0 }, // movd
+    { 457,0x66,0x0f,0x6e,0x0,-1,-1,-1,1,0 }, // movd
+    { 458,0x66,0x0f,0x6e,0x0,-1,-1,-1,1,0 }, // movq
+    { 459,0x66,0x0f,0x6f,0x0,-1,-1,-1,1,0 }, // movdqa
+    { 460,0xf3,0x0f,0x6f,0x0,-1,-1,-1,1,0 }, // movdqu
+    { 461,0xf2,0x0f,0x70,0x0,-1,-1,-1,1,0 }, // pshuflw
+    { 462,0xf3,0x0f,0x70,0x0,-1,-1,-1,1,0 }, // pshufhw
+    { 463,0x66,0x0f,0x70,0x0,-1,-1,-1,1,0 }, // pshufd
+    { 464,0x66,0x0f,0x74,0x0,-1,-1,-1,1,0 }, // pcmpeqb
+    { 465,0x66,0x0f,0x75,0x0,-1,-1,-1,1,0 }, // pcmpeqw
+    { 466,0x66,0x0f,0x76,0x0,-1,-1,-1,1,0 }, // pcmpeqd
+    { 467,0x00,0x0f,0x77,0x0,-1,-1,-1,0,0 }, // emms
+    { 468,0x00,0x0f,0x78,0x0,-1,-1,-1,1,0 }, // vmread
+    { 468,0x00,0x0f,0x78,0x0,-1,-1,-1,1,0 }, // vmread
+    { 469,0x00,0x0f,0x79,0x0,-1,-1,-1,1,0 }, // vmwrite
+    { 469,0x00,0x0f,0x79,0x0,-1,-1,-1,1,0 }, // vmwrite
+    { 457,0x66,0x0f,0x7e,0x0,-1,-1,-1,1,0 }, // movd
+    { 457,0x66,0x0f,0x7e,0x0,-1,-1,-1,1,0 }, // movd
+    { 458,0x66,0x0f,0x7e,0x0,-1,-1,-1,1,0 }, // movq
+    { 458,0xf3,0x0f,0x7e,0x0,-1,-1,-1,1,0 }, // movq
+    { 459,0x66,0x0f,0x7f,0x0,-1,-1,-1,1,0 }, // movdqa
+    { 460,0xf3,0x0f,0x7f,0x0,-1,-1,-1,1,0 }, // movdqu
+    { 48,0x00,0x0f,0x80,0x0,-1,-1,-1,0,0 }, // jo
+    { 49,0x00,0x0f,0x81,0x0,-1,-1,-1,0,0 }, // jno
+    { 50,0x00,0x0f,0x82,0x0,-1,-1,-1,0,0 }, // jb
+    { 51,0x00,0x0f,0x82,0x0,-1,-1,-1,0,0 }, // jnae
+    { 52,0x00,0x0f,0x82,0x0,-1,-1,-1,0,0 }, // jc
+    { 53,0x00,0x0f,0x83,0x0,-1,-1,-1,0,0 }, // jnb
+    { 54,0x00,0x0f,0x83,0x0,-1,-1,-1,0,0 }, // jae
+    { 55,0x00,0x0f,0x83,0x0,-1,-1,-1,0,0 }, // jnc
+    { 56,0x00,0x0f,0x84,0x0,-1,-1,-1,0,0 }, // jz
+    { 57,0x00,0x0f,0x84,0x0,-1,-1,-1,0,0 }, // je
+    { 58,0x00,0x0f,0x85,0x0,-1,-1,-1,0,0 }, // jnz
+    { 59,0x00,0x0f,0x85,0x0,-1,-1,-1,0,0 }, // jne
+    { 60,0x00,0x0f,0x86,0x0,-1,-1,-1,0,0 }, // jbe
+    { 61,0x00,0x0f,0x86,0x0,-1,-1,-1,0,0 }, // jna
+    { 62,0x00,0x0f,0x87,0x0,-1,-1,-1,0,0 }, // jnbe
+    { 63,0x00,0x0f,0x87,0x0,-1,-1,-1,0,0 }, // ja
+    { 64,0x00,0x0f,0x88,0x0,-1,-1,-1,0,0 }, // js
+    { 65,0x00,0x0f,0x89,0x0,-1,-1,-1,0,0 }, // jns
+    { 66,0x00,0x0f,0x8a,0x0,-1,-1,-1,0,0 }, // jp
+    { 67,0x00,0x0f,0x8a,0x0,-1,-1,-1,0,0 }, // jpe
+    { 68,0x00,0x0f,0x8b,0x0,-1,-1,-1,0,0 }, // jnp
+    { 69,0x00,0x0f,0x8b,0x0,-1,-1,-1,0,0 }, // jpo
+    { 70,0x00,0x0f,0x8c,0x0,-1,-1,-1,0,0 }, // jl
+    { 71,0x00,0x0f,0x8c,0x0,-1,-1,-1,0,0 }, // jnge
+    { 72,0x00,0x0f,0x8d,0x0,-1,-1,-1,0,0 }, // jnl
+    { 73,0x00,0x0f,0x8d,0x0,-1,-1,-1,0,0 }, // jge
+    { 74,0x00,0x0f,0x8e,0x0,-1,-1,-1,0,0 }, // jle
+    { 75,0x00,0x0f,0x8e,0x0,-1,-1,-1,0,0 }, // jng
+    { 76,0x00,0x0f,0x8f,0x0,-1,-1,-1,0,0 }, // jnle
+    { 77,0x00,0x0f,0x8f,0x0,-1,-1,-1,0,0 }, // jg
+    { 470,0x00,0x0f,0x90,0x0,0,-1,-1,0,0 }, // seto
+    { 471,0x00,0x0f,0x91,0x0,0,-1,-1,0,0 }, // setno
+    { 472,0x00,0x0f,0x92,0x0,0,-1,-1,0,0 }, // setb
+    { 473,0x00,0x0f,0x92,0x0,0,-1,-1,0,0 }, // setnae
+    { 474,0x00,0x0f,0x92,0x0,0,-1,-1,0,0 }, // setc
+    { 475,0x00,0x0f,0x93,0x0,0,-1,-1,0,0 }, // setnb
+    { 476,0x00,0x0f,0x93,0x0,0,-1,-1,0,0 }, // setae
+    { 477,0x00,0x0f,0x93,0x0,0,-1,-1,0,0 }, // setnc
+    { 478,0x00,0x0f,0x94,0x0,0,-1,-1,0,0 }, // setz
+    { 479,0x00,0x0f,0x94,0x0,0,-1,-1,0,0 }, // sete
+    { 480,0x00,0x0f,0x95,0x0,0,-1,-1,0,0 }, // setnz
+    { 481,0x00,0x0f,0x95,0x0,0,-1,-1,0,0 }, // setne
+    { 482,0x00,0x0f,0x96,0x0,0,-1,-1,0,0 }, // setbe
+    { 483,0x00,0x0f,0x96,0x0,0,-1,-1,0,0 }, // setna
+    { 484,0x00,0x0f,0x97,0x0,0,-1,-1,0,0 }, // setnbe
+    { 485,0x00,0x0f,0x97,0x0,0,-1,-1,0,0 }, // seta
+    { 486,0x00,0x0f,0x98,0x0,0,-1,-1,0,0 }, // sets
+    { 487,0x00,0x0f,0x99,0x0,0,-1,-1,0,0 }, // setns
+    { 488,0x00,0x0f,0x9a,0x0,0,-1,-1,0,0 }, // setp
+    { 489,0x00,0x0f,0x9a,0x0,0,-1,-1,0,0 }, // setpe
+    { 490,0x00,0x0f,0x9b,0x0,0,-1,-1,0,0 }, // setnp
+    { 491,0x00,0x0f,0x9b,0x0,0,-1,-1,0,0 }, // setpo
+    { 492,0x00,0x0f,0x9c,0x0,0,-1,-1,0,0 }, // setl
+    { 493,0x00,0x0f,0x9c,0x0,0,-1,-1,0,0 }, // setnge
+    { 494,0x00,0x0f,0x9d,0x0,0,-1,-1,0,0 }, // setnl
+    { 495,0x00,0x0f,0x9d,0x0,0,-1,-1,0,0 }, // setge
+    { 496,0x00,0x0f,0x9e,0x0,0,-1,-1,0,0 }, // setle
+    { 497,0x00,0x0f,0x9e,0x0,0,-1,-1,0,0 }, // setng
+    { 498,0x00,0x0f,0x9f,0x0,0,-1,-1,0,0 }, // setnle
+    { 499,0x00,0x0f,0x9f,0x0,0,-1,-1,0,0 }, // setg
+    { 33,0x00,0x0f,0xa0,0x0,-1,-1,-1,0,1 }, // push
+    { 2,0x00,0x0f,0xa1,0x0,-1,-1,-1,0,0 }, // pop
+    { 500,0x00,0x0f,0xa2,0x0,-1,-1,-1,0,0 }, // cpuid
+    { 501,0x00,0x0f,0xa3,0x0,-1,-1,-1,1,0 }, // bt
+    { 502,0x00,0x0f,0xa4,0x0,-1,-1,0,1,0 }, // shld
+    { 502,0x00,0x0f,0xa5,0x0,-1,-1,0,1,0 }, // shld
+    { 33,0x00,0x0f,0xa8,0x0,-1,-1,-1,0,1 }, // push
+    { 2,0x00,0x0f,0xa9,0x0,-1,-1,-1,0,0 }, // pop
+    { 503,0x00,0x0f,0xaa,0x0,-1,-1,-1,0,0 }, // rsm
+    { 504,0x00,0x0f,0xab,0x0,-1,-1,-1,1,0 }, // bts
+    { 505,0x00,0x0f,0xac,0x0,-1,-1,0,1,0 }, // shrd
+    { 505,0x00,0x0f,0xad,0x0,-1,-1,0,1,0 }, // shrd
+    { 506,0x00,0x0f,0xae,0x0,2,-1,-1,0,0 }, // ldmxcsr
+    { 507,0x00,0x0f,0xae,0x0,3,-1,-1,0,0 }, // stmxcsr
+    { 508,0x00,0x0f,0xae,0x0,4,-1,-1,0,0 }, // xsave
+    { 508,0x00,0x0f,0xae,0x0,4,-1,-1,0,0 }, // xsave
+    { 509,0x00,0x0f,0xae,0x0,5,-1,-1,0,0 }, // lfence
+    { 510,0x00,0x0f,0xae,0x0,5,-1,-1,0,0 }, // xrstor
+    { 510,0x00,0x0f,0xae,0x0,5,-1,-1,0,0 }, // xrstor
+    { 511,0x00,0x0f,0xae,0x0,6,-1,-1,0,0 }, // mfence
+    { 512,0x00,0x0f,0xae,0x0,7,-1,-1,0,0 }, // sfence
+    { 513,0x00,0x0f,0xae,0x0,7,-1,-1,0,0 }, // clflush
+    { 39,0x00,0x0f,0xaf,0x0,-1,1,1,1,0 }, // imul
+    { 514,0x00,0x0f,0xb0,0x0,-1,0,0,1,0 }, // cmpxchg
+    { 514,0x00,0x0f,0xb1,0x0,-1,1,0,1,0 }, // cmpxchg
+    { 515,0x00,0x0f,0xb3,0x0,-1,-1,-1,1,0 }, // btr
+    { 516,0x00,0x0f,0xb6,0x0,-1,0,1,1,0 }, // movzx
+    { 516,0x00,0x0f,0xb7,0x0,-1,1,1,1,0 }, // movzx
+    { 281,0x00,0x0f,0xb8,0x0,-1,-1,-1,0,0 }, // jmpe
+    { 517,0xf3,0x0f,0xb8,0x0,-1,-1,-1,1,0 }, // popcnt
+    { 518,0x00,0x0f,0xb9,0x0,-1,-1,-1,1,0 }, // ud
+    { 501,0x00,0x0f,0xba,0x0,4,-1,-1,0,0 }, // bt
+    { 504,0x00,0x0f,0xba,0x0,5,-1,-1,0,0 }, // bts
+    { 515,0x00,0x0f,0xba,0x0,6,-1,-1,0,0 }, // btr
+    { 519,0x00,0x0f,0xba,0x0,7,-1,-1,0,0 }, // btc
+    { 519,0x00,0x0f,0xbb,0x0,-1,-1,-1,1,0 }, // btc
+    { 520,0x00,0x0f,0xbc,0x0,-1,-1,-1,1,0 }, // bsf
+    { 521,0x00,0x0f,0xbd,0x0,-1,-1,-1,1,0 }, // bsr
+    { 522,0x00,0x0f,0xbe,0x0,-1,0,1,1,0 }, // movsx
+    { 522,0x00,0x0f,0xbf,0x0,-1,1,1,1,0 }, // movsx
+    { 523,0xf3,0x0f,0xc2,0x0,-1,-1,-1,1,0 }, // cmpss
+    { 107,0xf2,0x0f,0xc2,0x0,-1,-1,-1,1,0 }, // cmpsd
+    { 524,0x00,0x0f,0xc3,0x0,-1,-1,-1,1,0 }, // movnti
+    { 525,0x66,0x0f,0xc4,0x0,-1,-1,-1,1,0 }, // pinsrw
+    { 526,0x00,0x0f,0xc7,0x0,1,-1,-1,0,0 }, // cmpxchg8b
+    { 526,0x00,0x0f,0xc7,0x0,1,-1,-1,0,0 }, // cmpxchg8b
+    { 527,0x00,0x0f,0xc7,0x0,1,-1,-1,0,0 }, // cmpxchg16b
+    { 528,0x00,0x0f,0xc7,0x0,6,-1,-1,0,0 }, // vmptrld
+    { 529,0x66,0x0f,0xc7,0x0,6,-1,-1,0,0 }, // vmclear
+    { 530,0xf3,0x0f,0xc7,0x0,6,-1,-1,0,0 }, // vmxon
+    { 531,0x00,0x0f,0xc7,0x0,7,-1,-1,0,0 }, // vmptrst
+    { 532,0x00,0x0f,0xc8,0x0,-1,-1,-1,0,0 }, // bswap
+    { 533,0x66,0x0f,0xd1,0x0,-1,-1,-1,1,0 }, // psrlw
+    { 534,0x66,0x0f,0xd2,0x0,-1,-1,-1,1,0 }, // psrld
+    { 535,0x66,0x0f,0xd3,0x0,-1,-1,-1,1,0 }, // psrlq
+    { 536,0x66,0x0f,0xd4,0x0,-1,-1,-1,1,0 }, // paddq
+    { 537,0x66,0x0f,0xd5,0x0,-1,-1,-1,1,0 }, // pmullw
+    { 458,0x66,0x0f,0xd6,0x0,-1,-1,-1,1,0 }, // movq
+    { 538,0x66,0x0f,0xd8,0x0,-1,-1,-1,1,0 }, // psubusb
+    { 539,0x66,0x0f,0xd9,0x0,-1,-1,-1,1,0 }, // psubusw
+    { 540,0x66,0x0f,0xda,0x0,-1,-1,-1,1,0 }, // pminub
+    { 541,0x66,0x0f,0xdb,0x0,-1,-1,-1,1,0 }, // pand
+    { 542,0x66,0x0f,0xdc,0x0,-1,-1,-1,1,0 }, // paddusb
+    { 543,0x66,0x0f,0xdd,0x0,-1,-1,-1,1,0 }, // paddusw
+    { 544,0x66,0x0f,0xde,0x0,-1,-1,-1,1,0 }, // pmaxub
+    { 545,0x66,0x0f,0xdf,0x0,-1,-1,-1,1,0 }, // pandn
+    { 546,0x66,0x0f,0xe0,0x0,-1,-1,-1,1,0 }, // pavgb
+    { 547,0x66,0x0f,0xe1,0x0,-1,-1,-1,1,0 }, // psraw
+    { 548,0x66,0x0f,0xe2,0x0,-1,-1,-1,1,0 }, // psrad
+    { 549,0x66,0x0f,0xe3,0x0,-1,-1,-1,1,0 }, // pavgw
+    { 550,0x66,0x0f,0xe4,0x0,-1,-1,-1,1,0 }, // pmulhuw
+    { 551,0x66,0x0f,0xe5,0x0,-1,-1,-1,1,0 }, // pmulhw
+    { 552,0x66,0x0f,0xe7,0x0,-1,-1,-1,1,0 }, // movntdq
+    { 553,0x66,0x0f,0xe8,0x0,-1,-1,-1,1,0 }, // psubsb
+    { 554,0x66,0x0f,0xe9,0x0,-1,-1,-1,1,0 }, // psubsw
+    { 555,0x66,0x0f,0xea,0x0,-1,-1,-1,1,0 }, // pminsw
+    { 556,0x66,0x0f,0xeb,0x0,-1,-1,-1,1,0 }, // por
+    { 557,0x66,0x0f,0xec,0x0,-1,-1,-1,1,0 }, // paddsb
+    { 558,0x66,0x0f,0xed,0x0,-1,-1,-1,1,0 }, // paddsw
+    { 559,0x66,0x0f,0xee,0x0,-1,-1,-1,1,0 }, // pmaxsw
+    { 560,0x66,0x0f,0xef,0x0,-1,-1,-1,1,0 }, // pxor
+    { 561,0xf2,0x0f,0xf0,0x0,-1,-1,-1,1,0 }, // lddqu
+    { 562,0x66,0x0f,0xf1,0x0,-1,-1,-1,1,0 }, // psllw
+    { 563,0x66,0x0f,0xf2,0x0,-1,-1,-1,1,0 }, // pslld
+    { 564,0x66,0x0f,0xf3,0x0,-1,-1,-1,1,0 }, // psllq
+    { 565,0x66,0x0f,0xf4,0x0,-1,-1,-1,1,0 }, // pmuludq
+    { 566,0x66,0x0f,0xf5,0x0,-1,-1,-1,1,0 }, // pmaddwd
+    { 567,0x66,0x0f,0xf6,0x0,-1,-1,-1,1,0 }, // psadbw
+    { 568,0x66,0x0f,0xf8,0x0,-1,-1,-1,1,0 }, // psubb
+    { 569,0x66,0x0f,0xf9,0x0,-1,-1,-1,1,0 }, // psubw
+    { 570,0x66,0x0f,0xfa,0x0,-1,-1,-1,1,0 }, // psubd
+    { 571,0x66,0x0f,0xfb,0x0,-1,-1,-1,1,0 }, // psubq
+    { 572,0x66,0x0f,0xfc,0x0,-1,-1,-1,1,0 }, // paddb
+    { 573,0x66,0x0f,0xfd,0x0,-1,-1,-1,1,0 }, // paddw
+    { 574,0x66,0x0f,0xfe,0x0,-1,-1,-1,1,0 }, // paddd
+};
+
+// Indexes in opcodes, grouped by mnemonic. Each opcode alias refers to a slice of these.
+short opcode_alias_opcodes[] = {
+    13, 14, 15, 16, 17, 18, 128, 136, 144, // adc
+    0, 1, 2, 3, 4, 5, 126, 134, 142, // add
+    740, // addsd
+    739, // addss
+    80, // alter
+    25, 26, 27, 28, 29, 30, 130, 138, 146, // and
+    77, // arpl
+    885, // bsf
+    886, // bsr
+    900, // bswap
+    852, 880, // bt
+    883, 884, // btc
+    874, 882, // btr
+    858, 881, // bts
+    496, 546, 547, // call
+    162, 164, // cbw
+    168, 170, // cdq
+    166, // cdqe
+    536, // clc
+    540, // cld
+    870, // clflush
+    538, // cli
+    576, // clts
+    519, // cmc
+    720, // cmova
+    711, // cmovae
+    707, // cmovb
+    717, // cmovbe
+    709, // cmovc
+    714, // cmove
+    734, // cmovg
+    730, // cmovge
+    727, // cmovl
+    731, // cmovle
+    718, // cmovna
+    708, // cmovnae
+    710, // cmovnb
+    719, // cmovnbe
+    712, // cmovnc
+    716, // cmovne
+    732, // cmovng
+    728, // cmovnge
+    729, // cmovnl
+    733, // cmovnle
+    706, // cmovno
+    725, // cmovnp
+    722, // cmovns
+    715, // cmovnz
+    705, // cmovo
+    723, // cmovp
+    724, // cmovpe
+    726, // cmovpo
+    721, // cmovs
+    713, // cmovz
+    47, 48, 49, 50, 51, 52, 133, 141, 149, // cmp
+    193, 196, 198, // cmps
+    194, // cmpsb
+    197, 200, 890, // cmpsd
+    201, // cmpsq
+    889, // cmpss
+    195, 199, // cmpsw
+    872, 873, // cmpxchg
+    895, // cmpxchg16b
+    893, 894, // cmpxchg8b
+    631, // comisd
+    630, // comiss
+    851, // cpuid
+    171, // cqo
+    689, 691, // crc32
+    38, // cs
+    627, // cvtsd2si
+    744, // cvtsd2ss
+    623, // cvtsi2sd
+    622, // cvtsi2ss
+    743, // cvtss2sd
+    626, // cvtss2si
+    625, // cvttsd2si
+    624, // cvttss2si
+    167, 169, // cwd
+    163, 165, // cwde
+    64, 543, 545, // dec
+    526, 534, // div
+    750, // divsd
+    749, // divss
+    53, // ds
+    778, // emms
+    257, 258, // enter
+    31, // es
+    700, // extractps
+    349, // f2xm1
+    338, // fabs
+    313, 314, 405, 406, // fadd
+    439, 440, // faddp
+    337, // fchs
+    395, // fclex
+    368, // fcmovb
+    372, // fcmovbe
+    370, // fcmove
+    381, // fcmovnb
+    385, // fcmovnbe
+    383, // fcmovne
+    387, // fcmovnu
+    374, // fcmovu
+    317, 318, 409, // fcom
+    410, 411, // fcom2
+    403, // fcomi
+    476, // fcomip
+    319, 320, 412, // fcomp
+    413, 414, // fcomp3
+    445, 446, // fcomp5
+    448, // fcompp
+    366, // fcos
+    355, // fdecstp
+    392, // fdisi
+    325, 326, 419, 422, // fdiv
+    459, 460, // fdivp
+    327, 328, 420, 421, // fdivr
+    456, 457, // fdivrp
+    389, // feni
+    424, // ffree
+    462, // ffreep
+    367, 438, // fiadd
+    371, 444, // ficom
+    373, 447, // ficomp
+    378, 455, // fidiv
+    379, 458, // fidivr
+    380, 461, 474, // fild
+    369, 441, // fimul
+    356, // fincstp
+    397, // finit
+    384, 466, // fist
+    386, 469, 477, // fistp
+    382, 425, 463, // fisttp
+    375, 449, // fisub
+    376, 452, // fisubr
+    329, 401, 423, // fld
+    342, // fld1
+    341, // fldcw
+    344, // fldl2e
+    343, // fldl2t
+    346, // fldlg2
+    347, // fldln2
+    345, // fldpi
+    348, // fldz
+    315, 316, 407, 408, // fmul
+    442, 443, // fmulp
+    394, // fnclex
+    391, 393, // fndisi
+    388, 390, // fneni
+    396, // fninit
+    333, // fnop
+    398, 400, // fnsetpm
+    357, // fnstcw
+    436, 472, // fnstsw
+    352, // fpatan
+    359, // fprem
+    354, // fprem1
+    351, // fptan
+    363, // frndint
+    79, // fs
+    364, // fscale
+    399, // fsetpm
+    365, // fsin
+    362, // fsincos
+    361, // fsqrt
+    332, 428, 429, // fst
+    358, // fstcw
+    334, 404, 430, 431, // fstp
+    335, 336, // fstp1
+    467, 468, // fstp8
+    470, 471, // fstp9
+    437, 473, // fstsw
+    321, 322, 415, 418, // fsub
+    453, 454, // fsubp
+    323, 324, 416, 417, // fsubr
+    450, 451, // fsubrp
+    339, // ftst
+    432, 433, // fucom
+    402, // fucomi
+    475, // fucomip
+    434, 435, // fucomp
+    377, // fucompp
+    172, // fwait
+    340, // fxam
+    330, 331, // fxch
+    426, 427, // fxch4
+    464, 465, // fxch7
+    353, // fxtract
+    350, // fyl2x
+    360, // fyl2xp1
+    639, // getsec
+    81, // gs
+    598, 603, 604, 605, 606, 607, 608, 609, 610, 611, 612, 613, 615, 616, 617, 618, 619, 620, 621, // hint_nop
+    518, // hlt
+    505, // icebp
+    527, 535, // idiv
+    83, 85, 525, 533, 871, // imul
+    492, 493, 499, 500, // in
+    55, 542, 544, // inc
+    86, 89, // ins
+    87, // insb
+    90, // insd
+    88, // insw
+    263, 264, // int
+    504, // int1
+    265, // into
+    579, // invd
+    684, 685, // invept
+    569, // invlpg
+    686, 687, // invvpid
+    266, 268, // iret
+    267, 269, // iretd
+    270, // iretq
+    111, 804, // ja
+    102, 795, // jae
+    98, 791, // jb
+    108, 801, // jbe
+    100, 793, // jc
+    488, // jcxz
+    105, 798, // je
+    489, 490, // jecxz
+    125, 818, // jg
+    121, 814, // jge
+    118, 811, // jl
+    122, 815, // jle
+    497, 498, 548, 549, // jmp
+    558, 877, // jmpe
+    109, 802, // jna
+    99, 792, // jnae
+    101, 794, // jnb
+    110, 803, // jnbe
+    103, 796, // jnc
+    107, 800, // jne
+    123, 816, // jng
+    119, 812, // jnge
+    120, 813, // jnl
+    124, 817, // jnle
+    97, 790, // jno
+    116, 809, // jnp
+    113, 806, // jns
+    106, 799, // jnz
+    96, 789, // jo
+    114, 807, // jp
+    115, 808, // jpe
+    117, 810, // jpo
+    491, // jrcxz
+    112, 805, // js
+    104, 797, // jz
+    183, // lahf
+    572, // lar
+    930, // lddqu
+    861, // ldmxcsr
+    156, // lea
+    259, 260, // leave
+    865, // lfence
+    554, // lldt
+    568, // lmsw
+    574, 577, // loadall
+    503, // lock
+    213, 216, 218, // lods
+    214, // lodsb
+    217, 220, // lodsd
+    221, // lodsq
+    215, 219, // lodsw
+    486, 487, // loop
+    483, 485, // loope
+    479, 481, // loopne
+    478, 480, // loopnz
+    482, 484, // loopz
+    573, // lsl
+    555, // ltr
+    752, // maxsd
+    751, // maxss
+    868, // mfence
+    748, // minsd
+    747, // minss
+    563, // monitor
+    152, 153, 154, 155, 231, 232, 255, 256, // mov
+    688, 690, // movbe
+    767, 768, 783, 784, // movd
+    589, // movddup
+    770, 787, // movdqa
+    771, 788, // movdqu
+    594, 597, // movhpd
+    593, 596, // movhps
+    588, 592, // movlpd
+    587, 591, // movlps
+    921, // movntdq
+    665, // movntdqa
+    891, // movnti
+    769, 785, 786, 906, // movq
+    184, 187, 189, // movs
+    185, // movsb
+    887, 888, // movsx
+    188, 191, 584, 586, // movsd
+    595, // movshdup
+    590, // movsldup
+    78, // movsxd
+    192, // movsq
+    583, 585, // movss
+    186, 190, // movsw
+    875, 876, // movzx
+    704, // mpsadbw
+    524, 532, // mul
+    742, // mulsd
+    741, // mulss
+    564, // mwait
+    523, 531, // neg
+    159, 160, 582, 614, // nop
+    522, 530, // not
+    39, // ntaken
+    6, 7, 8, 9, 10, 11, 127, 135, 143, // or
+    494, 495, 501, 502, // out
+    91, 94, // outs
+    92, // outsb
+    95, // outsd
+    93, // outsw
+    654, // pabsb
+    656, // pabsd
+    655, // pabsw
+    764, // packssdw
+    756, // packsswb
+    666, // packusdw
+    760, // packuswb
+    941, // paddb
+    943, // paddd
+    904, // paddq
+    926, // paddsb
+    927, // paddsw
+    911, // paddusb
+    912, // paddusw
+    942, // paddw
+    695, // palignr
+    910, // pand
+    914, // pandn
+    161, // pause
+    915, // pavgb
+    918, // pavgw
+    652, // pblendvb
+    694, // pblendw
+    775, // pcmpeqb
+    777, // pcmpeqd
+    664, // pcmpeqq
+    776, // pcmpeqw
+    757, // pcmpgtb
+    759, // pcmpgtd
+    673, // pcmpgtq
+    758, // pcmpgtw
+    696, // pextrb
+    698, // pextrd
+    699, // pextrq
+    697, // pextrw
+    642, // phaddd
+    643, // phaddsw
+    641, // phaddw
+    683, // phminposuw
+    646, // phsubd
+    647, // phsubsw
+    645, // phsubw
+    701, // pinsrb
+    702, // pinsrd
+    703, // pinsrq
+    892, // pinsrw
+    644, // pmaddubsw
+    935, // pmaddwd
+    678, // pmaxsb
+    679, // pmaxsd
+    928, // pmaxsw
+    913, // pmaxub
+    681, // pmaxud
+    680, // pmaxuw
+    674, // pminsb
+    675, // pminsd
+    924, // pminsw
+    909, // pminub
+    677, // pminud
+    676, // pminuw
+    658, // pmovsxbd
+    659, // pmovsxbq
+    657, // pmovsxbw
+    662, // pmovsxdq
+    660, // pmovsxwd
+    661, // pmovsxwq
+    668, // pmovzxbd
+    669, // pmovzxbq
+    667, // pmovzxbw
+    672, // pmovzxdq
+    670, // pmovzxwd
+    671, // pmovzxwq
+    663, // pmuldq
+    651, // pmulhrsw
+    919, // pmulhuw
+    920, // pmulhw
+    682, // pmulld
+    905, // pmullw
+    934, // pmuludq
+    12, 75, 76, 157, 158, 850, 856, // pop
+    878, // popcnt
+    178, 180, // popf
+    179, // popfd
+    181, // popfq
+    925, // por
+    599, // prefetchnta
+    600, // prefetcht0
+    601, // prefetcht1
+    602, // prefetcht2
+    936, // psadbw
+    640, // pshufb
+    774, // pshufd
+    773, // pshufhw
+    772, // pshuflw
+    648, // psignb
+    650, // psignd
+    649, // psignw
+    932, // pslld
+    933, // psllq
+    931, // psllw
+    917, // psrad
+    916, // psraw
+    902, // psrld
+    903, // psrlq
+    901, // psrlw
+    937, // psubb
+    939, // psubd
+    940, // psubq
+    922, // psubsb
+    923, // psubsw
+    907, // psubusb
+    908, // psubusw
+    938, // psubw
+    653, // ptest
+    761, // punpckhbw
+    763, // punpckhdq
+    766, // punpckhqdq
+    762, // punpckhwd
+    753, // punpcklbw
+    755, // punpckldq
+    765, // punpcklqdq
+    754, // punpcklwd
+    73, 74, 82, 84, 550, 551, 849, 855, // push
+    174, 176, // pushf
+    175, // pushfd
+    177, // pushfq
+    929, // pxor
+    235, 245, 273, 283, 293, 303, // rcl
+    738, // rcpss
+    236, 246, 274, 284, 294, 304, // rcr
+    634, // rdmsr
+    635, // rdpmc
+    633, // rdtsc
+    571, // rdtscp
+    508, 511, 514, 517, // rep
+    513, 516, // repe
+    507, 510, // repne
+    506, 509, // repnz
+    512, 515, // repz
+    253, 254, // retn
+    261, 262, // retf
+    56, // rex
+    57, // rex.b
+    60, // rex.r
+    61, // rex.rb
+    62, // rex.rx
+    63, // rex.rxb
+    65, // rex.w
+    66, // rex.wb
+    69, // rex.wr
+    70, // rex.wrb
+    71, // rex.wrx
+    72, // rex.wrxb
+    67, // rex.wx
+    68, // rex.wxb
+    58, // rex.x
+    59, // rex.xb
+    233, 243, 271, 281, 291, 301, // rol
+    234, 244, 272, 282, 292, 302, // ror
+    693, // roundsd
+    692, // roundss
+    857, // rsm
+    737, // rsqrtss
+    182, // sahf
+    238, 240, 248, 250, 276, 278, 286, 288, 296, 298, 306, 308, // sal
+    242, 252, 280, 290, 300, 310, // sar
+    19, 20, 21, 22, 23, 24, 129, 137, 145, // sbb
+    222, 225, 227, // scas
+    223, // scasb
+    226, 229, // scasd
+    230, // scasq
+    224, 228, // scasw
+    834, // seta
+    825, // setae
+    821, // setb
+    831, // setbe
+    823, // setc
+    828, // sete
+    848, // setg
+    844, // setge
+    841, // setl
+    845, // setle
+    832, // setna
+    822, // setnae
+    824, // setnb
+    833, // setnbe
+    826, // setnc
+    830, // setne
+    846, // setng
+    842, // setnge
+    843, // setnl
+    847, // setnle
+    820, // setno
+    839, // setnp
+    836, // setns
+    829, // setnz
+    819, // seto
+    837, // setp
+    838, // setpe
+    840, // setpo
+    835, // sets
+    827, // setz
+    869, // sfence
+    237, 241, 247, 251, 275, 279, 285, 289, 295, 299, 305, 309, // shl
+    853, 854, // shld
+    239, 249, 277, 287, 297, 307, // shr
+    859, 860, // shrd
+    552, // sldt
+    567, // smsw
+    736, // sqrtsd
+    735, // sqrtss
+    46, // ss
+    537, // stc
+    541, // std
+    539, // sti
+    862, // stmxcsr
+    204, 207, 209, // stos
+    205, // stosb
+    208, 211, // stosd
+    212, // stosq
+    206, 210, // stosw
+    553, // str
+    32, 33, 34, 35, 36, 37, 131, 139, 147, // sub
+    746, // subsd
+    745, // subss
+    570, // swapgs
+    575, // syscall
+    636, 637, // sysenter
+    638, // sysexit
+    578, // sysret
+    54, // taken
+    150, 151, 202, 203, 520, 521, 528, 529, // test
+    629, // ucomisd
+    628, // ucomiss
+    879, // ud
+    581, // ud2
+    556, // verr
+    557, // verw
+    559, // vmcall
+    897, // vmclear
+    560, // vmlaunch
+    896, // vmptrld
+    899, // vmptrst
+    779, 780, // vmread
+    561, // vmresume
+    781, 782, // vmwrite
+    562, // vmxoff
+    898, // vmxon
+    173, // wait
+    580, // wbinvd
+    632, // wrmsr
+    565, // xgetbv
+    311, // xlat
+    312, // xlatb
+    40, 41, 42, 43, 44, 45, 132, 140, 148, // xor
+    866, 867, // xrstor
+    863, 864, // xsave
+    566, // xsetbv
 };
 
 OpcodeAlias opcode_aliases[] = {
-    { "aaa","aaa",0,0,0 },
-    { "aad","aad",0,0,0 },
-    { "aam","aam",0,0,0 },
-    { "aas","aas",0,0,0 },
-    { "adc","adc",0,0,0 },
-    { "add","add",0,0,0 },
-    { "addb","add",SIZE08,SIZE08,SIZE08 },
-    { "addl","add",SIZE32,SIZE32,SIZE32 },
-    { "addpd","addpd",0,0,0 },
-    { "addps","addps",0,0,0 },
-    { "addq","add",SIZE64,SIZE64,SIZE64 },
-    { "addsd","addsd",SIZE32,SIZE32,SIZE32 },
-    { "addss","addss",SIZE16,SIZE16,SIZE16 },
-    { "addsubpd","addsubpd",0,0,0 },
-    { "addsubps","addsubps",0,0,0 },
-    { "addw","add",SIZE16,SIZE16,SIZE16 },
-    { "adx","adx",0,0,0 },
-    { "alter","alter",0,0,0 },
-    { "amx","amx",0,0,0 },
-    { "and","and",0,0,0 },
-    { "andb","and",SIZE08,SIZE08,SIZE08 },
-    { "andl","and",SIZE32,SIZE32,SIZE32 },
-    { "andnpd","andnpd",0,0,0 },
-    { "andnps","andnps",0,0,0 },
-    { "andpd","andpd",0,0,0 },
-    { "andps","andps",0,0,0 },
-    { "andq","and",SIZE64,SIZE64,SIZE64 },
-    { "andw","and",SIZE16,SIZE16,SIZE16 },
-    { "arpl","arpl",0,0,0 },
-    { "blendpd","blendpd",0,0,0 },
-    { "blendps","blendps",0,0,0 },
-    { "blendvpd","blendvpd",0,0,0 },
-    { "blendvps","blendvps",0,0,0 },
-    { "bound","bound",0,0,0 },
-    { "bsf","bsf",0,0,0 },
-    { "bsr","bsr",0,0,0 },
-    { "bswap","bswap",0,0,0 },
-    { "bt","bt",0,0,0 },
-    { "btc","btc",0,0,0 },
-    { "btr","btr",0,0,0 },
-    { "bts","bts",0,0,0 },
-    { "call","call",0,0,0 },
-    { "callf","callf",0,0,0 },
-    { "callq","call",0,0,0 },
-    { "cbw","cbw",0,0,0 },
-    { "cdq","cdq",0,0,0 },
-    { "cdqe","cdqe",0,0,0 },
-    { "clc","clc",0,0,0 },
-    { "cld","cld",0,0,0 },
-    { "clflush","clflush",0,0,0 },
-    { "cli","cli",0,0,0 },
-    { "cltd","cdq",SIZE32,SIZE32,0 },
-    { "clts","clts",0,0,0 },
-    { "cmc","cmc",0,0,0 },
-    { "cmova","cmova",0,0,0 },
-    { "cmovae","cmovae",0,0,0 },
-    { "cmovael","cmovae",SIZE32,SIZE32,SIZE32 },
-    { "cmovaeq","cmovae",SIZE64,SIZE64,SIZE64 },
-    { "cmovaew","cmovae",SIZE16,SIZE16,SIZE16 },
-    { "cmoval","cmova",SIZE32,SIZE32,SIZE32 },
-    { "cmovaq","cmova",SIZE64,SIZE64,SIZE64 },
-    { "cmovaw","cmova",SIZE16,SIZE16,SIZE16 },
-    { "cmovb","cmovb",0,0,0 },
-    { "cmovbe","cmovbe",0,0,0 },
-    { "cmovbel","cmovbe",SIZE32,SIZE32,SIZE32 },
-    { "cmovbeq","cmovbe",SIZE64,SIZE64,SIZE64 },
-    { "cmovbew","cmovbe",SIZE16,SIZE16,SIZE16 },
-    { "cmovbl","cmovb",SIZE32,SIZE32,SIZE32 },
-    { "cmovbq","cmovb",SIZE64,SIZE64,SIZE64 },
-    { "cmovbw","cmovb",SIZE16,SIZE16,SIZE16 },
-    { "cmovc","cmovc",0,0,0 },
-    { "cmovcl","cmovc",SIZE32,SIZE32,SIZE32 },
-    { "cmovcq","cmovc",SIZE64,SIZE64,SIZE64 },
-    { "cmovcw","cmovc",SIZE16,SIZE16,SIZE16 },
-    { "cmove","cmove",0,0,0 },
-    { "cmovel","cmove",SIZE32,SIZE32,SIZE32 },
-    { "cmoveq","cmove",SIZE64,SIZE64,SIZE64 },
-    { "cmovew","cmove",SIZE16,SIZE16,SIZE16 },
-    { "cmovg","cmovg",0,0,0 },
-    { "cmovge","cmovge",0,0,0 },
-    { "cmovgel","cmovge",SIZE32,SIZE32,SIZE32 },
-    { "cmovgeq","cmovge",SIZE64,SIZE64,SIZE64 },
-    { "cmovgew","cmovge",SIZE16,SIZE16,SIZE16 },
-    { "cmovgl","cmovg",SIZE32,SIZE32,SIZE32 },
-    { "cmovgq","cmovg",SIZE64,SIZE64,SIZE64 },
-    { "cmovgw","cmovg",SIZE16,SIZE16,SIZE16 },
-    { "cmovl","cmovl",0,0,0 },
-    { "cmovle","cmovle",0,0,0 },
-    { "cmovlel","cmovle",SIZE32,SIZE32,SIZE32 },
-    { "cmovleq","cmovle",SIZE64,SIZE64,SIZE64 },
-    { "cmovlew","cmovle",SIZE16,SIZE16,SIZE16 },
-    { "cmovll","cmovl",SIZE32,SIZE32,SIZE32 },
-    { "cmovlq","cmovl",SIZE64,SIZE64,SIZE64 },
-    { "cmovlw","cmovl",SIZE16,SIZE16,SIZE16 },
-    { "cmovna","cmovna",0,0,0 },
-    { "cmovnae","cmovnae",0,0,0 },
-    { "cmovnael","cmovnae",SIZE32,SIZE32,SIZE32 },
-    { "cmovnaeq","cmovnae",SIZE64,SIZE64,SIZE64 },
-    { "cmovnaew","cmovnae",SIZE16,SIZE16,SIZE16 },
-    { "cmovnal","cmovna",SIZE32,SIZE32,SIZE32 },
-    { "cmovnaq","cmovna",SIZE64,SIZE64,SIZE64 },
-    { "cmovnaw","cmovna",SIZE16,SIZE16,SIZE16 },
-    { "cmovnb","cmovnb",0,0,0 },
-    { "cmovnbe","cmovnbe",0,0,0 },
-    { "cmovnbel","cmovnbe",SIZE32,SIZE32,SIZE32 },
-    { "cmovnbeq","cmovnbe",SIZE64,SIZE64,SIZE64 },
-    { "cmovnbew","cmovnbe",SIZE16,SIZE16,SIZE16 },
-    { "cmovnbl","cmovnb",SIZE32,SIZE32,SIZE32 },
-    { "cmovnbq","cmovnb",SIZE64,SIZE64,SIZE64 },
-    { "cmovnbw","cmovnb",SIZE16,SIZE16,SIZE16 },
-    { "cmovnc","cmovnc",0,0,0 },
-    { "cmovncl","cmovnc",SIZE32,SIZE32,SIZE32 },
-    { "cmovncq","cmovnc",SIZE64,SIZE64,SIZE64 },
-    { "cmovncw","cmovnc",SIZE16,SIZE16,SIZE16 },
-    { "cmovne","cmovne",0,0,0 },
-    { "cmovnel","cmovne",SIZE32,SIZE32,SIZE32 },
-    { "cmovneq","cmovne",SIZE64,SIZE64,SIZE64 },
-    { "cmovnew","cmovne",SIZE16,SIZE16,SIZE16 },
-    { "cmovng","cmovng",0,0,0 },
-    { "cmovnge","cmovnge",0,0,0 },
-    { "cmovngel","cmovnge",SIZE32,SIZE32,SIZE32 },
-    { "cmovngeq","cmovnge",SIZE64,SIZE64,SIZE64 },
-    { "cmovngew","cmovnge",SIZE16,SIZE16,SIZE16 },
-    { "cmovngl","cmovng",SIZE32,SIZE32,SIZE32 },
-    { "cmovngq","cmovng",SIZE64,SIZE64,SIZE64 },
-    { "cmovngw","cmovng",SIZE16,SIZE16,SIZE16 },
-    { "cmovnl","cmovnl",0,0,0 },
-    { "cmovnle","cmovnle",0,0,0 },
-    { "cmovnlel","cmovnle",SIZE32,SIZE32,SIZE32 },
-    { "cmovnleq","cmovnle",SIZE64,SIZE64,SIZE64 },
-    { "cmovnlew","cmovnle",SIZE16,SIZE16,SIZE16 },
-    { "cmovnll","cmovnl",SIZE32,SIZE32,SIZE32 },
-    { "cmovnlq","cmovnl",SIZE64,SIZE64,SIZE64 },
-    { "cmovnlw","cmovnl",SIZE16,SIZE16,SIZE16 },
-    { "cmovno","cmovno",0,0,0 },
-    { "cmovnol","cmovno",SIZE32,SIZE32,SIZE32 },
-    { "cmovnoq","cmovno",SIZE64,SIZE64,SIZE64 },
-    { "cmovnow","cmovno",SIZE16,SIZE16,SIZE16 },
-    { "cmovnp","cmovnp",0,0,0 },
-    { "cmovnpl","cmovnp",SIZE32,SIZE32,SIZE32 },
-    { "cmovnpq","cmovnp",SIZE64,SIZE64,SIZE64 },
-    { "cmovnpw","cmovnp",SIZE16,SIZE16,SIZE16 },
-    { "cmovns","cmovns",0,0,0 },
-    { "cmovnsl","cmovns",SIZE32,SIZE32,SIZE32 },
-    { "cmovnsq","cmovns",SIZE64,SIZE64,SIZE64 },
-    { "cmovnsw","cmovns",SIZE16,SIZE16,SIZE16 },
-    { "cmovnz","cmovnz",0,0,0 },
-    { "cmovnzl","cmovnz",SIZE32,SIZE32,SIZE32 },
-    { "cmovnzq","cmovnz",SIZE64,SIZE64,SIZE64 },
-    { "cmovnzw","cmovnz",SIZE16,SIZE16,SIZE16 },
-    { "cmovo","cmovo",0,0,0 },
-    { "cmovol","cmovo",SIZE32,SIZE32,SIZE32 },
-    { "cmovoq","cmovo",SIZE64,SIZE64,SIZE64 },
-    { "cmovow","cmovo",SIZE16,SIZE16,SIZE16 },
-    { "cmovp","cmovp",0,0,0 },
-    { "cmovpe","cmovpe",0,0,0 },
-    { "cmovpel","cmovpe",SIZE32,SIZE32,SIZE32 },
-    { "cmovpeq","cmovpe",SIZE64,SIZE64,SIZE64 },
-    { "cmovpew","cmovpe",SIZE16,SIZE16,SIZE16 },
-    { "cmovpl","cmovp",SIZE32,SIZE32,SIZE32 },
-    { "cmovpo","cmovpo",0,0,0 },
-    { "cmovpol","cmovpo",SIZE32,SIZE32,SIZE32 },
-    { "cmovpoq","cmovpo",SIZE64,SIZE64,SIZE64 },
-    { "cmovpow","cmovpo",SIZE16,SIZE16,SIZE16 },
-    { "cmovpq","cmovp",SIZE64,SIZE64,SIZE64 },
-    { "cmovpw","cmovp",SIZE16,SIZE16,SIZE16 },
-    { "cmovs","cmovs",0,0,0 },
-    { "cmovsl","cmovs",SIZE32,SIZE32,SIZE32 },
-    { "cmovsq","cmovs",SIZE64,SIZE64,SIZE64 },
-    { "cmovsw","cmovs",SIZE16,SIZE16,SIZE16 },
-    { "cmovz","cmovz",0,0,0 },
-    { "cmovzl","cmovz",SIZE32,SIZE32,SIZE32 },
-    { "cmovzq","cmovz",SIZE64,SIZE64,SIZE64 },
-    { "cmovzw","cmovz",SIZE16,SIZE16,SIZE16 },
-    { "cmp","cmp",0,0,0 },
-    { "cmpb","cmp",SIZE08,SIZE08,SIZE08 },
-    { "cmpl","cmp",SIZE32,SIZE32,SIZE32 },
-    { "cmppd","cmppd",0,0,0 },
-    { "cmpps","cmpps",0,0,0 },
-    { "cmpq","cmp",SIZE64,SIZE64,SIZE64 },
-    { "cmps","cmps",0,0,0 },
-    { "cmpsb","cmpsb",0,0,0 },
-    { "cmpsd","cmpsd",0,0,0 },
-    { "cmpsq","cmpsq",0,0,0 },
-    { "cmpss","cmpss",0,0,0 },
-    { "cmpsw","cmpsw",0,0,0 },
-    { "cmpw","cmp",SIZE16,SIZE16,SIZE16 },
-    { "cmpxchg","cmpxchg",0,0,0 },
-    { "cmpxchg16b","cmpxchg16b",0,0,0 },
-    { "cmpxchg8b","cmpxchg8b",0,0,0 },
-    { "comisd","comisd",SIZE32,SIZE32,SIZE32 },
-    { "comiss","comiss",SIZE16,SIZE16,SIZE16 },
-    { "cpuid","cpuid",0,0,0 },
-    { "cqo","cqo",0,0,0 },
-    { "cqto","cqo",SIZE64,SIZE64,0 },
-    { "crc32","crc32",0,0,0 },
-    { "cs","cs",0,0,0 },
-    { "cvtdq2pd","cvtdq2pd",0,0,0 },
-    { "cvtdq2ps","cvtdq2ps",0,0,0 },
-    { "cvtpd2dq","cvtpd2dq",0,0,0 },
-    { "cvtpd2pi","cvtpd2pi",0,0,0 },
-    { "cvtpd2ps","cvtpd2ps",0,0,0 },
-    { "cvtpi2pd","cvtpi2pd",0,0,0 },
-    { "cvtpi2ps","cvtpi2ps",0,0,0 },
-    { "cvtps2dq","cvtps2dq",0,0,0 },
-    { "cvtps2pd","cvtps2pd",0,0,0 },
-    { "cvtps2pi","cvtps2pi",0,0,0 },
-    { "cvtsd2si","cvtsd2si",0,0,0 },
-    { "cvtsd2ss","cvtsd2ss",SIZE32,SIZE16,0 },
-    { "cvtsi2sd","cvtsi2sd",0,0,0 },
-    { "cvtsi2sdl","cvtsi2sd",SIZE32,SIZE32,0 },
-    { "cvtsi2sdq","cvtsi2sd",SIZE64,SIZE32,0 },
-    { "cvtsi2ss","cvtsi2ss",0,0,0 },
-    { "cvtsi2ssl","cvtsi2ss",SIZE32,SIZE16,0 },
-    { "cvtsi2ssq","cvtsi2ss",SIZE32,SIZE32,0 },
-    { "cvtss2sd","cvtss2sd",0,0,0 },
-    { "cvtss2si","cvtss2si",0,0,0 },
-    { "cvttpd2dq","cvttpd2dq",0,0,0 },
-    { "cvttpd2pi","cvttpd2pi",0,0,0 },
-    { "cvttps2dq","cvttps2dq",0,0,0 },
-    { "cvttps2pi","cvttps2pi",0,0,0 },
-    { "cvttsd2si","cvttsd2si",0,0,0 },
-    { "cvttsd2sil","cvttsd2si",SIZE32,SIZE32,SIZE32 },
-    { "cvttsd2siq","cvttsd2si",SIZE64,SIZE64,SIZE64 },
-    { "cvttss2si","cvttss2si",0,0,0 },
-    { "cvttss2sil","cvttss2si",SIZE32,SIZE32,SIZE32 },
-    { "cvttss2siq","cvttss2si",SIZE64,SIZE64,SIZE64 },
-    { "cwd","cwd",0,0,0 },
-    { "cwde","cwde",0,0,0 },
-    { "cwtd","cwd",SIZE16,SIZE32,0 },
-    { "daa","daa",0,0,0 },
-    { "das","das",0,0,0 },
-    { "dec","dec",0,0,0 },
-    { "div","div",0,0,0 },
-    { "divl","div",SIZE32,SIZE32,SIZE32 },
-    { "divpd","divpd",0,0,0 },
-    { "divps","divps",0,0,0 },
-    { "divq","div",SIZE64,SIZE64,SIZE64 },
-    { "divsd","divsd",SIZE32,SIZE32,SIZE32 },
-    { "divss","divss",SIZE16,SIZE16,SIZE16 },
-    { "dppd","dppd",0,0,0 },
-    { "dpps","dpps",0,0,0 },
-    { "ds","ds",0,0,0 },
-    { "emms","emms",0,0,0 },
-    { "enter","enter",0,0,0 },
-    { "es","es",0,0,0 },
-    { "extractps","extractps",0,0,0 },
-    { "f2xm1","f2xm1",0,0,0 },
-    { "fabs","fabs",0,0,0 },
-    { "fadd","fadd",0,0,0 },
-    { "faddp","faddp",0,0,0 },
-    { "fadds","fadd",SIZE32,SIZE32,SIZE32 },
-    { "fbld","fbld",0,0,0 },
-    { "fbstp","fbstp",0,0,0 },
-    { "fchs","fchs",0,0,0 },
-    { "fclex","fclex",0,0,0 },
-    { "fcmovb","fcmovb",0,0,0 },
-    { "fcmovbe","fcmovbe",0,0,0 },
-    { "fcmove","fcmove",0,0,0 },
-    { "fcmovnb","fcmovnb",0,0,0 },
-    { "fcmovnbe","fcmovnbe",0,0,0 },
-    { "fcmovne","fcmovne",0,0,0 },
-    { "fcmovnu","fcmovnu",0,0,0 },
-    { "fcmovu","fcmovu",0,0,0 },
-    { "fcom","fcom",0,0,0 },
-    { "fcom2","fcom2",0,0,0 },
-    { "fcomi","fcomi",0,0,0 },
-    { "fcomip","fcomip",0,0,0 },
-    { "fcomp","fcomp",0,0,0 },
-    { "fcomp3","fcomp3",0,0,0 },
-    { "fcomp5","fcomp5",0,0,0 },
-    { "fcompp","fcompp",0,0,0 },
-    { "fcos","fcos",0,0,0 },
-    { "fdecstp","fdecstp",0,0,0 },
-    { "fdisi","fdisi",0,0,0 },
-    { "fdiv","fdiv",0,0,0 },
-    { "fdivp","fdivp",0,0,0 },
-    { "fdivr","fdivr",0,0,0 },
-    { "fdivrp","fdivrp",0,0,0 },
-    { "feni","feni",0,0,0 },
-    { "ffree","ffree",0,0,0 },
-    { "ffreep","ffreep",0,0,0 },
-    { "fiadd","fiadd",0,0,0 },
-    { "ficom","ficom",0,0,0 },
-    { "ficomp","ficomp",0,0,0 },
-    { "fidiv","fidiv",0,0,0 },
-    { "fidivr","fidivr",0,0,0 },
-    { "fild","fild",SIZE16,SIZE16,SIZE16 },
-    { "fildl","fild",SIZE32,SIZE32,SIZE32 },
-    { "fildll","fild",SIZE64,SIZE64,SIZE64 },
-    { "fildq","fild",SIZE64,SIZE64,SIZE64 },
-    { "filds","fild",SIZE16,SIZE16,SIZE16 },
-    { "fimul","fimul",0,0,0 },
-    { "fincstp","fincstp",0,0,0 },
-    { "finit","finit",0,0,0 },
-    { "fist","fist",0,0,0 },
-    { "fistp","fistp",SIZE16,SIZE16,SIZE16 },
-    { "fistpl","fistp",SIZE32,SIZE32,SIZE32 },
-    { "fistpll","fistp",SIZE64,SIZE64,SIZE64 },
-    { "fistpq","fistp",SIZE64,SIZE64,SIZE64 },
-    { "fistps","fistp",SIZE16,SIZE16,SIZE16 },
-    { "fisttp","fisttp",0,0,0 },
-    { "fisub","fisub",0,0,0 },
-    { "fisubr","fisubr",0,0,0 },
-    { "fld","fld",SIZE32,SIZE32,SIZE32 },
-    { "fld1","fld1",0,0,0 },
-    { "fldcw","fldcw",0,0,0 },
-    { "fldenv","fldenv",0,0,0 },
-    { "fldl","fld",SIZE64,SIZE64,SIZE64 },
-    { "fldl2e","fldl2e",0,0,0 },
-    { "fldl2t","fldl2t",0,0,0 },
-    { "fldlg2","fldlg2",0,0,0 },
-    { "fldln2","fldln2",0,0,0 },
-    { "fldpi","fldpi",0,0,0 },
-    { "flds","fld",SIZE32,SIZE32,SIZE32 },
-    { "fldt","fld",SIZEST,SIZEST,SIZEST },
-    { "fldz","fldz",0,0,0 },
-    { "fmul","fmul",0,0,0 },
-    { "fmulp","fmulp",0,0,0 },
-    { "fnclex","fnclex",0,0,0 },
-    { "fndisi","fndisi",0,0,0 },
-    { "fneni","fneni",0,0,0 },
-    { "fninit","fninit",0,0,0 },
-    { "fnop","fnop",0,0,0 },
-    { "fnsave","fnsave",0,0,0 },
-    { "fnsetpm","fnsetpm",0,0,0 },
-    { "fnstcw","fnstcw",0,0,0 },
-    { "fnstenv","fnstenv",0,0,0 },
-    { "fnstsw","fnstsw",0,0,0 },
-    { "fpatan","fpatan",0,0,0 },
-    { "fprem","fprem",0,0,0 },
-    { "fprem1","fprem1",0,0,0 },
-    { "fptan","fptan",0,0,0 },
-    { "frndint","frndint",0,0,0 },
-    { "frstor","frstor",0,0,0 },
-    { "fs","fs",0,0,0 },
-    { "fsave","fsave",0,0,0 },
-    { "fscale","fscale",0,0,0 },
-    { "fsetpm","fsetpm",0,0,0 },
-    { "fsin","fsin",0,0,0 },
-    { "fsincos","fsincos",0,0,0 },
-    { "fsqrt","fsqrt",0,0,0 },
-    { "fst","fst",0,0,0 },
-    { "fstcw","fstcw",0,0,0 },
-    { "fstenv","fstenv",0,0,0 },
-    { "fstp","fstp",0,0,0 },
-    { "fstp1","fstp1",0,0,0 },
-    { "fstp8","fstp8",0,0,0 },
-    { "fstp9","fstp9",0,0,0 },
-    { "fstpl","fstp",SIZE64,SIZE64,SIZE64 },
-    { "fstps","fstp",SIZE32,SIZE32,SIZE32 },
-    { "fstpt","fstp",SIZEST,SIZEST,SIZEST },
-    { "fstsw","fstsw",0,0,0 },
-    { "fsub","fsub",0,0,0 },
-    { "fsubp","fsubp",0,0,0 },
-    { "fsubr","fsubr",0,0,0 },
-    { "fsubrp","fsubrp",0,0,0 },
-    { "ftst","ftst",0,0,0 },
-    { "fucom","fucom",0,0,0 },
-    { "fucomi","fucomi",0,0,0 },
-    { "fucomip","fucomip",0,0,0 },
-    { "fucomp","fucomp",0,0,0 },
-    { "fucompp","fucompp",0,0,0 },
-    { "fwait","fwait",0,0,0 },
-    { "fxam","fxam",0,0,0 },
-    { "fxch","fxch",0,0,0 },
-    { "fxch4","fxch4",0,0,0 },
-    { "fxch7","fxch7",0,0,0 },
-    { "fxrstor","fxrstor",0,0,0 },
-    { "fxsave","fxsave",0,0,0 },
-    { "fxtract","fxtract",0,0,0 },
-    { "fyl2x","fyl2x",0,0,0 },
-    { "fyl2xp1","fyl2xp1",0,0,0 },
-    { "getsec","getsec",0,0,0 },
-    { "gs","gs",0,0,0 },
-    { "haddpd","haddpd",0,0,0 },
-    { "haddps","haddps",0,0,0 },
-    { "hint_nop","hint_nop",0,0,0 },
-    { "hlt","hlt",0,0,0 },
-    { "hsubpd","hsubpd",0,0,0 },
-    { "hsubps","hsubps",0,0,0 },
-    { "icebp","icebp",0,0,0 },
-    { "idiv","idiv",0,0,0 },
-    { "idivl","idiv",SIZE32,SIZE32,SIZE32 },
-    { "idivq","idiv",SIZE64,SIZE64,SIZE64 },
-    { "imul","imul",0,0,0 },
-    { "imulb","imul",SIZE08,SIZE08,SIZE08 },
-    { "imull","imul",SIZE32,SIZE32,SIZE32 },
-    { "imulq","imul",SIZE64,SIZE64,SIZE64 },
-    { "imulw","imul",SIZE16,SIZE16,SIZE16 },
-    { "in","in",0,0,0 },
-    { "inc","inc",0,0,0 },
-    { "ins","ins",0,0,0 },
-    { "insb","insb",0,0,0 },
-    { "insd","insd",0,0,0 },
-    { "insertps","insertps",0,0,0 },
-    { "insw","insw",0,0,0 },
-    { "int","int",0,0,0 },
-    { "int1","int1",0,0,0 },
-    { "into","into",0,0,0 },
-    { "invd","invd",0,0,0 },
-    { "invept","invept",0,0,0 },
-    { "invlpg","invlpg",0,0,0 },
-    { "invvpid","invvpid",0,0,0 },
-    { "iret","iret",0,0,0 },
-    { "iretd","iretd",0,0,0 },
-    { "iretq","iretq",0,0,0 },
-    { "ja","ja",0,0,0 },
-    { "jae","jae",0,0,0 },
-    { "jb","jb",0,0,0 },
-    { "jbe","jbe",0,0,0 },
-    { "jc","jc",0,0,0 },
-    { "jcxz","jcxz",0,0,0 },
-    { "je","je",0,0,0 },
-    { "jecxz","jecxz",0,0,0 },
-    { "jg","jg",0,0,0 },
-    { "jge","jge",0,0,0 },
-    { "jl","jl",0,0,0 },
-    { "jle","jle",0,0,0 },
-    { "jmp","jmp",0,0,0 },
-    { "jmpe","jmpe",0,0,0 },
-    { "jmpf","jmpf",0,0,0 },
-    { "jna","jna",0,0,0 },
-    { "jnae","jnae",0,0,0 },
-    { "jnb","jnb",0,0,0 },
-    { "jnbe","jnbe",0,0,0 },
-    { "jnc","jnc",0,0,0 },
-    { "jne","jne",0,0,0 },
-    { "jng","jng",0,0,0 },
-    { "jnge","jnge",0,0,0 },
-    { "jnl","jnl",0,0,0 },
-    { "jnle","jnle",0,0,0 },
-    { "jno","jno",0,0,0 },
-    { "jnp","jnp",0,0,0 },
-    { "jns","jns",0,0,0 },
-    { "jnz","jnz",0,0,0 },
-    { "jo","jo",0,0,0 },
-    { "jp","jp",0,0,0 },
-    { "jpe","jpe",0,0,0 },
-    { "jpo","jpo",0,0,0 },
-    { "jrcxz","jrcxz",0,0,0 },
-    { "js","js",0,0,0 },
-    { "jz","jz",0,0,0 },
-    { "lahf","lahf",0,0,0 },
-    { "lar","lar",0,0,0 },
-    { "lddqu","lddqu",0,0,0 },
-    { "ldmxcsr","ldmxcsr",0,0,0 },
-    { "lds","lds",0,0,0 },
-    { "lea","lea",0,0,0 },
-    { "leaq","lea",SIZE64,SIZE64,SIZE64 },
-    { "leave","leave",0,0,0 },
-    { "leaveq","leave",0,0,0 },
-    { "les","les",0,0,0 },
-    { "lfence","lfence",0,0,0 },
-    { "lfs","lfs",0,0,0 },
-    { "lgdt","lgdt",0,0,0 },
-    { "lgs","lgs",0,0,0 },
-    { "lidt","lidt",0,0,0 },
-    { "lldt","lldt",0,0,0 },
-    { "lmsw","lmsw",0,0,0 },
-    { "loadall","loadall",0,0,0 },
-    { "lock","lock",0,0,0 },
-    { "lods","lods",0,0,0 },
-    { "lodsb","lodsb",0,0,0 },
-    { "lodsd","lodsd",0,0,0 },
-    { "lodsq","lodsq",0,0,0 },
-    { "lodsw","lodsw",0,0,0 },
-    { "loop","loop",0,0,0 },
-    { "loope","loope",0,0,0 },
-    { "loopne","loopne",0,0,0 },
-    { "loopnz","loopnz",0,0,0 },
-    { "loopz","loopz",0,0,0 },
-    { "lsl","lsl",0,0,0 },
-    { "lss","lss",0,0,0 },
-    { "ltr","ltr",0,0,0 },
-    { "maskmovdqu","maskmovdqu",0,0,0 },
-    { "maskmovq","maskmovq",0,0,0 },
-    { "maxpd","maxpd",0,0,0 },
-    { "maxps","maxps",0,0,0 },
-    { "maxsd","maxsd",0,0,0 },
-    { "maxss","maxss",0,0,0 },
-    { "mfence","mfence",0,0,0 },
-    { "minpd","minpd",0,0,0 },
-    { "minps","minps",0,0,0 },
-    { "minsd","minsd",0,0,0 },
-    { "minss","minss",0,0,0 },
-    { "monitor","monitor",0,0,0 },
-    { "mov","mov",0,0,0 },
-    { "movabsq","mov",SIZE64,SIZE64,SIZE64 },
-    { "movapd","movapd",0,0,0 },
-    { "movaps","movaps",0,0,0 },
-    { "movb","mov",SIZE08,SIZE08,SIZE08 },
-    { "movbe","movbe",0,0,0 },
-    { "movd","movd",0,0,0 },
-    { "movddup","movddup",0,0,0 },
-    { "movdq2q","movdq2q",0,0,0 },
-    { "movdqa","movdqa",0,0,0 },
-    { "movdqu","movdqu",0,0,0 },
-    { "movhlps","movhlps",0,0,0 },
-    { "movhpd","movhpd",0,0,0 },
-    { "movhps","movhps",0,0,0 },
-    { "movl","mov",SIZE32,SIZE32,SIZE32 },
-    { "movlhps","movlhps",0,0,0 },
-    { "movlpd","movlpd",0,0,0 },
-    { "movlps","movlps",0,0,0 },
-    { "movmskpd","movmskpd",0,0,0 },
-    { "movmskps","movmskps",0,0,0 },
-    { "movntdq","movntdq",0,0,0 },
-    { "movntdqa","movntdqa",0,0,0 },
-    { "movnti","movnti",0,0,0 },
-    { "movntpd","movntpd",0,0,0 },
-    { "movntps","movntps",0,0,0 },
-    { "movntq","movntq",0,0,0 },
-    { "movq","movq",SIZE64,SIZE64,SIZE64 },
-    { "movq","mov",SIZE64,SIZE64,SIZE64 },
-    { "movq2dq","movq2dq",0,0,0 },
-    { "movs","movs",0,0,0 },
-    { "movsb","movsb",0,0,0 },
-    { "movsbl","movsx",SIZE08,SIZE32,0 },
-    { "movsbq","movsx",SIZE08,SIZE64,0 },
-    { "movsbw","movsx",SIZE08,SIZE32,0 },
-    { "movsd","movsd",SIZE32,SIZE32,SIZE32 },
-    { "movshdup","movshdup",0,0,0 },
-    { "movsldup","movsldup",0,0,0 },
-    { "movslq","movsxd",SIZE32,SIZE64,0 },
-    { "movsq","movsq",0,0,0 },
-    { "movss","movss",SIZE16,SIZE16,SIZE16 },
-    { "movsw","movsw",0,0,0 },
-    { "movswl","movsx",SIZE16,SIZE32,0 },
-    { "movswq","movsx",SIZE16,SIZE64,0 },
-    { "movsx","movsx",0,0,0 },
-    { "movsxd","movsxd",0,0,0 },
-    { "movupd","movupd",0,0,0 },
-    { "movups","movups",0,0,0 },
-    { "movw","mov",SIZE16,SIZE16,SIZE16 },
-    { "movzbl","movzx",SIZE08,SIZE32,0 },
-    { "movzbq","movzx",SIZE08,SIZE64,0 },
-    { "movzbw","movzx",SIZE08,SIZE16,0 },
-    { "movzwl","movzx",SIZE16,SIZE32,0 },
-    { "movzwq","movzx",SIZE16,SIZE64,0 },
-    { "movzx","movzx",0,0,0 },
-    { "mpsadbw","mpsadbw",0,0,0 },
-    { "mul","mul",0,0,0 },
-    { "mulpd","mulpd",0,0,0 },
-    { "mulps","mulps",0,0,0 },
-    { "mulsd","mulsd",SIZE32,SIZE32,SIZE32 },
-    { "mulss","mulss",SIZE16,SIZE16,SIZE16 },
-    { "mwait","mwait",0,0,0 },
-    { "neg","neg",0,0,0 },
-    { "nop","nop",0,0,0 },
-    { "not","not",0,0,0 },
-    { "notb","not",SIZE08,SIZE08,SIZE08 },
-    { "notl","not",SIZE32,SIZE32,SIZE32 },
-    { "notq","not",SIZE64,SIZE64,SIZE64 },
-    { "notw","not",SIZE16,SIZE16,SIZE16 },
-    { "ntaken","ntaken",0,0,0 },
-    { "or","or",0,0,0 },
-    { "orb","or",SIZE08,SIZE08,SIZE08 },
-    { "orl","or",SIZE32,SIZE32,SIZE32 },
-    { "orpd","orpd",0,0,0 },
-    { "orps","orps",0,0,0 },
-    { "orq","or",SIZE64,SIZE64,SIZE64 },
-    { "orw","or",SIZE16,SIZE16,SIZE16 },
-    { "out","out",0,0,0 },
-    { "outs","outs",0,0,0 },
-    { "outsb","outsb",0,0,0 },
-    { "outsd","outsd",0,0,0 },
-    { "outsw","outsw",0,0,0 },
-    { "pabsb","pabsb",0,0,0 },
-    { "pabsd","pabsd",0,0,0 },
-    { "pabsw","pabsw",0,0,0 },
-    { "packssdw","packssdw",0,0,0 },
-    { "packsswb","packsswb",0,0,0 },
-    { "packusdw","packusdw",0,0,0 },
-    { "packuswb","packuswb",0,0,0 },
-    { "paddb","paddb",0,0,0 },
-    { "paddd","paddd",0,0,0 },
-    { "paddq","paddq",0,0,0 },
-    { "paddsb","paddsb",0,0,0 },
-    { "paddsw","paddsw",0,0,0 },
-    { "paddusb","paddusb",0,0,0 },
-    { "paddusw","paddusw",0,0,0 },
-    { "paddw","paddw",0,0,0 },
-    { "palignr","palignr",0,0,0 },
-    { "pand","pand",0,0,0 },
-    { "pandn","pandn",0,0,0 },
-    { "pause","pause",0,0,0 },
-    { "pavgb","pavgb",0,0,0 },
-    { "pavgw","pavgw",0,0,0 },
-    { "pblendvb","pblendvb",0,0,0 },
-    { "pblendw","pblendw",0,0,0 },
-    { "pcmpeqb","pcmpeqb",0,0,0 },
-    { "pcmpeqd","pcmpeqd",0,0,0 },
-    { "pcmpeqq","pcmpeqq",0,0,0 },
-    { "pcmpeqw","pcmpeqw",0,0,0 },
-    { "pcmpestri","pcmpestri",0,0,0 },
-    { "pcmpestrm","pcmpestrm",0,0,0 },
-    { "pcmpgtb","pcmpgtb",0,0,0 },
-    { "pcmpgtd","pcmpgtd",0,0,0 },
-    { "pcmpgtq","pcmpgtq",0,0,0 },
-    { "pcmpgtw","pcmpgtw",0,0,0 },
-    { "pcmpistri","pcmpistri",0,0,0 },
-    { "pcmpistrm","pcmpistrm",0,0,0 },
-    { "pextrb","pextrb",0,0,0 },
-    { "pextrd","pextrd",0,0,0 },
-    { "pextrq","pextrq",0,0,0 },
-    { "pextrw","pextrw",0,0,0 },
-    { "phaddd","phaddd",0,0,0 },
-    { "phaddsw","phaddsw",0,0,0 },
-    { "phaddw","phaddw",0,0,0 },
-    { "phminposuw","phminposuw",0,0,0 },
-    { "phsubd","phsubd",0,0,0 },
-    { "phsubsw","phsubsw",0,0,0 },
-    { "phsubw","phsubw",0,0,0 },
-    { "pinsrb","pinsrb",0,0,0 },
-    { "pinsrd","pinsrd",0,0,0 },
-    { "pinsrq","pinsrq",0,0,0 },
-    { "pinsrw","pinsrw",0,0,0 },
-    { "pmaddubsw","pmaddubsw",0,0,0 },
-    { "pmaddwd","pmaddwd",0,0,0 },
-    { "pmaxsb","pmaxsb",0,0,0 },
-    { "pmaxsd","pmaxsd",0,0,0 },
-    { "pmaxsw","pmaxsw",0,0,0 },
-    { "pmaxub","pmaxub",0,0,0 },
-    { "pmaxud","pmaxud",0,0,0 },
-    { "pmaxuw","pmaxuw",0,0,0 },
-    { "pminsb","pminsb",0,0,0 },
-    { "pminsd","pminsd",0,0,0 },
-    { "pminsw","pminsw",0,0,0 },
-    { "pminub","pminub",0,0,0 },
-    { "pminud","pminud",0,0,0 },
-    { "pminuw","pminuw",0,0,0 },
-    { "pmovmskb","pmovmskb",0,0,0 },
-    { "pmovsxbd","pmovsxbd",0,0,0 },
-    { "pmovsxbq","pmovsxbq",0,0,0 },
-    { "pmovsxbw","pmovsxbw",0,0,0 },
-    { "pmovsxdq","pmovsxdq",0,0,0 },
-    { "pmovsxwd","pmovsxwd",0,0,0 },
-    { "pmovsxwq","pmovsxwq",0,0,0 },
-    { "pmovzxbd","pmovzxbd",0,0,0 },
-    { "pmovzxbq","pmovzxbq",0,0,0 },
-    { "pmovzxbw","pmovzxbw",0,0,0 },
-    { "pmovzxdq","pmovzxdq",0,0,0 },
-    { "pmovzxwd","pmovzxwd",0,0,0 },
-    { "pmovzxwq","pmovzxwq",0,0,0 },
-    { "pmuldq","pmuldq",0,0,0 },
-    { "pmulhrsw","pmulhrsw",0,0,0 },
-    { "pmulhuw","pmulhuw",0,0,0 },
-    { "pmulhw","pmulhw",0,0,0 },
-    { "pmulld","pmulld",0,0,0 },
-    { "pmullw","pmullw",0,0,0 },
-    { "pmuludq","pmuludq",0,0,0 },
-    { "pop","pop",0,0,0 },
-    { "popa","popa",0,0,0 },
-    { "popad","popad",0,0,0 },
-    { "popcnt","popcnt",0,0,0 },
-    { "popf","popf",0,0,0 },
-    { "popfd","popfd",0,0,0 },
-    { "popfq","popfq",0,0,0 },
-    { "popq","pop",SIZE64,SIZE64,SIZE64 },
-    { "por","por",0,0,0 },
-    { "prefetchnta","prefetchnta",0,0,0 },
-    { "prefetcht0","prefetcht0",0,0,0 },
-    { "prefetcht1","prefetcht1",0,0,0 },
-    { "prefetcht2","prefetcht2",0,0,0 },
-    { "psadbw","psadbw",0,0,0 },
-    { "pshufb","pshufb",0,0,0 },
-    { "pshufd","pshufd",0,0,0 },
-    { "pshufhw","pshufhw",0,0,0 },
-    { "pshuflw","pshuflw",0,0,0 },
-    { "pshufw","pshufw",0,0,0 },
-    { "psignb","psignb",0,0,0 },
-    { "psignd","psignd",0,0,0 },
-    { "psignw","psignw",0,0,0 },
-    { "pslld","pslld",0,0,0 },
-    { "pslldq","pslldq",0,0,0 },
-    { "psllq","psllq",0,0,0 },
-    { "psllw","psllw",0,0,0 },
-    { "psrad","psrad",0,0,0 },
-    { "psraw","psraw",0,0,0 },
-    { "psrld","psrld",0,0,0 },
-    { "psrldq","psrldq",0,0,0 },
-    { "psrlq","psrlq",0,0,0 },
-    { "psrlw","psrlw",0,0,0 },
-    { "psubb","psubb",0,0,0 },
-    { "psubd","psubd",0,0,0 },
-    { "psubq","psubq",0,0,0 },
-    { "psubsb","psubsb",0,0,0 },
-    { "psubsw","psubsw",0,0,0 },
-    { "psubusb","psubusb",0,0,0 },
-    { "psubusw","psubusw",0,0,0 },
-    { "psubw","psubw",0,0,0 },
-    { "ptest","ptest",0,0,0 },
-    { "punpckhbw","punpckhbw",0,0,0 },
-    { "punpckhdq","punpckhdq",0,0,0 },
-    { "punpckhqdq","punpckhqdq",0,0,0 },
-    { "punpckhwd","punpckhwd",0,0,0 },
-    { "punpcklbw","punpcklbw",0,0,0 },
-    { "punpckldq","punpckldq",0,0,0 },
-    { "punpcklqdq","punpcklqdq",0,0,0 },
-    { "punpcklwd","punpcklwd",0,0,0 },
-    { "push","push",0,0,0 },
-    { "pusha","pusha",0,0,0 },
-    { "pushad","pushad",0,0,0 },
-    { "pushf","pushf",0,0,0 },
-    { "pushfd","pushfd",0,0,0 },
-    { "pushfq","pushfq",0,0,0 },
-    { "pushq","push",SIZE64,SIZE64,SIZE64 },
-    { "pxor","pxor",0,0,0 },
-    { "rcl","rcl",0,0,0 },
-    { "rcpps","rcpps",0,0,0 },
-    { "rcpss","rcpss",0,0,0 },
-    { "rcr","rcr",0,0,0 },
-    { "rdmsr","rdmsr",0,0,0 },
-    { "rdpmc","rdpmc",0,0,0 },
-    { "rdtsc","rdtsc",0,0,0 },
-    { "rdtscp","rdtscp",0,0,0 },
-    { "rep","rep",0,0,0 },
-    { "repe","repe",0,0,0 },
-    { "repne","repne",0,0,0 },
-    { "repnz","repnz",0,0,0 },
-    { "repz","repz",0,0,0 },
-    { "ret","retn",0,0,0 },
-    { "retf","retf",0,0,0 },
-    { "retn","retn",0,0,0 },
-    { "retq","retn",SIZE64,SIZE64,SIZE64 },
-    { "rex","rex",0,0,0 },
-    { "rex.b","rex.b",0,0,0 },
-    { "rex.r","rex.r",0,0,0 },
-    { "rex.rb","rex.rb",0,0,0 },
-    { "rex.rx","rex.rx",0,0,0 },
-    { "rex.rxb","rex.rxb",0,0,0 },
-    { "rex.w","rex.w",0,0,0 },
-    { "rex.wb","rex.wb",0,0,0 },
-    { "rex.wr","rex.wr",0,0,0 },
-    { "rex.wrb","rex.wrb",0,0,0 },
-    { "rex.wrx","rex.wrx",0,0,0 },
-    { "rex.wrxb","rex.wrxb",0,0,0 },
-    { "rex.wx","rex.wx",0,0,0 },
-    { "rex.wxb","rex.wxb",0,0,0 },
-    { "rex.x","rex.x",0,0,0 },
-    { "rex.xb","rex.xb",0,0,0 },
-    { "rol","rol",0,0,0 },
-    { "ror","ror",0,0,0 },
-    { "roundpd","roundpd",0,0,0 },
-    { "roundps","roundps",0,0,0 },
-    { "roundsd","roundsd",0,0,0 },
-    { "roundss","roundss",0,0,0 },
-    { "rsm","rsm",0,0,0 },
-    { "rsqrtps","rsqrtps",0,0,0 },
-    { "rsqrtss","rsqrtss",0,0,0 },
-    { "sahf","sahf",0,0,0 },
-    { "sal","sal",0,0,0 },
-    { "salc","salc",0,0,0 },
-    { "sar","sar",0,0,0 },
-    { "sarb","sar",SIZE08,SIZE08,SIZE08 },
-    { "sarl","sar",SIZE32,SIZE32,SIZE32 },
-    { "sarq","sar",SIZE64,SIZE64,SIZE64 },
-    { "sarw","sar",SIZE16,SIZE16,SIZE16 },
-    { "sbb","sbb",0,0,0 },
-    { "scas","scas",0,0,0 },
-    { "scasb","scasb",0,0,0 },
-    { "scasd","scasd",0,0,0 },
-    { "scasq","scasq",0,0,0 },
-    { "scasw","scasw",0,0,0 },
-    { "seta","seta",0,0,0 },
-    { "setae","setae",0,0,0 },
-    { "setalc","setalc",0,0,0 },
-    { "setb","setb",0,0,0 },
-    { "setbe","setbe",0,0,0 },
-    { "setc","setc",0,0,0 },
-    { "sete","sete",0,0,0 },
-    { "setg","setg",0,0,0 },
-    { "setge","setge",0,0,0 },
-    { "setl","setl",0,0,0 },
-    { "setle","setle",0,0,0 },
-    { "setna","setna",0,0,0 },
-    { "setnae","setnae",0,0,0 },
-    { "setnb","setnb",0,0,0 },
-    { "setnbe","setnbe",0,0,0 },
-    { "setnc","setnc",0,0,0 },
-    { "setne","setne",0,0,0 },
-    { "setng","setng",0,0,0 },
-    { "setnge","setnge",0,0,0 },
-    { "setnl","setnl",0,0,0 },
-    { "setnle","setnle",0,0,0 },
-    { "setno","setno",0,0,0 },
-    { "setnp","setnp",0,0,0 },
-    { "setns","setns",0,0,0 },
-    { "setnz","setnz",0,0,0 },
-    { "seto","seto",0,0,0 },
-    { "setp","setp",0,0,0 },
-    { "setpe","setpe",0,0,0 },
-    { "setpo","setpo",0,0,0 },
-    { "sets","sets",0,0,0 },
-    { "setz","setz",0,0,0 },
-    { "sfence","sfence",0,0,0 },
-    { "sgdt","sgdt",0,0,0 },
-    { "shl","shl",0,0,0 },
-    { "shlb","shl",SIZE08,SIZE08,SIZE08 },
-    { "shld","shld",0,0,0 },
-    { "shll","shl",SIZE32,SIZE32,SIZE32 },
-    { "shlq","shl",SIZE64,SIZE64,SIZE64 },
-    { "shlw","shl",SIZE16,SIZE16,SIZE16 },
-    { "shr","shr",0,0,0 },
-    { "shrb","shr",SIZE08,SIZE08,SIZE08 },
-    { "shrd","shrd",0,0,0 },
-    { "shrl","shr",SIZE32,SIZE32,SIZE32 },
-    { "shrq","shr",SIZE64,SIZE64,SIZE64 },
-    { "shrw","shr",SIZE16,SIZE16,SIZE16 },
-    { "shufpd","shufpd",0,0,0 },
-    { "shufps","shufps",0,0,0 },
-    { "sidt","sidt",0,0,0 },
-    { "sldt","sldt",0,0,0 },
-    { "smsw","smsw",0,0,0 },
-    { "sqrtpd","sqrtpd",0,0,0 },
-    { "sqrtps","sqrtps",0,0,0 },
-    { "sqrtsd","sqrtsd",0,0,0 },
-    { "sqrtss","sqrtss",0,0,0 },
-    { "ss","ss",0,0,0 },
-    { "stc","stc",0,0,0 },
-    { "std","std",0,0,0 },
-    { "sti","sti",0,0,0 },
-    { "stmxcsr","stmxcsr",0,0,0 },
-    { "stos","stos",0,0,0 },
-    { "stosb","stosb",0,0,0 },
-    { "stosd","stosd",0,0,0 },
-    { "stosq","stosq",0,0,0 },
-    { "stosw","stosw",0,0,0 },
-    { "str","str",0,0,0 },
-    { "sub","sub",0,0,0 },
-    { "subb","sub",SIZE08,SIZE08,SIZE08 },
-    { "subl","sub",SIZE32,SIZE32,SIZE32 },
-    { "subpd","subpd",0,0,0 },
-    { "subps","subps",0,0,0 },
-    { "subq","sub",SIZE64,SIZE64,SIZE64 },
-    { "subsd","subsd",SIZE32,SIZE32,SIZE32 },
-    { "subss","subss",SIZE16,SIZE16,SIZE16 },
-    { "subw","sub",SIZE16,SIZE16,SIZE16 },
-    { "swapgs","swapgs",0,0,0 },
-    { "syscall","syscall",0,0,0 },
-    { "sysenter","sysenter",0,0,0 },
-    { "sysexit","sysexit",0,0,0 },
-    { "sysret","sysret",0,0,0 },
-    { "taken","taken",0,0,0 },
-    { "test","test",0,0,0 },
-    { "testb","test",SIZE08,SIZE08,SIZE08 },
-    { "testl","test",SIZE32,SIZE32,SIZE32 },
-    { "testq","test",SIZE64,SIZE64,SIZE64 },
-    { "testw","test",SIZE16,SIZE16,SIZE16 },
-    { "ucomisd","ucomisd",SIZE32,SIZE32,SIZE32 },
-    { "ucomiss","ucomiss",SIZE16,SIZE16,SIZE16 },
-    { "ud","ud",0,0,0 },
-    { "ud2","ud2",0,0,0 },
-    { "unpckhpd","unpckhpd",0,0,0 },
-    { "unpckhps","unpckhps",0,0,0 },
-    { "unpcklpd","unpcklpd",0,0,0 },
-    { "unpcklps","unpcklps",0,0,0 },
-    { "verr","verr",0,0,0 },
-    { "verw","verw",0,0,0 },
-    { "vmcall","vmcall",0,0,0 },
-    { "vmclear","vmclear",0,0,0 },
-    { "vmlaunch","vmlaunch",0,0,0 },
-    { "vmptrld","vmptrld",0,0,0 },
-    { "vmptrst","vmptrst",0,0,0 },
-    { "vmread","vmread",0,0,0 },
-    { "vmresume","vmresume",0,0,0 },
-    { "vmwrite","vmwrite",0,0,0 },
-    { "vmxoff","vmxoff",0,0,0 },
-    { "vmxon","vmxon",0,0,0 },
-    { "wait","wait",0,0,0 },
-    { "wbinvd","wbinvd",0,0,0 },
-    { "wrmsr","wrmsr",0,0,0 },
-    { "xadd","xadd",0,0,0 },
-    { "xchg","xchg",0,0,0 },
-    { "xgetbv","xgetbv",0,0,0 },
-    { "xlat","xlat",0,0,0 },
-    { "xlatb","xlatb",0,0,0 },
-    { "xor","xor",0,0,0 },
-    { "xorb","xor",SIZE08,SIZE08,SIZE08 },
-    { "xorl","xor",SIZE32,SIZE32,SIZE32 },
-    { "xorpd","xorpd",0,0,0 },
-    { "xorps","xorps",0,0,0 },
-    { "xorq","xor",SIZE64,SIZE64,SIZE64 },
-    { "xorw","xor",SIZE16,SIZE16,SIZE16 },
-    { "xrstor","xrstor",0,0,0 },
-    { "xsave","xsave",0,0,0 },
-    { "xsetbv","xsetbv",0,0,0 },
+    { "aaa","aaa",0,0,0,0,0 },
+    { "aad","aad",0,0,0,0,0 },
+    { "aam","aam",0,0,0,0,0 },
+    { "aas","aas",0,0,0,0,0 },
+    { "adc","adc",0,0,0,0,9 },
+    { "add","add",0,0,0,9,9 },
+    { "addb","add",SIZE08,SIZE08,SIZE08,9,9 },
+    { "addl","add",SIZE32,SIZE32,SIZE32,9,9 },
+    { "addpd","addpd",0,0,0,18,0 },
+    { "addps","addps",0,0,0,18,0 },
+    { "addq","add",SIZE64,SIZE64,SIZE64,9,9 },
+    { "addsd","addsd",SIZE32,SIZE32,SIZE32,18,1 },
+    { "addss","addss",SIZE16,SIZE16,SIZE16,19,1 },
+    { "addsubpd","addsubpd",0,0,0,20,0 },
+    { "addsubps","addsubps",0,0,0,20,0 },
+    { "addw","add",SIZE16,SIZE16,SIZE16,9,9 },
+    { "adx","adx",0,0,0,20,0 },
+    { "alter","alter",0,0,0,20,1 },
+    { "amx","amx",0,0,0,21,0 },
+    { "and","and",0,0,0,21,9 },
+    { "andb","and",SIZE08,SIZE08,SIZE08,21,9 },
+    { "andl","and",SIZE32,SIZE32,SIZE32,21,9 },
+    { "andnpd","andnpd",0,0,0,30,0 },
+    { "andnps","andnps",0,0,0,30,0 },
+    { "andpd","andpd",0,0,0,30,0 },
+    { "andps","andps",0,0,0,30,0 },
+    { "andq","and",SIZE64,SIZE64,SIZE64,21,9 },
+    { "andw","and",SIZE16,SIZE16,SIZE16,21,9 },
+    { "arpl","arpl",0,0,0,30,1 },
+    { "blendpd","blendpd",0,0,0,31,0 },
+    { "blendps","blendps",0,0,0,31,0 },
+    { "blendvpd","blendvpd",0,0,0,31,0 },
+    { "blendvps","blendvps",0,0,0,31,0 },
+    { "bound","bound",0,0,0,31,0 },
+    { "bsf","bsf",0,0,0,31,1 },
+    { "bsr","bsr",0,0,0,32,1 },
+    { "bswap","bswap",0,0,0,33,1 },
+    { "bt","bt",0,0,0,34,2 },
+    { "btc","btc",0,0,0,36,2 },
+    { "btr","btr",0,0,0,38,2 },
+    { "bts","bts",0,0,0,40,2 },
+    { "call","call",0,0,0,42,3 },
+    { "callf","callf",0,0,0,45,0 },
+    { "callq","call",0,0,0,42,3 },
+    { "cbw","cbw",0,0,0,45,2 },
+    { "cdq","cdq",0,0,0,47,2 },
+    { "cdqe","cdqe",0,0,0,49,1 },
+    { "clc","clc",0,0,0,50,1 },
+    { "cld","cld",0,0,0,51,1 },
+    { "clflush","clflush",0,0,0,52,1 },
+    { "cli","cli",0,0,0,53,1 },
+    { "cltd","cdq",SIZE32,SIZE32,0,47,2 },
+    { "clts","clts",0,0,0,54,1 },
+    { "cmc","cmc",0,0,0,55,1 },
+    { "cmova","cmova",0,0,0,56,1 },
+    { "cmovae","cmovae",0,0,0,57,1 },
+    { "cmovael","cmovae",SIZE32,SIZE32,SIZE32,57,1 },
+    { "cmovaeq","cmovae",SIZE64,SIZE64,SIZE64,57,1 },
+    { "cmovaew","cmovae",SIZE16,SIZE16,SIZE16,57,1 },
+    { "cmoval","cmova",SIZE32,SIZE32,SIZE32,56,1 },
+    { "cmovaq","cmova",SIZE64,SIZE64,SIZE64,56,1 },
+    { "cmovaw","cmova",SIZE16,SIZE16,SIZE16,56,1 },
+    { "cmovb","cmovb",0,0,0,58,1 },
+    { "cmovbe","cmovbe",0,0,0,59,1 },
+    { "cmovbel","cmovbe",SIZE32,SIZE32,SIZE32,59,1 },
+    { "cmovbeq","cmovbe",SIZE64,SIZE64,SIZE64,59,1 },
+    { "cmovbew","cmovbe",SIZE16,SIZE16,SIZE16,59,1 },
+    { "cmovbl","cmovb",SIZE32,SIZE32,SIZE32,58,1 },
+    { "cmovbq","cmovb",SIZE64,SIZE64,SIZE64,58,1 },
+    { "cmovbw","cmovb",SIZE16,SIZE16,SIZE16,58,1 },
+    { "cmovc","cmovc",0,0,0,60,1 },
+    { "cmovcl","cmovc",SIZE32,SIZE32,SIZE32,60,1 },
+    { "cmovcq","cmovc",SIZE64,SIZE64,SIZE64,60,1 },
+    { "cmovcw","cmovc",SIZE16,SIZE16,SIZE16,60,1 },
+    { "cmove","cmove",0,0,0,61,1 },
+    { "cmovel","cmove",SIZE32,SIZE32,SIZE32,61,1 },
+    { "cmoveq","cmove",SIZE64,SIZE64,SIZE64,61,1 },
+    { "cmovew","cmove",SIZE16,SIZE16,SIZE16,61,1 },
+    { "cmovg","cmovg",0,0,0,62,1 },
+    { "cmovge","cmovge",0,0,0,63,1 },
+    { "cmovgel","cmovge",SIZE32,SIZE32,SIZE32,63,1 },
+    { "cmovgeq","cmovge",SIZE64,SIZE64,SIZE64,63,1 },
+    { "cmovgew","cmovge",SIZE16,SIZE16,SIZE16,63,1 },
+    { "cmovgl","cmovg",SIZE32,SIZE32,SIZE32,62,1 },
+    { "cmovgq","cmovg",SIZE64,SIZE64,SIZE64,62,1 },
+    { "cmovgw","cmovg",SIZE16,SIZE16,SIZE16,62,1 },
+    { "cmovl","cmovl",0,0,0,64,1 },
+    { "cmovle","cmovle",0,0,0,65,1 },
+    { "cmovlel","cmovle",SIZE32,SIZE32,SIZE32,65,1 },
+    { "cmovleq","cmovle",SIZE64,SIZE64,SIZE64,65,1 },
+    { "cmovlew","cmovle",SIZE16,SIZE16,SIZE16,65,1 },
+    { "cmovll","cmovl",SIZE32,SIZE32,SIZE32,64,1 },
+    { "cmovlq","cmovl",SIZE64,SIZE64,SIZE64,64,1 },
+    { "cmovlw","cmovl",SIZE16,SIZE16,SIZE16,64,1 },
+    { "cmovna","cmovna",0,0,0,66,1 },
+    { "cmovnae","cmovnae",0,0,0,67,1 },
+    { "cmovnael","cmovnae",SIZE32,SIZE32,SIZE32,67,1 },
+    { "cmovnaeq","cmovnae",SIZE64,SIZE64,SIZE64,67,1 },
+    { "cmovnaew","cmovnae",SIZE16,SIZE16,SIZE16,67,1 },
+    { "cmovnal","cmovna",SIZE32,SIZE32,SIZE32,66,1 },
+    { "cmovnaq","cmovna",SIZE64,SIZE64,SIZE64,66,1 },
+    { "cmovnaw","cmovna",SIZE16,SIZE16,SIZE16,66,1 },
+    { "cmovnb","cmovnb",0,0,0,68,1 },
+    { "cmovnbe","cmovnbe",0,0,0,69,1 },
+    { "cmovnbel","cmovnbe",SIZE32,SIZE32,SIZE32,69,1 },
+    { "cmovnbeq","cmovnbe",SIZE64,SIZE64,SIZE64,69,1 },
+    { "cmovnbew","cmovnbe",SIZE16,SIZE16,SIZE16,69,1 },
+    { "cmovnbl","cmovnb",SIZE32,SIZE32,SIZE32,68,1 },
+    { "cmovnbq","cmovnb",SIZE64,SIZE64,SIZE64,68,1 },
+    { "cmovnbw","cmovnb",SIZE16,SIZE16,SIZE16,68,1 },
+    { "cmovnc","cmovnc",0,0,0,70,1 },
+    { "cmovncl","cmovnc",SIZE32,SIZE32,SIZE32,70,1 },
+    { "cmovncq","cmovnc",SIZE64,SIZE64,SIZE64,70,1 },
+    { "cmovncw","cmovnc",SIZE16,SIZE16,SIZE16,70,1 },
+    { "cmovne","cmovne",0,0,0,71,1 },
+    { "cmovnel","cmovne",SIZE32,SIZE32,SIZE32,71,1 },
+    { "cmovneq","cmovne",SIZE64,SIZE64,SIZE64,71,1 },
+    { "cmovnew","cmovne",SIZE16,SIZE16,SIZE16,71,1 },
+    { "cmovng","cmovng",0,0,0,72,1 },
+    { "cmovnge","cmovnge",0,0,0,73,1 },
+    { "cmovngel","cmovnge",SIZE32,SIZE32,SIZE32,73,1 },
+    { "cmovngeq","cmovnge",SIZE64,SIZE64,SIZE64,73,1 },
+    { "cmovngew","cmovnge",SIZE16,SIZE16,SIZE16,73,1 },
+    { "cmovngl","cmovng",SIZE32,SIZE32,SIZE32,72,1 },
+    { "cmovngq","cmovng",SIZE64,SIZE64,SIZE64,72,1 },
+    { "cmovngw","cmovng",SIZE16,SIZE16,SIZE16,72,1 },
+    { "cmovnl","cmovnl",0,0,0,74,1 },
+    { "cmovnle","cmovnle",0,0,0,75,1 },
+    { "cmovnlel","cmovnle",SIZE32,SIZE32,SIZE32,75,1 },
+    { "cmovnleq","cmovnle",SIZE64,SIZE64,SIZE64,75,1 },
+    { "cmovnlew","cmovnle",SIZE16,SIZE16,SIZE16,75,1 },
+    { "cmovnll","cmovnl",SIZE32,SIZE32,SIZE32,74,1 },
+    { "cmovnlq","cmovnl",SIZE64,SIZE64,SIZE64,74,1 },
+    { "cmovnlw","cmovnl",SIZE16,SIZE16,SIZE16,74,1 },
+    { "cmovno","cmovno",0,0,0,76,1 },
+    { "cmovnol","cmovno",SIZE32,SIZE32,SIZE32,76,1 },
+    { "cmovnoq","cmovno",SIZE64,SIZE64,SIZE64,76,1 },
+    { "cmovnow","cmovno",SIZE16,SIZE16,SIZE16,76,1 },
+    { "cmovnp","cmovnp",0,0,0,77,1 },
+    { "cmovnpl","cmovnp",SIZE32,SIZE32,SIZE32,77,1 },
+    { "cmovnpq","cmovnp",SIZE64,SIZE64,SIZE64,77,1 },
+    { "cmovnpw","cmovnp",SIZE16,SIZE16,SIZE16,77,1 },
+    { "cmovns","cmovns",0,0,0,78,1 },
+    { "cmovnsl","cmovns",SIZE32,SIZE32,SIZE32,78,1 },
+    { "cmovnsq","cmovns",SIZE64,SIZE64,SIZE64,78,1 },
+    { "cmovnsw","cmovns",SIZE16,SIZE16,SIZE16,78,1 },
+    { "cmovnz","cmovnz",0,0,0,79,1 },
+    { "cmovnzl","cmovnz",SIZE32,SIZE32,SIZE32,79,1 },
+    { "cmovnzq","cmovnz",SIZE64,SIZE64,SIZE64,79,1 },
+    { "cmovnzw","cmovnz",SIZE16,SIZE16,SIZE16,79,1 },
+    { "cmovo","cmovo",0,0,0,80,1 },
+    { "cmovol","cmovo",SIZE32,SIZE32,SIZE32,80,1 },
+    { "cmovoq","cmovo",SIZE64,SIZE64,SIZE64,80,1 },
+    { "cmovow","cmovo",SIZE16,SIZE16,SIZE16,80,1 },
+    { "cmovp","cmovp",0,0,0,81,1 },
+    { "cmovpe","cmovpe",0,0,0,82,1 },
+    { "cmovpel","cmovpe",SIZE32,SIZE32,SIZE32,82,1 },
+    { "cmovpeq","cmovpe",SIZE64,SIZE64,SIZE64,82,1 },
+    { "cmovpew","cmovpe",SIZE16,SIZE16,SIZE16,82,1 },
+    { "cmovpl","cmovp",SIZE32,SIZE32,SIZE32,81,1 },
+    { "cmovpo","cmovpo",0,0,0,83,1 },
+    { "cmovpol","cmovpo",SIZE32,SIZE32,SIZE32,83,1 },
+    { "cmovpoq","cmovpo",SIZE64,SIZE64,SIZE64,83,1 },
+    { "cmovpow","cmovpo",SIZE16,SIZE16,SIZE16,83,1 },
+    { "cmovpq","cmovp",SIZE64,SIZE64,SIZE64,81,1 },
+    { "cmovpw","cmovp",SIZE16,SIZE16,SIZE16,81,1 },
+    { "cmovs","cmovs",0,0,0,84,1 },
+    { "cmovsl","cmovs",SIZE32,SIZE32,SIZE32,84,1 },
+    { "cmovsq","cmovs",SIZE64,SIZE64,SIZE64,84,1 },
+    { "cmovsw","cmovs",SIZE16,SIZE16,SIZE16,84,1 },
+    { "cmovz","cmovz",0,0,0,85,1 },
+    { "cmovzl","cmovz",SIZE32,SIZE32,SIZE32,85,1 },
+    { "cmovzq","cmovz",SIZE64,SIZE64,SIZE64,85,1 },
+    { "cmovzw","cmovz",SIZE16,SIZE16,SIZE16,85,1 },
+    { "cmp","cmp",0,0,0,86,9 },
+    { "cmpb","cmp",SIZE08,SIZE08,SIZE08,86,9 },
+    { "cmpl","cmp",SIZE32,SIZE32,SIZE32,86,9 },
+    { "cmppd","cmppd",0,0,0,95,0 },
+    { "cmpps","cmpps",0,0,0,95,0 },
+    { "cmpq","cmp",SIZE64,SIZE64,SIZE64,86,9 },
+    { "cmps","cmps",0,0,0,95,3 },
+    { "cmpsb","cmpsb",0,0,0,98,1 },
+    { "cmpsd","cmpsd",0,0,0,99,3 },
+    { "cmpsq","cmpsq",0,0,0,102,1 },
+    { "cmpss","cmpss",0,0,0,103,1 },
+    { "cmpsw","cmpsw",0,0,0,104,2 },
+    { "cmpw","cmp",SIZE16,SIZE16,SIZE16,86,9 },
+    { "cmpxchg","cmpxchg",0,0,0,106,2 },
+    { "cmpxchg16b","cmpxchg16b",0,0,0,108,1 },
+    { "cmpxchg8b","cmpxchg8b",0,0,0,109,2 },
+    { "comisd","comisd",SIZE32,SIZE32,SIZE32,111,1 },
+    { "comiss","comiss",SIZE16,SIZE16,SIZE16,112,1 },
+    { "cpuid","cpuid",0,0,0,113,1 },
+    { "cqo","cqo",0,0,0,114,1 },
+    { "cqto","cqo",SIZE64,SIZE64,0,114,1 },
+    { "crc32","crc32",0,0,0,115,2 },
+    { "cs","cs",0,0,0,117,1 },
+    { "cvtdq2pd","cvtdq2pd",0,0,0,118,0 },
+    { "cvtdq2ps","cvtdq2ps",0,0,0,118,0 },
+    { "cvtpd2dq","cvtpd2dq",0,0,0,118,0 },
+    { "cvtpd2pi","cvtpd2pi",0,0,0,118,0 },
+    { "cvtpd2ps","cvtpd2ps",0,0,0,118,0 },
+    { "cvtpi2pd","cvtpi2pd",0,0,0,118,0 },
+    { "cvtpi2ps","cvtpi2ps",0,0,0,118,0 },
+    { "cvtps2dq","cvtps2dq",0,0,0,118,0 },
+    { "cvtps2pd","cvtps2pd",0,0,0,118,0 },
+    { "cvtps2pi","cvtps2pi",0,0,0,118,0 },
+    { "cvtsd2si","cvtsd2si",0,0,0,118,1 },
+    { "cvtsd2ss","cvtsd2ss",SIZE32,SIZE16,0,119,1 },
+    { "cvtsi2sd","cvtsi2sd",0,0,0,120,1 },
+    { "cvtsi2sdl","cvtsi2sd",SIZE32,SIZE32,0,120,1 },
+    { "cvtsi2sdq","cvtsi2sd",SIZE64,SIZE32,0,120,1 },
+    { "cvtsi2ss","cvtsi2ss",0,0,0,121,1 },
+    { "cvtsi2ssl","cvtsi2ss",SIZE32,SIZE16,0,121,1 },
+    { "cvtsi2ssq","cvtsi2ss",SIZE32,SIZE32,0,121,1 },
+    { "cvtss2sd","cvtss2sd",0,0,0,122,1 },
+    { "cvtss2si","cvtss2si",0,0,0,123,1 },
+    { "cvttpd2dq","cvttpd2dq",0,0,0,124,0 },
+    { "cvttpd2pi","cvttpd2pi",0,0,0,124,0 },
+    { "cvttps2dq","cvttps2dq",0,0,0,124,0 },
+    { "cvttps2pi","cvttps2pi",0,0,0,124,0 },
+    { "cvttsd2si","cvttsd2si",0,0,0,124,1 },
+    { "cvttsd2sil","cvttsd2si",SIZE32,SIZE32,SIZE32,124,1 },
+    { "cvttsd2siq","cvttsd2si",SIZE64,SIZE64,SIZE64,124,1 },
+    { "cvttss2si","cvttss2si",0,0,0,125,1 },
+    { "cvttss2sil","cvttss2si",SIZE32,SIZE32,SIZE32,125,1 },
+    { "cvttss2siq","cvttss2si",SIZE64,SIZE64,SIZE64,125,1 },
+    { "cwd","cwd",0,0,0,126,2 },
+    { "cwde","cwde",0,0,0,128,2 },
+    { "cwtd","cwd",SIZE16,SIZE32,0,126,2 },
+    { "daa","daa",0,0,0,130,0 },
+    { "das","das",0,0,0,130,0 },
+    { "dec","dec",0,0,0,130,3 },
+    { "div","div",0,0,0,133,2 },
+    { "divl","div",SIZE32,SIZE32,SIZE32,133,2 },
+    { "divpd","divpd",0,0,0,135,0 },
+    { "divps","divps",0,0,0,135,0 },
+    { "divq","div",SIZE64,SIZE64,SIZE64,133,2 },
+    { "divsd","divsd",SIZE32,SIZE32,SIZE32,135,1 },
+    { "divss","divss",SIZE16,SIZE16,SIZE16,136,1 },
+    { "dppd","dppd",0,0,0,137,0 },
+    { "dpps","dpps",0,0,0,137,0 },
+    { "ds","ds",0,0,0,137,1 },
+    { "emms","emms",0,0,0,138,1 },
+    { "enter","enter",0,0,0,139,2 },
+    { "es","es",0,0,0,141,1 },
+    { "extractps","extractps",0,0,0,142,1 },
+    { "f2xm1","f2xm1",0,0,0,143,1 },
+    { "fabs","fabs",0,0,0,144,1 },
+    { "fadd","fadd",0,0,0,145,4 },
+    { "faddp","faddp",0,0,0,149,2 },
+    { "fadds","fadd",SIZE32,SIZE32,SIZE32,145,4 },
+    { "fbld","fbld",0,0,0,151,0 },
+    { "fbstp","fbstp",0,0,0,151,0 },
+    { "fchs","fchs",0,0,0,151,1 },
+    { "fclex","fclex",0,0,0,152,1 },
+    { "fcmovb","fcmovb",0,0,0,153,1 },
+    { "fcmovbe","fcmovbe",0,0,0,154,1 },
+    { "fcmove","fcmove",0,0,0,155,1 },
+    { "fcmovnb","fcmovnb",0,0,0,156,1 },
+    { "fcmovnbe","fcmovnbe",0,0,0,157,1 },
+    { "fcmovne","fcmovne",0,0,0,158,1 },
+    { "fcmovnu","fcmovnu",0,0,0,159,1 },
+    { "fcmovu","fcmovu",0,0,0,160,1 },
+    { "fcom","fcom",0,0,0,161,3 },
+    { "fcom2","fcom2",0,0,0,164,2 },
+    { "fcomi","fcomi",0,0,0,166,1 },
+    { "fcomip","fcomip",0,0,0,167,1 },
+    { "fcomp","fcomp",0,0,0,168,3 },
+    { "fcomp3","fcomp3",0,0,0,171,2 },
+    { "fcomp5","fcomp5",0,0,0,173,2 },
+    { "fcompp","fcompp",0,0,0,175,1 },
+    { "fcos","fcos",0,0,0,176,1 },
+    { "fdecstp","fdecstp",0,0,0,177,1 },
+    { "fdisi","fdisi",0,0,0,178,1 },
+    { "fdiv","fdiv",0,0,0,179,4 },
+    { "fdivp","fdivp",0,0,0,183,2 },
+    { "fdivr","fdivr",0,0,0,185,4 },
+    { "fdivrp","fdivrp",0,0,0,189,2 },
+    { "feni","feni",0,0,0,191,1 },
+    { "ffree","ffree",0,0,0,192,1 },
+    { "ffreep","ffreep",0,0,0,193,1 },
+    { "fiadd","fiadd",0,0,0,194,2 },
+    { "ficom","ficom",0,0,0,196,2 },
+    { "ficomp","ficomp",0,0,0,198,2 },
+    { "fidiv","fidiv",0,0,0,200,2 },
+    { "fidivr","fidivr",0,0,0,202,2 },
+    { "fild","fild",SIZE16,SIZE16,SIZE16,204,3 },
+    { "fildl","fild",SIZE32,SIZE32,SIZE32,204,3 },
+    { "fildll","fild",SIZE64,SIZE64,SIZE64,204,3 },
+    { "fildq","fild",SIZE64,SIZE64,SIZE64,204,3 },
+    { "filds","fild",SIZE16,SIZE16,SIZE16,204,3 },
+    { "fimul","fimul",0,0,0,207,2 },
+    { "fincstp","fincstp",0,0,0,209,1 },
+    { "finit","finit",0,0,0,210,1 },
+    { "fist","fist",0,0,0,211,2 },
+    { "fistp","fistp",SIZE16,SIZE16,SIZE16,213,3 },
+    { "fistpl","fistp",SIZE32,SIZE32,SIZE32,213,3 },
+    { "fistpll","fistp",SIZE64,SIZE64,SIZE64,213,3 },
+    { "fistpq","fistp",SIZE64,SIZE64,SIZE64,213,3 },
+    { "fistps","fistp",SIZE16,SIZE16,SIZE16,213,3 },
+    { "fisttp","fisttp",0,0,0,216,3 },
+    { "fisub","fisub",0,0,0,219,2 },
+    { "fisubr","fisubr",0,0,0,221,2 },
+    { "fld","fld",SIZE32,SIZE32,SIZE32,223,3 },
+    { "fld1","fld1",0,0,0,226,1 },
+    { "fldcw","fldcw",0,0,0,227,1 },
+    { "fldenv","fldenv",0,0,0,228,0 },
+    { "fldl","fld",SIZE64,SIZE64,SIZE64,223,3 },
+    { "fldl2e","fldl2e",0,0,0,228,1 },
+    { "fldl2t","fldl2t",0,0,0,229,1 },
+    { "fldlg2","fldlg2",0,0,0,230,1 },
+    { "fldln2","fldln2",0,0,0,231,1 },
+    { "fldpi","fldpi",0,0,0,232,1 },
+    { "flds","fld",SIZE32,SIZE32,SIZE32,223,3 },
+    { "fldt","fld",SIZEST,SIZEST,SIZEST,223,3 },
+    { "fldz","fldz",0,0,0,233,1 },
+    { "fmul","fmul",0,0,0,234,4 },
+    { "fmulp","fmulp",0,0,0,238,2 },
+    { "fnclex","fnclex",0,0,0,240,1 },
+    { "fndisi","fndisi",0,0,0,241,2 },
+    { "fneni","fneni",0,0,0,243,2 },
+    { "fninit","fninit",0,0,0,245,1 },
+    { "fnop","fnop",0,0,0,246,1 },
+    { "fnsave","fnsave",0,0,0,247,0 },
+    { "fnsetpm","fnsetpm",0,0,0,247,2 },
+    { "fnstcw","fnstcw",0,0,0,249,1 },
+    { "fnstenv","fnstenv",0,0,0,250,0 },
+    { "fnstsw","fnstsw",0,0,0,250,2 },
+    { "fpatan","fpatan",0,0,0,252,1 },
+    { "fprem","fprem",0,0,0,253,1 },
+    { "fprem1","fprem1",0,0,0,254,1 },
+    { "fptan","fptan",0,0,0,255,1 },
+    { "frndint","frndint",0,0,0,256,1 },
+    { "frstor","frstor",0,0,0,257,0 },
+    { "fs","fs",0,0,0,257,1 },
+    { "fsave","fsave",0,0,0,258,0 },
+    { "fscale","fscale",0,0,0,258,1 },
+    { "fsetpm","fsetpm",0,0,0,259,1 },
+    { "fsin","fsin",0,0,0,260,1 },
+    { "fsincos","fsincos",0,0,0,261,1 },
+    { "fsqrt","fsqrt",0,0,0,262,1 },
+    { "fst","fst",0,0,0,263,3 },
+    { "fstcw","fstcw",0,0,0,266,1 },
+    { "fstenv","fstenv",0,0,0,267,0 },
+    { "fstp","fstp",0,0,0,267,4 },
+    { "fstp1","fstp1",0,0,0,271,2 },
+    { "fstp8","fstp8",0,0,0,273,2 },
+    { "fstp9","fstp9",0,0,0,275,2 },
+    { "fstpl","fstp",SIZE64,SIZE64,SIZE64,267,4 },
+    { "fstps","fstp",SIZE32,SIZE32,SIZE32,267,4 },
+    { "fstpt","fstp",SIZEST,SIZEST,SIZEST,267,4 },
+    { "fstsw","fstsw",0,0,0,277,2 },
+    { "fsub","fsub",0,0,0,279,4 },
+    { "fsubp","fsubp",0,0,0,283,2 },
+    { "fsubr","fsubr",0,0,0,285,4 },
+    { "fsubrp","fsubrp",0,0,0,289,2 },
+    { "ftst","ftst",0,0,0,291,1 },
+    { "fucom","fucom",0,0,0,292,2 },
+    { "fucomi","fucomi",0,0,0,294,1 },
+    { "fucomip","fucomip",0,0,0,295,1 },
+    { "fucomp","fucomp",0,0,0,296,2 },
+    { "fucompp","fucompp",0,0,0,298,1 },
+    { "fwait","fwait",0,0,0,299,1 },
+    { "fxam","fxam",0,0,0,300,1 },
+    { "fxch","fxch",0,0,0,301,2 },
+    { "fxch4","fxch4",0,0,0,303,2 },
+    { "fxch7","fxch7",0,0,0,305,2 },
+    { "fxrstor","fxrstor",0,0,0,307,0 },
+    { "fxsave","fxsave",0,0,0,307,0 },
+    { "fxtract","fxtract",0,0,0,307,1 },
+    { "fyl2x","fyl2x",0,0,0,308,1 },
+    { "fyl2xp1","fyl2xp1",0,0,0,309,1 },
+    { "getsec","getsec",0,0,0,310,1 },
+    { "gs","gs",0,0,0,311,1 },
+    { "haddpd","haddpd",0,0,0,312,0 },
+    { "haddps","haddps",0,0,0,312,0 },
+    { "hint_nop","hint_nop",0,0,0,312,19 },
+    { "hlt","hlt",0,0,0,331,1 },
+    { "hsubpd","hsubpd",0,0,0,332,0 },
+    { "hsubps","hsubps",0,0,0,332,0 },
+    { "icebp","icebp",0,0,0,332,1 },
+    { "idiv","idiv",0,0,0,333,2 },
+    { "idivl","idiv",SIZE32,SIZE32,SIZE32,333,2 },
+    { "idivq","idiv",SIZE64,SIZE64,SIZE64,333,2 },
+    { "imul","imul",0,0,0,335,5 },
+    { "imulb","imul",SIZE08,SIZE08,SIZE08,335,5 },
+    { "imull","imul",SIZE32,SIZE32,SIZE32,335,5 },
+    { "imulq","imul",SIZE64,SIZE64,SIZE64,335,5 },
+    { "imulw","imul",SIZE16,SIZE16,SIZE16,335,5 },
+    { "in","in",0,0,0,340,4 },
+    { "inc","inc",0,0,0,344,3 },
+    { "ins","ins",0,0,0,347,2 },
+    { "insb","insb",0,0,0,349,1 },
+    { "insd","insd",0,0,0,350,1 },
+    { "insertps","insertps",0,0,0,351,0 },
+    { "insw","insw",0,0,0,351,1 },
+    { "int","int",0,0,0,352,2 },
+    { "int1","int1",0,0,0,354,1 },
+    { "into","into",0,0,0,355,1 },
+    { "invd","invd",0,0,0,356,1 },
+    { "invept","invept",0,0,0,357,2 },
+    { "invlpg","invlpg",0,0,0,359,1 },
+    { "invvpid","invvpid",0,0,0,360,2 },
+    { "iret","iret",0,0,0,362,2 },
+    { "iretd","iretd",0,0,0,364,2 },
+    { "iretq","iretq",0,0,0,366,1 },
+    { "ja","ja",0,0,0,367,2 },
+    { "jae","jae",0,0,0,369,2 },
+    { "jb","jb",0,0,0,371,2 },
+    { "jbe","jbe",0,0,0,373,2 },
+    { "jc","jc",0,0,0,375,2 },
+    { "jcxz","jcxz",0,0,0,377,1 },
+    { "je","je",0,0,0,378,2 },
+    { "jecxz","jecxz",0,0,0,380,2 },
+    { "jg","jg",0,0,0,382,2 },
+    { "jge","jge",0,0,0,384,2 },
+    { "jl","jl",0,0,0,386,2 },
+    { "jle","jle",0,0,0,388,2 },
+    { "jmp","jmp",0,0,0,390,4 },
+    { "jmpe","jmpe",0,0,0,394,2 },
+    { "jmpf","jmpf",0,0,0,396,0 },
+    { "jna","jna",0,0,0,396,2 },
+    { "jnae","jnae",0,0,0,398,2 },
+    { "jnb","jnb",0,0,0,400,2 },
+    { "jnbe","jnbe",0,0,0,402,2 },
+    { "jnc","jnc",0,0,0,404,2 },
+    { "jne","jne",0,0,0,406,2 },
+    { "jng","jng",0,0,0,408,2 },
+    { "jnge","jnge",0,0,0,410,2 },
+    { "jnl","jnl",0,0,0,412,2 },
+    { "jnle","jnle",0,0,0,414,2 },
+    { "jno","jno",0,0,0,416,2 },
+    { "jnp","jnp",0,0,0,418,2 },
+    { "jns","jns",0,0,0,420,2 },
+    { "jnz","jnz",0,0,0,422,2 },
+    { "jo","jo",0,0,0,424,2 },
+    { "jp","jp",0,0,0,426,2 },
+    { "jpe","jpe",0,0,0,428,2 },
+    { "jpo","jpo",0,0,0,430,2 },
+    { "jrcxz","jrcxz",0,0,0,432,1 },
+    { "js","js",0,0,0,433,2 },
+    { "jz","jz",0,0,0,435,2 },
+    { "lahf","lahf",0,0,0,437,1 },
+    { "lar","lar",0,0,0,438,1 },
+    { "lddqu","lddqu",0,0,0,439,1 },
+    { "ldmxcsr","ldmxcsr",0,0,0,440,1 },
+    { "lds","lds",0,0,0,441,0 },
+    { "lea","lea",0,0,0,441,1 },
+    { "leaq","lea",SIZE64,SIZE64,SIZE64,441,1 },
+    { "leave","leave",0,0,0,442,2 },
+    { "leaveq","leave",0,0,0,442,2 },
+    { "les","les",0,0,0,444,0 },
+    { "lfence","lfence",0,0,0,444,1 },
+    { "lfs","lfs",0,0,0,445,0 },
+    { "lgdt","lgdt",0,0,0,445,0 },
+    { "lgs","lgs",0,0,0,445,0 },
+    { "lidt","lidt",0,0,0,445,0 },
+    { "lldt","lldt",0,0,0,445,1 },
+    { "lmsw","lmsw",0,0,0,446,1 },
+    { "loadall","loadall",0,0,0,447,2 },
+    { "lock","lock",0,0,0,449,1 },
+    { "lods","lods",0,0,0,450,3 },
+    { "lodsb","lodsb",0,0,0,453,1 },
+    { "lodsd","lodsd",0,0,0,454,2 },
+    { "lodsq","lodsq",0,0,0,456,1 },
+    { "lodsw","lodsw",0,0,0,457,2 },
+    { "loop","loop",0,0,0,459,2 },
+    { "loope","loope",0,0,0,461,2 },
+    { "loopne","loopne",0,0,0,463,2 },
+    { "loopnz","loopnz",0,0,0,465,2 },
+    { "loopz","loopz",0,0,0,467,2 },
+    { "lsl","lsl",0,0,0,469,1 },
+    { "lss","lss",0,0,0,470,0 },
+    { "ltr","ltr",0,0,0,470,1 },
+    { "maskmovdqu","maskmovdqu",0,0,0,471,0 },
+    { "maskmovq","maskmovq",0,0,0,471,0 },
+    { "maxpd","maxpd",0,0,0,471,0 },
+    { "maxps","maxps",0,0,0,471,0 },
+    { "maxsd","maxsd",0,0,0,471,1 },
+    { "maxss","maxss",0,0,0,472,1 },
+    { "mfence","mfence",0,0,0,473,1 },
+    { "minpd","minpd",0,0,0,474,0 },
+    { "minps","minps",0,0,0,474,0 },
+    { "minsd","minsd",0,0,0,474,1 },
+    { "minss","minss",0,0,0,475,1 },
+    { "monitor","monitor",0,0,0,476,1 },
+    { "mov","mov",0,0,0,477,8 },
+    { "movabsq","mov",SIZE64,SIZE64,SIZE64,477,8 },
+    { "movapd","movapd",0,0,0,485,0 },
+    { "movaps","movaps",0,0,0,485,0 },
+    { "movb","mov",SIZE08,SIZE08,SIZE08,477,8 },
+    { "movbe","movbe",0,0,0,485,2 },
+    { "movd","movd",0,0,0,487,4 },
+    { "movddup","movddup",0,0,0,491,1 },
+    { "movdq2q","movdq2q",0,0,0,492,0 },
+    { "movdqa","movdqa",0,0,0,492,2 },
+    { "movdqu","movdqu",0,0,0,494,2 },
+    { "movhlps","movhlps",0,0,0,496,0 },
+    { "movhpd","movhpd",0,0,0,496,2 },
+    { "movhps","movhps",0,0,0,498,2 },
+    { "movl","mov",SIZE32,SIZE32,SIZE32,477,8 },
+    { "movlhps","movlhps",0,0,0,500,0 },
+    { "movlpd","movlpd",0,0,0,500,2 },
+    { "movlps","movlps",0,0,0,502,2 },
+    { "movmskpd","movmskpd",0,0,0,504,0 },
+    { "movmskps","movmskps",0,0,0,504,0 },
+    { "movntdq","movntdq",0,0,0,504,1 },
+    { "movntdqa","movntdqa",0,0,0,505,1 },
+    { "movnti","movnti",0,0,0,506,1 },
+    { "movntpd","movntpd",0,0,0,507,0 },
+    { "movntps","movntps",0,0,0,507,0 },
+    { "movntq","movntq",0,0,0,507,0 },
+    { "movq","movq",SIZE64,SIZE64,SIZE64,507,4 },
+    { "movq","mov",SIZE64,SIZE64,SIZE64,477,8 },
+    { "movq2dq","movq2dq",0,0,0,511,0 },
+    { "movs","movs",0,0,0,511,3 },
+    { "movsb","movsb",0,0,0,514,1 },
+    { "movsbl","movsx",SIZE08,SIZE32,0,515,2 },
+    { "movsbq","movsx",SIZE08,SIZE64,0,515,2 },
+    { "movsbw","movsx",SIZE08,SIZE32,0,515,2 },
+    { "movsd","movsd",SIZE32,SIZE32,SIZE32,517,4 },
+    { "movshdup","movshdup",0,0,0,521,1 },
+    { "movsldup","movsldup",0,0,0,522,1 },
+    { "movslq","movsxd",SIZE32,SIZE64,0,523,1 },
+    { "movsq","movsq",0,0,0,524,1 },
+    { "movss","movss",SIZE16,SIZE16,SIZE16,525,2 },
+    { "movsw","movsw",0,0,0,527,2 },
+    { "movswl","movsx",SIZE16,SIZE32,0,515,2 },
+    { "movswq","movsx",SIZE16,SIZE64,0,515,2 },
+    { "movsx","movsx",0,0,0,515,2 },
+    { "movsxd","movsxd",0,0,0,523,1 },
+    { "movupd","movupd",0,0,0,529,0 },
+    { "movups","movups",0,0,0,529,0 },
+    { "movw","mov",SIZE16,SIZE16,SIZE16,477,8 },
+    { "movzbl","movzx",SIZE08,SIZE32,0,529,2 },
+    { "movzbq","movzx",SIZE08,SIZE64,0,529,2 },
+    { "movzbw","movzx",SIZE08,SIZE16,0,529,2 },
+    { "movzwl","movzx",SIZE16,SIZE32,0,529,2 },
+    { "movzwq","movzx",SIZE16,SIZE64,0,529,2 },
+    { "movzx","movzx",0,0,0,529,2 },
+    { "mpsadbw","mpsadbw",0,0,0,531,1 },
+    { "mul","mul",0,0,0,532,2 },
+    { "mulpd","mulpd",0,0,0,534,0 },
+    { "mulps","mulps",0,0,0,534,0 },
+    { "mulsd","mulsd",SIZE32,SIZE32,SIZE32,534,1 },
+    { "mulss","mulss",SIZE16,SIZE16,SIZE16,535,1 },
+    { "mwait","mwait",0,0,0,536,1 },
+    { "neg","neg",0,0,0,537,2 },
+    { "nop","nop",0,0,0,539,4 },
+    { "not","not",0,0,0,543,2 },
+    { "notb","not",SIZE08,SIZE08,SIZE08,543,2 },
+    { "notl","not",SIZE32,SIZE32,SIZE32,543,2 },
+    { "notq","not",SIZE64,SIZE64,SIZE64,543,2 },
+    { "notw","not",SIZE16,SIZE16,SIZE16,543,2 },
+    { "ntaken","ntaken",0,0,0,545,1 },
+    { "or","or",0,0,0,546,9 },
+    { "orb","or",SIZE08,SIZE08,SIZE08,546,9 },
+    { "orl","or",SIZE32,SIZE32,SIZE32,546,9 },
+    { "orpd","orpd",0,0,0,555,0 },
+    { "orps","orps",0,0,0,555,0 },
+    { "orq","or",SIZE64,SIZE64,SIZE64,546,9 },
+    { "orw","or",SIZE16,SIZE16,SIZE16,546,9 },
+    { "out","out",0,0,0,555,4 },
+    { "outs","outs",0,0,0,559,2 },
+    { "outsb","outsb",0,0,0,561,1 },
+    { "outsd","outsd",0,0,0,562,1 },
+    { "outsw","outsw",0,0,0,563,1 },
+    { "pabsb","pabsb",0,0,0,564,1 },
+    { "pabsd","pabsd",0,0,0,565,1 },
+    { "pabsw","pabsw",0,0,0,566,1 },
+    { "packssdw","packssdw",0,0,0,567,1 },
+    { "packsswb","packsswb",0,0,0,568,1 },
+    { "packusdw","packusdw",0,0,0,569,1 },
+    { "packuswb","packuswb",0,0,0,570,1 },
+    { "paddb","paddb",0,0,0,571,1 },
+    { "paddd","paddd",0,0,0,572,1 },
+    { "paddq","paddq",0,0,0,573,1 },
+    { "paddsb","paddsb",0,0,0,574,1 },
+    { "paddsw","paddsw",0,0,0,575,1 },
+    { "paddusb","paddusb",0,0,0,576,1 },
+    { "paddusw","paddusw",0,0,0,577,1 },
+    { "paddw","paddw",0,0,0,578,1 },
+    { "palignr","palignr",0,0,0,579,1 },
+    { "pand","pand",0,0,0,580,1 },
+    { "pandn","pandn",0,0,0,581,1 },
+    { "pause","pause",0,0,0,582,1 },
+    { "pavgb","pavgb",0,0,0,583,1 },
+    { "pavgw","pavgw",0,0,0,584,1 },
+    { "pblendvb","pblendvb",0,0,0,585,1 },
+    { "pblendw","pblendw",0,0,0,586,1 },
+    { "pcmpeqb","pcmpeqb",0,0,0,587,1 },
+    { "pcmpeqd","pcmpeqd",0,0,0,588,1 },
+    { "pcmpeqq","pcmpeqq",0,0,0,589,1 },
+    { "pcmpeqw","pcmpeqw",0,0,0,590,1 },
+    { "pcmpestri","pcmpestri",0,0,0,591,0 },
+    { "pcmpestrm","pcmpestrm",0,0,0,591,0 },
+    { "pcmpgtb","pcmpgtb",0,0,0,591,1 },
+    { "pcmpgtd","pcmpgtd",0,0,0,592,1 },
+    { "pcmpgtq","pcmpgtq",0,0,0,593,1 },
+    { "pcmpgtw","pcmpgtw",0,0,0,594,1 },
+    { "pcmpistri","pcmpistri",0,0,0,595,0 },
+    { "pcmpistrm","pcmpistrm",0,0,0,595,0 },
+    { "pextrb","pextrb",0,0,0,595,1 },
+    { "pextrd","pextrd",0,0,0,596,1 },
+    { "pextrq","pextrq",0,0,0,597,1 },
+    { "pextrw","pextrw",0,0,0,598,1 },
+    { "phaddd","phaddd",0,0,0,599,1 },
+    { "phaddsw","phaddsw",0,0,0,600,1 },
+    { "phaddw","phaddw",0,0,0,601,1 },
+    { "phminposuw","phminposuw",0,0,0,602,1 },
+    { "phsubd","phsubd",0,0,0,603,1 },
+    { "phsubsw","phsubsw",0,0,0,604,1 },
+    { "phsubw","phsubw",0,0,0,605,1 },
+    { "pinsrb","pinsrb",0,0,0,606,1 },
+    { "pinsrd","pinsrd",0,0,0,607,1 },
+    { "pinsrq","pinsrq",0,0,0,608,1 },
+    { "pinsrw","pinsrw",0,0,0,609,1 },
+    { "pmaddubsw","pmaddubsw",0,0,0,610,1 },
+    { "pmaddwd","pmaddwd",0,0,0,611,1 },
+    { "pmaxsb","pmaxsb",0,0,0,612,1 },
+    { "pmaxsd","pmaxsd",0,0,0,613,1 },
+    { "pmaxsw","pmaxsw",0,0,0,614,1 },
+    { "pmaxub","pmaxub",0,0,0,615,1 },
+    { "pmaxud","pmaxud",0,0,0,616,1 },
+    { "pmaxuw","pmaxuw",0,0,0,617,1 },
+    { "pminsb","pminsb",0,0,0,618,1 },
+    { "pminsd","pminsd",0,0,0,619,1 },
+    { "pminsw","pminsw",0,0,0,620,1 },
+    { "pminub","pminub",0,0,0,621,1 },
+    { "pminud","pminud",0,0,0,622,1 },
+    { "pminuw","pminuw",0,0,0,623,1 },
+    { "pmovmskb","pmovmskb",0,0,0,624,0 },
+    { "pmovsxbd","pmovsxbd",0,0,0,624,1 },
+    { "pmovsxbq","pmovsxbq",0,0,0,625,1 },
+    { "pmovsxbw","pmovsxbw",0,0,0,626,1 },
+    { "pmovsxdq","pmovsxdq",0,0,0,627,1 },
+    { "pmovsxwd","pmovsxwd",0,0,0,628,1 },
+    { "pmovsxwq","pmovsxwq",0,0,0,629,1 },
+    { "pmovzxbd","pmovzxbd",0,0,0,630,1 },
+    { "pmovzxbq","pmovzxbq",0,0,0,631,1 },
+    { "pmovzxbw","pmovzxbw",0,0,0,632,1 },
+    { "pmovzxdq","pmovzxdq",0,0,0,633,1 },
+    { "pmovzxwd","pmovzxwd",0,0,0,634,1 },
+    { "pmovzxwq","pmovzxwq",0,0,0,635,1 },
+    { "pmuldq","pmuldq",0,0,0,636,1 },
+    { "pmulhrsw","pmulhrsw",0,0,0,637,1 },
+    { "pmulhuw","pmulhuw",0,0,0,638,1 },
+    { "pmulhw","pmulhw",0,0,0,639,1 },
+    { "pmulld","pmulld",0,0,0,640,1 },
+    { "pmullw","pmullw",0,0,0,641,1 },
+    { "pmuludq","pmuludq",0,0,0,642,1 },
+    { "pop","pop",0,0,0,643,7 },
+    { "popa","popa",0,0,0,650,0 },
+    { "popad","popad",0,0,0,650,0 },
+    { "popcnt","popcnt",0,0,0,650,1 },
+    { "popf","popf",0,0,0,651,2 },
+    { "popfd","popfd",0,0,0,653,1 },
+    { "popfq","popfq",0,0,0,654,1 },
+    { "popq","pop",SIZE64,SIZE64,SIZE64,643,7 },
+    { "por","por",0,0,0,655,1 },
+    { "prefetchnta","prefetchnta",0,0,0,656,1 },
+    { "prefetcht0","prefetcht0",0,0,0,657,1 },
+    { "prefetcht1","prefetcht1",0,0,0,658,1 },
+    { "prefetcht2","prefetcht2",0,0,0,659,1 },
+    { "psadbw","psadbw",0,0,0,660,1 },
+    { "pshufb","pshufb",0,0,0,661,1 },
+    { "pshufd","pshufd",0,0,0,662,1 },
+    { "pshufhw","pshufhw",0,0,0,663,1 },
+    { "pshuflw","pshuflw",0,0,0,664,1 },
+    { "pshufw","pshufw",0,0,0,665,0 },
+    { "psignb","psignb",0,0,0,665,1 },
+    { "psignd","psignd",0,0,0,666,1 },
+    { "psignw","psignw",0,0,0,667,1 },
+    { "pslld","pslld",0,0,0,668,1 },
+    { "pslldq","pslldq",0,0,0,669,0 },
+    { "psllq","psllq",0,0,0,669,1 },
+    { "psllw","psllw",0,0,0,670,1 },
+    { "psrad","psrad",0,0,0,671,1 },
+    { "psraw","psraw",0,0,0,672,1 },
+    { "psrld","psrld",0,0,0,673,1 },
+    { "psrldq","psrldq",0,0,0,674,0 },
+    { "psrlq","psrlq",0,0,0,674,1 },
+    { "psrlw","psrlw",0,0,0,675,1 },
+    { "psubb","psubb",0,0,0,676,1 },
+    { "psubd","psubd",0,0,0,677,1 },
+    { "psubq","psubq",0,0,0,678,1 },
+    { "psubsb","psubsb",0,0,0,679,1 },
+    { "psubsw","psubsw",0,0,0,680,1 },
+    { "psubusb","psubusb",0,0,0,681,1 },
+    { "psubusw","psubusw",0,0,0,682,1 },
+    { "psubw","psubw",0,0,0,683,1 },
+    { "ptest","ptest",0,0,0,684,1 },
+    { "punpckhbw","punpckhbw",0,0,0,685,1 },
+    { "punpckhdq","punpckhdq",0,0,0,686,1 },
+    { "punpckhqdq","punpckhqdq",0,0,0,687,1 },
+    { "punpckhwd","punpckhwd",0,0,0,688,1 },
+    { "punpcklbw","punpcklbw",0,0,0,689,1 },
+    { "punpckldq","punpckldq",0,0,0,690,1 },
+    { "punpcklqdq","punpcklqdq",0,0,0,691,1 },
+    { "punpcklwd","punpcklwd",0,0,0,692,1 },
+    { "push","push",0,0,0,693,8 },
+    { "pusha","pusha",0,0,0,701,0 },
+    { "pushad","pushad",0,0,0,701,0 },
+    { "pushf","pushf",0,0,0,701,2 },
+    { "pushfd","pushfd",0,0,0,703,1 },
+    { "pushfq","pushfq",0,0,0,704,1 },
+    { "pushq","push",SIZE64,SIZE64,SIZE64,693,8 },
+    { "pxor","pxor",0,0,0,705,1 },
+    { "rcl","rcl",0,0,0,706,6 },
+    { "rcpps","rcpps",0,0,0,712,0 },
+    { "rcpss","rcpss",0,0,0,712,1 },
+    { "rcr","rcr",0,0,0,713,6 },
+    { "rdmsr","rdmsr",0,0,0,719,1 },
+    { "rdpmc","rdpmc",0,0,0,720,1 },
+    { "rdtsc","rdtsc",0,0,0,721,1 },
+    { "rdtscp","rdtscp",0,0,0,722,1 },
+    { "rep","rep",0,0,0,723,4 },
+    { "repe","repe",0,0,0,727,2 },
+    { "repne","repne",0,0,0,729,2 },
+    { "repnz","repnz",0,0,0,731,2 },
+    { "repz","repz",0,0,0,733,2 },
+    { "ret","retn",0,0,0,735,2 },
+    { "retf","retf",0,0,0,737,2 },
+    { "retn","retn",0,0,0,735,2 },
+    { "retq","retn",SIZE64,SIZE64,SIZE64,735,2 },
+    { "rex","rex",0,0,0,739,1 },
+    { "rex.b","rex.b",0,0,0,740,1 },
+    { "rex.r","rex.r",0,0,0,741,1 },
+    { "rex.rb","rex.rb",0,0,0,742,1 },
+    { "rex.rx","rex.rx",0,0,0,743,1 },
+    { "rex.rxb","rex.rxb",0,0,0,744,1 },
+    { "rex.w","rex.w",0,0,0,745,1 },
+    { "rex.wb","rex.wb",0,0,0,746,1 },
+    { "rex.wr","rex.wr",0,0,0,747,1 },
+    { "rex.wrb","rex.wrb",0,0,0,748,1 },
+    { "rex.wrx","rex.wrx",0,0,0,749,1 },
+    { "rex.wrxb","rex.wrxb",0,0,0,750,1 },
+    { "rex.wx","rex.wx",0,0,0,751,1 },
+    { "rex.wxb","rex.wxb",0,0,0,752,1 },
+    { "rex.x","rex.x",0,0,0,753,1 },
+    { "rex.xb","rex.xb",0,0,0,754,1 },
+    { "rol","rol",0,0,0,755,6 },
+    { "ror","ror",0,0,0,761,6 },
+    { "roundpd","roundpd",0,0,0,767,0 },
+    { "roundps","roundps",0,0,0,767,0 },
+    { "roundsd","roundsd",0,0,0,767,1 },
+    { "roundss","roundss",0,0,0,768,1 },
+    { "rsm","rsm",0,0,0,769,1 },
+    { "rsqrtps","rsqrtps",0,0,0,770,0 },
+    { "rsqrtss","rsqrtss",0,0,0,770,1 },
+    { "sahf","sahf",0,0,0,771,1 },
+    { "sal","sal",0,0,0,772,12 },
+    { "salc","salc",0,0,0,784,0 },
+    { "sar","sar",0,0,0,784,6 },
+    { "sarb","sar",SIZE08,SIZE08,SIZE08,784,6 },
+    { "sarl","sar",SIZE32,SIZE32,SIZE32,784,6 },
+    { "sarq","sar",SIZE64,SIZE64,SIZE64,784,6 },
+    { "sarw","sar",SIZE16,SIZE16,SIZE16,784,6 },
+    { "sbb","sbb",0,0,0,790,9 },
+    { "scas","scas",0,0,0,799,3 },
+    { "scasb","scasb",0,0,0,802,1 },
+    { "scasd","scasd",0,0,0,803,2 },
+    { "scasq","scasq",0,0,0,805,1 },
+    { "scasw","scasw",0,0,0,806,2 },
+    { "seta","seta",0,0,0,808,1 },
+    { "setae","setae",0,0,0,809,1 },
+    { "setalc","setalc",0,0,0,810,0 },
+    { "setb","setb",0,0,0,810,1 },
+    { "setbe","setbe",0,0,0,811,1 },
+    { "setc","setc",0,0,0,812,1 },
+    { "sete","sete",0,0,0,813,1 },
+    { "setg","setg",0,0,0,814,1 },
+    { "setge","setge",0,0,0,815,1 },
+    { "setl","setl",0,0,0,816,1 },
+    { "setle","setle",0,0,0,817,1 },
+    { "setna","setna",0,0,0,818,1 },
+    { "setnae","setnae",0,0,0,819,1 },
+    { "setnb","setnb",0,0,0,820,1 },
+    { "setnbe","setnbe",0,0,0,821,1 },
+    { "setnc","setnc",0,0,0,822,1 },
+    { "setne","setne",0,0,0,823,1 },
+    { "setng","setng",0,0,0,824,1 },
+    { "setnge","setnge",0,0,0,825,1 },
+    { "setnl","setnl",0,0,0,826,1 },
+    { "setnle","setnle",0,0,0,827,1 },
+    { "setno","setno",0,0,0,828,1 },
+    { "setnp","setnp",0,0,0,829,1 },
+    { "setns","setns",0,0,0,830,1 },
+    { "setnz","setnz",0,0,0,831,1 },
+    { "seto","seto",0,0,0,832,1 },
+    { "setp","setp",0,0,0,833,1 },
+    { "setpe","setpe",0,0,0,834,1 },
+    { "setpo","setpo",0,0,0,835,1 },
+    { "sets","sets",0,0,0,836,1 },
+    { "setz","setz",0,0,0,837,1 },
+    { "sfence","sfence",0,0,0,838,1 },
+    { "sgdt","sgdt",0,0,0,839,0 },
+    { "shl","shl",0,0,0,839,12 },
+    { "shlb","shl",SIZE08,SIZE08,SIZE08,839,12 },
+    { "shld","shld",0,0,0,851,2 },
+    { "shll","shl",SIZE32,SIZE32,SIZE32,839,12 },
+    { "shlq","shl",SIZE64,SIZE64,SIZE64,839,12 },
+    { "shlw","shl",SIZE16,SIZE16,SIZE16,839,12 },
+    { "shr","shr",0,0,0,853,6 },
+    { "shrb","shr",SIZE08,SIZE08,SIZE08,853,6 },
+    { "shrd","shrd",0,0,0,859,2 },
+    { "shrl","shr",SIZE32,SIZE32,SIZE32,853,6 },
+    { "shrq","shr",SIZE64,SIZE64,SIZE64,853,6 },
+    { "shrw","shr",SIZE16,SIZE16,SIZE16,853,6 },
+    { "shufpd","shufpd",0,0,0,861,0 },
+    { "shufps","shufps",0,0,0,861,0 },
+    { "sidt","sidt",0,0,0,861,0 },
+    { "sldt","sldt",0,0,0,861,1 },
+    { "smsw","smsw",0,0,0,862,1 },
+    { "sqrtpd","sqrtpd",0,0,0,863,0 },
+    { "sqrtps","sqrtps",0,0,0,863,0 },
+    { "sqrtsd","sqrtsd",0,0,0,863,1 },
+    { "sqrtss","sqrtss",0,0,0,864,1 },
+    { "ss","ss",0,0,0,865,1 },
+    { "stc","stc",0,0,0,866,1 },
+    { "std","std",0,0,0,867,1 },
+    { "sti","sti",0,0,0,868,1 },
+    { "stmxcsr","stmxcsr",0,0,0,869,1 },
+    { "stos","stos",0,0,0,870,3 },
+    { "stosb","stosb",0,0,0,873,1 },
+    { "stosd","stosd",0,0,0,874,2 },
+    { "stosq","stosq",0,0,0,876,1 },
+    { "stosw","stosw",0,0,0,877,2 },
+    { "str","str",0,0,0,879,1 },
+    { "sub","sub",0,0,0,880,9 },
+    { "subb","sub",SIZE08,SIZE08,SIZE08,880,9 },
+    { "subl","sub",SIZE32,SIZE32,SIZE32,880,9 },
+    { "subpd","subpd",0,0,0,889,0 },
+    { "subps","subps",0,0,0,889,0 },
+    { "subq","sub",SIZE64,SIZE64,SIZE64,880,9 },
+    { "subsd","subsd",SIZE32,SIZE32,SIZE32,889,1 },
+    { "subss","subss",SIZE16,SIZE16,SIZE16,890,1 },
+    { "subw","sub",SIZE16,SIZE16,SIZE16,880,9 },
+    { "swapgs","swapgs",0,0,0,891,1 },
+    { "syscall","syscall",0,0,0,892,1 },
+    { "sysenter","sysenter",0,0,0,893,2 },
+    { "sysexit","sysexit",0,0,0,895,1 },
+    { "sysret","sysret",0,0,0,896,1 },
+    { "taken","taken",0,0,0,897,1 },
+    { "test","test",0,0,0,898,8 },
+    { "testb","test",SIZE08,SIZE08,SIZE08,898,8 },
+    { "testl","test",SIZE32,SIZE32,SIZE32,898,8 },
+    { "testq","test",SIZE64,SIZE64,SIZE64,898,8 },
+    { "testw","test",SIZE16,SIZE16,SIZE16,898,8 },
+    { "ucomisd","ucomisd",SIZE32,SIZE32,SIZE32,906,1 },
+    { "ucomiss","ucomiss",SIZE16,SIZE16,SIZE16,907,1 },
+    { "ud","ud",0,0,0,908,1 },
+    { "ud2","ud2",0,0,0,909,1 },
+    { "unpckhpd","unpckhpd",0,0,0,910,0 },
+    { "unpckhps","unpckhps",0,0,0,910,0 },
+    { "unpcklpd","unpcklpd",0,0,0,910,0 },
+    { "unpcklps","unpcklps",0,0,0,910,0 },
+    { "verr","verr",0,0,0,910,1 },
+    { "verw","verw",0,0,0,911,1 },
+    { "vmcall","vmcall",0,0,0,912,1 },
+    { "vmclear","vmclear",0,0,0,913,1 },
+    { "vmlaunch","vmlaunch",0,0,0,914,1 },
+    { "vmptrld","vmptrld",0,0,0,915,1 },
+    { "vmptrst","vmptrst",0,0,0,916,1 },
+    { "vmread","vmread",0,0,0,917,2 },
+    { "vmresume","vmresume",0,0,0,919,1 },
+    { "vmwrite","vmwrite",0,0,0,920,2 },
+    { "vmxoff","vmxoff",0,0,0,922,1 },
+    { "vmxon","vmxon",0,0,0,923,1 },
+    { "wait","wait",0,0,0,924,1 },
+    { "wbinvd","wbinvd",0,0,0,925,1 },
+    { "wrmsr","wrmsr",0,0,0,926,1 },
+    { "xadd","xadd",0,0,0,927,0 },
+    { "xchg","xchg",0,0,0,927,0 },
+    { "xgetbv","xgetbv",0,0,0,927,1 },
+    { "xlat","xlat",0,0,0,928,1 },
+    { "xlatb","xlatb",0,0,0,929,1 },
+    { "xor","xor",0,0,0,930,9 },
+    { "xorb","xor",SIZE08,SIZE08,SIZE08,930,9 },
+    { "xorl","xor",SIZE32,SIZE32,SIZE32,930,9 },
+    { "xorpd","xorpd",0,0,0,939,0 },
+    { "xorps","xorps",0,0,0,939,0 },
+    { "xorq","xor",SIZE64,SIZE64,SIZE64,930,9 },
+    { "xorw","xor",SIZE16,SIZE16,SIZE16,930,9 },
+    { "xrstor","xrstor",0,0,0,939,2 },
+    { "xsave","xsave",0,0,0,941,2 },
+    { "xsetbv","xsetbv",0,0,0,943,1 },
+};
+
+// Opcode aliases with the same name
+OpcodeAliasGroup opcode_alias_groups[] = {
+    { "aaa",0,1 },
+    { "aad",1,1 },
+    { "aam",2,1 },
+    { "aas",3,1 },
+    { "adc",4,1 },
+    { "add",5,1 },
+    { "addb",6,1 },
+    { "addl",7,1 },
+    { "addpd",8,1 },
+    { "addps",9,1 },
+    { "addq",10,1 },
+    { "addsd",11,1 },
+    { "addss",12,1 },
+    { "addsubpd",13,1 },
+    { "addsubps",14,1 },
+    { "addw",15,1 },
+    { "adx",16,1 },
+    { "alter",17,1 },
+    { "amx",18,1 },
+    { "and",19,1 },
+    { "andb",20,1 },
+    { "andl",21,1 },
+    { "andnpd",22,1 },
+    { "andnps",23,1 },
+    { "andpd",24,1 },
+    { "andps",25,1 },
+    { "andq",26,1 },
+    { "andw",27,1 },
+    { "arpl",28,1 },
+    { "blendpd",29,1 },
+    { "blendps",30,1 },
+    { "blendvpd",31,1 },
+    { "blendvps",32,1 },
+    { "bound",33,1 },
+    { "bsf",34,1 },
+    { "bsr",35,1 },
+    { "bswap",36,1 },
+    { "bt",37,1 },
+    { "btc",38,1 },
+    { "btr",39,1 },
+    { "bts",40,1 },
+    { "call",41,1 },
+    { "callf",42,1 },
+    { "callq",43,1 },
+    { "cbw",44,1 },
+    { "cdq",45,1 },
+    { "cdqe",46,1 },
+    { "clc",47,1 },
+    { "cld",48,1 },
+    { "clflush",49,1 },
+    { "cli",50,1 },
+    { "cltd",51,1 },
+    { "clts",52,1 },
+    { "cmc",53,1 },
+    { "cmova",54,1 },
+    { "cmovae",55,1 },
+    { "cmovael",56,1 },
+    { "cmovaeq",57,1 },
+    { "cmovaew",58,1 },
+    { "cmoval",59,1 },
+    { "cmovaq",60,1 },
+    { "cmovaw",61,1 },
+    { "cmovb",62,1 },
+    { "cmovbe",63,1 },
+    { "cmovbel",64,1 },
+    { "cmovbeq",65,1 },
+    { "cmovbew",66,1 },
+    { "cmovbl",67,1 },
+    { "cmovbq",68,1 },
+    { "cmovbw",69,1 },
+    { "cmovc",70,1 },
+    { "cmovcl",71,1 },
+    { "cmovcq",72,1 },
+    { "cmovcw",73,1 },
+    { "cmove",74,1 },
+    { "cmovel",75,1 },
+    { "cmoveq",76,1 },
+    { "cmovew",77,1 },
+    { "cmovg",78,1 },
+    { "cmovge",79,1 },
+    { "cmovgel",80,1 },
+    { "cmovgeq",81,1 },
+    { "cmovgew",82,1 },
+    { "cmovgl",83,1 },
+    { "cmovgq",84,1 },
+    { "cmovgw",85,1 },
+    { "cmovl",86,1 },
+    { "cmovle",87,1 },
+    { "cmovlel",88,1 },
+    { "cmovleq",89,1 },
+    { "cmovlew",90,1 },
+    { "cmovll",91,1 },
+    { "cmovlq",92,1 },
+    { "cmovlw",93,1 },
+    { "cmovna",94,1 },
+    { "cmovnae",95,1 },
+    { "cmovnael",96,1 },
+    { "cmovnaeq",97,1 },
+    { "cmovnaew",98,1 },
+    { "cmovnal",99,1 },
+    { "cmovnaq",100,1 },
+    { "cmovnaw",101,1 },
+    { "cmovnb",102,1 },
+    { "cmovnbe",103,1 },
+    { "cmovnbel",104,1 },
+    { "cmovnbeq",105,1 },
+    { "cmovnbew",106,1 },
+    { "cmovnbl",107,1 },
+    { "cmovnbq",108,1 },
+    { "cmovnbw",109,1 },
+    { "cmovnc",110,1 },
+    { "cmovncl",111,1 },
+    { "cmovncq",112,1 },
+    { "cmovncw",113,1 },
+    { "cmovne",114,1 },
+    { "cmovnel",115,1 },
+    { "cmovneq",116,1 },
+    { "cmovnew",117,1 },
+    { "cmovng",118,1 },
+    { "cmovnge",119,1 },
+    { "cmovngel",120,1 },
+    { "cmovngeq",121,1 },
+    { "cmovngew",122,1 },
+    { "cmovngl",123,1 },
+    { "cmovngq",124,1 },
+    { "cmovngw",125,1 },
+    { "cmovnl",126,1 },
+    { "cmovnle",127,1 },
+    { "cmovnlel",128,1 },
+    { "cmovnleq",129,1 },
+    { "cmovnlew",130,1 },
+    { "cmovnll",131,1 },
+    { "cmovnlq",132,1 },
+    { "cmovnlw",133,1 },
+    { "cmovno",134,1 },
+    { "cmovnol",135,1 },
+    { "cmovnoq",136,1 },
+    { "cmovnow",137,1 },
+    { "cmovnp",138,1 },
+    { "cmovnpl",139,1 },
+    { "cmovnpq",140,1 },
+    { "cmovnpw",141,1 },
+    { "cmovns",142,1 },
+    { "cmovnsl",143,1 },
+    { "cmovnsq",144,1 },
+    { "cmovnsw",145,1 },
+    { "cmovnz",146,1 },
+    { "cmovnzl",147,1 },
+    { "cmovnzq",148,1 },
+    { "cmovnzw",149,1 },
+    { "cmovo",150,1 },
+    { "cmovol",151,1 },
+    { "cmovoq",152,1 },
+    { "cmovow",153,1 },
+    { "cmovp",154,1 },
+    { "cmovpe",155,1 },
+    { "cmovpel",156,1 },
+    { "cmovpeq",157,1 },
+    { "cmovpew",158,1 },
+    { "cmovpl",159,1 },
+    { "cmovpo",160,1 },
+    { "cmovpol",161,1 },
+    { "cmovpoq",162,1 },
+    { "cmovpow",163,1 },
+    { "cmovpq",164,1 },
+    { "cmovpw",165,1 },
+    { "cmovs",166,1 },
+    { "cmovsl",167,1 },
+    { "cmovsq",168,1 },
+    { "cmovsw",169,1 },
+    { "cmovz",170,1 },
+    { "cmovzl",171,1 },
+    { "cmovzq",172,1 },
+    { "cmovzw",173,1 },
+    { "cmp",174,1 },
+    { "cmpb",175,1 },
+    { "cmpl",176,1 },
+    { "cmppd",177,1 },
+    { "cmpps",178,1 },
+    { "cmpq",179,1 },
+    { "cmps",180,1 },
+    { "cmpsb",181,1 },
+    { "cmpsd",182,1 },
+    { "cmpsq",183,1 },
+    { "cmpss",184,1 },
+    { "cmpsw",185,1 },
+    { "cmpw",186,1 },
+    { "cmpxchg",187,1 },
+    { "cmpxchg16b",188,1 },
+    { "cmpxchg8b",189,1 },
+    { "comisd",190,1 },
+    { "comiss",191,1 },
+    { "cpuid",192,1 },
+    { "cqo",193,1 },
+    { "cqto",194,1 },
+    { "crc32",195,1 },
+    { "cs",196,1 },
+    { "cvtdq2pd",197,1 },
+    { "cvtdq2ps",198,1 },
+    { "cvtpd2dq",199,1 },
+    { "cvtpd2pi",200,1 },
+    { "cvtpd2ps",201,1 },
+    { "cvtpi2pd",202,1 },
+    { "cvtpi2ps",203,1 },
+    { "cvtps2dq",204,1 },
+    { "cvtps2pd",205,1 },
+    { "cvtps2pi",206,1 },
+    { "cvtsd2si",207,1 },
+    { "cvtsd2ss",208,1 },
+    { "cvtsi2sd",209,1 },
+    { "cvtsi2sdl",210,1 },
+    { "cvtsi2sdq",211,1 },
+    { "cvtsi2ss",212,1 },
+    { "cvtsi2ssl",213,1 },
+    { "cvtsi2ssq",214,1 },
+    { "cvtss2sd",215,1 },
+    { "cvtss2si",216,1 },
+    { "cvttpd2dq",217,1 },
+    { "cvttpd2pi",218,1 },
+    { "cvttps2dq",219,1 },
+    { "cvttps2pi",220,1 },
+    { "cvttsd2si",221,1 },
+    { "cvttsd2sil",222,1 },
+    { "cvttsd2siq",223,1 },
+    { "cvttss2si",224,1 },
+    { "cvttss2sil",225,1 },
+    { "cvttss2siq",226,1 },
+    { "cwd",227,1 },
+    { "cwde",228,1 },
+    { "cwtd",229,1 },
+    { "daa",230,1 },
+    { "das",231,1 },
+    { "dec",232,1 },
+    { "div",233,1 },
+    { "divl",234,1 },
+    { "divpd",235,1 },
+    { "divps",236,1 },
+    { "divq",237,1 },
+    { "divsd",238,1 },
+    { "divss",239,1 },
+    { "dppd",240,1 },
+    { "dpps",241,1 },
+    { "ds",242,1 },
+    { "emms",243,1 },
+    { "enter",244,1 },
+    { "es",245,1 },
+    { "extractps",246,1 },
+    { "f2xm1",247,1 },
+    { "fabs",248,1 },
+    { "fadd",249,1 },
+    { "faddp",250,1 },
+    { "fadds",251,1 },
+    { "fbld",252,1 },
+    { "fbstp",253,1 },
+    { "fchs",254,1 },
+    { "fclex",255,1 },
+    { "fcmovb",256,1 },
+    { "fcmovbe",257,1 },
+    { "fcmove",258,1 },
+    { "fcmovnb",259,1 },
+    { "fcmovnbe",260,1 },
+    { "fcmovne",261,1 },
+    { "fcmovnu",262,1 },
+    { "fcmovu",263,1 },
+    { "fcom",264,1 },
+    { "fcom2",265,1 },
+    { "fcomi",266,1 },
+    { "fcomip",267,1 },
+    { "fcomp",268,1 },
+    { "fcomp3",269,1 },
+    { "fcomp5",270,1 },
+    { "fcompp",271,1 },
+    { "fcos",272,1 },
+    { "fdecstp",273,1 },
+    { "fdisi",274,1 },
+    { "fdiv",275,1 },
+    { "fdivp",276,1 },
+    { "fdivr",277,1 },
+    { "fdivrp",278,1 },
+    { "feni",279,1 },
+    { "ffree",280,1 },
+    { "ffreep",281,1 },
+    { "fiadd",282,1 },
+    { "ficom",283,1 },
+    { "ficomp",284,1 },
+    { "fidiv",285,1 },
+    { "fidivr",286,1 },
+    { "fild",287,1 },
+    { "fildl",288,1 },
+    { "fildll",289,1 },
+    { "fildq",290,1 },
+    { "filds",291,1 },
+    { "fimul",292,1 },
+    { "fincstp",293,1 },
+    { "finit",294,1 },
+    { "fist",295,1 },
+    { "fistp",296,1 },
+    { "fistpl",297,1 },
+    { "fistpll",298,1 },
+    { "fistpq",299,1 },
+    { "fistps",300,1 },
+    { "fisttp",301,1 },
+    { "fisub",302,1 },
+    { "fisubr",303,1 },
+    { "fld",304,1 },
+    { "fld1",305,1 },
+    { "fldcw",306,1 },
+    { "fldenv",307,1 },
+    { "fldl",308,1 },
+    { "fldl2e",309,1 },
+    { "fldl2t",310,1 },
+    { "fldlg2",311,1 },
+    { "fldln2",312,1 },
+    { "fldpi",313,1 },
+    { "flds",314,1 },
+    { "fldt",315,1 },
+    { "fldz",316,1 },
+    { "fmul",317,1 },
+    { "fmulp",318,1 },
+    { "fnclex",319,1 },
+    { "fndisi",320,1 },
+    { "fneni",321,1 },
+    { "fninit",322,1 },
+    { "fnop",323,1 },
+    { "fnsave",324,1 },
+    { "fnsetpm",325,1 },
+    { "fnstcw",326,1 },
+    { "fnstenv",327,1 },
+    { "fnstsw",328,1 },
+    { "fpatan",329,1 },
+    { "fprem",330,1 },
+    { "fprem1",331,1 },
+    { "fptan",332,1 },
+    { "frndint",333,1 },
+    { "frstor",334,1 },
+    { "fs",335,1 },
+    { "fsave",336,1 },
+    { "fscale",337,1 },
+    { "fsetpm",338,1 },
+    { "fsin",339,1 },
+    { "fsincos",340,1 },
+    { "fsqrt",341,1 },
+    { "fst",342,1 },
+    { "fstcw",343,1 },
+    { "fstenv",344,1 },
+    { "fstp",345,1 },
+    { "fstp1",346,1 },
+    { "fstp8",347,1 },
+    { "fstp9",348,1 },
+    { "fstpl",349,1 },
+    { "fstps",350,1 },
+    { "fstpt",351,1 },
+    { "fstsw",352,1 },
+    { "fsub",353,1 },
+    { "fsubp",354,1 },
+    { "fsubr",355,1 },
+    { "fsubrp",356,1 },
+    { "ftst",357,1 },
+    { "fucom",358,1 },
+    { "fucomi",359,1 },
+    { "fucomip",360,1 },
+    { "fucomp",361,1 },
+    { "fucompp",362,1 },
+    { "fwait",363,1 },
+    { "fxam",364,1 },
+    { "fxch",365,1 },
+    { "fxch4",366,1 },
+    { "fxch7",367,1 },
+    { "fxrstor",368,1 },
+    { "fxsave",369,1 },
+    { "fxtract",370,1 },
+    { "fyl2x",371,1 },
+    { "fyl2xp1",372,1 },
+    { "getsec",373,1 },
+    { "gs",374,1 },
+    { "haddpd",375,1 },
+    { "haddps",376,1 },
+    { "hint_nop",377,1 },
+    { "hlt",378,1 },
+    { "hsubpd",379,1 },
+    { "hsubps",380,1 },
+    { "icebp",381,1 },
+    { "idiv",382,1 },
+    { "idivl",383,1 },
+    { "idivq",384,1 },
+    { "imul",385,1 },
+    { "imulb",386,1 },
+    { "imull",387,1 },
+    { "imulq",388,1 },
+    { "imulw",389,1 },
+    { "in",390,1 },
+    { "inc",391,1 },
+    { "ins",392,1 },
+    { "insb",393,1 },
+    { "insd",394,1 },
+    { "insertps",395,1 },
+    { "insw",396,1 },
+    { "int",397,1 },
+    { "int1",398,1 },
+    { "into",399,1 },
+    { "invd",400,1 },
+    { "invept",401,1 },
+    { "invlpg",402,1 },
+    { "invvpid",403,1 },
+    { "iret",404,1 },
+    { "iretd",405,1 },
+    { "iretq",406,1 },
+    { "ja",407,1 },
+    { "jae",408,1 },
+    { "jb",409,1 },
+    { "jbe",410,1 },
+    { "jc",411,1 },
+    { "jcxz",412,1 },
+    { "je",413,1 },
+    { "jecxz",414,1 },
+    { "jg",415,1 },
+    { "jge",416,1 },
+    { "jl",417,1 },
+    { "jle",418,1 },
+    { "jmp",419,1 },
+    { "jmpe",420,1 },
+    { "jmpf",421,1 },
+    { "jna",422,1 },
+    { "jnae",423,1 },
+    { "jnb",424,1 },
+    { "jnbe",425,1 },
+    { "jnc",426,1 },
+    { "jne",427,1 },
+    { "jng",428,1 },
+    { "jnge",429,1 },
+    { "jnl",430,1 },
+    { "jnle",431,1 },
+    { "jno",432,1 },
+    { "jnp",433,1 },
+    { "jns",434,1 },
+    { "jnz",435,1 },
+    { "jo",436,1 },
+    { "jp",437,1 },
+    { "jpe",438,1 },
+    { "jpo",439,1 },
+    { "jrcxz",440,1 },
+    { "js",441,1 },
+    { "jz",442,1 },
+    { "lahf",443,1 },
+    { "lar",444,1 },
+    { "lddqu",445,1 },
+    { "ldmxcsr",446,1 },
+    { "lds",447,1 },
+    { "lea",448,1 },
+    { "leaq",449,1 },
+    { "leave",450,1 },
+    { "leaveq",451,1 },
+    { "les",452,1 },
+    { "lfence",453,1 },
+    { "lfs",454,1 },
+    { "lgdt",455,1 },
+    { "lgs",456,1 },
+    { "lidt",457,1 },
+    { "lldt",458,1 },
+    { "lmsw",459,1 },
+    { "loadall",460,1 },
+    { "lock",461,1 },
+    { "lods",462,1 },
+    { "lodsb",463,1 },
+    { "lodsd",464,1 },
+    { "lodsq",465,1 },
+    { "lodsw",466,1 },
+    { "loop",467,1 },
+    { "loope",468,1 },
+    { "loopne",469,1 },
+    { "loopnz",470,1 },
+    { "loopz",471,1 },
+    { "lsl",472,1 },
+    { "lss",473,1 },
+    { "ltr",474,1 },
+    { "maskmovdqu",475,1 },
+    { "maskmovq",476,1 },
+    { "maxpd",477,1 },
+    { "maxps",478,1 },
+    { "maxsd",479,1 },
+    { "maxss",480,1 },
+    { "mfence",481,1 },
+    { "minpd",482,1 },
+    { "minps",483,1 },
+    { "minsd",484,1 },
+    { "minss",485,1 },
+    { "monitor",486,1 },
+    { "mov",487,1 },
+    { "movabsq",488,1 },
+    { "movapd",489,1 },
+    { "movaps",490,1 },
+    { "movb",491,1 },
+    { "movbe",492,1 },
+    { "movd",493,1 },
+    { "movddup",494,1 },
+    { "movdq2q",495,1 },
+    { "movdqa",496,1 },
+    { "movdqu",497,1 },
+    { "movhlps",498,1 },
+    { "movhpd",499,1 },
+    { "movhps",500,1 },
+    { "movl",501,1 },
+    { "movlhps",502,1 },
+    { "movlpd",503,1 },
+    { "movlps",504,1 },
+    { "movmskpd",505,1 },
+    { "movmskps",506,1 },
+    { "movntdq",507,1 },
+    { "movntdqa",508,1 },
+    { "movnti",509,1 },
+    { "movntpd",510,1 },
+    { "movntps",511,1 },
+    { "movntq",512,1 },
+    { "movq",513,2 },
+    { "movq2dq",515,1 },
+    { "movs",516,1 },
+    { "movsb",517,1 },
+    { "movsbl",518,1 },
+    { "movsbq",519,1 },
+    { "movsbw",520,1 },
+    { "movsd",521,1 },
+    { "movshdup",522,1 },
+    { "movsldup",523,1 },
+    { "movslq",524,1 },
+    { "movsq",525,1 },
+    { "movss",526,1 },
+    { "movsw",527,1 },
+    { "movswl",528,1 },
+    { "movswq",529,1 },
+    { "movsx",530,1 },
+    { "movsxd",531,1 },
+    { "movupd",532,1 },
+    { "movups",533,1 },
+    { "movw",534,1 },
+    { "movzbl",535,1 },
+    { "movzbq",536,1 },
+    { "movzbw",537,1 },
+    { "movzwl",538,1 },
+    { "movzwq",539,1 },
+    { "movzx",540,1 },
+    { "mpsadbw",541,1 },
+    { "mul",542,1 },
+    { "mulpd",543,1 },
+    { "mulps",544,1 },
+    { "mulsd",545,1 },
+    { "mulss",546,1 },
+    { "mwait",547,1 },
+    { "neg",548,1 },
+    { "nop",549,1 },
+    { "not",550,1 },
+    { "notb",551,1 },
+    { "notl",552,1 },
+    { "notq",553,1 },
+    { "notw",554,1 },
+    { "ntaken",555,1 },
+    { "or",556,1 },
+    { "orb",557,1 },
+    { "orl",558,1 },
+    { "orpd",559,1 },
+    { "orps",560,1 },
+    { "orq",561,1 },
+    { "orw",562,1 },
+    { "out",563,1 },
+    { "outs",564,1 },
+    { "outsb",565,1 },
+    { "outsd",566,1 },
+    { "outsw",567,1 },
+    { "pabsb",568,1 },
+    { "pabsd",569,1 },
+    { "pabsw",570,1 },
+    { "packssdw",571,1 },
+    { "packsswb",572,1 },
+    { "packusdw",573,1 },
+    { "packuswb",574,1 },
+    { "paddb",575,1 },
+    { "paddd",576,1 },
+    { "paddq",577,1 },
+    { "paddsb",578,1 },
+    { "paddsw",579,1 },
+    { "paddusb",580,1 },
+    { "paddusw",581,1 },
+    { "paddw",582,1 },
+    { "palignr",583,1 },
+    { "pand",584,1 },
+    { "pandn",585,1 },
+    { "pause",586,1 },
+    { "pavgb",587,1 },
+    { "pavgw",588,1 },
+    { "pblendvb",589,1 },
+    { "pblendw",590,1 },
+    { "pcmpeqb",591,1 },
+    { "pcmpeqd",592,1 },
+    { "pcmpeqq",593,1 },
+    { "pcmpeqw",594,1 },
+    { "pcmpestri",595,1 },
+    { "pcmpestrm",596,1 },
+    { "pcmpgtb",597,1 },
+    { "pcmpgtd",598,1 },
+    { "pcmpgtq",599,1 },
+    { "pcmpgtw",600,1 },
+    { "pcmpistri",601,1 },
+    { "pcmpistrm",602,1 },
+    { "pextrb",603,1 },
+    { "pextrd",604,1 },
+    { "pextrq",605,1 },
+    { "pextrw",606,1 },
+    { "phaddd",607,1 },
+    { "phaddsw",608,1 },
+    { "phaddw",609,1 },
+    { "phminposuw",610,1 },
+    { "phsubd",611,1 },
+    { "phsubsw",612,1 },
+    { "phsubw",613,1 },
+    { "pinsrb",614,1 },
+    { "pinsrd",615,1 },
+    { "pinsrq",616,1 },
+    { "pinsrw",617,1 },
+    { "pmaddubsw",618,1 },
+    { "pmaddwd",619,1 },
+    { "pmaxsb",620,1 },
+    { "pmaxsd",621,1 },
+    { "pmaxsw",622,1 },
+    { "pmaxub",623,1 },
+    { "pmaxud",624,1 },
+    { "pmaxuw",625,1 },
+    { "pminsb",626,1 },
+    { "pminsd",627,1 },
+    { "pminsw",628,1 },
+    { "pminub",629,1 },
+    { "pminud",630,1 },
+    { "pminuw",631,1 },
+    { "pmovmskb",632,1 },
+    { "pmovsxbd",633,1 },
+    { "pmovsxbq",634,1 },
+    { "pmovsxbw",635,1 },
+    { "pmovsxdq",636,1 },
+    { "pmovsxwd",637,1 },
+    { "pmovsxwq",638,1 },
+    { "pmovzxbd",639,1 },
+    { "pmovzxbq",640,1 },
+    { "pmovzxbw",641,1 },
+    { "pmovzxdq",642,1 },
+    { "pmovzxwd",643,1 },
+    { "pmovzxwq",644,1 },
+    { "pmuldq",645,1 },
+    { "pmulhrsw",646,1 },
+    { "pmulhuw",647,1 },
+    { "pmulhw",648,1 },
+    { "pmulld",649,1 },
+    { "pmullw",650,1 },
+    { "pmuludq",651,1 },
+    { "pop",652,1 },
+    { "popa",653,1 },
+    { "popad",654,1 },
+    { "popcnt",655,1 },
+    { "popf",656,1 },
+    { "popfd",657,1 },
+    { "popfq",658,1 },
+    { "popq",659,1 },
+    { "por",660,1 },
+    { "prefetchnta",661,1 },
+    { "prefetcht0",662,1 },
+    { "prefetcht1",663,1 },
+    { "prefetcht2",664,1 },
+    { "psadbw",665,1 },
+    { "pshufb",666,1 },
+    { "pshufd",667,1 },
+    { "pshufhw",668,1 },
+    { "pshuflw",669,1 },
+    { "pshufw",670,1 },
+    { "psignb",671,1 },
+    { "psignd",672,1 },
+    { "psignw",673,1 },
+    { "pslld",674,1 },
+    { "pslldq",675,1 },
+    { "psllq",676,1 },
+    { "psllw",677,1 },
+    { "psrad",678,1 },
+    { "psraw",679,1 },
+    { "psrld",680,1 },
+    { "psrldq",681,1 },
+    { "psrlq",682,1 },
+    { "psrlw",683,1 },
+    { "psubb",684,1 },
+    { "psubd",685,1 },
+    { "psubq",686,1 },
+    { "psubsb",687,1 },
+    { "psubsw",688,1 },
+    { "psubusb",689,1 },
+    { "psubusw",690,1 },
+    { "psubw",691,1 },
+    { "ptest",692,1 },
+    { "punpckhbw",693,1 },
+    { "punpckhdq",694,1 },
+    { "punpckhqdq",695,1 },
+    { "punpckhwd",696,1 },
+    { "punpcklbw",697,1 },
+    { "punpckldq",698,1 },
+    { "punpcklqdq",699,1 },
+    { "punpcklwd",700,1 },
+    { "push",701,1 },
+    { "pusha",702,1 },
+    { "pushad",703,1 },
+    { "pushf",704,1 },
+    { "pushfd",705,1 },
+    { "pushfq",706,1 },
+    { "pushq",707,1 },
+    { "pxor",708,1 },
+    { "rcl",709,1 },
+    { "rcpps",710,1 },
+    { "rcpss",711,1 },
+    { "rcr",712,1 },
+    { "rdmsr",713,1 },
+    { "rdpmc",714,1 },
+    { "rdtsc",715,1 },
+    { "rdtscp",716,1 },
+    { "rep",717,1 },
+    { "repe",718,1 },
+    { "repne",719,1 },
+    { "repnz",720,1 },
+    { "repz",721,1 },
+    { "ret",722,1 },
+    { "retf",723,1 },
+    { "retn",724,1 },
+    { "retq",725,1 },
+    { "rex",726,1 },
+    { "rex.b",727,1 },
+    { "rex.r",728,1 },
+    { "rex.rb",729,1 },
+    { "rex.rx",730,1 },
+    { "rex.rxb",731,1 },
+    { "rex.w",732,1 },
+    { "rex.wb",733,1 },
+    { "rex.wr",734,1 },
+    { "rex.wrb",735,1 },
+    { "rex.wrx",736,1 },
+    { "rex.wrxb",737,1 },
+    { "rex.wx",738,1 },
+    { "rex.wxb",739,1 },
+    { "rex.x",740,1 },
+    { "rex.xb",741,1 },
+    { "rol",742,1 },
+    { "ror",743,1 },
+    { "roundpd",744,1 },
+    { "roundps",745,1 },
+    { "roundsd",746,1 },
+    { "roundss",747,1 },
+    { "rsm",748,1 },
+    { "rsqrtps",749,1 },
+    { "rsqrtss",750,1 },
+    { "sahf",751,1 },
+    { "sal",752,1 },
+    { "salc",753,1 },
+    { "sar",754,1 },
+    { "sarb",755,1 },
+    { "sarl",756,1 },
+    { "sarq",757,1 },
+    { "sarw",758,1 },
+    { "sbb",759,1 },
+    { "scas",760,1 },
+    { "scasb",761,1 },
+    { "scasd",762,1 },
+    { "scasq",763,1 },
+    { "scasw",764,1 },
+    { "seta",765,1 },
+    { "setae",766,1 },
+    { "setalc",767,1 },
+    { "setb",768,1 },
+    { "setbe",769,1 },
+    { "setc",770,1 },
+    { "sete",771,1 },
+    { "setg",772,1 },
+    { "setge",773,1 },
+    { "setl",774,1 },
+    { "setle",775,1 },
+    { "setna",776,1 },
+    { "setnae",777,1 },
+    { "setnb",778,1 },
+    { "setnbe",779,1 },
+    { "setnc",780,1 },
+    { "setne",781,1 },
+    { "setng",782,1 },
+    { "setnge",783,1 },
+    { "setnl",784,1 },
+    { "setnle",785,1 },
+    { "setno",786,1 },
+    { "setnp",787,1 },
+    { "setns",788,1 },
+    { "setnz",789,1 },
+    { "seto",790,1 },
+    { "setp",791,1 },
+    { "setpe",792,1 },
+    { "setpo",793,1 },
+    { "sets",794,1 },
+    { "setz",795,1 },
+    { "sfence",796,1 },
+    { "sgdt",797,1 },
+    { "shl",798,1 },
+    { "shlb",799,1 },
+    { "shld",800,1 },
+    { "shll",801,1 },
+    { "shlq",802,1 },
+    { "shlw",803,1 },
+    { "shr",804,1 },
+    { "shrb",805,1 },
+    { "shrd",806,1 },
+    { "shrl",807,1 },
+    { "shrq",808,1 },
+    { "shrw",809,1 },
+    { "shufpd",810,1 },
+    { "shufps",811,1 },
+    { "sidt",812,1 },
+    { "sldt",813,1 },
+    { "smsw",814,1 },
+    { "sqrtpd",815,1 },
+    { "sqrtps",816,1 },
+    { "sqrtsd",817,1 },
+    { "sqrtss",818,1 },
+    { "ss",819,1 },
+    { "stc",820,1 },
+    { "std",821,1 },
+    { "sti",822,1 },
+    { "stmxcsr",823,1 },
+    { "stos",824,1 },
+    { "stosb",825,1 },
+    { "stosd",826,1 },
+    { "stosq",827,1 },
+    { "stosw",828,1 },
+    { "str",829,1 },
+    { "sub",830,1 },
+    { "subb",831,1 },
+    { "subl",832,1 },
+    { "subpd",833,1 },
+    { "subps",834,1 },
+    { "subq",835,1 },
+    { "subsd",836,1 },
+    { "subss",837,1 },
+    { "subw",838,1 },
+    { "swapgs",839,1 },
+    { "syscall",840,1 },
+    { "sysenter",841,1 },
+    { "sysexit",842,1 },
+    { "sysret",843,1 },
+    { "taken",844,1 },
+    { "test",845,1 },
+    { "testb",846,1 },
+    { "testl",847,1 },
+    { "testq",848,1 },
+    { "testw",849,1 },
+    { "ucomisd",850,1 },
+    { "ucomiss",851,1 },
+    { "ud",852,1 },
+    { "ud2",853,1 },
+    { "unpckhpd",854,1 },
+    { "unpckhps",855,1 },
+    { "unpcklpd",856,1 },
+    { "unpcklps",857,1 },
+    { "verr",858,1 },
+    { "verw",859,1 },
+    { "vmcall",860,1 },
+    { "vmclear",861,1 },
+    { "vmlaunch",862,1 },
+    { "vmptrld",863,1 },
+    { "vmptrst",864,1 },
+    { "vmread",865,1 },
+    { "vmresume",866,1 },
+    { "vmwrite",867,1 },
+    { "vmxoff",868,1 },
+    { "vmxon",869,1 },
+    { "wait",870,1 },
+    { "wbinvd",871,1 },
+    { "wrmsr",872,1 },
+    { "xadd",873,1 },
+    { "xchg",874,1 },
+    { "xgetbv",875,1 },
+    { "xlat",876,1 },
+    { "xlatb",877,1 },
+    { "xor",878,1 },
+    { "xorb",879,1 },
+    { "xorl",880,1 },
+    { "xorpd",881,1 },
+    { "xorps",882,1 },
+    { "xorq",883,1 },
+    { "xorw",884,1 },
+    { "xrstor",885,1 },
+    { "xsave",886,1 },
+    { "xsetbv",887,1 },
 };
 
 int opcode_count = sizeof(opcodes) / sizeof(Opcode);
-int opcode_aliases_count = sizeof(opcode_aliases) / sizeof(OpcodeAlias);
\ No newline at end of file
+int opcode_aliases_count = sizeof(opcode_aliases) / sizeof(OpcodeAlias);
+int opcode_alias_groups_count = sizeof(opcode_alias_groups) / sizeof(OpcodeAliasGroup);
+
+// Perfect hash of opcode alias group names, see make_perfect_hash() in the generator
+#define OPCODE_ALIAS_HASH_SIZE    1024
+#define OPCODE_ALIAS_HASH_BUCKETS 256
+
+static short opcode_alias_hash_displacements[] = {
+    7, 1, 1, 12, 6, 6, 10, 5, 3, 1, 13, 7, 11, 3, 6, 24,
+    4, 11, 10, 10, 1, 2, 37, 1, 4, 1, 10, 3, 25, 17, 22, 19,
+    7, 2, 3, 2, 27, 15, 62, 29, 1, 11, 19, 2, 2, 1, 4, 5,
+    6, 15, 70, 1, 1, 2, 25, 0, 20, 4, 9, 2, 9, 23, 6, 1,
+    2, 2, 1, 2, 7, 1, 31, 1, 3, 47, 3, 2, 12, 25, 9, 25,
+    46, 6, 6, 3, 25, 12, 3, 3, 13, 8, 19, 1, 10, 6, 25, 2,
+    1, 27, 42, 4, 3, 6, 24, 15, 5, 1, 6, 1, 13, 49, 6, 15,
+    11, 0, 2, 20, 9, 12, 26, 17, 1, 43, 105, 2, 13, 9, 3, 56,
+    2, 2, 4, 4, 22, 100, 3, 14, 1, 1, 8, 19, 13, 15, 3, 2,
+    41, 3, 2, 18, 4, 70, 2, 8, 11, 10, 2, 25, 24, 23, 7, 1,
+    39, 1, 8, 65, 8, 1, 2, 4, 18, 22, 2, 2, 5, 76, 7, 11,
+    2, 1, 23, 5, 2, 32, 8, 11, 4, 49, 26, 7, 58, 5, 24, 14,
+    3, 28, 85, 3, 19, 17, 5, 6, 2, 4, 7, 9, 15, 9, 2, 2,
+    4, 10, 3, 4, 3, 6, 7, 5, 133, 5, 1, 21, 131, 135, 11, 9,
+    8, 1, 154, 10, 17, 10, 1, 7, 31, 12, 38, 6, 1, 24, 19, 50,
+    11, 2, 25, 43, 8, 0, 24, 133, 1, 61, 2, 68, 39, 36, 44, 1,
+};
+
+static short opcode_alias_hash_table[] = {
+    245, 740, 83, 769, 380, 591, 816, 136, 153, 324, 525, 314, 581, 423, -1, 661,
+    760, 253, -1, -1, 389, 378, 452, 157, 305, 80, -1, 484, 857, 833, -1, 827,
+    523, -1, 657, 384, -1, 3, 480, 541, 699, 854, 604, 461, 580, 377, 859, -1,
+    505, 436, 791, 303, 773, 571, 31, 232, 519, 641, 211, 95, 651, -1, 205, 227,
+    768, 537, 170, 558, 132, 623, 45, 315, 499, 160, -1, 165, -1, 617, 102, 605,
+    406, 883, 10, 707, 469, 299, 593, 531, 675, 39, 747, -1, 556, 545, 793, 336,
+    84, 875, 762, 776, 364, 345, -1, 877, 15, 223, 155, 828, 612, -1, 861, 785,
+    -1, -1, 247, 527, 70, 430, 767, 509, -1, 281, 179, 131, 321, 386, 653, 574,
+    200, 87, 357, 572, 711, 635, 79, 313, 75, 620, -1, 373, 63, -1, 451, 815,
+    724, 225, 727, -1, 426, -1, 249, 886, 739, 149, 21, 265, 799, 464, 814, 824,
+    264, 419, 786, 680, 551, 450, 873, 658, 448, 624, -1, -1, 382, 594, 659, 478,
+    183, 142, 603, -1, 583, 881, 212, 668, 812, 51, 867, 885, 557, 262, 130, 783,
+    801, 757, 732, 738, 36, 528, 174, 187, 524, 25, 126, 829, 876, -1, 182, 637,
+    351, 105, 855, 606, 140, 712, 705, 311, 392, 20, 7, 673, 586, 860, 437, 2,
+    375, 257, 69, 442, -1, 794, 553, 721, -1, 164, 6, -1, 224, 72, 652, 146,
+    479, 622, 555, -1, 500, -1, 842, 869, -1, 322, 92, 158, 863, 228, 151, 252,
+    852, 764, 549, -1, 683, 775, 4, 862, 498, 813, 561, 40, 62, 846, 798, 30,
+    807, 834, 215, 293, 851, 804, 291, 613, -1, 312, -1, 53, -1, 706, 667, -1,
+    42, 427, 240, 411, 587, 309, -1, -1, 114, 817, -1, 596, -1, 259, 650, -1,
+    682, 181, 832, -1, 569, 630, 463, 547, 656, 752, 229, 16, 17, 356, 676, 339,
+    323, 334, 648, 690, 839, 33, 254, 47, 150, 12, 358, 383, 616, 694, 761, 716,
+    376, 879, 169, 664, 286, 646, 241, 431, 141, 67, 261, 395, 11, 771, 735, 714,
+    -1, -1, 154, -1, 670, 348, 287, 542, 85, 415, 789, 689, 559, 148, 201, 185,
+    244, 878, 567, 129, 521, 22, 260, 54, 634, -1, 467, 332, 487, -1, 809, -1,
+    532, 420, 428, 359, -1, 766, 107, 86, 548, 517, 326, 400, -1, 390, 381, -1,
+    202, 37, 208, 492, 61, 691, -1, 416, 76, 167, 295, 544, 647, 145, 82, 818,
+    402, 125, 692, 288, 128, 306, -1, 115, -1, 337, 518, 666, 502, 340, 655, -1,
+    703, 49, -1, 424, 836, 238, -1, 64, -1, -1, 486, 564, 292, -1, 439, 748,
+    -1, 327, 726, -1, 763, 729, 214, 737, 850, 152, -1, 176, 599, 408, 329, 802,
+    728, 275, 546, 239, 284, 497, 226, 5, 248, 674, 704, 118, 575, 209, 684, -1,
+    538, 654, 371, 41, 618, 106, 717, 725, 296, 297, 9, -1, 343, -1, 465, 810,
+    412, 477, 388, 489, 743, 495, 44, 385, 640, -1, 756, 188, 139, 443, 819, 820,
+    304, 56, -1, 338, 662, 193, 175, 177, 391, 34, 135, 363, 568, 695, 758, 660,
+    99, 822, 251, 880, 788, -1, 702, 686, 217, 379, -1, 844, -1, 512, 429, 27,
+    231, 671, 52, 856, 781, 397, 282, 516, 792, 213, 207, 619, 199, 171, 821, 441,
+    755, 101, 577, 331, -1, 482, 354, 687, 602, -1, 474, 552, 163, 414, 685, 811,
+    485, 864, -1, 458, 349, 865, 283, 744, 123, 774, 353, -1, 168, 782, 361, 539,
+    300, 78, -1, 310, -1, 579, 636, 396, 320, -1, 508, -1, 116, 352, 759, 144,
+    566, 109, 778, 639, 302, -1, 751, 134, 796, -1, -1, 218, 124, 853, 723, 317,
+    -1, -1, 393, 493, 730, 632, 515, 779, -1, 91, 127, -1, 540, 403, 697, 649,
+    285, -1, 269, 459, 422, 522, -1, 335, 206, 468, 266, 307, 235, 837, 263, 28,
+    611, 194, 884, 678, 255, 584, 868, 501, 872, 173, 81, 621, 184, -1, 119, 449,
+    342, 720, 808, 446, 369, 626, 598, 366, 866, 607, 18, 784, 642, 589, 360, 258,
+    433, 627, 823, 841, -1, 510, 608, -1, 506, 294, 601, 94, -1, 663, 514, -1,
+    679, 713, 688, 440, 535, 496, 560, 410, 530, 554, 800, 243, -1, 838, 710, 256,
+    734, 407, -1, 582, 614, 367, 681, 190, -1, 298, 147, 65, 122, 490, -1, 192,
+    55, 845, 746, 578, 220, 831, 754, 333, 615, 24, 722, 454, 534, 633, 457, 736,
+    526, 835, 445, -1, 104, -1, 120, 276, 197, 26, 103, 280, -1, 570, 718, 742,
+    595, 849, 110, 29, 401, 590, 308, 14, 874, -1, -1, 843, 372, 470, 750, 787,
+    -1, -1, 520, 840, 178, -1, 629, 230, 643, -1, -1, 741, 701, 137, 610, 290,
+    -1, 66, 374, 325, 370, 35, 368, 609, -1, 271, 826, 88, 133, 108, -1, 677,
+    19, 772, 709, 592, 405, -1, 882, 347, 73, 806, 273, 8, -1, 221, 696, 278,
+    488, 203, 576, 1, 279, 399, 71, 447, 204, 847, 483, 745, 198, 472, 191, 387,
+    117, -1, 453, -1, 790, 330, 344, 513, 573, 803, 189, -1, 74, 246, 777, 563,
+    -1, 628, 700, 644, 434, 219, 50, -1, 172, 89, 665, 462, 250, 645, 274, 494,
+    68, 57, 350, 195, 100, -1, -1, 625, 417, 77, 693, -1, 268, 672, 543, -1,
+    715, 161, 435, 511, 112, 289, 473, 404, 93, -1, 143, 121, 237, 180, 267, 795,
+    409, 233, 733, 529, 60, 341, 765, 491, 59, 216, 362, 365, 277, 444, 536, 355,
+    398, 456, 96, 38, 98, -1, -1, 156, 770, 319, 753, 669, -1, -1, 780, 236,
+    0, -1, -1, 90, -1, 597, 413, 825, 858, 562, -1, 438, 481, 503, 871, 631,
+    418, 830, 166, 272, 13, 455, 46, 159, 475, 113, -1, 23, 196, -1, 638, 848,
+    504, 805, -1, 111, 301, 210, -1, 476, -1, 731, -1, 507, 550, 48, 719, 533,
+    421, 43, 425, 316, 708, 234, 138, 58, 588, 749, 870, 270, 460, 466, 797, 346,
+    328, 432, 471, 242, 394, 698, 186, 318, 222, 600, 97, 32, 585, 162, -1, 565,
+};
+
+// Seeded FNV-1a hash
+static unsigned int opcode_alias_hash(unsigned int seed, char *name, int length) {
+    unsigned int result = 2166136261u ^ seed;
+    for (int i = 0; i < length; i++) result = (result ^ (unsigned char) name[i]) * 16777619u;
+    return result;
+}
+
+// Look up an opcode alias group by name. Returns -1 if not found.
+int lookup_opcode_alias_group(char *name, int length) {
+    int displacement = opcode_alias_hash_displacements[opcode_alias_hash(0, name, length) % OPCODE_ALIAS_HASH_BUCKETS];
+    int index = opcode_alias_hash_table[opcode_alias_hash(displacement, name, length) % OPCODE_ALIAS_HASH_SIZE];
+    if (index == -1) return -1;
+
+    char *group_name = opcode_alias_groups[index].name;
+    if (strncmp(group_name, name, length) || group_name[length]) return -1;
+
+    return index;
+}
+
+#define IS_REGISTER(op) (OP_TYPE_IS_REG(op) && !(op)->indirect)
+#define IS_XMM_REGISTER(op) (OP_TYPE_IS_XMM(op) && !(op)->indirect)
+#define IS_RELATIVE(op) (OP_TYPE_IS_MEM(op) && !(op)->indirect)
+
+// Add a little endian value of size bytes
+static uint8_t *encode_value(uint8_t *data, long value, int size) {
+    memcpy(data, &value, size);
+    return data + size;
+}
+
+// Specialised encoders for opcodes with register, immediate or relative operands.
+// See make_opcode_encoder() in the generator.
+
+// add Gb, Eb
+static int encode_opcode_0(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op1->reg;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x00;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// add Gvqp, Evqp
+static int encode_opcode_1(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op1->reg;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x01;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// add Eb, Gb
+static int encode_opcode_2(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x02;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// add Evqp, Gvqp
+static int encode_opcode_3(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x03;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// add Ib, b
+static int encode_opcode_4(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x04;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// add Ivds, vqp
+static int encode_opcode_5(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x05;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = (size == SIZE64 ? SIZE32 : size);
+    data = encode_value(data, op1->imm_or_mem_value, (size == SIZE64 ? SIZE32 : size));
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// or Gb, Eb
+static int encode_opcode_6(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op1->reg;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x08;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// or Gvqp, Evqp
+static int encode_opcode_7(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op1->reg;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x09;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// or Eb, Gb
+static int encode_opcode_8(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0a;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// or Evqp, Gvqp
+static int encode_opcode_9(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0b;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// or Ib, b
+static int encode_opcode_10(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0c;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// or Ivds, vqp
+static int encode_opcode_11(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0d;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = (size == SIZE64 ? SIZE32 : size);
+    data = encode_value(data, op1->imm_or_mem_value, (size == SIZE64 ? SIZE32 : size));
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// pop
+static int encode_opcode_12(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// adc Gb, Eb
+static int encode_opcode_13(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op1->reg;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x10;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// adc Gvqp, Evqp
+static int encode_opcode_14(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op1->reg;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x11;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// adc Eb, Gb
+static int encode_opcode_15(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x12;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// adc Evqp, Gvqp
+static int encode_opcode_16(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x13;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// adc Ib, b
+static int encode_opcode_17(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x14;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// adc Ivds, vqp
+static int encode_opcode_18(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x15;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = (size == SIZE64 ? SIZE32 : size);
+    data = encode_value(data, op1->imm_or_mem_value, (size == SIZE64 ? SIZE32 : size));
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// sbb Gb, Eb
+static int encode_opcode_19(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op1->reg;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x18;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// sbb Gvqp, Evqp
+static int encode_opcode_20(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op1->reg;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x19;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// sbb Eb, Gb
+static int encode_opcode_21(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x1a;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// sbb Evqp, Gvqp
+static int encode_opcode_22(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x1b;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// sbb Ib, b
+static int encode_opcode_23(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x1c;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// sbb Ivds, vqp
+static int encode_opcode_24(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x1d;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = (size == SIZE64 ? SIZE32 : size);
+    data = encode_value(data, op1->imm_or_mem_value, (size == SIZE64 ? SIZE32 : size));
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// and Gb, Eb
+static int encode_opcode_25(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op1->reg;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x20;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// and Gvqp, Evqp
+static int encode_opcode_26(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op1->reg;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x21;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// and Eb, Gb
+static int encode_opcode_27(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x22;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// and Evqp, Gvqp
+static int encode_opcode_28(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x23;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// and Ib, b
+static int encode_opcode_29(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x24;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// and Ivds, vqp
+static int encode_opcode_30(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x25;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = (size == SIZE64 ? SIZE32 : size);
+    data = encode_value(data, op1->imm_or_mem_value, (size == SIZE64 ? SIZE32 : size));
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// es
+static int encode_opcode_31(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x26;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// sub Gb, Eb
+static int encode_opcode_32(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op1->reg;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x28;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// sub Gvqp, Evqp
+static int encode_opcode_33(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op1->reg;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x29;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// sub Eb, Gb
+static int encode_opcode_34(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x2a;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// sub Evqp, Gvqp
+static int encode_opcode_35(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x2b;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// sub Ib, b
+static int encode_opcode_36(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x2c;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// sub Ivds, vqp
+static int encode_opcode_37(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x2d;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = (size == SIZE64 ? SIZE32 : size);
+    data = encode_value(data, op1->imm_or_mem_value, (size == SIZE64 ? SIZE32 : size));
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cs
+static int encode_opcode_38(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x2e;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// ntaken
+static int encode_opcode_39(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x2e;
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// xor Gb, Eb
+static int encode_opcode_40(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op1->reg;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x30;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// xor Gvqp, Evqp
+static int encode_opcode_41(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op1->reg;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x31;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// xor Eb, Gb
+static int encode_opcode_42(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x32;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// xor Evqp, Gvqp
+static int encode_opcode_43(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x33;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// xor Ib, b
+static int encode_opcode_44(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x34;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// xor Ivds, vqp
+static int encode_opcode_45(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x35;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = (size == SIZE64 ? SIZE32 : size);
+    data = encode_value(data, op1->imm_or_mem_value, (size == SIZE64 ? SIZE32 : size));
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// ss
+static int encode_opcode_46(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x36;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cmp Gb, Eb
+static int encode_opcode_47(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op1->reg;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x38;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cmp Gvqp, Evqp
+static int encode_opcode_48(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op1->reg;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x39;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cmp Eb, Gb
+static int encode_opcode_49(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x3a;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cmp Evqp, Gvqp
+static int encode_opcode_50(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x3b;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cmp Ib, b
+static int encode_opcode_51(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x3c;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cmp Ivds, vqp
+static int encode_opcode_52(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x3d;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = (size == SIZE64 ? SIZE32 : size);
+    data = encode_value(data, op1->imm_or_mem_value, (size == SIZE64 ? SIZE32 : size));
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// ds
+static int encode_opcode_53(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x3e;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// taken
+static int encode_opcode_54(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x3e;
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// inc Zv
+static int encode_opcode_55(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 0;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || rm >= 8) *data++ = 0x40 | 0 | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x40 + (op1->reg & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// rex
+static int encode_opcode_56(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x40;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// rex.b
+static int encode_opcode_57(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x41;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// rex.x
+static int encode_opcode_58(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x42;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// rex.xb
+static int encode_opcode_59(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x43;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// rex.r
+static int encode_opcode_60(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x44;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// rex.rb
+static int encode_opcode_61(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x45;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// rex.rx
+static int encode_opcode_62(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x46;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// rex.rxb
+static int encode_opcode_63(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x47;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// dec Zv
+static int encode_opcode_64(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 0;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || rm >= 8) *data++ = 0x40 | 0 | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x48 + (op1->reg & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// rex.w
+static int encode_opcode_65(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x48;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// rex.wb
+static int encode_opcode_66(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x49;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// rex.wx
+static int encode_opcode_67(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x4a;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// rex.wxb
+static int encode_opcode_68(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x4b;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// rex.wr
+static int encode_opcode_69(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x4c;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// rex.wrb
+static int encode_opcode_70(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x4d;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// rex.wrx
+static int encode_opcode_71(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x4e;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// rex.wrxb
+static int encode_opcode_72(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x4f;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// push Zv
+static int encode_opcode_73(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 0;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (rm >= 8) *data++ = 0x40 | 0 | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x50 + (op1->reg & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// push Zvq
+static int encode_opcode_74(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 0;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (rm >= 8) *data++ = 0x40 | 0 | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x50 + (op1->reg & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// pop Zv
+static int encode_opcode_75(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 0;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || rm >= 8) *data++ = 0x40 | 0 | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x58 + (op1->reg & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// pop Zvq
+static int encode_opcode_76(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 0;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || rm >= 8) *data++ = 0x40 | 0 | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x58 + (op1->reg & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// arpl Gw, Ew
+static int encode_opcode_77(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op1->reg;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x63;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// movsxd Ed, Gdqp
+static int encode_opcode_78(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x63;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// fs
+static int encode_opcode_79(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x64;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// alter
+static int encode_opcode_80(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x64;
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// gs
+static int encode_opcode_81(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x65;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// push Ivs
+static int encode_opcode_82(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x68;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = (size == SIZE64 ? SIZE32 : size);
+    data = encode_value(data, op1->imm_or_mem_value, (size == SIZE64 ? SIZE32 : size));
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// imul Ivds, Evqp, Gvqp
+static int encode_opcode_83(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2) && IS_REGISTER(op3))) return 0;
+
+    int reg = op3->reg;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || OP_TYPE_IS_ALT_8BIT(op3) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x69;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = (size == SIZE64 ? SIZE32 : size);
+    data = encode_value(data, op1->imm_or_mem_value, (size == SIZE64 ? SIZE32 : size));
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// push Ibss
+static int encode_opcode_84(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x6a;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// imul Ibs, Evqp, Gvqp
+static int encode_opcode_85(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2) && IS_REGISTER(op3))) return 0;
+
+    int reg = op3->reg;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || OP_TYPE_IS_ALT_8BIT(op3) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x6b;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// ins w
+static int encode_opcode_86(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x6c;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// insb
+static int encode_opcode_87(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x6c;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// insw
+static int encode_opcode_88(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x6d;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// ins w
+static int encode_opcode_89(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1)) *data++ = 0x40 | 0 | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x6d;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// insd
+static int encode_opcode_90(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x6d;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// outs b
+static int encode_opcode_91(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x6e;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// outsb
+static int encode_opcode_92(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x6e;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// outsw
+static int encode_opcode_93(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x6f;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// outs v
+static int encode_opcode_94(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1)) *data++ = 0x40 | 0 | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x6f;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// outsd
+static int encode_opcode_95(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x6f;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// jo Jbs
+static int encode_opcode_96(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x70;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, 0, SIZE08);
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// jno Jbs
+static int encode_opcode_97(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x71;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, 0, SIZE08);
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// jb Jbs
+static int encode_opcode_98(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x72;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, 0, SIZE08);
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// jnae Jbs
+static int encode_opcode_99(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x72;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, 0, SIZE08);
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// jc Jbs
+static int encode_opcode_100(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x72;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, 0, SIZE08);
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// jnb Jbs
+static int encode_opcode_101(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x73;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, 0, SIZE08);
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// jae Jbs
+static int encode_opcode_102(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x73;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, 0, SIZE08);
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// jnc Jbs
+static int encode_opcode_103(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x73;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, 0, SIZE08);
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// jz Jbs
+static int encode_opcode_104(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x74;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, 0, SIZE08);
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// je Jbs
+static int encode_opcode_105(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x74;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, 0, SIZE08);
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// jnz Jbs
+static int encode_opcode_106(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x75;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, 0, SIZE08);
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// jne Jbs
+static int encode_opcode_107(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x75;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, 0, SIZE08);
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// jbe Jbs
+static int encode_opcode_108(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x76;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, 0, SIZE08);
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// jna Jbs
+static int encode_opcode_109(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x76;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, 0, SIZE08);
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// jnbe Jbs
+static int encode_opcode_110(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x77;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, 0, SIZE08);
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// ja Jbs
+static int encode_opcode_111(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x77;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, 0, SIZE08);
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// js Jbs
+static int encode_opcode_112(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x78;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, 0, SIZE08);
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// jns Jbs
+static int encode_opcode_113(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x79;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, 0, SIZE08);
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// jp Jbs
+static int encode_opcode_114(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x7a;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, 0, SIZE08);
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// jpe Jbs
+static int encode_opcode_115(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x7a;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, 0, SIZE08);
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// jnp Jbs
+static int encode_opcode_116(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x7b;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, 0, SIZE08);
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// jpo Jbs
+static int encode_opcode_117(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x7b;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, 0, SIZE08);
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// jl Jbs
+static int encode_opcode_118(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x7c;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, 0, SIZE08);
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// jnge Jbs
+static int encode_opcode_119(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x7c;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, 0, SIZE08);
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// jnl Jbs
+static int encode_opcode_120(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x7d;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, 0, SIZE08);
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// jge Jbs
+static int encode_opcode_121(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x7d;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, 0, SIZE08);
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// jle Jbs
+static int encode_opcode_122(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x7e;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, 0, SIZE08);
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// jng Jbs
+static int encode_opcode_123(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x7e;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, 0, SIZE08);
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// jnle Jbs
+static int encode_opcode_124(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x7f;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, 0, SIZE08);
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// jg Jbs
+static int encode_opcode_125(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x7f;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, 0, SIZE08);
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// add Ib, Eb
+static int encode_opcode_126(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 0;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x80;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// or Ib, Eb
+static int encode_opcode_127(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 1;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x80;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// adc Ib, Eb
+static int encode_opcode_128(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 2;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x80;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// sbb Ib, Eb
+static int encode_opcode_129(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 3;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x80;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// and Ib, Eb
+static int encode_opcode_130(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 4;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x80;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// sub Ib, Eb
+static int encode_opcode_131(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 5;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x80;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// xor Ib, Eb
+static int encode_opcode_132(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 6;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x80;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cmp Ib, Eb
+static int encode_opcode_133(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 7;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x80;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// add Ivds, Evqp
+static int encode_opcode_134(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 0;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x81;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = (size == SIZE64 ? SIZE32 : size);
+    data = encode_value(data, op1->imm_or_mem_value, (size == SIZE64 ? SIZE32 : size));
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// or Ivds, Evqp
+static int encode_opcode_135(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 1;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x81;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = (size == SIZE64 ? SIZE32 : size);
+    data = encode_value(data, op1->imm_or_mem_value, (size == SIZE64 ? SIZE32 : size));
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// adc Ivds, Evqp
+static int encode_opcode_136(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 2;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x81;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = (size == SIZE64 ? SIZE32 : size);
+    data = encode_value(data, op1->imm_or_mem_value, (size == SIZE64 ? SIZE32 : size));
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// sbb Ivds, Evqp
+static int encode_opcode_137(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 3;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x81;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = (size == SIZE64 ? SIZE32 : size);
+    data = encode_value(data, op1->imm_or_mem_value, (size == SIZE64 ? SIZE32 : size));
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// and Ivds, Evqp
+static int encode_opcode_138(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 4;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x81;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = (size == SIZE64 ? SIZE32 : size);
+    data = encode_value(data, op1->imm_or_mem_value, (size == SIZE64 ? SIZE32 : size));
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// sub Ivds, Evqp
+static int encode_opcode_139(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 5;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x81;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = (size == SIZE64 ? SIZE32 : size);
+    data = encode_value(data, op1->imm_or_mem_value, (size == SIZE64 ? SIZE32 : size));
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// xor Ivds, Evqp
+static int encode_opcode_140(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 6;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x81;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = (size == SIZE64 ? SIZE32 : size);
+    data = encode_value(data, op1->imm_or_mem_value, (size == SIZE64 ? SIZE32 : size));
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cmp Ivds, Evqp
+static int encode_opcode_141(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 7;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x81;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = (size == SIZE64 ? SIZE32 : size);
+    data = encode_value(data, op1->imm_or_mem_value, (size == SIZE64 ? SIZE32 : size));
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// add Ibs, Evqp
+static int encode_opcode_142(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 0;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x83;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// or Ibs, Evqp
+static int encode_opcode_143(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 1;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x83;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// adc Ibs, Evqp
+static int encode_opcode_144(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 2;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x83;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// sbb Ibs, Evqp
+static int encode_opcode_145(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 3;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x83;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// and Ibs, Evqp
+static int encode_opcode_146(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 4;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x83;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// sub Ibs, Evqp
+static int encode_opcode_147(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 5;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x83;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// xor Ibs, Evqp
+static int encode_opcode_148(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 6;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x83;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cmp Ibs, Evqp
+static int encode_opcode_149(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 7;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x83;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// test Gb, Eb
+static int encode_opcode_150(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op1->reg;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x84;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// test Gvqp, Evqp
+static int encode_opcode_151(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op1->reg;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x85;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// mov Gb, Eb
+static int encode_opcode_152(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op1->reg;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x88;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// mov Gvqp, Evqp
+static int encode_opcode_153(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op1->reg;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x89;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// mov Eb, Gb
+static int encode_opcode_154(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x8a;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// mov Evqp, Gvqp
+static int encode_opcode_155(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x8b;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// pop Ev
+static int encode_opcode_157(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 0;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || rm >= 8) *data++ = 0x40 | 0 | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x8f;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// pop Evq
+static int encode_opcode_158(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 0;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || rm >= 8) *data++ = 0x40 | 0 | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x8f;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// nop
+static int encode_opcode_159(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x90;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// nop
+static int encode_opcode_160(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0xf3;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x90;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// pause
+static int encode_opcode_161(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0xf3;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x90;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cbw
+static int encode_opcode_162(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x98;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cwde
+static int encode_opcode_163(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x98;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cbw
+static int encode_opcode_164(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x98;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cwde
+static int encode_opcode_165(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x98;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cdqe
+static int encode_opcode_166(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x98;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cwd
+static int encode_opcode_167(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x99;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cdq
+static int encode_opcode_168(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x99;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cwd
+static int encode_opcode_169(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x99;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cdq
+static int encode_opcode_170(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x99;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cqo
+static int encode_opcode_171(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x99;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// pushf
+static int encode_opcode_174(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x9c;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// pushfd
+static int encode_opcode_175(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x9c;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// pushf
+static int encode_opcode_176(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x9c;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// pushfq
+static int encode_opcode_177(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x9c;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// popf
+static int encode_opcode_178(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x9d;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// popfd
+static int encode_opcode_179(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x9d;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// popf
+static int encode_opcode_180(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x9d;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// popfq
+static int encode_opcode_181(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x9d;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// sahf
+static int encode_opcode_182(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x9e;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// lahf
+static int encode_opcode_183(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x9f;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// movs
+static int encode_opcode_184(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xa4;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// movsb
+static int encode_opcode_185(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xa4;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// movsw
+static int encode_opcode_186(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xa5;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// movs
+static int encode_opcode_187(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0xa5;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// movsd
+static int encode_opcode_188(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xa5;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// movs
+static int encode_opcode_189(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xa5;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// movsw
+static int encode_opcode_190(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xa5;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// movsd
+static int encode_opcode_191(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xa5;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// movsq
+static int encode_opcode_192(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xa5;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cmps
+static int encode_opcode_193(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xa6;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cmpsb
+static int encode_opcode_194(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xa6;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cmpsw
+static int encode_opcode_195(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xa7;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cmps
+static int encode_opcode_196(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0xa7;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cmpsd
+static int encode_opcode_197(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xa7;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cmps
+static int encode_opcode_198(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xa7;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cmpsw
+static int encode_opcode_199(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xa7;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cmpsd
+static int encode_opcode_200(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xa7;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cmpsq
+static int encode_opcode_201(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xa7;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// test Ib, b
+static int encode_opcode_202(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xa8;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// test Ivds, vqp
+static int encode_opcode_203(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xa9;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = (size == SIZE64 ? SIZE32 : size);
+    data = encode_value(data, op1->imm_or_mem_value, (size == SIZE64 ? SIZE32 : size));
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// stos
+static int encode_opcode_204(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xaa;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// stosb
+static int encode_opcode_205(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xaa;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// stosw
+static int encode_opcode_206(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xab;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// stos
+static int encode_opcode_207(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0xab;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// stosd
+static int encode_opcode_208(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xab;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// stos
+static int encode_opcode_209(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xab;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// stosw
+static int encode_opcode_210(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xab;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// stosd
+static int encode_opcode_211(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xab;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// stosq
+static int encode_opcode_212(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xab;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// lods
+static int encode_opcode_213(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xac;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// lodsb
+static int encode_opcode_214(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xac;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// lodsw
+static int encode_opcode_215(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xad;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// lods
+static int encode_opcode_216(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0xad;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// lodsd
+static int encode_opcode_217(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xad;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// lods
+static int encode_opcode_218(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xad;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// lodsw
+static int encode_opcode_219(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xad;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// lodsd
+static int encode_opcode_220(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xad;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// lodsq
+static int encode_opcode_221(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xad;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// scas
+static int encode_opcode_222(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xae;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// scasb
+static int encode_opcode_223(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xae;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// scasw
+static int encode_opcode_224(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xaf;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// scas
+static int encode_opcode_225(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0xaf;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// scasd
+static int encode_opcode_226(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xaf;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// scas
+static int encode_opcode_227(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xaf;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// scasw
+static int encode_opcode_228(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xaf;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// scasd
+static int encode_opcode_229(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xaf;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// scasq
+static int encode_opcode_230(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xaf;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// mov Ib, Zb
+static int encode_opcode_231(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 0;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xb0 + (op2->reg & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// mov Ivqp, Zvqp
+static int encode_opcode_232(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 0;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xb8 + (op2->reg & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = size;
+    data = encode_value(data, op1->imm_or_mem_value, size);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// rol Ib, Eb
+static int encode_opcode_233(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 0;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xc0;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// ror Ib, Eb
+static int encode_opcode_234(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 1;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xc0;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// rcl Ib, Eb
+static int encode_opcode_235(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 2;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xc0;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// rcr Ib, Eb
+static int encode_opcode_236(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 3;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xc0;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// shl Ib, Eb
+static int encode_opcode_237(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 4;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xc0;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// sal Ib, Eb
+static int encode_opcode_238(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 4;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xc0;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// shr Ib, Eb
+static int encode_opcode_239(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 5;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xc0;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// sal Ib, Eb
+static int encode_opcode_240(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 6;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xc0;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// shl Ib, Eb
+static int encode_opcode_241(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 6;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xc0;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// sar Ib, Eb
+static int encode_opcode_242(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 7;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xc0;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// rol Ib, Evqp
+static int encode_opcode_243(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 0;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xc1;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// ror Ib, Evqp
+static int encode_opcode_244(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 1;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xc1;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// rcl Ib, Evqp
+static int encode_opcode_245(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 2;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xc1;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// rcr Ib, Evqp
+static int encode_opcode_246(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 3;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xc1;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// shl Ib, Evqp
+static int encode_opcode_247(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 4;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xc1;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// sal Ib, Evqp
+static int encode_opcode_248(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 4;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xc1;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// shr Ib, Evqp
+static int encode_opcode_249(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 5;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xc1;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// sal Ib, Evqp
+static int encode_opcode_250(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 6;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xc1;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// shl Ib, Evqp
+static int encode_opcode_251(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 6;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xc1;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// sar Ib, Evqp
+static int encode_opcode_252(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 7;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xc1;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// retn Iw
+static int encode_opcode_253(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0xc2;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = (size == SIZE64 ? SIZE32 : size);
+    data = encode_value(data, 0, (size == SIZE64 ? SIZE32 : size));
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// retn
+static int encode_opcode_254(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0xc3;
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// mov Ib, Eb
+static int encode_opcode_255(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 0;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xc6;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// mov Ivds, Evqp
+static int encode_opcode_256(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 0;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xc7;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = (size == SIZE64 ? SIZE32 : size);
+    data = encode_value(data, op1->imm_or_mem_value, (size == SIZE64 ? SIZE32 : size));
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// leave
+static int encode_opcode_259(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xc9;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// leave
+static int encode_opcode_260(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xc9;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// retf Iw
+static int encode_opcode_261(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0xca;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = (size == SIZE64 ? SIZE32 : size);
+    data = encode_value(data, 0, (size == SIZE64 ? SIZE32 : size));
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// retf
+static int encode_opcode_262(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0xcb;
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// int Ib
+static int encode_opcode_264(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1))) return 0;
+
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xcd;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// into
+static int encode_opcode_265(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xce;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// iret
+static int encode_opcode_266(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xcf;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// iretd
+static int encode_opcode_267(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xcf;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// iret
+static int encode_opcode_268(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xcf;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// iretd
+static int encode_opcode_269(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xcf;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// iretq
+static int encode_opcode_270(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xcf;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// rol b, Eb
+static int encode_opcode_291(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 0;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xd2;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// ror b, Eb
+static int encode_opcode_292(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 1;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xd2;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// rcl b, Eb
+static int encode_opcode_293(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 2;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xd2;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// rcr b, Eb
+static int encode_opcode_294(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 3;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xd2;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// shl b, Eb
+static int encode_opcode_295(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 4;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xd2;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// sal b, Eb
+static int encode_opcode_296(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 4;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xd2;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// shr b, Eb
+static int encode_opcode_297(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 5;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xd2;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// sal b, Eb
+static int encode_opcode_298(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 6;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xd2;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// shl b, Eb
+static int encode_opcode_299(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 6;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xd2;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// sar b, Eb
+static int encode_opcode_300(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 7;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xd2;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// rol b, Evqp
+static int encode_opcode_301(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 0;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xd3;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// ror b, Evqp
+static int encode_opcode_302(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 1;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xd3;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// rcl b, Evqp
+static int encode_opcode_303(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 2;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xd3;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// rcr b, Evqp
+static int encode_opcode_304(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 3;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xd3;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// shl b, Evqp
+static int encode_opcode_305(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 4;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xd3;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// sal b, Evqp
+static int encode_opcode_306(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 4;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xd3;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// shr b, Evqp
+static int encode_opcode_307(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 5;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xd3;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// sal b, Evqp
+static int encode_opcode_308(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 6;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xd3;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// shl b, Evqp
+static int encode_opcode_309(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 6;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xd3;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// sar b, Evqp
+static int encode_opcode_310(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 7;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xd3;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// xlat
+static int encode_opcode_311(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xd7;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// xlatb
+static int encode_opcode_312(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xd7;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// fneni
+static int encode_opcode_390(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xdb;
+    *data++ = 0xe0;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// fndisi
+static int encode_opcode_393(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xdb;
+    *data++ = 0xe1;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// fnsetpm
+static int encode_opcode_400(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xdb;
+    *data++ = 0xe4;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// loopnz Jbs
+static int encode_opcode_478(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0xe0;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, 0, SIZE08);
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// loopne Jbs
+static int encode_opcode_479(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0xe0;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, 0, SIZE08);
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// loopnz Jbs
+static int encode_opcode_480(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0xe0;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, 0, SIZE08);
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// loopne Jbs
+static int encode_opcode_481(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0xe0;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, 0, SIZE08);
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// loopz Jbs
+static int encode_opcode_482(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0xe1;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, 0, SIZE08);
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// loope Jbs
+static int encode_opcode_483(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0xe1;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, 0, SIZE08);
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// loopz Jbs
+static int encode_opcode_484(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0xe1;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, 0, SIZE08);
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// loope Jbs
+static int encode_opcode_485(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0xe1;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, 0, SIZE08);
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// loop Jbs
+static int encode_opcode_486(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0xe2;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, 0, SIZE08);
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// loop Jbs
+static int encode_opcode_487(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0xe2;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, 0, SIZE08);
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// jcxz Jbs
+static int encode_opcode_488(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0xe3;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, 0, SIZE08);
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// jecxz Jbs
+static int encode_opcode_489(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0xe3;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, 0, SIZE08);
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// jecxz Jbs
+static int encode_opcode_490(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0xe3;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, 0, SIZE08);
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// jrcxz Jbs
+static int encode_opcode_491(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0xe3;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, 0, SIZE08);
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// in Ib, b
+static int encode_opcode_492(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xe4;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// in Ib, v
+static int encode_opcode_493(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2)) *data++ = 0x40 | 0 | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xe5;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// out b, Ib
+static int encode_opcode_494(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && OP_TYPE_IS_IMM(op2))) return 0;
+
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xe6;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op2->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// out v, Ib
+static int encode_opcode_495(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && OP_TYPE_IS_IMM(op2))) return 0;
+
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1)) *data++ = 0x40 | 0 | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xe7;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op2->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// call Jvds
+static int encode_opcode_496(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0xe8;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = (size == SIZE64 ? SIZE32 : size);
+    data = encode_value(data, 0, (size == SIZE64 ? SIZE32 : size));
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// jmp Jvds
+static int encode_opcode_497(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0xe9;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = (size == SIZE64 ? SIZE32 : size);
+    data = encode_value(data, 0, (size == SIZE64 ? SIZE32 : size));
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// jmp Jbs
+static int encode_opcode_498(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0xeb;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, 0, SIZE08);
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// in w, b
+static int encode_opcode_499(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xec;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// in w, v
+static int encode_opcode_500(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2)) *data++ = 0x40 | 0 | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xed;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// out b, w
+static int encode_opcode_501(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xee;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// out v, w
+static int encode_opcode_502(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2)) *data++ = 0x40 | 0 | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xef;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// lock
+static int encode_opcode_503(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xf0;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// int1
+static int encode_opcode_504(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xf1;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// icebp
+static int encode_opcode_505(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xf1;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// repnz
+static int encode_opcode_506(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xf2;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// repne
+static int encode_opcode_507(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xf2;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// rep
+static int encode_opcode_508(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xf2;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// repnz
+static int encode_opcode_509(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xf2;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// repne
+static int encode_opcode_510(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xf2;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// rep
+static int encode_opcode_511(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xf2;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// repz
+static int encode_opcode_512(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xf3;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// repe
+static int encode_opcode_513(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xf3;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// rep
+static int encode_opcode_514(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xf3;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// repz
+static int encode_opcode_515(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xf3;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// repe
+static int encode_opcode_516(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xf3;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// rep
+static int encode_opcode_517(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xf3;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// hlt
+static int encode_opcode_518(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xf4;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cmc
+static int encode_opcode_519(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xf5;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// test Ib, Eb
+static int encode_opcode_520(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 0;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xf6;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// test Ib, Eb
+static int encode_opcode_521(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 1;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xf6;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// not Eb
+static int encode_opcode_522(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 2;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xf6;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// neg Eb
+static int encode_opcode_523(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 3;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xf6;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// mul Eb
+static int encode_opcode_524(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 4;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xf6;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// imul Eb
+static int encode_opcode_525(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 5;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xf6;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// div Eb
+static int encode_opcode_526(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 6;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xf6;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// idiv Eb
+static int encode_opcode_527(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 7;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xf6;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// test Ivds, Evqp
+static int encode_opcode_528(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 0;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xf7;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = (size == SIZE64 ? SIZE32 : size);
+    data = encode_value(data, op1->imm_or_mem_value, (size == SIZE64 ? SIZE32 : size));
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// test Ivds, Evqp
+static int encode_opcode_529(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 1;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xf7;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = (size == SIZE64 ? SIZE32 : size);
+    data = encode_value(data, op1->imm_or_mem_value, (size == SIZE64 ? SIZE32 : size));
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// not Evqp
+static int encode_opcode_530(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 2;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xf7;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// neg Evqp
+static int encode_opcode_531(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 3;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xf7;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// mul Evqp
+static int encode_opcode_532(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 4;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xf7;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// imul Evqp
+static int encode_opcode_533(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 5;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xf7;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// div Evqp
+static int encode_opcode_534(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 6;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xf7;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// idiv Evqp
+static int encode_opcode_535(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 7;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xf7;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// clc
+static int encode_opcode_536(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xf8;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// stc
+static int encode_opcode_537(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xf9;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cli
+static int encode_opcode_538(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xfa;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// sti
+static int encode_opcode_539(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xfb;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cld
+static int encode_opcode_540(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xfc;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// std
+static int encode_opcode_541(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xfd;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// inc Eb
+static int encode_opcode_542(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 0;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xfe;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// dec Eb
+static int encode_opcode_543(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 1;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xfe;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// inc Evqp
+static int encode_opcode_544(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 0;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xff;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// dec Evqp
+static int encode_opcode_545(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 1;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xff;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// call Ev
+static int encode_opcode_546(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 2;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || rm >= 8) *data++ = 0x40 | 0 | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xff;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// call Eq
+static int encode_opcode_547(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 2;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || rm >= 8) *data++ = 0x40 | 0 | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xff;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// jmp Ev
+static int encode_opcode_548(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 4;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || rm >= 8) *data++ = 0x40 | 0 | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xff;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// jmp Eq
+static int encode_opcode_549(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 4;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || rm >= 8) *data++ = 0x40 | 0 | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xff;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// push Ev
+static int encode_opcode_550(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 6;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (rm >= 8) *data++ = 0x40 | 0 | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xff;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// push Evq
+static int encode_opcode_551(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 6;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (rm >= 8) *data++ = 0x40 | 0 | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0xff;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// lldt Ew
+static int encode_opcode_554(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 2;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x00;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// ltr Ew
+static int encode_opcode_555(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 3;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x00;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// verr Ew
+static int encode_opcode_556(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 4;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x00;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// verw Ew
+static int encode_opcode_557(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 5;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x00;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// jmpe
+static int encode_opcode_558(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 6;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x0f;
+    *data++ = 0x00;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// vmcall
+static int encode_opcode_559(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x01;
+    *data++ = 0xc1;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// vmlaunch
+static int encode_opcode_560(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x01;
+    *data++ = 0xc2;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// vmresume
+static int encode_opcode_561(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x01;
+    *data++ = 0xc3;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// vmxoff
+static int encode_opcode_562(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x01;
+    *data++ = 0xc4;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// monitor
+static int encode_opcode_563(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x01;
+    *data++ = 0xc8;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// mwait
+static int encode_opcode_564(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x01;
+    *data++ = 0xc9;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// xgetbv
+static int encode_opcode_565(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x01;
+    *data++ = 0xd0;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// xsetbv
+static int encode_opcode_566(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x01;
+    *data++ = 0xd1;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// lmsw Ew
+static int encode_opcode_568(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 6;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x01;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// swapgs
+static int encode_opcode_570(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x01;
+    *data++ = 0xf8;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// rdtscp
+static int encode_opcode_571(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x01;
+    *data++ = 0xf9;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// loadall
+static int encode_opcode_574(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x0f;
+    *data++ = 0x05;
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// syscall
+static int encode_opcode_575(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x0f;
+    *data++ = 0x05;
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// clts
+static int encode_opcode_576(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x06;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// loadall
+static int encode_opcode_577(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x0f;
+    *data++ = 0x07;
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// sysret
+static int encode_opcode_578(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x0f;
+    *data++ = 0x07;
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// invd
+static int encode_opcode_579(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x08;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// wbinvd
+static int encode_opcode_580(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x09;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// ud2
+static int encode_opcode_581(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x0b;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// nop Ev
+static int encode_opcode_582(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 0;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || rm >= 8) *data++ = 0x40 | 0 | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x0d;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// movss Wss, Vss
+static int encode_opcode_583(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0xf3;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x10;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// movsd Wsd, Vsd
+static int encode_opcode_584(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0xf2;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x10;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// movss Vss, Wss
+static int encode_opcode_585(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op1->reg;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0xf3;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x11;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// movsd Vsd, Wsd
+static int encode_opcode_586(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op1->reg;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0xf2;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x11;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// movddup Wq, Vq
+static int encode_opcode_589(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0xf2;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x12;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// movsldup Wq, Vq
+static int encode_opcode_590(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0xf3;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x12;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// movshdup Wq, Vq
+static int encode_opcode_595(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0xf3;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x16;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// hint_nop Ev
+static int encode_opcode_598(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 0;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || rm >= 8) *data++ = 0x40 | 0 | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x18;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// hint_nop Ev
+static int encode_opcode_603(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 4;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || rm >= 8) *data++ = 0x40 | 0 | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x18;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// hint_nop Ev
+static int encode_opcode_604(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 5;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || rm >= 8) *data++ = 0x40 | 0 | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x18;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// hint_nop Ev
+static int encode_opcode_605(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 6;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || rm >= 8) *data++ = 0x40 | 0 | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x18;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// hint_nop Ev
+static int encode_opcode_606(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 7;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || rm >= 8) *data++ = 0x40 | 0 | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x18;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// hint_nop Ev
+static int encode_opcode_607(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 0;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || rm >= 8) *data++ = 0x40 | 0 | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x19;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// hint_nop Ev
+static int encode_opcode_608(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 0;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || rm >= 8) *data++ = 0x40 | 0 | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x1a;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// hint_nop Ev
+static int encode_opcode_609(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 0;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || rm >= 8) *data++ = 0x40 | 0 | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x1b;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// hint_nop Ev
+static int encode_opcode_610(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 0;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || rm >= 8) *data++ = 0x40 | 0 | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x1c;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// hint_nop Ev
+static int encode_opcode_611(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 0;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || rm >= 8) *data++ = 0x40 | 0 | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x1d;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// hint_nop Ev
+static int encode_opcode_612(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 0;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || rm >= 8) *data++ = 0x40 | 0 | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x1e;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// hint_nop Ev
+static int encode_opcode_613(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 0;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || rm >= 8) *data++ = 0x40 | 0 | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x1f;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// nop Ev
+static int encode_opcode_614(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 0;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || rm >= 8) *data++ = 0x40 | 0 | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x1f;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// hint_nop Ev
+static int encode_opcode_615(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 1;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || rm >= 8) *data++ = 0x40 | 0 | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x1f;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// hint_nop Ev
+static int encode_opcode_616(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 2;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || rm >= 8) *data++ = 0x40 | 0 | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x1f;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// hint_nop Ev
+static int encode_opcode_617(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 3;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || rm >= 8) *data++ = 0x40 | 0 | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x1f;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// hint_nop Ev
+static int encode_opcode_618(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 4;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || rm >= 8) *data++ = 0x40 | 0 | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x1f;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// hint_nop Ev
+static int encode_opcode_619(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 5;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || rm >= 8) *data++ = 0x40 | 0 | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x1f;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// hint_nop Ev
+static int encode_opcode_620(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 6;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || rm >= 8) *data++ = 0x40 | 0 | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x1f;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// hint_nop Ev
+static int encode_opcode_621(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 7;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || rm >= 8) *data++ = 0x40 | 0 | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x1f;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cvtsi2ss Edqp, Vss
+static int encode_opcode_622(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0xf3;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x2a;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cvtsi2sd Edqp, Vsd
+static int encode_opcode_623(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0xf2;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x2a;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cvttss2si Wss, Gdqp
+static int encode_opcode_624(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0xf3;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x2c;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cvttsd2si Wsd, Gdqp
+static int encode_opcode_625(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0xf2;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x2c;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cvtss2si Wss, Gdqp
+static int encode_opcode_626(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0xf3;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x2d;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cvtsd2si Wsd, Gdqp
+static int encode_opcode_627(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0xf2;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x2d;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// ucomiss Wss, Vss
+static int encode_opcode_628(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x2e;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// ucomisd Wsd, Vsd
+static int encode_opcode_629(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x2e;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// comiss Wss, Vss
+static int encode_opcode_630(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x2f;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// comisd Wsd, Vsd
+static int encode_opcode_631(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x2f;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// wrmsr
+static int encode_opcode_632(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x30;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// rdtsc
+static int encode_opcode_633(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x31;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// rdmsr
+static int encode_opcode_634(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x32;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// rdpmc
+static int encode_opcode_635(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x33;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// sysenter
+static int encode_opcode_636(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x0f;
+    *data++ = 0x34;
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// sysenter
+static int encode_opcode_637(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x0f;
+    *data++ = 0x34;
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// sysexit
+static int encode_opcode_638(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x0f;
+    *data++ = 0x35;
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// getsec
+static int encode_opcode_639(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x37;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// pshufb Wdq, Vdq
+static int encode_opcode_640(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x38;
+    *data++ = 0x00;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// phaddw Wdq, Vdq
+static int encode_opcode_641(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x38;
+    *data++ = 0x01;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// phaddd Wdq, Vdq
+static int encode_opcode_642(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x38;
+    *data++ = 0x02;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// phaddsw Wdq, Vdq
+static int encode_opcode_643(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x38;
+    *data++ = 0x03;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// pmaddubsw Wdq, Vdq
+static int encode_opcode_644(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x38;
+    *data++ = 0x04;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// phsubw Wdq, Vdq
+static int encode_opcode_645(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x38;
+    *data++ = 0x05;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// phsubd Wdq, Vdq
+static int encode_opcode_646(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x38;
+    *data++ = 0x06;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// phsubsw Wdq, Vdq
+static int encode_opcode_647(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x38;
+    *data++ = 0x07;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// psignb Wdq, Vdq
+static int encode_opcode_648(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x38;
+    *data++ = 0x08;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// psignw Wdq, Vdq
+static int encode_opcode_649(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x38;
+    *data++ = 0x09;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// psignd Wdq, Vdq
+static int encode_opcode_650(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x38;
+    *data++ = 0x0a;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// pmulhrsw Wdq, Vdq
+static int encode_opcode_651(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x38;
+    *data++ = 0x0b;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// pblendvb Wdq, Vdq
+static int encode_opcode_652(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x38;
+    *data++ = 0x10;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// ptest Wdq, Vdq
+static int encode_opcode_653(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x38;
+    *data++ = 0x17;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// pabsb Wdq, Vdq
+static int encode_opcode_654(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x38;
+    *data++ = 0x1c;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// pabsw Wdq, Vdq
+static int encode_opcode_655(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x38;
+    *data++ = 0x1d;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// pabsd Wdq, Vdq
+static int encode_opcode_656(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x38;
+    *data++ = 0x1e;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// pmuldq Wdq, Vdq
+static int encode_opcode_663(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x38;
+    *data++ = 0x28;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// pcmpeqq Wdq, Vdq
+static int encode_opcode_664(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x38;
+    *data++ = 0x29;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// packusdw Wdq, Vdq
+static int encode_opcode_666(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x38;
+    *data++ = 0x2b;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// pcmpgtq Wdq, Vdq
+static int encode_opcode_673(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x38;
+    *data++ = 0x37;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// pminsb Wdq, Vdq
+static int encode_opcode_674(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x38;
+    *data++ = 0x38;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// pminsd Wdq, Vdq
+static int encode_opcode_675(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x38;
+    *data++ = 0x39;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// pminuw Wdq, Vdq
+static int encode_opcode_676(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x38;
+    *data++ = 0x3a;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// pminud Wdq, Vdq
+static int encode_opcode_677(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x38;
+    *data++ = 0x3b;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// pmaxsb Wdq, Vdq
+static int encode_opcode_678(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x38;
+    *data++ = 0x3c;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// pmaxsd Wdq, Vdq
+static int encode_opcode_679(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x38;
+    *data++ = 0x3d;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// pmaxuw Wdq, Vdq
+static int encode_opcode_680(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x38;
+    *data++ = 0x3e;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// pmaxud Wdq, Vdq
+static int encode_opcode_681(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x38;
+    *data++ = 0x3f;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// pmulld Wdq, Vdq
+static int encode_opcode_682(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x38;
+    *data++ = 0x40;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// phminposuw Wdq, Vdq
+static int encode_opcode_683(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x38;
+    *data++ = 0x41;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// crc32 Eb, Gdqp
+static int encode_opcode_689(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0xf2;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x38;
+    *data++ = 0xf0;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// crc32 Evqp, Gdqp
+static int encode_opcode_691(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0xf2;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x38;
+    *data++ = 0xf1;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// roundss Ib, Wss, Vss
+static int encode_opcode_692(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_XMM_REGISTER(op2) && IS_XMM_REGISTER(op3))) return 0;
+
+    int reg = op3->reg;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || OP_TYPE_IS_ALT_8BIT(op3) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x3a;
+    *data++ = 0x0a;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// roundsd Ib, Wsd, Vsd
+static int encode_opcode_693(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_XMM_REGISTER(op2) && IS_XMM_REGISTER(op3))) return 0;
+
+    int reg = op3->reg;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || OP_TYPE_IS_ALT_8BIT(op3) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x3a;
+    *data++ = 0x0b;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// pblendw Ib, Wdq, Vdq
+static int encode_opcode_694(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_XMM_REGISTER(op2) && IS_XMM_REGISTER(op3))) return 0;
+
+    int reg = op3->reg;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || OP_TYPE_IS_ALT_8BIT(op3) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x3a;
+    *data++ = 0x0e;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// palignr Ib, Wdq, Vdq
+static int encode_opcode_695(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_XMM_REGISTER(op2) && IS_XMM_REGISTER(op3))) return 0;
+
+    int reg = op3->reg;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || OP_TYPE_IS_ALT_8BIT(op3) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x3a;
+    *data++ = 0x0f;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// pextrd Ib, Vdq, Ed
+static int encode_opcode_698(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_XMM_REGISTER(op2) && IS_REGISTER(op3))) return 0;
+
+    int reg = op2->reg;
+    int rm = op3->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || OP_TYPE_IS_ALT_8BIT(op3) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x3a;
+    *data++ = 0x16;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// pextrq Ib, Vdq, Eqp
+static int encode_opcode_699(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_XMM_REGISTER(op2) && IS_REGISTER(op3))) return 0;
+
+    int reg = op2->reg;
+    int rm = op3->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || OP_TYPE_IS_ALT_8BIT(op3) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x3a;
+    *data++ = 0x16;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// extractps Ib, Vdq, Ed
+static int encode_opcode_700(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_XMM_REGISTER(op2) && IS_REGISTER(op3))) return 0;
+
+    int reg = op2->reg;
+    int rm = op3->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || OP_TYPE_IS_ALT_8BIT(op3) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x3a;
+    *data++ = 0x17;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// pinsrd Ib, Ed, Vdq
+static int encode_opcode_702(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2) && IS_XMM_REGISTER(op3))) return 0;
+
+    int reg = op3->reg;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || OP_TYPE_IS_ALT_8BIT(op3) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x3a;
+    *data++ = 0x22;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// pinsrq Ib, Eqp, Vdq
+static int encode_opcode_703(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2) && IS_XMM_REGISTER(op3))) return 0;
+
+    int reg = op3->reg;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || OP_TYPE_IS_ALT_8BIT(op3) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x3a;
+    *data++ = 0x22;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// mpsadbw Ib, Wdq, Vdq
+static int encode_opcode_704(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_XMM_REGISTER(op2) && IS_XMM_REGISTER(op3))) return 0;
+
+    int reg = op3->reg;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || OP_TYPE_IS_ALT_8BIT(op3) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x3a;
+    *data++ = 0x42;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cmovo Evqp, Gvqp
+static int encode_opcode_705(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x40;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cmovno Evqp, Gvqp
+static int encode_opcode_706(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x41;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cmovb Evqp, Gvqp
+static int encode_opcode_707(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x42;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cmovnae Evqp, Gvqp
+static int encode_opcode_708(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x42;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cmovc Evqp, Gvqp
+static int encode_opcode_709(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x42;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cmovnb Evqp, Gvqp
+static int encode_opcode_710(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x43;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cmovae Evqp, Gvqp
+static int encode_opcode_711(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x43;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cmovnc Evqp, Gvqp
+static int encode_opcode_712(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x43;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cmovz Evqp, Gvqp
+static int encode_opcode_713(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x44;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cmove Evqp, Gvqp
+static int encode_opcode_714(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x44;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cmovnz Evqp, Gvqp
+static int encode_opcode_715(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x45;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cmovne Evqp, Gvqp
+static int encode_opcode_716(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x45;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cmovbe Evqp, Gvqp
+static int encode_opcode_717(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x46;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cmovna Evqp, Gvqp
+static int encode_opcode_718(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x46;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cmovnbe Evqp, Gvqp
+static int encode_opcode_719(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x47;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cmova Evqp, Gvqp
+static int encode_opcode_720(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x47;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cmovs Evqp, Gvqp
+static int encode_opcode_721(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x48;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cmovns Evqp, Gvqp
+static int encode_opcode_722(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x49;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cmovp Evqp, Gvqp
+static int encode_opcode_723(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x4a;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cmovpe Evqp, Gvqp
+static int encode_opcode_724(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x4a;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cmovnp Evqp, Gvqp
+static int encode_opcode_725(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x4b;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cmovpo Evqp, Gvqp
+static int encode_opcode_726(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x4b;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cmovl Evqp, Gvqp
+static int encode_opcode_727(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x4c;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cmovnge Evqp, Gvqp
+static int encode_opcode_728(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x4c;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cmovnl Evqp, Gvqp
+static int encode_opcode_729(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x4d;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cmovge Evqp, Gvqp
+static int encode_opcode_730(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x4d;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cmovle Evqp, Gvqp
+static int encode_opcode_731(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x4e;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cmovng Evqp, Gvqp
+static int encode_opcode_732(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x4e;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cmovnle Evqp, Gvqp
+static int encode_opcode_733(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x4f;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cmovg Evqp, Gvqp
+static int encode_opcode_734(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x4f;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// sqrtss Wss, Vss
+static int encode_opcode_735(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0xf3;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x51;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// sqrtsd Wsd, Vsd
+static int encode_opcode_736(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0xf2;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x51;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// rsqrtss Wss, Vss
+static int encode_opcode_737(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0xf3;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x52;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// rcpss Wss, Vss
+static int encode_opcode_738(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0xf3;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x53;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// addss Wss, Vss
+static int encode_opcode_739(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0xf3;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x58;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// addsd Wsd, Vsd
+static int encode_opcode_740(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0xf2;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x58;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// mulss Wss, Vss
+static int encode_opcode_741(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0xf3;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x59;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// mulsd Wsd, Vsd
+static int encode_opcode_742(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0xf2;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x59;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cvtss2sd Wss, Vsd
+static int encode_opcode_743(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0xf3;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x5a;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cvtsd2ss Wsd, Vss
+static int encode_opcode_744(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0xf2;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x5a;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// subss Wss, Vss
+static int encode_opcode_745(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0xf3;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x5c;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// subsd Wsd, Vsd
+static int encode_opcode_746(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0xf2;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x5c;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// minss Wss, Vss
+static int encode_opcode_747(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0xf3;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x5d;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// minsd Wsd, Vsd
+static int encode_opcode_748(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0xf2;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x5d;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// divss Wss, Vss
+static int encode_opcode_749(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0xf3;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x5e;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// divsd Wsd, Vsd
+static int encode_opcode_750(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0xf2;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x5e;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// maxss Wss, Vss
+static int encode_opcode_751(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0xf3;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x5f;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// maxsd Wsd, Vsd
+static int encode_opcode_752(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0xf2;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x5f;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// punpcklbw Wdq, Vdq
+static int encode_opcode_753(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x60;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// punpcklwd Wdq, Vdq
+static int encode_opcode_754(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x61;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// punpckldq Wdq, Vdq
+static int encode_opcode_755(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x62;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// packsswb Wdq, Vdq
+static int encode_opcode_756(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x63;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// pcmpgtb Wdq, Vdq
+static int encode_opcode_757(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x64;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// pcmpgtw Wdq, Vdq
+static int encode_opcode_758(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x65;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// pcmpgtd Wdq, Vdq
+static int encode_opcode_759(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x66;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// packuswb Wdq, Vdq
+static int encode_opcode_760(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x67;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// punpckhbw Wdq, Vdq
+static int encode_opcode_761(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x68;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// punpckhwd Wdq, Vdq
+static int encode_opcode_762(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x69;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// punpckhdq Wdq, Vdq
+static int encode_opcode_763(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x6a;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// packssdw Wdq, Vdq
+static int encode_opcode_764(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x6b;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// punpcklqdq Wdq, Vdq
+static int encode_opcode_765(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x6c;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// punpckhqdq Wdq, Vdq
+static int encode_opcode_766(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x6d;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// movd Ed, Vdq
+static int encode_opcode_767(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x6e;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// movd Ed, Vdq
+static int encode_opcode_768(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x6e;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// movq Eqp, Vdq
+static int encode_opcode_769(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x6e;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// movdqa Wdq, Vdq
+static int encode_opcode_770(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x6f;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// movdqu Wdq, Vdq
+static int encode_opcode_771(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0xf3;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x6f;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// pshuflw Ib, Wdq, Vdq
+static int encode_opcode_772(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_XMM_REGISTER(op2) && IS_XMM_REGISTER(op3))) return 0;
+
+    int reg = op3->reg;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0xf2;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || OP_TYPE_IS_ALT_8BIT(op3) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x70;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// pshufhw Ib, Wdq, Vdq
+static int encode_opcode_773(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_XMM_REGISTER(op2) && IS_XMM_REGISTER(op3))) return 0;
+
+    int reg = op3->reg;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0xf3;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || OP_TYPE_IS_ALT_8BIT(op3) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x70;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// pshufd Ib, Wdq, Vdq
+static int encode_opcode_774(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_XMM_REGISTER(op2) && IS_XMM_REGISTER(op3))) return 0;
+
+    int reg = op3->reg;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || OP_TYPE_IS_ALT_8BIT(op3) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x70;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// pcmpeqb Wdq, Vdq
+static int encode_opcode_775(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x74;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// pcmpeqw Wdq, Vdq
+static int encode_opcode_776(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x75;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// pcmpeqd Wdq, Vdq
+static int encode_opcode_777(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x76;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// vmread Gd, Ed
+static int encode_opcode_779(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op1->reg;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x78;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// vmread Gq, Eq
+static int encode_opcode_780(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op1->reg;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x78;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// vmwrite Ed, Gd
+static int encode_opcode_781(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x79;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// vmwrite Eq, Gq
+static int encode_opcode_782(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x79;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// movd Vdq, Ed
+static int encode_opcode_783(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op1->reg;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x7e;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// movd Vdq, Ed
+static int encode_opcode_784(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op1->reg;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x7e;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// movq Vdq, Eqp
+static int encode_opcode_785(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op1->reg;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x7e;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// movq Wq, Vq
+static int encode_opcode_786(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0xf3;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x7e;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// movdqa Vdq, Wdq
+static int encode_opcode_787(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op1->reg;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x7f;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// movdqu Vdq, Wdq
+static int encode_opcode_788(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op1->reg;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0xf3;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x7f;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// jo Jvds
+static int encode_opcode_789(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x0f;
+    *data++ = 0x80;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = (size == SIZE64 ? SIZE32 : size);
+    data = encode_value(data, 0, (size == SIZE64 ? SIZE32 : size));
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// jno Jvds
+static int encode_opcode_790(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x0f;
+    *data++ = 0x81;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = (size == SIZE64 ? SIZE32 : size);
+    data = encode_value(data, 0, (size == SIZE64 ? SIZE32 : size));
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// jb Jvds
+static int encode_opcode_791(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x0f;
+    *data++ = 0x82;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = (size == SIZE64 ? SIZE32 : size);
+    data = encode_value(data, 0, (size == SIZE64 ? SIZE32 : size));
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// jnae Jvds
+static int encode_opcode_792(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x0f;
+    *data++ = 0x82;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = (size == SIZE64 ? SIZE32 : size);
+    data = encode_value(data, 0, (size == SIZE64 ? SIZE32 : size));
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// jc Jvds
+static int encode_opcode_793(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x0f;
+    *data++ = 0x82;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = (size == SIZE64 ? SIZE32 : size);
+    data = encode_value(data, 0, (size == SIZE64 ? SIZE32 : size));
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// jnb Jvds
+static int encode_opcode_794(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x0f;
+    *data++ = 0x83;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = (size == SIZE64 ? SIZE32 : size);
+    data = encode_value(data, 0, (size == SIZE64 ? SIZE32 : size));
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// jae Jvds
+static int encode_opcode_795(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x0f;
+    *data++ = 0x83;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = (size == SIZE64 ? SIZE32 : size);
+    data = encode_value(data, 0, (size == SIZE64 ? SIZE32 : size));
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// jnc Jvds
+static int encode_opcode_796(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x0f;
+    *data++ = 0x83;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = (size == SIZE64 ? SIZE32 : size);
+    data = encode_value(data, 0, (size == SIZE64 ? SIZE32 : size));
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// jz Jvds
+static int encode_opcode_797(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x0f;
+    *data++ = 0x84;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = (size == SIZE64 ? SIZE32 : size);
+    data = encode_value(data, 0, (size == SIZE64 ? SIZE32 : size));
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// je Jvds
+static int encode_opcode_798(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x0f;
+    *data++ = 0x84;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = (size == SIZE64 ? SIZE32 : size);
+    data = encode_value(data, 0, (size == SIZE64 ? SIZE32 : size));
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// jnz Jvds
+static int encode_opcode_799(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x0f;
+    *data++ = 0x85;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = (size == SIZE64 ? SIZE32 : size);
+    data = encode_value(data, 0, (size == SIZE64 ? SIZE32 : size));
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// jne Jvds
+static int encode_opcode_800(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x0f;
+    *data++ = 0x85;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = (size == SIZE64 ? SIZE32 : size);
+    data = encode_value(data, 0, (size == SIZE64 ? SIZE32 : size));
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// jbe Jvds
+static int encode_opcode_801(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x0f;
+    *data++ = 0x86;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = (size == SIZE64 ? SIZE32 : size);
+    data = encode_value(data, 0, (size == SIZE64 ? SIZE32 : size));
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// jna Jvds
+static int encode_opcode_802(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x0f;
+    *data++ = 0x86;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = (size == SIZE64 ? SIZE32 : size);
+    data = encode_value(data, 0, (size == SIZE64 ? SIZE32 : size));
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// jnbe Jvds
+static int encode_opcode_803(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x0f;
+    *data++ = 0x87;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = (size == SIZE64 ? SIZE32 : size);
+    data = encode_value(data, 0, (size == SIZE64 ? SIZE32 : size));
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// ja Jvds
+static int encode_opcode_804(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x0f;
+    *data++ = 0x87;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = (size == SIZE64 ? SIZE32 : size);
+    data = encode_value(data, 0, (size == SIZE64 ? SIZE32 : size));
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// js Jvds
+static int encode_opcode_805(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x0f;
+    *data++ = 0x88;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = (size == SIZE64 ? SIZE32 : size);
+    data = encode_value(data, 0, (size == SIZE64 ? SIZE32 : size));
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// jns Jvds
+static int encode_opcode_806(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x0f;
+    *data++ = 0x89;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = (size == SIZE64 ? SIZE32 : size);
+    data = encode_value(data, 0, (size == SIZE64 ? SIZE32 : size));
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// jp Jvds
+static int encode_opcode_807(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x0f;
+    *data++ = 0x8a;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = (size == SIZE64 ? SIZE32 : size);
+    data = encode_value(data, 0, (size == SIZE64 ? SIZE32 : size));
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// jpe Jvds
+static int encode_opcode_808(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x0f;
+    *data++ = 0x8a;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = (size == SIZE64 ? SIZE32 : size);
+    data = encode_value(data, 0, (size == SIZE64 ? SIZE32 : size));
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// jnp Jvds
+static int encode_opcode_809(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x0f;
+    *data++ = 0x8b;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = (size == SIZE64 ? SIZE32 : size);
+    data = encode_value(data, 0, (size == SIZE64 ? SIZE32 : size));
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// jpo Jvds
+static int encode_opcode_810(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x0f;
+    *data++ = 0x8b;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = (size == SIZE64 ? SIZE32 : size);
+    data = encode_value(data, 0, (size == SIZE64 ? SIZE32 : size));
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// jl Jvds
+static int encode_opcode_811(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x0f;
+    *data++ = 0x8c;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = (size == SIZE64 ? SIZE32 : size);
+    data = encode_value(data, 0, (size == SIZE64 ? SIZE32 : size));
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// jnge Jvds
+static int encode_opcode_812(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x0f;
+    *data++ = 0x8c;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = (size == SIZE64 ? SIZE32 : size);
+    data = encode_value(data, 0, (size == SIZE64 ? SIZE32 : size));
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// jnl Jvds
+static int encode_opcode_813(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x0f;
+    *data++ = 0x8d;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = (size == SIZE64 ? SIZE32 : size);
+    data = encode_value(data, 0, (size == SIZE64 ? SIZE32 : size));
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// jge Jvds
+static int encode_opcode_814(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x0f;
+    *data++ = 0x8d;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = (size == SIZE64 ? SIZE32 : size);
+    data = encode_value(data, 0, (size == SIZE64 ? SIZE32 : size));
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// jle Jvds
+static int encode_opcode_815(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x0f;
+    *data++ = 0x8e;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = (size == SIZE64 ? SIZE32 : size);
+    data = encode_value(data, 0, (size == SIZE64 ? SIZE32 : size));
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// jng Jvds
+static int encode_opcode_816(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x0f;
+    *data++ = 0x8e;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = (size == SIZE64 ? SIZE32 : size);
+    data = encode_value(data, 0, (size == SIZE64 ? SIZE32 : size));
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// jnle Jvds
+static int encode_opcode_817(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x0f;
+    *data++ = 0x8f;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = (size == SIZE64 ? SIZE32 : size);
+    data = encode_value(data, 0, (size == SIZE64 ? SIZE32 : size));
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// jg Jvds
+static int encode_opcode_818(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_RELATIVE(op1))) return 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x0f;
+    *data++ = 0x8f;
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = (size == SIZE64 ? SIZE32 : size);
+    data = encode_value(data, 0, (size == SIZE64 ? SIZE32 : size));
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// seto Eb
+static int encode_opcode_819(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 0;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x90;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// setno Eb
+static int encode_opcode_820(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 0;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x91;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// setb Eb
+static int encode_opcode_821(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 0;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x92;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// setnae Eb
+static int encode_opcode_822(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 0;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x92;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// setc Eb
+static int encode_opcode_823(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 0;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x92;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// setnb Eb
+static int encode_opcode_824(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 0;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x93;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// setae Eb
+static int encode_opcode_825(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 0;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x93;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// setnc Eb
+static int encode_opcode_826(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 0;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x93;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// setz Eb
+static int encode_opcode_827(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 0;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x94;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// sete Eb
+static int encode_opcode_828(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 0;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x94;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// setnz Eb
+static int encode_opcode_829(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 0;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x95;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// setne Eb
+static int encode_opcode_830(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 0;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x95;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// setbe Eb
+static int encode_opcode_831(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 0;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x96;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// setna Eb
+static int encode_opcode_832(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 0;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x96;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// setnbe Eb
+static int encode_opcode_833(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 0;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x97;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// seta Eb
+static int encode_opcode_834(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 0;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x97;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// sets Eb
+static int encode_opcode_835(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 0;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x98;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// setns Eb
+static int encode_opcode_836(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 0;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x99;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// setp Eb
+static int encode_opcode_837(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 0;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x9a;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// setpe Eb
+static int encode_opcode_838(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 0;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x9a;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// setnp Eb
+static int encode_opcode_839(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 0;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x9b;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// setpo Eb
+static int encode_opcode_840(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 0;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x9b;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// setl Eb
+static int encode_opcode_841(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 0;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x9c;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// setnge Eb
+static int encode_opcode_842(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 0;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x9c;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// setnl Eb
+static int encode_opcode_843(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 0;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x9d;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// setge Eb
+static int encode_opcode_844(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 0;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x9d;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// setle Eb
+static int encode_opcode_845(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 0;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x9e;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// setng Eb
+static int encode_opcode_846(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 0;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x9e;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// setnle Eb
+static int encode_opcode_847(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 0;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x9f;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// setg Eb
+static int encode_opcode_848(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 0;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0x9f;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// push
+static int encode_opcode_849(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x0f;
+    *data++ = 0xa0;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// pop
+static int encode_opcode_850(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xa1;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cpuid
+static int encode_opcode_851(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xa2;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// bt Gvqp, Evqp
+static int encode_opcode_852(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op1->reg;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xa3;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// shld Ib, Gvqp, Evqp
+static int encode_opcode_853(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2) && IS_REGISTER(op3))) return 0;
+
+    int reg = op2->reg;
+    int rm = op3->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || OP_TYPE_IS_ALT_8BIT(op3) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xa4;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// shld b, Gvqp, Evqp
+static int encode_opcode_854(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2) && IS_REGISTER(op3))) return 0;
+
+    int reg = op2->reg;
+    int rm = op3->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || OP_TYPE_IS_ALT_8BIT(op3) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xa5;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// push
+static int encode_opcode_855(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x0f;
+    *data++ = 0xa8;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// pop
+static int encode_opcode_856(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 0;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xa9;
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// rsm
+static int encode_opcode_857(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x0f;
+    *data++ = 0xaa;
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// bts Gvqp, Evqp
+static int encode_opcode_858(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op1->reg;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xab;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// shrd Ib, Gvqp, Evqp
+static int encode_opcode_859(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2) && IS_REGISTER(op3))) return 0;
+
+    int reg = op2->reg;
+    int rm = op3->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || OP_TYPE_IS_ALT_8BIT(op3) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xac;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// shrd b, Gvqp, Evqp
+static int encode_opcode_860(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2) && IS_REGISTER(op3))) return 0;
+
+    int reg = op2->reg;
+    int rm = op3->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || OP_TYPE_IS_ALT_8BIT(op3) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xad;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// lfence
+static int encode_opcode_865(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 5;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xae;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// mfence
+static int encode_opcode_868(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 6;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xae;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// sfence
+static int encode_opcode_869(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    int reg = 7;
+    int rm = 0;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (size == SIZE64) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xae;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// imul Evqp, Gvqp
+static int encode_opcode_871(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xaf;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cmpxchg Gb, Eb
+static int encode_opcode_872(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op1->reg;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xb0;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cmpxchg Gvqp, Evqp
+static int encode_opcode_873(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op1->reg;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xb1;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// btr Gvqp, Evqp
+static int encode_opcode_874(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op1->reg;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xb3;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// movzx Eb, Gvqp
+static int encode_opcode_875(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xb6;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// movzx Ew, Gvqp
+static int encode_opcode_876(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xb7;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// jmpe
+static int encode_opcode_877(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0x0f;
+    *data++ = 0xb8;
+
+    instr->size = data - instr->data;
+    instr->branch = 1;
+
+    return 1;
+}
+
+// popcnt Evqp, Gvqp
+static int encode_opcode_878(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    *data++ = 0xf3;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xb8;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// ud E, G
+static int encode_opcode_879(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xb9;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// bt Ib, Evqp
+static int encode_opcode_880(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 4;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xba;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// bts Ib, Evqp
+static int encode_opcode_881(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 5;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xba;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// btr Ib, Evqp
+static int encode_opcode_882(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 6;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xba;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// btc Ib, Evqp
+static int encode_opcode_883(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = 7;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xba;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// btc Gvqp, Evqp
+static int encode_opcode_884(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op1->reg;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xbb;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// bsf Evqp, Gvqp
+static int encode_opcode_885(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xbc;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// bsr Evqp, Gvqp
+static int encode_opcode_886(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xbd;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// movsx Eb, Gvqp
+static int encode_opcode_887(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xbe;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// movsx Ew, Gvqp
+static int encode_opcode_888(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1) && IS_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xbf;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cmpss Ib, Wss, Vss
+static int encode_opcode_889(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_XMM_REGISTER(op2) && IS_XMM_REGISTER(op3))) return 0;
+
+    int reg = op3->reg;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0xf3;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || OP_TYPE_IS_ALT_8BIT(op3) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xc2;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// cmpsd Ib, Wsd, Vsd
+static int encode_opcode_890(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(OP_TYPE_IS_IMM(op1) && IS_XMM_REGISTER(op2) && IS_XMM_REGISTER(op3))) return 0;
+
+    int reg = op3->reg;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0xf2;
+    if (OP_TYPE_IS_ALT_8BIT(op2) || OP_TYPE_IS_ALT_8BIT(op3) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xc2;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->relocation.offset = data - instr->data;
+    instr->relocation.size = SIZE08;
+    data = encode_value(data, op1->imm_or_mem_value, SIZE08);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// bswap Zvqp
+static int encode_opcode_900(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_REGISTER(op1))) return 0;
+
+    int reg = 0;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    if (size == SIZE16) *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || size == SIZE64 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xc8 + (op1->reg & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// psrlw Wdq, Vdq
+static int encode_opcode_901(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xd1;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// psrld Wdq, Vdq
+static int encode_opcode_902(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xd2;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// psrlq Wdq, Vdq
+static int encode_opcode_903(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xd3;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// paddq Wdq, Vdq
+static int encode_opcode_904(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xd4;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// pmullw Wdq, Vdq
+static int encode_opcode_905(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xd5;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// movq Vq, Wq
+static int encode_opcode_906(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op1->reg;
+    int rm = op2->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xd6;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// psubusb Wdq, Vdq
+static int encode_opcode_907(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xd8;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// psubusw Wdq, Vdq
+static int encode_opcode_908(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xd9;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// pminub Wdq, Vdq
+static int encode_opcode_909(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xda;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// pand Wdq, Vdq
+static int encode_opcode_910(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xdb;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// paddusb Wdq, Vdq
+static int encode_opcode_911(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xdc;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// paddusw Wdq, Vdq
+static int encode_opcode_912(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xdd;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// pmaxub Wdq, Vdq
+static int encode_opcode_913(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xde;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// pandn Wdq, Vdq
+static int encode_opcode_914(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xdf;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// pavgb Wdq, Vdq
+static int encode_opcode_915(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xe0;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// psraw Wdq, Vdq
+static int encode_opcode_916(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xe1;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// psrad Wdq, Vdq
+static int encode_opcode_917(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xe2;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// pavgw Wdq, Vdq
+static int encode_opcode_918(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xe3;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// pmulhuw Wdq, Vdq
+static int encode_opcode_919(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xe4;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// pmulhw Wdq, Vdq
+static int encode_opcode_920(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xe5;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// psubsb Wdq, Vdq
+static int encode_opcode_922(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xe8;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// psubsw Wdq, Vdq
+static int encode_opcode_923(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xe9;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// pminsw Wdq, Vdq
+static int encode_opcode_924(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xea;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// por Wdq, Vdq
+static int encode_opcode_925(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xeb;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// paddsb Wdq, Vdq
+static int encode_opcode_926(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xec;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// paddsw Wdq, Vdq
+static int encode_opcode_927(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xed;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// pmaxsw Wdq, Vdq
+static int encode_opcode_928(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xee;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// pxor Wdq, Vdq
+static int encode_opcode_929(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xef;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// psllw Wdq, Vdq
+static int encode_opcode_931(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xf1;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// pslld Wdq, Vdq
+static int encode_opcode_932(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xf2;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// psllq Wdq, Vdq
+static int encode_opcode_933(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xf3;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// pmuludq Wdq, Vdq
+static int encode_opcode_934(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xf4;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// pmaddwd Wdq, Vdq
+static int encode_opcode_935(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xf5;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// psadbw Wdq, Vdq
+static int encode_opcode_936(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xf6;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// psubb Wdq, Vdq
+static int encode_opcode_937(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xf8;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// psubw Wdq, Vdq
+static int encode_opcode_938(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xf9;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// psubd Wdq, Vdq
+static int encode_opcode_939(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xfa;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// psubq Wdq, Vdq
+static int encode_opcode_940(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xfb;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// paddb Wdq, Vdq
+static int encode_opcode_941(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xfc;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// paddw Wdq, Vdq
+static int encode_opcode_942(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xfd;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// paddd Wdq, Vdq
+static int encode_opcode_943(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {
+    if (!(IS_XMM_REGISTER(op1) && IS_XMM_REGISTER(op2))) return 0;
+
+    int reg = op2->reg;
+    int rm = op1->reg;
+
+    memset(instr, 0, sizeof(Instructions));
+    uint8_t *data = instr->data;
+
+    *data++ = 0x66;
+    if (OP_TYPE_IS_ALT_8BIT(op1) || OP_TYPE_IS_ALT_8BIT(op2) || size == SIZE64 || reg >= 8 || rm >= 8) *data++ = 0x40 | ((size == SIZE64) << 3) | ((reg >> 3) * 4) | (rm >> 3);
+    *data++ = 0x0f;
+    *data++ = 0xfe;
+    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);
+
+    instr->size = data - instr->data;
+
+    return 1;
+}
+
+// Specialised encoders, indexed like opcodes. NULL if the opcode doesn't have one.
+OpcodeEncoder opcode_encoders[] = {
+    encode_opcode_0, // add
+    encode_opcode_1, // add
+    encode_opcode_2, // add
+    encode_opcode_3, // add
+    encode_opcode_4, // add
+    encode_opcode_5, // add
+    encode_opcode_6, // or
+    encode_opcode_7, // or
+    encode_opcode_8, // or
+    encode_opcode_9, // or
+    encode_opcode_10, // or
+    encode_opcode_11, // or
+    encode_opcode_12, // pop
+    encode_opcode_13, // adc
+    encode_opcode_14, // adc
+    encode_opcode_15, // adc
+    encode_opcode_16, // adc
+    encode_opcode_17, // adc
+    encode_opcode_18, // adc
+    encode_opcode_19, // sbb
+    encode_opcode_20, // sbb
+    encode_opcode_21, // sbb
+    encode_opcode_22, // sbb
+    encode_opcode_23, // sbb
+    encode_opcode_24, // sbb
+    encode_opcode_25, // and
+    encode_opcode_26, // and
+    encode_opcode_27, // and
+    encode_opcode_28, // and
+    encode_opcode_29, // and
+    encode_opcode_30, // and
+    encode_opcode_31, // es
+    encode_opcode_32, // sub
+    encode_opcode_33, // sub
+    encode_opcode_34, // sub
+    encode_opcode_35, // sub
+    encode_opcode_36, // sub
+    encode_opcode_37, // sub
+    encode_opcode_38, // cs
+    encode_opcode_39, // ntaken
+    encode_opcode_40, // xor
+    encode_opcode_41, // xor
+    encode_opcode_42, // xor
+    encode_opcode_43, // xor
+    encode_opcode_44, // xor
+    encode_opcode_45, // xor
+    encode_opcode_46, // ss
+    encode_opcode_47, // cmp
+    encode_opcode_48, // cmp
+    encode_opcode_49, // cmp
+    encode_opcode_50, // cmp
+    encode_opcode_51, // cmp
+    encode_opcode_52, // cmp
+    encode_opcode_53, // ds
+    encode_opcode_54, // taken
+    encode_opcode_55, // inc
+    encode_opcode_56, // rex
+    encode_opcode_57, // rex.b
+    encode_opcode_58, // rex.x
+    encode_opcode_59, // rex.xb
+    encode_opcode_60, // rex.r
+    encode_opcode_61, // rex.rb
+    encode_opcode_62, // rex.rx
+    encode_opcode_63, // rex.rxb
+    encode_opcode_64, // dec
+    encode_opcode_65, // rex.w
+    encode_opcode_66, // rex.wb
+    encode_opcode_67, // rex.wx
+    encode_opcode_68, // rex.wxb
+    encode_opcode_69, // rex.wr
+    encode_opcode_70, // rex.wrb
+    encode_opcode_71, // rex.wrx
+    encode_opcode_72, // rex.wrxb
+    encode_opcode_73, // push
+    encode_opcode_74, // push
+    encode_opcode_75, // pop
+    encode_opcode_76, // pop
+    encode_opcode_77, // arpl
+    encode_opcode_78, // movsxd
+    encode_opcode_79, // fs
+    encode_opcode_80, // alter
+    encode_opcode_81, // gs
+    encode_opcode_82, // push
+    encode_opcode_83, // imul
+    encode_opcode_84, // push
+    encode_opcode_85, // imul
+    encode_opcode_86, // ins
+    encode_opcode_87, // insb
+    encode_opcode_88, // insw
+    encode_opcode_89, // ins
+    encode_opcode_90, // insd
+    encode_opcode_91, // outs
+    encode_opcode_92, // outsb
+    encode_opcode_93, // outsw
+    encode_opcode_94, // outs
+    encode_opcode_95, // outsd
+    encode_opcode_96, // jo
+    encode_opcode_97, // jno
+    encode_opcode_98, // jb
+    encode_opcode_99, // jnae
+    encode_opcode_100, // jc
+    encode_opcode_101, // jnb
+    encode_opcode_102, // jae
+    encode_opcode_103, // jnc
+    encode_opcode_104, // jz
+    encode_opcode_105, // je
+    encode_opcode_106, // jnz
+    encode_opcode_107, // jne
+    encode_opcode_108, // jbe
+    encode_opcode_109, // jna
+    encode_opcode_110, // jnbe
+    encode_opcode_111, // ja
+    encode_opcode_112, // js
+    encode_opcode_113, // jns
+    encode_opcode_114, // jp
+    encode_opcode_115, // jpe
+    encode_opcode_116, // jnp
+    encode_opcode_117, // jpo
+    encode_opcode_118, // jl
+    encode_opcode_119, // jnge
+    encode_opcode_120, // jnl
+    encode_opcode_121, // jge
+    encode_opcode_122, // jle
+    encode_opcode_123, // jng
+    encode_opcode_124, // jnle
+    encode_opcode_125, // jg
+    encode_opcode_126, // add
+    encode_opcode_127, // or
+    encode_opcode_128, // adc
+    encode_opcode_129, // sbb
+    encode_opcode_130, // and
+    encode_opcode_131, // sub
+    encode_opcode_132, // xor
+    encode_opcode_133, // cmp
+    encode_opcode_134, // add
+    encode_opcode_135, // or
+    encode_opcode_136, // adc
+    encode_opcode_137, // sbb
+    encode_opcode_138, // and
+    encode_opcode_139, // sub
+    encode_opcode_140, // xor
+    encode_opcode_141, // cmp
+    encode_opcode_142, // add
+    encode_opcode_143, // or
+    encode_opcode_144, // adc
+    encode_opcode_145, // sbb
+    encode_opcode_146, // and
+    encode_opcode_147, // sub
+    encode_opcode_148, // xor
+    encode_opcode_149, // cmp
+    encode_opcode_150, // test
+    encode_opcode_151, // test
+    encode_opcode_152, // mov
+    encode_opcode_153, // mov
+    encode_opcode_154, // mov
+    encode_opcode_155, // mov
+    NULL, // lea
+    encode_opcode_157, // pop
+    encode_opcode_158, // pop
+    encode_opcode_159, // nop
+    encode_opcode_160, // nop
+    encode_opcode_161, // pause
+    encode_opcode_162, // cbw
+    encode_opcode_163, // cwde
+    encode_opcode_164, // cbw
+    encode_opcode_165, // cwde
+    encode_opcode_166, // cdqe
+    encode_opcode_167, // cwd
+    encode_opcode_168, // cdq
+    encode_opcode_169, // cwd
+    encode_opcode_170, // cdq
+    encode_opcode_171, // cqo
+    NULL, // fwait
+    NULL, // wait
+    encode_opcode_174, // pushf
+    encode_opcode_175, // pushfd
+    encode_opcode_176, // pushf
+    encode_opcode_177, // pushfq
+    encode_opcode_178, // popf
+    encode_opcode_179, // popfd
+    encode_opcode_180, // popf
+    encode_opcode_181, // popfq
+    encode_opcode_182, // sahf
+    encode_opcode_183, // lahf
+    encode_opcode_184, // movs
+    encode_opcode_185, // movsb
+    encode_opcode_186, // movsw
+    encode_opcode_187, // movs
+    encode_opcode_188, // movsd
+    encode_opcode_189, // movs
+    encode_opcode_190, // movsw
+    encode_opcode_191, // movsd
+    encode_opcode_192, // movsq
+    encode_opcode_193, // cmps
+    encode_opcode_194, // cmpsb
+    encode_opcode_195, // cmpsw
+    encode_opcode_196, // cmps
+    encode_opcode_197, // cmpsd
+    encode_opcode_198, // cmps
+    encode_opcode_199, // cmpsw
+    encode_opcode_200, // cmpsd
+    encode_opcode_201, // cmpsq
+    encode_opcode_202, // test
+    encode_opcode_203, // test
+    encode_opcode_204, // stos
+    encode_opcode_205, // stosb
+    encode_opcode_206, // stosw
+    encode_opcode_207, // stos
+    encode_opcode_208, // stosd
+    encode_opcode_209, // stos
+    encode_opcode_210, // stosw
+    encode_opcode_211, // stosd
+    encode_opcode_212, // stosq
+    encode_opcode_213, // lods
+    encode_opcode_214, // lodsb
+    encode_opcode_215, // lodsw
+    encode_opcode_216, // lods
+    encode_opcode_217, // lodsd
+    encode_opcode_218, // lods
+    encode_opcode_219, // lodsw
+    encode_opcode_220, // lodsd
+    encode_opcode_221, // lodsq
+    encode_opcode_222, // scas
+    encode_opcode_223, // scasb
+    encode_opcode_224, // scasw
+    encode_opcode_225, // scas
+    encode_opcode_226, // scasd
+    encode_opcode_227, // scas
+    encode_opcode_228, // scasw
+    encode_opcode_229, // scasd
+    encode_opcode_230, // scasq
+    encode_opcode_231, // mov
+    encode_opcode_232, // mov
+    encode_opcode_233, // rol
+    encode_opcode_234, // ror
+    encode_opcode_235, // rcl
+    encode_opcode_236, // rcr
+    encode_opcode_237, // shl
+    encode_opcode_238, // sal
+    encode_opcode_239, // shr
+    encode_opcode_240, // sal
+    encode_opcode_241, // shl
+    encode_opcode_242, // sar
+    encode_opcode_243, // rol
+    encode_opcode_244, // ror
+    encode_opcode_245, // rcl
+    encode_opcode_246, // rcr
+    encode_opcode_247, // shl
+    encode_opcode_248, // sal
+    encode_opcode_249, // shr
+    encode_opcode_250, // sal
+    encode_opcode_251, // shl
+    encode_opcode_252, // sar
+    encode_opcode_253, // retn
+    encode_opcode_254, // retn
+    encode_opcode_255, // mov
+    encode_opcode_256, // mov
+    NULL, // enter
+    NULL, // enter
+    encode_opcode_259, // leave
+    encode_opcode_260, // leave
+    encode_opcode_261, // retf
+    encode_opcode_262, // retf
+    NULL, // int
+    encode_opcode_264, // int
+    encode_opcode_265, // into
+    encode_opcode_266, // iret
+    encode_opcode_267, // iretd
+    encode_opcode_268, // iret
+    encode_opcode_269, // iretd
+    encode_opcode_270, // iretq
+    NULL, // rol
+    NULL, // ror
+    NULL, // rcl
+    NULL, // rcr
+    NULL, // shl
+    NULL, // sal
+    NULL, // shr
+    NULL, // sal
+    NULL, // shl
+    NULL, // sar
+    NULL, // rol
+    NULL, // ror
+    NULL, // rcl
+    NULL, // rcr
+    NULL, // shl
+    NULL, // sal
+    NULL, // shr
+    NULL, // sal
+    NULL, // shl
+    NULL, // sar
+    encode_opcode_291, // rol
+    encode_opcode_292, // ror
+    encode_opcode_293, // rcl
+    encode_opcode_294, // rcr
+    encode_opcode_295, // shl
+    encode_opcode_296, // sal
+    encode_opcode_297, // shr
+    encode_opcode_298, // sal
+    encode_opcode_299, // shl
+    encode_opcode_300, // sar
+    encode_opcode_301, // rol
+    encode_opcode_302, // ror
+    encode_opcode_303, // rcl
+    encode_opcode_304, // rcr
+    encode_opcode_305, // shl
+    encode_opcode_306, // sal
+    encode_opcode_307, // shr
+    encode_opcode_308, // sal
+    encode_opcode_309, // shl
+    encode_opcode_310, // sar
+    encode_opcode_311, // xlat
+    encode_opcode_312, // xlatb
+    NULL, // fadd
+    NULL, // fadd
+    NULL, // fmul
+    NULL, // fmul
+    NULL, // fcom
+    NULL, // fcom
+    NULL, // fcomp
+    NULL, // fcomp
+    NULL, // fsub
+    NULL, // fsub
+    NULL, // fsubr
+    NULL, // fsubr
+    NULL, // fdiv
+    NULL, // fdiv
+    NULL, // fdivr
+    NULL, // fdivr
+    NULL, // fld
+    NULL, // fxch
+    NULL, // fxch
+    NULL, // fst
+    NULL, // fnop
+    NULL, // fstp
+    NULL, // fstp1
+    NULL, // fstp1
+    NULL, // fchs
+    NULL, // fabs
+    NULL, // ftst
+    NULL, // fxam
+    NULL, // fldcw
+    NULL, // fld1
+    NULL, // fldl2t
+    NULL, // fldl2e
+    NULL, // fldpi
+    NULL, // fldlg2
+    NULL, // fldln2
+    NULL, // fldz
+    NULL, // f2xm1
+    NULL, // fyl2x
+    NULL, // fptan
+    NULL, // fpatan
+    NULL, // fxtract
+    NULL, // fprem1
+    NULL, // fdecstp
+    NULL, // fincstp
+    NULL, // fnstcw
+    NULL, // fstcw
+    NULL, // fprem
+    NULL, // fyl2xp1
+    NULL, // fsqrt
+    NULL, // fsincos
+    NULL, // frndint
+    NULL, // fscale
+    NULL, // fsin
+    NULL, // fcos
+    NULL, // fiadd
+    NULL, // fcmovb
+    NULL, // fimul
+    NULL, // fcmove
+    NULL, // ficom
+    NULL, // fcmovbe
+    NULL, // ficomp
+    NULL, // fcmovu
+    NULL, // fisub
+    NULL, // fisubr
+    NULL, // fucompp
+    NULL, // fidiv
+    NULL, // fidivr
+    NULL, // fild
+    NULL, // fcmovnb
+    NULL, // fisttp
+    NULL, // fcmovne
+    NULL, // fist
+    NULL, // fcmovnbe
+    NULL, // fistp
+    NULL, // fcmovnu
+    NULL, // fneni
+    NULL, // feni
+    encode_opcode_390, // fneni
+    NULL, // fndisi
+    NULL, // fdisi
+    encode_opcode_393, // fndisi
+    NULL, // fnclex
+    NULL, // fclex
+    NULL, // fninit
+    NULL, // finit
+    NULL, // fnsetpm
+    NULL, // fsetpm
+    encode_opcode_400, // fnsetpm
+    NULL, // fld
+    NULL, // fucomi
+    NULL, // fcomi
+    NULL, // fstp
+    NULL, // fadd
+    NULL, // fadd
+    NULL, // fmul
+    NULL, // fmul
+    NULL, // fcom
+    NULL, // fcom2
+    NULL, // fcom2
+    NULL, // fcomp
+    NULL, // fcomp3
+    NULL, // fcomp3
+    NULL, // fsub
+    NULL, // fsubr
+    NULL, // fsubr
+    NULL, // fsub
+    NULL, // fdiv
+    NULL, // fdivr
+    NULL, // fdivr
+    NULL, // fdiv
+    NULL, // fld
+    NULL, // ffree
+    NULL, // fisttp
+    NULL, // fxch4
+    NULL, // fxch4
+    NULL, // fst
+    NULL, // fst
+    NULL, // fstp
+    NULL, // fstp
+    NULL, // fucom
+    NULL, // fucom
+    NULL, // fucomp
+    NULL, // fucomp
+    NULL, // fnstsw
+    NULL, // fstsw
+    NULL, // fiadd
+    NULL, // faddp
+    NULL, // faddp
+    NULL, // fimul
+    NULL, // fmulp
+    NULL, // fmulp
+    NULL, // ficom
+    NULL, // fcomp5
+    NULL, // fcomp5
+    NULL, // ficomp
+    NULL, // fcompp
+    NULL, // fisub
+    NULL, // fsubrp
+    NULL, // fsubrp
+    NULL, // fisubr
+    NULL, // fsubp
+    NULL, // fsubp
+    NULL, // fidiv
+    NULL, // fdivrp
+    NULL, // fdivrp
+    NULL, // fidivr
+    NULL, // fdivp
+    NULL, // fdivp
+    NULL, // fild
+    NULL, // ffreep
+    NULL, // fisttp
+    NULL, // fxch7
+    NULL, // fxch7
+    NULL, // fist
+    NULL, // fstp8
+    NULL, // fstp8
+    NULL, // fistp
+    NULL, // fstp9
+    NULL, // fstp9
+    NULL, // fnstsw
+    NULL, // fstsw
+    NULL, // fild
+    NULL, // fucomip
+    NULL, // fcomip
+    NULL, // fistp
+    encode_opcode_478, // loopnz
+    encode_opcode_479, // loopne
+    encode_opcode_480, // loopnz
+    encode_opcode_481, // loopne
+    encode_opcode_482, // loopz
+    encode_opcode_483, // loope
+    encode_opcode_484, // loopz
+    encode_opcode_485, // loope
+    encode_opcode_486, // loop
+    encode_opcode_487, // loop
+    encode_opcode_488, // jcxz
+    encode_opcode_489, // jecxz
+    encode_opcode_490, // jecxz
+    encode_opcode_491, // jrcxz
+    encode_opcode_492, // in
+    encode_opcode_493, // in
+    encode_opcode_494, // out
+    encode_opcode_495, // out
+    encode_opcode_496, // call
+    encode_opcode_497, // jmp
+    encode_opcode_498, // jmp
+    encode_opcode_499, // in
+    encode_opcode_500, // in
+    encode_opcode_501, // out
+    encode_opcode_502, // out
+    encode_opcode_503, // lock
+    encode_opcode_504, // int1
+    encode_opcode_505, // icebp
+    encode_opcode_506, // repnz
+    encode_opcode_507, // repne
+    encode_opcode_508, // rep
+    encode_opcode_509, // repnz
+    encode_opcode_510, // repne
+    encode_opcode_511, // rep
+    encode_opcode_512, // repz
+    encode_opcode_513, // repe
+    encode_opcode_514, // rep
+    encode_opcode_515, // repz
+    encode_opcode_516, // repe
+    encode_opcode_517, // rep
+    encode_opcode_518, // hlt
+    encode_opcode_519, // cmc
+    encode_opcode_520, // test
+    encode_opcode_521, // test
+    encode_opcode_522, // not
+    encode_opcode_523, // neg
+    encode_opcode_524, // mul
+    encode_opcode_525, // imul
+    encode_opcode_526, // div
+    encode_opcode_527, // idiv
+    encode_opcode_528, // test
+    encode_opcode_529, // test
+    encode_opcode_530, // not
+    encode_opcode_531, // neg
+    encode_opcode_532, // mul
+    encode_opcode_533, // imul
+    encode_opcode_534, // div
+    encode_opcode_535, // idiv
+    encode_opcode_536, // clc
+    encode_opcode_537, // stc
+    encode_opcode_538, // cli
+    encode_opcode_539, // sti
+    encode_opcode_540, // cld
+    encode_opcode_541, // std
+    encode_opcode_542, // inc
+    encode_opcode_543, // dec
+    encode_opcode_544, // inc
+    encode_opcode_545, // dec
+    encode_opcode_546, // call
+    encode_opcode_547, // call
+    encode_opcode_548, // jmp
+    encode_opcode_549, // jmp
+    encode_opcode_550, // push
+    encode_opcode_551, // push
+    NULL, // sldt
+    NULL, // str
+    encode_opcode_554, // lldt
+    encode_opcode_555, // ltr
+    encode_opcode_556, // verr
+    encode_opcode_557, // verw
+    encode_opcode_558, // jmpe
+    encode_opcode_559, // vmcall
+    encode_opcode_560, // vmlaunch
+    encode_opcode_561, // vmresume
+    encode_opcode_562, // vmxoff
+    encode_opcode_563, // monitor
+    encode_opcode_564, // mwait
+    encode_opcode_565, // xgetbv
+    encode_opcode_566, // xsetbv
+    NULL, // smsw
+    encode_opcode_568, // lmsw
+    NULL, // invlpg
+    encode_opcode_570, // swapgs
+    encode_opcode_571, // rdtscp
+    NULL, // lar
+    NULL, // lsl
+    encode_opcode_574, // loadall
+    encode_opcode_575, // syscall
+    encode_opcode_576, // clts
+    encode_opcode_577, // loadall
+    encode_opcode_578, // sysret
+    encode_opcode_579, // invd
+    encode_opcode_580, // wbinvd
+    encode_opcode_581, // ud2
+    encode_opcode_582, // nop
+    encode_opcode_583, // movss
+    encode_opcode_584, // movsd
+    encode_opcode_585, // movss
+    encode_opcode_586, // movsd
+    NULL, // movlps
+    NULL, // movlpd
+    encode_opcode_589, // movddup
+    encode_opcode_590, // movsldup
+    NULL, // movlps
+    NULL, // movlpd
+    NULL, // movhps
+    NULL, // movhpd
+    encode_opcode_595, // movshdup
+    NULL, // movhps
+    NULL, // movhpd
+    encode_opcode_598, // hint_nop
+    NULL, // prefetchnta
+    NULL, // prefetcht0
+    NULL, // prefetcht1
+    NULL, // prefetcht2
+    encode_opcode_603, // hint_nop
+    encode_opcode_604, // hint_nop
+    encode_opcode_605, // hint_nop
+    encode_opcode_606, // hint_nop
+    encode_opcode_607, // hint_nop
+    encode_opcode_608, // hint_nop
+    encode_opcode_609, // hint_nop
+    encode_opcode_610, // hint_nop
+    encode_opcode_611, // hint_nop
+    encode_opcode_612, // hint_nop
+    encode_opcode_613, // hint_nop
+    encode_opcode_614, // nop
+    encode_opcode_615, // hint_nop
+    encode_opcode_616, // hint_nop
+    encode_opcode_617, // hint_nop
+    encode_opcode_618, // hint_nop
+    encode_opcode_619, // hint_nop
+    encode_opcode_620, // hint_nop
+    encode_opcode_621, // hint_nop
+    encode_opcode_622, // cvtsi2ss
+    encode_opcode_623, // cvtsi2sd
+    encode_opcode_624, // cvttss2si
+    encode_opcode_625, // cvttsd2si
+    encode_opcode_626, // cvtss2si
+    encode_opcode_627, // cvtsd2si
+    encode_opcode_628, // ucomiss
+    encode_opcode_629, // ucomisd
+    encode_opcode_630, // comiss
+    encode_opcode_631, // comisd
+    encode_opcode_632, // wrmsr
+    encode_opcode_633, // rdtsc
+    encode_opcode_634, // rdmsr
+    encode_opcode_635, // rdpmc
+    encode_opcode_636, // sysenter
+    encode_opcode_637, // sysenter
+    encode_opcode_638, // sysexit
+    encode_opcode_639, // getsec
+    encode_opcode_640, // pshufb
+    encode_opcode_641, // phaddw
+    encode_opcode_642, // phaddd
+    encode_opcode_643, // phaddsw
+    encode_opcode_644, // pmaddubsw
+    encode_opcode_645, // phsubw
+    encode_opcode_646, // phsubd
+    encode_opcode_647, // phsubsw
+    encode_opcode_648, // psignb
+    encode_opcode_649, // psignw
+    encode_opcode_650, // psignd
+    encode_opcode_651, // pmulhrsw
+    encode_opcode_652, // pblendvb
+    encode_opcode_653, // ptest
+    encode_opcode_654, // pabsb
+    encode_opcode_655, // pabsw
+    encode_opcode_656, // pabsd
+    NULL, // pmovsxbw
+    NULL, // pmovsxbd
+    NULL, // pmovsxbq
+    NULL, // pmovsxwd
+    NULL, // pmovsxwq
+    NULL, // pmovsxdq
+    encode_opcode_663, // pmuldq
+    encode_opcode_664, // pcmpeqq
+    NULL, // movntdqa
+    encode_opcode_666, // packusdw
+    NULL, // pmovzxbw
+    NULL, // pmovzxbd
+    NULL, // pmovzxbq
+    NULL, // pmovzxwd
+    NULL, // pmovzxwq
+    NULL, // pmovzxdq
+    encode_opcode_673, // pcmpgtq
+    encode_opcode_674, // pminsb
+    encode_opcode_675, // pminsd
+    encode_opcode_676, // pminuw
+    encode_opcode_677, // pminud
+    encode_opcode_678, // pmaxsb
+    encode_opcode_679, // pmaxsd
+    encode_opcode_680, // pmaxuw
+    encode_opcode_681, // pmaxud
+    encode_opcode_682, // pmulld
+    encode_opcode_683, // phminposuw
+    NULL, // invept
+    NULL, // invept
+    NULL, // invvpid
+    NULL, // invvpid
+    NULL, // movbe
+    encode_opcode_689, // crc32
+    NULL, // movbe
+    encode_opcode_691, // crc32
+    encode_opcode_692, // roundss
+    encode_opcode_693, // roundsd
+    encode_opcode_694, // pblendw
+    encode_opcode_695, // palignr
+    NULL, // pextrb
+    NULL, // pextrw
+    encode_opcode_698, // pextrd
+    encode_opcode_699, // pextrq
+    encode_opcode_700, // extractps
+    NULL, // pinsrb
+    encode_opcode_702, // pinsrd
+    encode_opcode_703, // pinsrq
+    encode_opcode_704, // mpsadbw
+    encode_opcode_705, // cmovo
+    encode_opcode_706, // cmovno
+    encode_opcode_707, // cmovb
+    encode_opcode_708, // cmovnae
+    encode_opcode_709, // cmovc
+    encode_opcode_710, // cmovnb
+    encode_opcode_711, // cmovae
+    encode_opcode_712, // cmovnc
+    encode_opcode_713, // cmovz
+    encode_opcode_714, // cmove
+    encode_opcode_715, // cmovnz
+    encode_opcode_716, // cmovne
+    encode_opcode_717, // cmovbe
+    encode_opcode_718, // cmovna
+    encode_opcode_719, // cmovnbe
+    encode_opcode_720, // cmova
+    encode_opcode_721, // cmovs
+    encode_opcode_722, // cmovns
+    encode_opcode_723, // cmovp
+    encode_opcode_724, // cmovpe
+    encode_opcode_725, // cmovnp
+    encode_opcode_726, // cmovpo
+    encode_opcode_727, // cmovl
+    encode_opcode_728, // cmovnge
+    encode_opcode_729, // cmovnl
+    encode_opcode_730, // cmovge
+    encode_opcode_731, // cmovle
+    encode_opcode_732, // cmovng
+    encode_opcode_733, // cmovnle
+    encode_opcode_734, // cmovg
+    encode_opcode_735, // sqrtss
+    encode_opcode_736, // sqrtsd
+    encode_opcode_737, // rsqrtss
+    encode_opcode_738, // rcpss
+    encode_opcode_739, // addss
+    encode_opcode_740, // addsd
+    encode_opcode_741, // mulss
+    encode_opcode_742, // mulsd
+    encode_opcode_743, // cvtss2sd
+    encode_opcode_744, // cvtsd2ss
+    encode_opcode_745, // subss
+    encode_opcode_746, // subsd
+    encode_opcode_747, // minss
+    encode_opcode_748, // minsd
+    encode_opcode_749, // divss
+    encode_opcode_750, // divsd
+    encode_opcode_751, // maxss
+    encode_opcode_752, // maxsd
+    encode_opcode_753, // punpcklbw
+    encode_opcode_754, // punpcklwd
+    encode_opcode_755, // punpckldq
+    encode_opcode_756, // packsswb
+    encode_opcode_757, // pcmpgtb
+    encode_opcode_758, // pcmpgtw
+    encode_opcode_759, // pcmpgtd
+    encode_opcode_760, // packuswb
+    encode_opcode_761, // punpckhbw
+    encode_opcode_762, // punpckhwd
+    encode_opcode_763, // punpckhdq
+    encode_opcode_764, // packssdw
+    encode_opcode_765, // punpcklqdq
+    encode_opcode_766, // punpckhqdq
+    encode_opcode_767, // movd
+    encode_opcode_768, // movd
+    encode_opcode_769, // movq
+    encode_opcode_770, // movdqa
+    encode_opcode_771, // movdqu
+    encode_opcode_772, // pshuflw
+    encode_opcode_773, // pshufhw
+    encode_opcode_774, // pshufd
+    encode_opcode_775, // pcmpeqb
+    encode_opcode_776, // pcmpeqw
+    encode_opcode_777, // pcmpeqd
+    NULL, // emms
+    encode_opcode_779, // vmread
+    encode_opcode_780, // vmread
+    encode_opcode_781, // vmwrite
+    encode_opcode_782, // vmwrite
+    encode_opcode_783, // movd
+    encode_opcode_784, // movd
+    encode_opcode_785, // movq
+    encode_opcode_786, // movq
+    encode_opcode_787, // movdqa
+    encode_opcode_788, // movdqu
+    encode_opcode_789, // jo
+    encode_opcode_790, // jno
+    encode_opcode_791, // jb
+    encode_opcode_792, // jnae
+    encode_opcode_793, // jc
+    encode_opcode_794, // jnb
+    encode_opcode_795, // jae
+    encode_opcode_796, // jnc
+    encode_opcode_797, // jz
+    encode_opcode_798, // je
+    encode_opcode_799, // jnz
+    encode_opcode_800, // jne
+    encode_opcode_801, // jbe
+    encode_opcode_802, // jna
+    encode_opcode_803, // jnbe
+    encode_opcode_804, // ja
+    encode_opcode_805, // js
+    encode_opcode_806, // jns
+    encode_opcode_807, // jp
+    encode_opcode_808, // jpe
+    encode_opcode_809, // jnp
+    encode_opcode_810, // jpo
+    encode_opcode_811, // jl
+    encode_opcode_812, // jnge
+    encode_opcode_813, // jnl
+    encode_opcode_814, // jge
+    encode_opcode_815, // jle
+    encode_opcode_816, // jng
+    encode_opcode_817, // jnle
+    encode_opcode_818, // jg
+    encode_opcode_819, // seto
+    encode_opcode_820, // setno
+    encode_opcode_821, // setb
+    encode_opcode_822, // setnae
+    encode_opcode_823, // setc
+    encode_opcode_824, // setnb
+    encode_opcode_825, // setae
+    encode_opcode_826, // setnc
+    encode_opcode_827, // setz
+    encode_opcode_828, // sete
+    encode_opcode_829, // setnz
+    encode_opcode_830, // setne
+    encode_opcode_831, // setbe
+    encode_opcode_832, // setna
+    encode_opcode_833, // setnbe
+    encode_opcode_834, // seta
+    encode_opcode_835, // sets
+    encode_opcode_836, // setns
+    encode_opcode_837, // setp
+    encode_opcode_838, // setpe
+    encode_opcode_839, // setnp
+    encode_opcode_840, // setpo
+    encode_opcode_841, // setl
+    encode_opcode_842, // setnge
+    encode_opcode_843, // setnl
+    encode_opcode_844, // setge
+    encode_opcode_845, // setle
+    encode_opcode_846, // setng
+    encode_opcode_847, // setnle
+    encode_opcode_848, // setg
+    encode_opcode_849, // push
+    encode_opcode_850, // pop
+    encode_opcode_851, // cpuid
+    encode_opcode_852, // bt
+    encode_opcode_853, // shld
+    encode_opcode_854, // shld
+    encode_opcode_855, // push
+    encode_opcode_856, // pop
+    encode_opcode_857, // rsm
+    encode_opcode_858, // bts
+    encode_opcode_859, // shrd
+    encode_opcode_860, // shrd
+    NULL, // ldmxcsr
+    NULL, // stmxcsr
+    NULL, // xsave
+    NULL, // xsave
+    encode_opcode_865, // lfence
+    NULL, // xrstor
+    NULL, // xrstor
+    encode_opcode_868, // mfence
+    encode_opcode_869, // sfence
+    NULL, // clflush
+    encode_opcode_871, // imul
+    encode_opcode_872, // cmpxchg
+    encode_opcode_873, // cmpxchg
+    encode_opcode_874, // btr
+    encode_opcode_875, // movzx
+    encode_opcode_876, // movzx
+    encode_opcode_877, // jmpe
+    encode_opcode_878, // popcnt
+    encode_opcode_879, // ud
+    encode_opcode_880, // bt
+    encode_opcode_881, // bts
+    encode_opcode_882, // btr
+    encode_opcode_883, // btc
+    encode_opcode_884, // btc
+    encode_opcode_885, // bsf
+    encode_opcode_886, // bsr
+    encode_opcode_887, // movsx
+    encode_opcode_888, // movsx
+    encode_opcode_889, // cmpss
+    encode_opcode_890, // cmpsd
+    NULL, // movnti
+    NULL, // pinsrw
+    NULL, // cmpxchg8b
+    NULL, // cmpxchg8b
+    NULL, // cmpxchg16b
+    NULL, // vmptrld
+    NULL, // vmclear
+    NULL, // vmxon
+    NULL, // vmptrst
+    encode_opcode_900, // bswap
+    encode_opcode_901, // psrlw
+    encode_opcode_902, // psrld
+    encode_opcode_903, // psrlq
+    encode_opcode_904, // paddq
+    encode_opcode_905, // pmullw
+    encode_opcode_906, // movq
+    encode_opcode_907, // psubusb
+    encode_opcode_908, // psubusw
+    encode_opcode_909, // pminub
+    encode_opcode_910, // pand
+    encode_opcode_911, // paddusb
+    encode_opcode_912, // paddusw
+    encode_opcode_913, // pmaxub
+    encode_opcode_914, // pandn
+    encode_opcode_915, // pavgb
+    encode_opcode_916, // psraw
+    encode_opcode_917, // psrad
+    encode_opcode_918, // pavgw
+    encode_opcode_919, // pmulhuw
+    encode_opcode_920, // pmulhw
+    NULL, // movntdq
+    encode_opcode_922, // psubsb
+    encode_opcode_923, // psubsw
+    encode_opcode_924, // pminsw
+    encode_opcode_925, // por
+    encode_opcode_926, // paddsb
+    encode_opcode_927, // paddsw
+    encode_opcode_928, // pmaxsw
+    encode_opcode_929, // pxor
+    NULL, // lddqu
+    encode_opcode_931, // psllw
+    encode_opcode_932, // pslld
+    encode_opcode_933, // psllq
+    encode_opcode_934, // pmuludq
+    encode_opcode_935, // pmaddwd
+    encode_opcode_936, // psadbw
+    encode_opcode_937, // psubb
+    encode_opcode_938, // psubw
+    encode_opcode_939, // psubd
+    encode_opcode_940, // psubq
+    encode_opcode_941, // paddb
+    encode_opcode_942, // paddw
+    encode_opcode_943, // paddd
+};
\ No newline at end of file
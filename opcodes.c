@@ -2,21 +2,16 @@
 #include <stdlib.h>
 #include <string.h>
 
-#include "list.h"
 #include "opcodes.h"
-#include "strmap.h"
-#include "utils.h"
-
-// Uncomment to enable debug output
-// #define DEBUG
 
 static char *am_strings[] = { " ", "C", "D", "E", "ES", "EST", "G", "I", "J", "H", "M", "O", "R", "S", "ST", "T", "V", "W", "Z" };
 
 static char *type_strings[] = { "  ", "b", "bs", "bss", "d", "di", "dr", "dq", "dqp", "er", "q", "qi", "qp", "sr", "ss", "sd", "v", "vds", "vq", "vqp", "vs", "w", "wi", "1"};
 
-StrMap *opcode_alias_map;
+void print_opcode(int opcode_index) {
+    Opcode *opcode = &opcodes[opcode_index];
+    OpcodeOperands *operands = &opcode_operands[opcode_index];
 
-void print_opcode(Opcode *opcode) {
     char opcd_ext = opcode->needs_mod_rm
         ? 'r'
         : opcode->opcd_ext == -1 ? ' ' : '0' + opcode->opcd_ext;
@@ -49,7 +44,7 @@ void print_opcode(Opcode *opcode) {
         sec_opcd = "    ";
 
     printf("  %-10s  %s %s 0x%02x %s %c %c %c %s %c %s%s  %s%s  %s%s\n",
-        opcode->mnem,
+        opcode_mnemonics[opcode->mnem],
         prefix,
         ohf_prefix,
         opcode->primary_opcode,
@@ -58,47 +53,13 @@ void print_opcode(Opcode *opcode) {
         op_size,
         opcd_ext,
         opcode->needs_mod_rm ? "RM" : "  ",
-        opcode->acc ? 'a' : ' ',
-
-        am_strings[opcode->op1.am],
-        type_strings[opcode->op1.type],
-        am_strings[opcode->op2.am],
-        type_strings[opcode->op2.type],
-        am_strings[opcode->op3.am],
-        type_strings[opcode->op3.type]
+        operands->acc ? 'a' : ' ',
+
+        am_strings[operands->op1.am],
+        type_strings[operands->op1.type],
+        am_strings[operands->op2.am],
+        type_strings[operands->op2.type],
+        am_strings[operands->op3.am],
+        type_strings[operands->op3.type]
     );
 }
-
-void init_opcodes(void) {
-    opcode_alias_map = new_strmap();
-
-    for (int i = 0; i < opcode_aliases_count; i++) {
-        OpcodeAlias *opcode_alias = &opcode_aliases[i];
-
-        // Ensure opcode aliases are unique and add them to the map
-        List *opcode_alias_list = strmap_get(opcode_alias_map, opcode_alias->alias_mnem);
-        if (!opcode_alias_list) {
-            opcode_alias_list = new_list(8);
-            strmap_put(opcode_alias_map, opcode_alias->alias_mnem, opcode_alias_list);
-        }
-
-        append_to_list(opcode_alias_list, opcode_alias);
-
-        #ifdef DEBUG
-        printf("%s\n", opcode_alias->alias_mnem);
-        #endif
-
-        opcode_alias->opcodes = new_list(16);
-
-        for (int j = 0; j < opcode_count; j++) {
-            Opcode *opcode = &opcodes[j];
-            if (!strcmp(opcode->mnem, opcode_alias->mnem)) {
-                append_to_list(opcode_alias->opcodes, opcode);
-
-                #ifdef DEBUG
-                print_opcode(opcode);
-                #endif
-            }
-        }
-    }
-}
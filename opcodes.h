@@ -4,9 +4,6 @@
 #include <stdint.h>
 #include <stddef.h>
 
-#include "list.h"
-#include "strmap.h"
-
 // Addressing modes
 #define AM_C      1      // The reg field of the ModR/M byte selects a control register
 #define AM_D      2      // The reg field of the ModR/M byte selects a debug register
@@ -52,34 +49,44 @@
 #define AT_WI   22   // # Word Integer (x87 FPU only)
 #define AT_1    23   // Immediate one. Not part of the official spec
 
+// An opcode operand, packed into 32 bits
 typedef struct opcode_op {
-    int am;                     // Addressing mode
-    int type;                   // Type
-    int sizes;
-    char uses_op_size;
-    int can_be_imm64;
-    int word_or_double_word_operand;
-    char is_gen_reg;
-    char gen_reg_nr;
+    unsigned int am:5;                          // Addressing mode
+    unsigned int type:5;                        // Type
+    unsigned int sizes:6;                       // Mask of SIZE08 ... SIZEST
+    unsigned int uses_op_size:1;
+    unsigned int can_be_imm64:1;
+    unsigned int word_or_double_word_operand:1;
+    unsigned int is_gen_reg:1;
+    unsigned int gen_reg_nr:4;
 } OpcodeOp;
 
+// The parts of an opcode needed to match it against operands. They are checked for
+// every candidate opcode of an instruction, so are kept in a separate compact array,
+// opcode_operands, in parallel with opcodes.
+typedef struct opcode_operands {
+    OpcodeOp op1;
+    OpcodeOp op2;
+    OpcodeOp op3;
+    uint8_t arg_count;          // Number of operands
+    uint8_t acc:1;              // Accumulator
+    uint8_t branch:1;           // Is a branch instruction
+    uint8_t conver:1;           // Is a type conversion
+    uint8_t x87fpu:1;           // Is a X87 FPU long double instruction
+} OpcodeOperands;
+
+// The parts of an opcode needed to encode it
 typedef struct opcode {
-    char *mnem;
+    short mnem;                 // Index in opcode_mnemonics
     uint8_t prefix;             // Optional prefix
     uint8_t ohf_prefix;         // Optional 0xf prefix
     uint8_t primary_opcode;
     uint8_t sec_opcd;           // Secondary opcode
-    int opcd_ext;               // -1 if not used
-    int needs_mod_rm;
-    OpcodeOp op1;
-    OpcodeOp op2;
-    OpcodeOp op3;
-    char op_size;
-    char direction;
-    char acc;                   // Accumulator
-    char branch;                // Is a branch instruction
-    char conver;                // Is a type conversion
-    char x87fpu;                // Is a X87 FPU long double instruction
+    int8_t opcd_ext;            // -1 if not used
+    int8_t op_size;
+    int8_t direction;
+    uint8_t needs_mod_rm:1;
+    uint8_t default_64bit:1;    // Defaults to 64 bit in long mode, e.g. push. Never needs a REX prefix.
 } Opcode;
 
 typedef struct opcode_alias {
@@ -88,18 +95,32 @@ typedef struct opcode_alias {
     char op1_size;
     char op2_size;
     char op3_size;
-    List *opcodes;
+    short opcodes_start;        // Index in opcode_alias_opcodes of the first opcode
+    short opcodes_count;        // Number of opcodes
 } OpcodeAlias;
 
+// Opcode aliases that share the same name, e.g. movq
+typedef struct opcode_alias_group {
+    char *name;
+    short aliases_start;        // Index in opcode_aliases of the first alias
+    short aliases_count;        // Number of aliases
+} OpcodeAliasGroup;
+
+extern char *opcode_mnemonics[];
+extern OpcodeOperands opcode_operands[];
 extern Opcode opcodes[];
+extern short opcode_alias_opcodes[];
 extern OpcodeAlias opcode_aliases[];
+extern OpcodeAliasGroup opcode_alias_groups[];
 
 extern int opcode_count;
 extern int opcode_aliases_count;
+extern int opcode_alias_groups_count;
 
-extern StrMap *opcode_alias_map;
+// Index in opcodes and opcode_operands of the i-th opcode of an alias
+#define OPCODE_ALIAS_OPCODE_INDEX(opcode_alias, i) (opcode_alias_opcodes[(opcode_alias)->opcodes_start + (i)])
 
-void print_opcode(Opcode *opcode);
-void init_opcodes(void);
+void print_opcode(int opcode_index);
+int lookup_opcode_alias_group(char *name, int length);
 
 #endif
@@ -0,0 +1,241 @@
+#include <ctype.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "arena.h"
+#include "elf.h"
+#include "ordering.h"
+#include "parser.h"
+#include "symbols.h"
+
+// Function placement. Each code section is split into one range of chunks per function,
+// which starts at the function's label, or at the alignments right before it, and runs
+// up to the next function. Anything before the first function and after the .size of
+// the last one isn't in a range and stays where it is.
+//
+// With --symbol-ordering-file, the ranges are put in the order of the file. Functions
+// that aren't in it come after the ones that are, in their original order. With
+// -ffunction-sections, the ranges in .text each move to a section of their own, named
+// .text.<function>, which lets the linker leave out functions that aren't used.
+//
+// This is done before layout, so branches, relocations, .locs and .size expressions
+// all get their offsets from where the functions end up.
+
+char *symbol_ordering_filename;
+int function_sections;
+
+int ordered_functions;
+int function_section_count;
+
+typedef struct range {
+    int start;      // Offset of the first chunk in the stream
+    int end;        // Offset after the last chunk
+    int order;      // Position in the symbol ordering file, INT_MAX if not in it
+    int index;      // Position in the section
+    Symbol *symbol; // The first function in the range
+} Range;
+
+// Give the symbols in the ordering file their position in it. Names that aren't
+// symbols are ignored, as are blank lines and # comments.
+static void read_symbol_ordering_file(void) {
+    FILE *f = fopen(symbol_ordering_filename, "r");
+
+    if (f == 0) {
+        perror(symbol_ordering_filename);
+        exit(1);
+    }
+
+    char *line = NULL;
+    size_t allocated = 0;
+    int order = 0;
+
+    while (getline(&line, &allocated, f) != -1) {
+        char *name = line;
+        while (isspace(*name)) name++;
+
+        char *end = name + strlen(name);
+        while (end > name && isspace(end[-1])) end--;
+        *end = 0;
+
+        if (!*name || *name == '#') continue;
+
+        Symbol *symbol = get_symbol(name);
+        if (symbol && !symbol->order) symbol->order = ++order;
+    }
+
+    free(line);
+    fclose(f);
+}
+
+static int compare_ranges(const void *a, const void *b) {
+    const Range *range1 = a;
+    const Range *range2 = b;
+
+    if (range1->order != range2->order) return range1->order < range2->order ? -1 : 1;
+    return range1->index - range2->index;
+}
+
+// Split the chunks into function ranges. Returns the number of ranges, which is zero
+// if there are no functions.
+static int find_function_ranges(Chunks *chunks, Range **result) {
+    Range *ranges = NULL;
+    int range_count = 0;
+    int allocated = 0;
+
+    int split = 0;          // Where a function starting here starts, before any alignments
+    int size_end = 0;       // Offset after the last .size of a function
+    int has_code = 0;       // Is there anything but labels and alignments in the last range
+
+    chunks_foreach(chunks, chunk) {
+        int offset = (char *) chunk - chunks->data;
+
+        if (chunk->type == CT_LABEL) {
+            Symbol *symbol = ((LabelChunk *) chunk)->symbol;
+
+            if (symbol->type == STT_FUNC) {
+                // Functions at the same place share a range
+                if (!range_count || has_code) {
+                    if (range_count == allocated) {
+                        allocated = allocated ? allocated * 2 : 64;
+                        ranges = realloc(ranges, allocated * sizeof(Range));
+                    }
+
+                    if (range_count) ranges[range_count - 1].end = split;
+                    ranges[range_count] = (Range) { split, 0, INT_MAX, range_count, symbol };
+                    range_count++;
+                    has_code = 0;
+                }
+
+                Range *range = &ranges[range_count - 1];
+                if (symbol->order && symbol->order < range->order) range->order = symbol->order;
+            }
+        }
+        else if (chunk->type != CT_ALIGN) {
+            has_code = 1;
+
+            if (chunk->type == CT_SIZE_EXPR && ((SizeChunk *) chunk)->size_symbol->type == STT_FUNC)
+                size_end = offset + chunk->length;
+        }
+
+        if (chunk->type != CT_ALIGN) split = offset + chunk->length;
+    }
+
+    // Whatever comes after the last function stays at the end
+    if (range_count) {
+        Range *last = &ranges[range_count - 1];
+        last->end = size_end > last->start ? size_end : chunks->size;
+    }
+
+    *result = ranges;
+    return range_count;
+}
+
+// Copy the chunks of a range to the end of another stream of chunks
+static void append_range(Chunks *chunks, Chunks *source, Range *range) {
+    for (Chunk *chunk = (Chunk *) (source->data + range->start); chunk < (Chunk *) (source->data + range->end); chunk = NEXT_CHUNK(chunk))
+        memcpy(append_chunk(chunks, chunk->type, chunk->length), chunk, chunk->length);
+}
+
+// Move each function in .text to a .text.<function> section, in the order of the
+// symbol ordering file if there is one.
+static void split_function_sections(void) {
+    Chunks *chunks = section_text->chunks;
+    if (!chunks) return;
+
+    Range *ranges;
+    int range_count = find_function_ranges(chunks, &ranges);
+    if (!range_count) return;
+
+    int prefix_end = ranges[0].start;
+    int suffix_start = ranges[range_count - 1].end;
+
+    qsort(ranges, range_count, sizeof(Range), compare_ranges);
+
+    for (int i = 0; i < range_count; i++) {
+        Range *range = &ranges[i];
+        char *name = arena_alloc(strlen(range->symbol->name) + 7);
+        sprintf(name, ".text.%s", range->symbol->name);
+
+        // Functions with the same name as an existing section are added to it
+        Section *section = get_section(name);
+        if (!section) {
+            section = add_section(name, SHT_PROGBITS, SHF_ALLOC | SHF_EXECINSTR, 1);
+            function_section_count++;
+        }
+
+        if (!section->chunks) section->chunks = calloc(1, sizeof(Chunks));
+        append_range(section->chunks, chunks, range);
+
+        // The section must be aligned at least as much as anything in it
+        for (Chunk *chunk = (Chunk *) (chunks->data + range->start); chunk < (Chunk *) (chunks->data + range->end); chunk = NEXT_CHUNK(chunk)) {
+            if (chunk->type == CT_ALIGN && ((AlignChunk *) chunk)->alignment > section->align)
+                section->align = ((AlignChunk *) chunk)->alignment;
+        }
+    }
+
+    // Only what's before the first and after the last function stays in .text
+    Chunks text = {0};
+    Range prefix = { .start = 0, .end = prefix_end };
+    Range suffix = { .start = suffix_start, .end = chunks->size };
+    append_range(&text, chunks, &prefix);
+    append_range(&text, chunks, &suffix);
+
+    free(chunks->data);
+    *chunks = text;
+    free(ranges);
+}
+
+// Put the functions of a section in the order of the symbol ordering file
+static void order_section_functions(Section *section) {
+    Chunks *chunks = section->chunks;
+
+    Range *ranges;
+    int range_count = find_function_ranges(chunks, &ranges);
+
+    int is_ordered = 0;
+    for (int i = 0; i < range_count; i++) {
+        if (ranges[i].order != INT_MAX) {
+            ordered_functions++;
+            is_ordered = 1;
+        }
+    }
+
+    if (!is_ordered || range_count < 2) {
+        free(ranges);
+        return;
+    }
+
+    int prefix_end = ranges[0].start;
+    int suffix_start = ranges[range_count - 1].end;
+
+    qsort(ranges, range_count, sizeof(Range), compare_ranges);
+
+    char *data = malloc(chunks->allocated);
+    memcpy(data, chunks->data, prefix_end);
+    int size = prefix_end;
+
+    for (int i = 0; i < range_count; i++) {
+        memcpy(data + size, chunks->data + ranges[i].start, ranges[i].end - ranges[i].start);
+        size += ranges[i].end - ranges[i].start;
+    }
+
+    memcpy(data + size, chunks->data + suffix_start, chunks->size - suffix_start);
+
+    free(chunks->data);
+    chunks->data = data;
+    free(ranges);
+}
+
+// Move functions to their own sections and reorder them
+void place_functions(void) {
+    if (symbol_ordering_filename) read_symbol_ordering_file();
+    if (function_sections) split_function_sections();
+    if (!symbol_ordering_filename) return;
+
+    for (int i = 0; i < sections_list->length; i++) {
+        Section *section = sections_list->elements[i];
+        if (section->chunks && (section->flags & SHF_EXECINSTR)) order_section_functions(section);
+    }
+}
@@ -0,0 +1,12 @@
+#ifndef _ORDERING_H
+#define _ORDERING_H
+
+extern char *symbol_ordering_filename;
+extern int function_sections;
+
+extern int ordered_functions;
+extern int function_section_count;
+
+void place_functions(void);
+
+#endif
@@ -2,7 +2,7 @@
 #include <string.h>
 #include <stdlib.h>
 
-#include "branches.h"
+#include "arena.h"
 #include "dwarf.h"
 #include "elf.h"
 #include "expr.h"
@@ -21,24 +21,62 @@ typedef struct simple_expression {
     long value;     // Optional value. If symbol is set, it's an offset
 } SimpleExpression;
 
-static List *cur_chunks;       // Chunks list for current section
+#define MAX_SHARED_INSTRUCTIONS_KEY_SIZE 256
+
+static Section *cur_section;   // Section things are being added to
+static Chunks *cur_chunks;     // Chunks of the current section
+
+// Instructions of statements without a relocation, keyed by the mnemonic and the operands
+// without whitespace, so that identical statements are only encoded once.
+static StrMap *shared_instructions;
+
+int shared_instructions_hits;
+int shared_instructions_misses;
 
 // Lookup or create section by name and make it the current section things are being added to
 static void set_current_section(char *name) {
     Section *section = get_section(name);
     if (!section) section = add_section(name, SHT_PROGBITS, 0, 1);
-    if (!section->chunks) section->chunks = new_list(10240);
+    if (!section->chunks) section->chunks = calloc(1, sizeof(Chunks));
+    cur_section = section;
     cur_chunks = section->chunks;
 }
 
+// Append a zeroed record of size bytes to a stream of chunks. The returned pointer is
+// only valid until the next chunk is added.
+void *append_chunk(Chunks *chunks, int type, int size) {
+    int length = ALIGN_UP(size, CHUNK_ALIGNMENT);
+    if (length > 0xff) panic("Chunk record of %d bytes is too large", length);
+
+    if (chunks->size + length > chunks->allocated) {
+        chunks->allocated = chunks->allocated ? chunks->allocated * 2 : 64 * 1024;
+        chunks->data = realloc(chunks->data, chunks->allocated);
+    }
+
+    Chunk *chunk = (Chunk *) (chunks->data + chunks->size);
+    memset(chunk, 0, length);
+    chunk->type = type;
+    chunk->length = length;
+
+    chunks->size += length;
+    chunks->count++;
+
+    return chunk;
+}
+
+// Append a record to the chunks of the current section
+static void *add_chunk(int type, int size) {
+    return append_chunk(cur_chunks, type, size);
+}
+
 static long parse_signed_integer(void) {
     int negative = 0;
-    if (cur_token == TOK_MINUS) {
+    if (TOKEN_KIND(cur_token_index) == TOK_MINUS) {
         negative = 1;
         next();
     }
     expect(TOK_INTEGER, "integer");
-    long result = negative ? -cur_long : cur_long;
+    long result = negative ? -TOKEN_INTEGER(cur_token_index) : TOKEN_INTEGER(cur_token_index);
     next();
 
     return result;
@@ -61,29 +99,24 @@ static SimpleExpression parse_simple_expression(void) {
 
 // Parse .byte, .word, .long, .quad, etc
 static Chunk *parse_data_directive(int size) {
-    Chunk *chunk = calloc(1, sizeof(Chunk));
-    chunk->type = CT_DATA;
-    chunk->dac.expr = parse_expression();
-    chunk->dac.size = size;
+    Node *expr = parse_expression();
 
-    append_to_list(cur_chunks, chunk);
+    DataChunk *chunk = add_chunk(CT_DATA, sizeof(DataChunk));
+    chunk->expr = expr;
+    chunk->size = size;
 
-    return chunk;
+    return (Chunk *) chunk;
 }
 
 // Parse and encode .sleb128 and .uleb128
 static Chunk *common_parse_leb128(int (*encoder)(int, char *)) {
-    Chunk *chunk = calloc(1, sizeof(Chunk));
-    chunk->type = CT_DATA;
-
     long value = parse_signed_integer();
 
-    chunk->dac.data = malloc(8);
-    chunk->dac.size = encoder(value, chunk->dac.data);
-
-    append_to_list(cur_chunks, chunk);
+    DataChunk *chunk = add_chunk(CT_DATA, sizeof(DataChunk));
+    chunk->data = arena_alloc(8);
+    chunk->size = encoder(value, chunk->data);
 
-    return chunk;
+    return (Chunk *) chunk;
 }
 
 // Parse and encode .sleb128
@@ -97,24 +130,46 @@ static Chunk *parse_uleb128(void) {
 }
 
 
-Chunk *parse_directive_statement(void) {
-    Chunk *result = NULL;
-    int directive = cur_token;
+// Parse .align, .balign or .p2align ALIGNMENT[, [FILL][, MAX-SKIP]]
+static void parse_alignment_directive(int directive) {
+    long value = parse_signed_integer();
+
+    if (directive == TOK_DIRECTIVE_P2ALIGN) {
+        if (value < 0 || value > 30) panic(".p2align %ld is out of range", value);
+        value = 1 << value;
+    }
+    else if (value <= 0 || (value & (value - 1)) != 0)
+        panic(".align is not a power of 2");
+
+    // The section must be aligned at least as much as anything in it
+    if (value > cur_section->align) cur_section->align = value;
+
+    AlignChunk *chunk = add_chunk(CT_ALIGN, sizeof(AlignChunk));
+    chunk->alignment = value;
+    chunk->max_skip = value - 1;
+    chunk->fill = -1;
+
+    if (TOKEN_KIND(cur_token_index) != TOK_COMMA) return;
     next();
 
-    switch (directive) {
-        case TOK_DIRECTIVE_ALIGN: {
-            long value = parse_signed_integer();
-            if ((value & (value - 1)) != 0) panic(".align is not a power of 2");
+    if (TOKEN_KIND(cur_token_index) != TOK_COMMA) chunk->fill = parse_signed_integer() & 0xff;
+    if (TOKEN_KIND(cur_token_index) != TOK_COMMA) return;
+    next();
 
-            Chunk *result = calloc(1, sizeof(Chunk));
-            result->type = CT_ALIGN;
-            result->aic.alignment = value;
+    chunk->max_skip = parse_signed_integer();
+}
 
-            append_to_list(cur_chunks, result);
+Chunk *parse_directive_statement(void) {
+    Chunk *result = NULL;
+    int directive = TOKEN_KIND(cur_token_index);
+    next();
 
+    switch (directive) {
+        case TOK_DIRECTIVE_ALIGN:
+        case TOK_DIRECTIVE_BALIGN:
+        case TOK_DIRECTIVE_P2ALIGN:
+            parse_alignment_directive(directive);
             break;
-        }
 
         case TOK_DIRECTIVE_BYTE:
             result = parse_data_directive(1);
@@ -138,16 +193,16 @@ Chunk *parse_directive_statement(void) {
             break;
 
         case TOK_DIRECTIVE_FILE: {
-            if (cur_token == TOK_INTEGER) {
-                int number = cur_long;
+            if (TOKEN_KIND(cur_token_index) == TOK_INTEGER) {
+                int number = TOKEN_INTEGER(cur_token_index);
                 next();
                 expect(TOK_STRING_LITERAL, "filename");
-                add_dwarf_file(number, strdup(cur_string_literal.data));
+                add_dwarf_file(number, copy_string_literal(&TOKEN_STRING_LITERAL(cur_token_index)));
                 next();
             }
             else {
                 expect(TOK_STRING_LITERAL, "filename");
-                add_file_symbol(strdup(cur_string_literal.data));
+                add_file_symbol(copy_string_literal(&TOKEN_STRING_LITERAL(cur_token_index)));
                 next();
             }
 
@@ -156,18 +211,15 @@ Chunk *parse_directive_statement(void) {
 
         case TOK_DIRECTIVE_LOC: {
             expect(TOK_INTEGER, "integer");
-            int file_index = cur_long;
+            int file_index = TOKEN_INTEGER(cur_token_index);
             next();
 
-            int line_number = cur_long;
+            int line_number = TOKEN_INTEGER(cur_token_index);
             consume(TOK_INTEGER, "integer");
 
-            Chunk *chunk = calloc(1, sizeof(Chunk));
-            chunk->type = CT_LOC;
-            chunk->loc.file_index = file_index;
-            chunk->loc.line_number = line_number;
-
-            append_to_list(cur_chunks, chunk);
+            LocChunk *chunk = add_chunk(CT_LOC, sizeof(LocChunk));
+            chunk->file_index = file_index;
+            chunk->line_number = line_number;
 
             break;
         }
@@ -176,10 +228,10 @@ Chunk *parse_directive_statement(void) {
             expect(TOK_IDENTIFIER, "symbol");
 
             // Need to see if the symbol is preexisting and was flagged as a local
-            Symbol *symbol = get_symbol(cur_identifier);
+            Symbol *symbol = get_symbol(TOKEN_IDENTIFIER(cur_token_index)->name);
             int was_local = 0;
             if (!symbol) {
-                symbol = add_symbol(strdup(cur_identifier));
+                symbol = add_symbol(TOKEN_IDENTIFIER(cur_token_index)->name);
             }
             else {
                 was_local = 1;
@@ -214,7 +266,7 @@ Chunk *parse_directive_statement(void) {
 
         case TOK_DIRECTIVE_GLOBL: {
             expect(TOK_IDENTIFIER, "symbol");
-            Symbol *symbol = get_or_add_symbol(strdup(cur_identifier));
+            Symbol *symbol = get_or_add_identifier_symbol(TOKEN_IDENTIFIER(cur_token_index));
             symbol->binding = STB_GLOBAL;
             next();
             break;
@@ -222,7 +274,7 @@ Chunk *parse_directive_statement(void) {
 
         case TOK_DIRECTIVE_LOCAL: {
             expect(TOK_IDENTIFIER, "symbol");
-            Symbol *symbol = get_or_add_symbol(strdup(cur_identifier));
+            Symbol *symbol = get_or_add_identifier_symbol(TOKEN_IDENTIFIER(cur_token_index));
             if (symbol->binding != STB_GLOBAL) symbol->binding = STB_LOCAL; // Global trumps local
             next();
             break;
@@ -238,16 +290,16 @@ Chunk *parse_directive_statement(void) {
             //.- section .debug_strx,"S",@progbits
 
             expect(TOK_IDENTIFIER, "section name");
-            char *name = strdup(cur_identifier);
+            char *name = TOKEN_IDENTIFIER(cur_token_index)->name;
             next();
 
             int flags = 0;
-            if (cur_token == TOK_COMMA) {
+            if (TOKEN_KIND(cur_token_index) == TOK_COMMA) {
                 next();
                 expect(TOK_STRING_LITERAL, "flags string literal");
 
-                for (int i = 0; i < cur_string_literal.size - 1; i++) {
-                    char c = cur_string_literal.data[i];
+                for (int i = 0; i < TOKEN_STRING_LITERAL(cur_token_index).size - 1; i++) {
+                    char c = TOKEN_STRING_LITERAL(cur_token_index).data[i];
 
                     switch (c) {
                         case 'a': flags |= SHF_ALLOC;     break;
@@ -264,17 +316,17 @@ Chunk *parse_directive_statement(void) {
             }
 
             int type = SHT_PROGBITS;
-            if (cur_token == TOK_COMMA) {
+            if (TOKEN_KIND(cur_token_index) == TOK_COMMA) {
                 next();
                 expect(TOK_IDENTIFIER, "Expected @progbits"); // Other types aren't implemented
-                if (strcmp(cur_identifier, "@progbits")) error("Expected @progbits; others aren't implemented");
+                if (strcmp(TOKEN_IDENTIFIER(cur_token_index)->name, "@progbits")) error("Expected @progbits; others aren't implemented");
                 next();
             }
 
-            if (cur_token == TOK_COMMA) {
+            if (TOKEN_KIND(cur_token_index) == TOK_COMMA) {
                 next();
                 expect(TOK_INTEGER, "entsize");
-                if (cur_long != 1) error("Values other than 1 for entsise aren't implemented");
+                if (TOKEN_INTEGER(cur_token_index) != 1) error("Values other than 1 for entsise aren't implemented");
                 next();
             }
 
@@ -286,7 +338,7 @@ Chunk *parse_directive_statement(void) {
 
         case TOK_DIRECTIVE_SIZE: {
             expect(TOK_IDENTIFIER, "identifier");
-            Symbol *symbol = get_or_add_symbol(strdup(cur_identifier));
+            Symbol *symbol = get_or_add_identifier_symbol(TOKEN_IDENTIFIER(cur_token_index));
             next();
             consume(TOK_COMMA, ",");
             Node *root = parse_expression();
@@ -296,11 +348,9 @@ Chunk *parse_directive_statement(void) {
                 symbol->size = root->value->number;
             }
             else {
-                Chunk *result = calloc(1, sizeof(Chunk));
-                result->type = CT_SIZE_EXPR;
-                result->sic.size_expr = root;
-                result->sic.size_symbol = symbol;
-                append_to_list(cur_chunks, result);
+                SizeChunk *chunk = add_chunk(CT_SIZE_EXPR, sizeof(SizeChunk));
+                chunk->size_expr = root;
+                chunk->size_symbol = symbol;
             }
 
             break;
@@ -309,11 +359,10 @@ Chunk *parse_directive_statement(void) {
         case TOK_DIRECTIVE_STRING: {
             expect(TOK_STRING_LITERAL, "string literal");
 
-            result = calloc(1, sizeof(Chunk));
-            result->type = CT_DATA;
-            result->dac.data = strdup(cur_string_literal.data);
-            result->dac.size = cur_string_literal.size;
-            append_to_list(cur_chunks, result);
+            DataChunk *chunk = add_chunk(CT_DATA, sizeof(DataChunk));
+            chunk->data = copy_string_literal(&TOKEN_STRING_LITERAL(cur_token_index));
+            chunk->size = TOKEN_STRING_LITERAL(cur_token_index).size;
+            result = (Chunk *) chunk;
 
             next();
 
@@ -326,17 +375,18 @@ Chunk *parse_directive_statement(void) {
 
         case TOK_DIRECTIVE_TYPE:
             expect(TOK_IDENTIFIER, "identifier");
-            Symbol *symbol = get_or_add_symbol(strdup(cur_identifier));
+            Symbol *symbol = get_or_add_identifier_symbol(TOKEN_IDENTIFIER(cur_token_index));
             next();
             consume(TOK_COMMA, ",");
             expect(TOK_IDENTIFIER, "symbol type");
 
-            if (!strcmp(cur_identifier, "@function"))
+            char *type_name = TOKEN_IDENTIFIER(cur_token_index)->name;
+            if (!strcmp(type_name, "@function"))
                 symbol->type = STT_FUNC;
-            else if (!strcmp(cur_identifier, "@object"))
+            else if (!strcmp(type_name, "@object"))
                 symbol->type = STT_OBJECT;
             else
-                error("Unknown symbol type %s", cur_identifier);
+                error("Unknown symbol type %s", type_name);
 
             next();
 
@@ -351,11 +401,8 @@ Chunk *parse_directive_statement(void) {
             break;
 
         case TOK_DIRECTIVE_ZERO: {
-            Chunk *result = calloc(1, sizeof(Chunk));
-            result->type = CT_ZERO;
-            result->zec.size = cur_long;
-
-            append_to_list(cur_chunks, result);
+            ZeroChunk *chunk = add_chunk(CT_ZERO, sizeof(ZeroChunk));
+            chunk->size = TOKEN_INTEGER(cur_token_index);
 
             next();
 
@@ -370,8 +417,8 @@ Chunk *parse_directive_statement(void) {
 }
 
 // Truncate the register to a range 0-15 if it's one of the common registers.
-static int get_cur_register_reg(void) {
-    return cur_register < REG_RIP ? cur_register & 0xf : cur_register;
+static int get_register_reg(int reg) {
+    return reg < REG_RIP ? reg & 0xf : reg;
 }
 
 // Parse register, putting the details in op.
@@ -379,21 +426,22 @@ static void parse_register(Operand *op) {
     memset(op, 0, sizeof(Operand));
 
     // A pointer in a register is treated just like a register.
-    if (cur_token == TOK_MULTIPLY) next();
+    if (TOKEN_KIND(cur_token_index) == TOK_MULTIPLY) next();
 
     // Truncate unless it's RIP
-    op->reg = get_cur_register_reg();
+    int reg = TOKEN_REGISTER(cur_token_index);
+    op->reg = get_register_reg(reg);
 
     op->type =
-          cur_register < REG_WORD ? REG08
-        : cur_register < REG_LONG ? REG16
-        : cur_register < REG_QUAD ? REG32
-        : cur_register < REG_XMM  ? REG64
-        : cur_register < REG_ST   ? REGXM
-        : cur_register < REG_RIP  ? REGST
-                                  : REG64;
+          reg < REG_WORD ? REG08
+        : reg < REG_LONG ? REG16
+        : reg < REG_QUAD ? REG32
+        : reg < REG_XMM  ? REG64
+        : reg < REG_ST   ? REGXM
+        : reg < REG_RIP  ? REGST
+                         : REG64;
 
-    if (cur_register_alt_8bit) op->type |= ALT_8BIT;
+    if (TOKEN_REGISTER_IS_ALT_8BIT(cur_token_index)) op->type |= ALT_8BIT;
 
     next();
 }
@@ -405,7 +453,7 @@ static void parse_indirect_operand(Operand *op) {
     consume(TOK_LPAREN, "(");
     parse_register(op);
 
-    if (cur_token == TOK_COMMA) {
+    if (TOKEN_KIND(cur_token_index) == TOK_COMMA) {
         // Parse (base, index, scale)
 
         op->has_sib = 1;
@@ -413,13 +461,13 @@ static void parse_indirect_operand(Operand *op) {
         next();
 
         expect(TOK_REGISTER, "register");
-        op->index = get_cur_register_reg();
+        op->index = get_register_reg(TOKEN_REGISTER(cur_token_index));
         next();
 
         consume(TOK_COMMA, ",");
         expect(TOK_INTEGER, "integer");
 
-        switch (cur_long) {
+        switch (TOKEN_INTEGER(cur_token_index)) {
             case 1: op->scale = 0; break;
             case 2: op->scale = 1; break;
             case 4: op->scale = 2; break;
@@ -436,23 +484,21 @@ static void parse_indirect_operand(Operand *op) {
 }
 
 // Register/look up the symbol for a relocation and store it in the op.
-static void preprocess_op_relocation(Operand *op, char *identifier) {
-    if (string_ends_with(identifier, "@PLT")) {
-        char *symbol_name = strdup(identifier);
-        symbol_name[strlen(identifier) - 4] = 0;
-        identifier = symbol_name;
-    }
-    else if (string_ends_with(identifier, "@GOTPCREL")) {
-        char *symbol_name = strdup(identifier);
-        symbol_name[strlen(identifier) - 9] = 0;
-        identifier = symbol_name;
+static void preprocess_op_relocation(Operand *op, Identifier *identifier) {
+    char *name = identifier->name;
+
+    // Strip @PLT and @GOTPCREL and look up the symbol by the rest of the name
+    int suffix_size = 0;
+    if (string_ends_with(name, "@PLT"))
+        suffix_size = 4;
+    else if (string_ends_with(name, "@GOTPCREL")) {
+        suffix_size = 9;
         op->relocation_type = R_X86_64_REX_GOTP;
     }
-    else
-        identifier = strdup(identifier);
 
-    Symbol *symbol = get_or_add_symbol(identifier);
-    op->relocation_symbol = symbol;
+    if (suffix_size) identifier = intern_identifier(name, strlen(name) - suffix_size);
+
+    op->relocation_symbol = get_or_add_identifier_symbol(identifier);
 }
 
 // Determine integer size
@@ -467,11 +513,11 @@ static int get_integer_size(long value) {
 static void parse_operand(Operand *op) {
     memset(op, 0, sizeof(Operand));
 
-    if (cur_token == TOK_REGISTER || cur_token == TOK_MULTIPLY) {
+    if (TOKEN_KIND(cur_token_index) == TOK_REGISTER || TOKEN_KIND(cur_token_index) == TOK_MULTIPLY) {
         parse_register(op);
     }
 
-    else if (cur_token == TOK_DOLLAR) {
+    else if (TOKEN_KIND(cur_token_index) == TOK_DOLLAR) {
         // Immediate
         next();
         long value = parse_signed_integer();
@@ -479,15 +525,23 @@ static void parse_operand(Operand *op) {
         op->imm_or_mem_value = value;
     }
 
-    else if (cur_token == TOK_INTEGER || cur_token == TOK_MINUS) {
+    else if (TOKEN_KIND(cur_token_index) == TOK_INTEGER || TOKEN_KIND(cur_token_index) == TOK_MINUS) {
         // Memory
-        SimpleExpression expr = parse_simple_expression();
-        if (expr.symbol) error("Unexpected symbol in expression"); // Not implemented
+        int value;
+        int sign = TOKEN_KIND(cur_token_index) == TOK_MINUS;
+        if (peek_token(sign) == TOK_INTEGER && peek_token(sign + 1) == TOK_LPAREN) {
+            // A plain displacement like -8(%rbp) doesn't need an expression tree
+            value = parse_signed_integer();
+        }
+        else {
+            SimpleExpression expr = parse_simple_expression();
+            if (expr.symbol) error("Unexpected symbol in expression"); // Not implemented
+            value = expr.value;
+        }
 
-        int value = expr.value;
         op->type = MEM32; // Default memory address size
 
-        if (cur_token == TOK_LPAREN) {
+        if (TOKEN_KIND(cur_token_index) == TOK_LPAREN) {
             // Parse 5(...)
             parse_indirect_operand(op);
 
@@ -508,7 +562,7 @@ static void parse_operand(Operand *op) {
             op->imm_or_mem_value = value;
     }
 
-    else if (cur_token == TOK_IDENTIFIER) {
+    else if (TOKEN_KIND(cur_token_index) == TOK_IDENTIFIER) {
         // Parse:
         // identifier
         // identifier+n
@@ -516,45 +570,99 @@ static void parse_operand(Operand *op) {
         // identifier+n(%reg...)
 
         op->type = MEM32; // Default memory address size
-        char *identifier_copy = strdup(cur_identifier);
+        Identifier *identifier = TOKEN_IDENTIFIER(cur_token_index);
         next();
 
         // identifier+n
         int relocation_addend = 0;
-        if (cur_token == TOK_PLUS || cur_token == TOK_MINUS) {
-            int negative = cur_token == TOK_MINUS;
+        if (TOKEN_KIND(cur_token_index) == TOK_PLUS || TOKEN_KIND(cur_token_index) == TOK_MINUS) {
+            int negative = TOKEN_KIND(cur_token_index) == TOK_MINUS;
             next();
 
             relocation_addend = parse_signed_integer();
             if (negative) relocation_addend = - relocation_addend;
         }
 
-        preprocess_op_relocation(op, identifier_copy);
+        preprocess_op_relocation(op, identifier);
 
-        if (cur_token == TOK_LPAREN) {
+        if (TOKEN_KIND(cur_token_index) == TOK_LPAREN) {
             // (...)
             parse_indirect_operand(op);
             op->displacement_size = SIZE32;
             op->relocation_addend = relocation_addend;
 
-            preprocess_op_relocation(op, identifier_copy);
-            free(identifier_copy);
+            preprocess_op_relocation(op, identifier);
         }
     }
 
-    else if (cur_token == TOK_LPAREN) {
+    else if (TOKEN_KIND(cur_token_index) == TOK_LPAREN) {
         // Indirect without an identifier/displacement
         parse_indirect_operand(op);
     }
 
     else
-        error("Unable to parse operand for token %d", cur_token);
+        error("Unable to parse operand for token %d", TOKEN_KIND(cur_token_index));
+}
+
+static Chunk *add_code_chunk(Instructions *instr) {
+    CodeChunk *chunk = add_chunk(CT_CODE, sizeof(CodeChunk) + instr->size);
+    chunk->size = instr->size;
+    memcpy(chunk->data, instr->data, instr->size);
+
+    return (Chunk *) chunk;
+}
+
+// Add instructions with a relocation and, for branches, the short form in secondary
+static Chunk *add_relocated_code_chunk(Instructions *primary, Instructions *secondary, Symbol *symbol, int type, int addend) {
+    int secondary_size = secondary ? secondary->size : 0;
+    RelocatedCodeChunk *chunk = add_chunk(CT_RELOCATED_CODE, sizeof(RelocatedCodeChunk) + primary->size + secondary_size);
+
+    chunk->size = primary->size;
+    chunk->relocation_offset = primary->relocation.offset;
+    chunk->using_primary = 1;
+    chunk->relocation_type = type;
+    chunk->relocation_addend = addend;
+    chunk->relocation_symbol = symbol;
+    memcpy(chunk->data, primary->data, primary->size);
+
+    if (secondary) {
+        chunk->secondary_size = secondary->size;
+        chunk->secondary_relocation_offset = secondary->relocation.offset;
+        memcpy(chunk->data + primary->size, secondary->data, secondary->size);
+    }
+
+    return (Chunk *) chunk;
 }
 
 Chunk *parse_instruction_statement(void) {
-    char *mnemonic = strdup(cur_identifier);
+    InstructionToken *instruction = TOKEN_INSTRUCTION(cur_token_index);
+    int opcode_alias_group_index = instruction->opcode_alias_group;
+    if (opcode_alias_group_index == -1) error("Unknown instruction %.*s", instruction->mnemonic_size, instruction->mnemonic);
+
+    // Make the key for the shared instructions: "mnemonic operands"
+    static char key[MAX_SHARED_INSTRUCTIONS_KEY_SIZE];
+    int mnemonic_size = instruction->mnemonic_size;
+    int has_key =
+        mnemonic_size + 1 < MAX_SHARED_INSTRUCTIONS_KEY_SIZE &&
+        get_canonical_operands(key + mnemonic_size + 1, MAX_SHARED_INSTRUCTIONS_KEY_SIZE - mnemonic_size - 1) != -1;
+
+    if (has_key) {
+        memcpy(key, instruction->mnemonic, mnemonic_size);
+        key[mnemonic_size] = ' ';
+    }
+
     next();
 
+    if (has_key) {
+        Instructions *instr = strmap_get(shared_instructions, key);
+
+        if (instr) {
+            shared_instructions_hits++;
+            skip_statement();
+            return add_code_chunk(instr);
+        }
+    }
+
     // Only one instruction will ever be processed at the same time, so
     // use static memory for the operands.
     static Operand static_op1;
@@ -565,41 +673,27 @@ Chunk *parse_instruction_statement(void) {
     Operand *op2 = NULL;
     Operand *op3 = NULL;
 
-    if (cur_token != TOK_EOL && cur_token != TOK_EOF) {
+    if (TOKEN_KIND(cur_token_index) != TOK_EOL && TOKEN_KIND(cur_token_index) != TOK_EOF) {
         parse_operand(&static_op1);
         op1 = &static_op1;
     }
 
-    if (cur_token == TOK_COMMA) {
+    if (TOKEN_KIND(cur_token_index) == TOK_COMMA) {
         next();
         parse_operand(&static_op2);
         op2 = &static_op2;
     }
 
-    if (cur_token == TOK_COMMA) {
+    if (TOKEN_KIND(cur_token_index) == TOK_COMMA) {
         next();
         parse_operand(&static_op3);
         op3 = &static_op3;
     }
 
-    Instructions instr = make_instructions(mnemonic, op1, op2, op3);
-
-    Chunk *chunk = calloc(1, sizeof(Chunk));
-    append_to_list(cur_chunks, chunk);
-    chunk->coc.primary = malloc(sizeof(Instructions));
-    *chunk->coc.primary = instr;
-    chunk->coc.using_primary = 1;
-    chunk->type = CT_CODE;
-
-    if (instr.branch && op1 && op1->type == MEM32) {
-        op1->type = MEM08;
-        Instructions alt_instr = make_instructions(mnemonic, op1, op2, op3);
-
-        chunk->coc.secondary = calloc(1, sizeof(Instructions));
-        *chunk->coc.secondary = alt_instr;
-    }
-
-    free(mnemonic);
+    // Branches get both their long and short forms, layout_section() picks one of them
+    Instructions instr;
+    Instructions short_instr;
+    int has_short_form = make_branch_instructions(opcode_alias_group_index, op1, op2, op3, &instr, &short_instr);
 
     Operand *relocation_op = NULL;
     int relocation_addend = 0;
@@ -620,148 +714,138 @@ Chunk *parse_instruction_statement(void) {
         int relocation_type;
         if (relocation_op->relocation_type)
             relocation_type = relocation_op->relocation_type;
-        else if (chunk->coc.primary->branch) // This is set for branch opcodes
+        else if (instr.branch) // This is set for branch opcodes
             relocation_type = R_X86_64_PLT32;
         else
             relocation_type = R_X86_64_PC32;
 
-        chunk->coc.primary->relocation.type = relocation_type;
-        chunk->coc.primary->relocation.symbol = relocation_op->relocation_symbol;
-        chunk->coc.primary->relocation.addend = relocation_addend;
+        return add_relocated_code_chunk(&instr, has_short_form ? &short_instr : NULL,
+            relocation_op->relocation_symbol, relocation_type, relocation_addend);
+    }
 
-        if (chunk->coc.secondary) {
-            chunk->coc.secondary->relocation.type = relocation_type;
-            chunk->coc.secondary->relocation.symbol = relocation_op->relocation_symbol;
-            chunk->coc.secondary->relocation.addend = relocation_addend;
-        }
+    // Branches are reduced by layout_section(), so only share the rest
+    if (has_key && !has_short_form) {
+        shared_instructions_misses++;
+        Instructions *shared_instr = arena_alloc(sizeof(Instructions));
+        *shared_instr = instr;
+        strmap_put(shared_instructions, arena_strdup(key), shared_instr);
     }
 
-    return chunk;
+    return add_code_chunk(&instr);
 }
 
 void parse(void) {
-    while (cur_token != TOK_EOF) {
-        while (cur_token == TOK_EOL) next();
-
-        List *labels = new_list(4);
+    while (TOKEN_KIND(cur_token_index) != TOK_EOF) {
+        while (TOKEN_KIND(cur_token_index) == TOK_EOL) next();
 
         // Collect labels
-        while (cur_token == TOK_LABEL) {
-            append_to_list(labels, strdup(cur_identifier));
-
-            Chunk *chunk = calloc(1, sizeof(Chunk));
-            chunk->type = CT_LABEL;
-            chunk->lac.symbol = get_or_add_symbol(strdup(cur_identifier));
-            append_to_list(cur_chunks, chunk);
+        while (TOKEN_KIND(cur_token_index) == TOK_LABEL) {
+            Symbol *symbol = get_or_add_identifier_symbol(TOKEN_IDENTIFIER(cur_token_index));
+            LabelChunk *chunk = add_chunk(CT_LABEL, sizeof(LabelChunk));
+            chunk->symbol = symbol;
 
             next();
-            while (cur_token == TOK_EOL) next(); // More labels can follow
+            while (TOKEN_KIND(cur_token_index) == TOK_EOL) next(); // More labels can follow
         }
 
         // Parse statement
-        if (cur_token >= TOK_DIRECTIVE_ALIGN && cur_token <= TOK_DIRECTIVE_ZERO)
+        if (TOKEN_KIND(cur_token_index) >= TOK_DIRECTIVE_ALIGN && TOKEN_KIND(cur_token_index) <= TOK_DIRECTIVE_ZERO)
             parse_directive_statement();
-        else if (cur_token == TOK_INSTRUCTION)
+        else if (TOKEN_KIND(cur_token_index) == TOK_INSTRUCTION)
             parse_instruction_statement();
-        else if (cur_token == TOK_EOF)
+        else if (TOKEN_KIND(cur_token_index) == TOK_EOF)
             break;
         else
-            error("Syntax error at token %d", cur_token);
+            error("Syntax error at token %d", TOKEN_KIND(cur_token_index));
 
-        for (int i = 0; i < labels->length; i++) free(labels->elements[i]);
-        free_list(labels);
-
-        while (cur_token == TOK_EOL) next();
+        while (TOKEN_KIND(cur_token_index) == TOK_EOL) next();
     }
 }
 
-void emit_section_code(Section *section) {
-    List *chunks = section->chunks;
-
-    layout_section(section);
-
-    for (int i = 0; i < chunks->length; i++) {
-        Chunk *chunk = chunks->elements[i];
-        Instructions *instr = chunk->coc.using_primary ? chunk->coc.primary : chunk->coc.secondary;
-
-        // All branch instructions use 32 bit memory addresses for the time being,
-        // so we're only taking the primary instructions into account.
-        int base_offset = section->size;
+// Patch the value of a relocation into the code, or add it to the relocation table
+static void emit_relocated_code_chunk(Section *section, RelocatedCodeChunk *chunk, int base_offset) {
+    uint8_t *data = chunk->using_primary ? chunk->data : chunk->data + chunk->size;
+    int size = RELOCATED_CODE_CHUNK_SIZE(chunk);
+    int relocation_offset = chunk->using_primary ? chunk->relocation_offset : chunk->secondary_relocation_offset;
+    Symbol *symbol = chunk->relocation_symbol;
+
+    // Does the symbol need an entry in the relocation table?
+    if (
+            symbol->section != section ||
+            symbol->binding == STB_GLOBAL ||
+            chunk->relocation_type == R_X86_64_REX_GOTP
+            ) {
+
+        // For code relocations , a relative relocation is calculated from the end of the instruction.
+        // The linker doesn't know this though, so it needs to get an
+        // addend = -(size - relocation_offset)
+        add_relocation(
+            get_relocation_section(section), symbol, chunk->relocation_type,
+            base_offset + relocation_offset, chunk->relocation_addend + relocation_offset - size);
+    }
 
-        // chunk->offset is really only used to assert that the code in branches.c
-        // is consistent with the code here. Admittedly, this reeks of duplication
-        // so something isn't pretty here.
-        if (base_offset != chunk->offset)
-            panic("Internal error: mismatch in running offset (%#x) vs chunk offset (%#x)", base_offset, chunk->offset);
+    // The symbol address is known and can be used directly.
+    else {
+        if (chunk->using_primary) {
+            int relative_offset = symbol->value - (base_offset + relocation_offset + 4) + chunk->relocation_addend;
+            memcpy(data + relocation_offset, &relative_offset, 4); // 32 bit address
+        }
+        else {
+            // Double check relative offset doesn't exceed the limits of a signed char.
+            int relative_offset_int = symbol->value - (base_offset + relocation_offset + 1) + chunk->relocation_addend;
+            if (relative_offset_int < -128 || relative_offset_int > 127)
+                panic("Relative offset for code at %#lx out of bounds for symbol %s@%#x: %d",
+                    base_offset, symbol->name, symbol->value, relative_offset_int);
+
+            char relative_offset = relative_offset_int;
+            memcpy(data + relocation_offset, &relative_offset, 1); // 8 bit address
+        }
+    }
 
-        if (!chunk->type) panic("Internal error: zero chunk->type");
+    add_to_section(section, data, size);
+}
 
-        if (chunk->type == CT_SIZE_EXPR) {
-            Value value = evaluate_node(chunk->sic.size_expr, base_offset);
-            if (value.symbol) panic("Unexpectedly got a symbol when evaluating .size");
-            chunk->sic.size_symbol->size = value.number;
-        }
+// The padding for a branch padding chunk at offset. Nothing can be done about jumps
+// that are as large as the boundary.
+int branch_padding(BranchPaddingChunk *chunk, int offset) {
+    int size = 0;
+    Chunk *next = NEXT_CHUNK(&chunk->chunk);
+    for (int i = 0; i < chunk->chunk_count; i++, next = NEXT_CHUNK(next)) size += CHUNK_SIZE(next);
 
-        else if (chunk->type == CT_CODE && instr->relocation.symbol) {
-            int relocation_type;
-            if (instr->relocation.type)
-                relocation_type = instr->relocation.type; // Set by data handling code
-            else if (instr->branch) // This is set for branch opcodes
-                relocation_type = R_X86_64_PLT32;
-            else
-                relocation_type = R_X86_64_PC32;
-
-            // Does the symbol need an entry in the relocation table?
-            if (
-                    instr->relocation.symbol->section != section ||
-                    instr->relocation.symbol->binding == STB_GLOBAL ||
-                    instr->relocation.type == R_X86_64_REX_GOTP
-                    ) {
-
-                // For code relocations , a relative relocation is calculated from the end of the instruction.
-                // The linker doesn't know this though, so it needs to get an
-                // addend = -(instr->size - instr->relocation.offset)
-                int relocation_addend_offset = chunk->type == CT_CODE ? instr->relocation.offset - instr->size : 0;
-                add_relocation(
-                    get_relocation_section(section), instr->relocation.symbol, relocation_type,
-                    base_offset + instr->relocation.offset, instr->relocation.addend + relocation_addend_offset);
-            }
+    int position = offset & (chunk->boundary - 1);
+    return size < chunk->boundary && position + size >= chunk->boundary ? chunk->boundary - position : 0;
+}
 
-            // The symbol address is known and can be used directly.
-            else {
-                if (chunk->coc.using_primary) {
-                    int relative_offset = instr->relocation.symbol->value - (base_offset + instr->relocation.offset + 4) + instr->relocation.addend;
-                    memcpy(instr->data + instr->relocation.offset, &relative_offset, 4); // 32 bit address
-                }
-                else {
-                    instr = chunk->coc.secondary;
+// Emit the chunks of a section. layout_section() must have been called, so that the
+// branch forms and symbol offsets are final.
+void emit_section_code(Section *section) {
+    int start_size = section->size;
+    reserve_section_data(section, section->layout_size);
 
-                    // Double check relative offset doesn't exceed the limits of a signed char.
-                    int relative_offset_int = instr->relocation.symbol->value - (base_offset + instr->relocation.offset + 1) + instr->relocation.addend;
-                    if (relative_offset_int < -128 || relative_offset_int > 127)
-                        panic("Relative offset for code at %#lx out of bounds for symbol %s@%#x: %d",
-                            base_offset, instr->relocation.symbol->name, instr->relocation.symbol->value, relative_offset_int);
+    chunks_foreach(section->chunks, chunk) {
+        int base_offset = section->size;
 
-                    char relative_offset = relative_offset_int;
-                    memcpy(instr->data + instr->relocation.offset, &relative_offset, 1); // 8 bit address
-                }
+        switch (chunk->type)  {
+            case CT_CODE: {
+                CodeChunk *code_chunk = (CodeChunk *) chunk;
+                add_to_section(section, code_chunk->data, code_chunk->size);
+                break;
             }
-        }
 
-        // Add the chunk to the section
-        switch (chunk->type)  {
-            case CT_CODE:
-                add_to_section(section, instr->data, instr->size);
+            case CT_RELOCATED_CODE:
+                emit_relocated_code_chunk(section, (RelocatedCodeChunk *) chunk, base_offset);
                 break;
 
             case CT_DATA: {
-                if (chunk->dac.expr) {
-                    Value value = evaluate_node(chunk->dac.expr, base_offset);
-                    chunk->dac.data = (char *) &value.number;
+                DataChunk *data_chunk = (DataChunk *) chunk;
+                char *data = data_chunk->data;
+
+                if (data_chunk->expr) {
+                    Value value = evaluate_node(data_chunk->expr, base_offset);
 
                     if (value.symbol) {
                         int relocation_type;
-                        switch (chunk->dac.size) {
+                        switch (data_chunk->size) {
                             case 1: relocation_type = R_X86_64_8;  break;
                             case 2: relocation_type = R_X86_64_16; break;
                             case 4: relocation_type = R_X86_64_32; break;
@@ -775,43 +859,66 @@ void emit_section_code(Section *section) {
 
                         value.number = 0; // Write a zero - it will be replaced by the linker
                     }
-                }
 
-                add_to_section(section, chunk->dac.data, chunk->dac.size);
+                    add_to_section(section, &value.number, data_chunk->size);
+                }
+                else
+                    add_to_section(section, data, data_chunk->size);
 
                 break;
             }
 
             case CT_ZERO:
-                add_zeros_to_section(section, chunk->zec.size);
+                add_zeros_to_section(section, ((ZeroChunk *) chunk)->size);
                 break;
 
             case CT_ALIGN: {
-                int padding =  PADDING_FOR_ALIGN_UP(section->size, chunk->aic.alignment);
-                if (padding) {
-                    // Insert NOPs (0x90) as padding in a text section, otherwise zeros
-                    char value = section == section_text ? 0x90 : 0;
-                    add_repeated_value_to_section(section, value, padding);
-                }
+                AlignChunk *align_chunk = (AlignChunk *) chunk;
+                int padding = ALIGN_CHUNK_PADDING(align_chunk, section->size);
+
+                // Pad code with NOPs and anything else with zeros, unless there is a fill value
+                if (align_chunk->fill != -1)
+                    add_repeated_value_to_section(section, align_chunk->fill, padding);
+                else if (section->flags & SHF_EXECINSTR)
+                    add_nops_to_section(section, padding);
+                else
+                    add_zeros_to_section(section, padding);
+
                 break;
             }
 
-            case CT_LOC:
-                add_dwarf_loc(chunk->loc.file_index, chunk->loc.line_number, base_offset);
+            case CT_BRANCH_PADDING:
+                add_nops_to_section(section, branch_padding((BranchPaddingChunk *) chunk, section->size));
+                break;
+
+            case CT_LOC: {
+                LocChunk *loc_chunk = (LocChunk *) chunk;
+                add_dwarf_loc(section, loc_chunk->file_index, loc_chunk->line_number, base_offset);
+                break;
+            }
 
+            case CT_SIZE_EXPR: {
+                SizeChunk *size_chunk = (SizeChunk *) chunk;
+                Value value = evaluate_node(size_chunk->size_expr, base_offset);
+                if (value.symbol) panic("Unexpectedly got a symbol when evaluating .size");
+                size_chunk->size_symbol->size = value.number;
                 break;
+            }
 
-            case CT_SIZE_EXPR:
             case CT_LABEL:
                 // Nothing to do here
                 break;
 
             default:
-                panic("Unhandled chunk->type");
+                panic("Unhandled chunk->type %d", chunk->type);
         }
     }
+
+    if (section->size - start_size != section->layout_size)
+        panic("Emitted %d bytes in %s instead of %d", section->size - start_size, section->name, section->layout_size);
 }
 
 void init_parser(void) {
+    shared_instructions = new_strmap();
     set_current_section(".text");
 }
@@ -1,80 +1,136 @@
 #ifndef _PARSER_H
 #define _PARSER_H
 
+#include <stdint.h>
+
 #include "instr.h"
 
-// Code (instructions) and data (.byte, .word, etc) chunks are treated in a similar
-// way since they both can have relocations.
-// It's a bit of a hack, a data chunk carries a lot of unnecessary baggage.
+// The chunks of a section are kept in a packed stream of variable length records,
+// which are walked from start to end by layout_section() and emit_section_code().
+// Every record starts with a Chunk header; the rest depends on the type. Records are
+// aligned to CHUNK_ALIGNMENT bytes, so that the pointers in them are aligned too.
+
+#define CHUNK_ALIGNMENT 8
+
+typedef enum chunk_type {
+    CT_CODE           = 1, // Code, i.e. instructions without a relocation
+    CT_RELOCATED_CODE = 2, // Code with a relocation. Branches also have a short form
+    CT_DATA           = 3, // Data, coming from .byte, .word, .long, .quad or .string, evaluated in the second pass
+    CT_ZERO           = 4, // This is a bunch of zeroes.
+    CT_ALIGN          = 5, // Padding with a fill value, or NOPs in code and zeroes elsewhere
+    CT_SIZE_EXPR      = 6, // A size expression to be evaluated in the second pass; doesn't have a payload
+    CT_LOC            = 7, // A loc doesn't have a payload
+    CT_LABEL          = 8, // A label; doesn't have a payload
+    CT_BRANCH_PADDING = 9, // NOPs that keep the jump after it from crossing or ending on a boundary
+} ChunkType;
+
+typedef struct chunk {
+    uint8_t type;               // ChunkType
+    uint8_t length;             // Length of the record in bytes, including the header
+} Chunk;
+
 typedef struct code_chunk {
-    int using_primary;
-    Instructions *primary;
-    Instructions *secondary;
+    Chunk chunk;
+    uint8_t size;
+    uint8_t data[];
 } CodeChunk;
 
+// The primary instructions are followed by the secondary ones, if present. Branches
+// start out with the long primary form; layout_section() may switch them to the
+// short secondary form.
+typedef struct relocated_code_chunk {
+    Chunk chunk;
+    uint8_t size;                           // Size of the primary instructions
+    uint8_t relocation_offset;              // Offset of the relocated value in the primary instructions
+    uint8_t secondary_size;                 // Size of the secondary instructions, zero if there are none
+    uint8_t secondary_relocation_offset;    // Offset of the relocated value in the secondary instructions
+    uint8_t using_primary;
+    uint8_t relocation_type;
+    int relocation_addend;
+    Symbol *relocation_symbol;
+    uint8_t data[];
+} RelocatedCodeChunk;
+
+// Code (instructions) and data (.byte, .word, etc) chunks are treated in a similar
+// way since they both can have relocations.
 typedef struct data_chunk {
+    Chunk chunk;
+    int size;
     char *data;         // Either data or expr has a value
     Node *expr;
-    int size;
 } DataChunk;
 
 typedef struct zero_chunk {
+    Chunk chunk;
     int size;
 } ZeroChunk;
 
 typedef struct align_chunk {
-    int alignment;
+    Chunk chunk;
+    int alignment;              // Alignment in bytes, a power of two
+    int max_skip;               // Don't align if it takes more than this many bytes
+    int fill;                   // Padding byte, or -1 for NOPs in code and zeroes elsewhere
 } AlignChunk;
 
+// The padding depends on the size of the chunk_count chunks after it, which end with
+// a jump, call or ret. There may be a cmp or test before a jcc that gets fused with it.
+typedef struct branch_padding_chunk {
+    Chunk chunk;
+    int boundary;               // A power of two
+    int chunk_count;            // Number of chunks up to and including the branch
+} BranchPaddingChunk;
+
 typedef struct size_chunk {
+    Chunk chunk;
     Node *size_expr;            // Expression to be evaluated in a .size statement
     Symbol *size_symbol;        // Symbol in a .size statement
 } SizeChunk;
 
 typedef struct loc_chunk {
+    Chunk chunk;
     int file_index;
     int line_number;
 } LocChunk;
 
 typedef struct label_chunk {
+    Chunk chunk;
     Symbol *symbol;
 } LabelChunk;
 
-typedef enum chunk_type {
-    CT_CODE       = 1, // Code, i.e. instructions
-    CT_DATA       = 2, // Data, coming from .byte, .word, .long, .quad or .string, evaluated in the second pass
-    CT_ZERO       = 3, // This is a bunch of zeroes.
-    CT_ALIGN      = 4, // This is either a bunch of zeroes or NOPs, dependent on alignment and if it's in .text.
-    CT_SIZE_EXPR  = 5, // A size expression to be evaluated in the second pass; doesn't have a payload
-    CT_LOC        = 6, // A loc doesn't have a payload
-    CT_LABEL      = 7, // A label; doesn't have a payload
-} ChunkType;
+// A section's stream of chunks
+typedef struct chunks {
+    char *data;
+    int size;                   // Size of the stream in bytes
+    int allocated;
+    int count;                  // Number of chunks
+} Chunks;
 
-typedef struct chunk {
-    ChunkType type;
-    int offset;
-    union {
-        CodeChunk   coc;
-        DataChunk   dac;
-        ZeroChunk   zec;
-        AlignChunk  aic;
-        SizeChunk   sic;
-        LocChunk    loc;
-        LabelChunk  lac;
-    };
-} Chunk;
+#define FIRST_CHUNK(chunks) ((Chunk *) (chunks)->data)
+#define END_OF_CHUNKS(chunks) ((Chunk *) ((chunks)->data + (chunks)->size))
+#define NEXT_CHUNK(chunk) ((Chunk *) ((char *) (chunk) + (chunk)->length))
+#define chunks_foreach(chunks, chunk) for (Chunk *chunk = FIRST_CHUNK(chunks); chunk < END_OF_CHUNKS(chunks); chunk = NEXT_CHUNK(chunk))
 
-#define CODE_CHUNK_SIZE(chunk) ((chunk)->coc.using_primary ? (chunk)->coc.primary->size : (chunk)->coc.secondary->size)
-#define ZERO_CHUNK_SIZE(chunk) ((chunk)->zec.size)
-#define DATA_CHUNK_SIZE(chunk) ((chunk)->dac.size)
+#define IS_BRANCH_CHUNK(chunk) ((chunk)->type == CT_RELOCATED_CODE && ((RelocatedCodeChunk *) (chunk))->secondary_size)
+
+#define RELOCATED_CODE_CHUNK_SIZE(rcc) ((rcc)->using_primary ? (rcc)->size : (rcc)->secondary_size)
+
+// The padding for an alignment chunk at offset
+#define ALIGN_CHUNK_PADDING(ac, offset) \
+    (PADDING_FOR_ALIGN_UP((offset), (ac)->alignment) <= (ac)->max_skip ? PADDING_FOR_ALIGN_UP((offset), (ac)->alignment) : 0)
 
 #define CHUNK_SIZE(chunk) ( \
-      ((chunk)->type == CT_CODE) ? CODE_CHUNK_SIZE(chunk) \
-    : ((chunk)->type == CT_DATA) ? DATA_CHUNK_SIZE(chunk) \
-    : ((chunk)->type == CT_ZERO) ? ZERO_CHUNK_SIZE(chunk) \
+      ((chunk)->type == CT_CODE)           ? ((CodeChunk *) (chunk))->size \
+    : ((chunk)->type == CT_RELOCATED_CODE) ? RELOCATED_CODE_CHUNK_SIZE((RelocatedCodeChunk *) (chunk)) \
+    : ((chunk)->type == CT_DATA)           ? ((DataChunk *) (chunk))->size \
+    : ((chunk)->type == CT_ZERO)           ? ((ZeroChunk *) (chunk))->size \
     : 0 \
 )
 
+extern int shared_instructions_hits;
+extern int shared_instructions_misses;
+
+void *append_chunk(Chunks *chunks, int type, int size);
+int branch_padding(BranchPaddingChunk *chunk, int offset);
 Chunk *parse_instruction_statement(void);
 Chunk *parse_directive_statement(void);
 void parse(void);
@@ -0,0 +1,360 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "elf.h"
+#include "instr.h"
+#include "list.h"
+#include "parser.h"
+#include "peephole.h"
+#include "utils.h"
+
+// Peephole optimization. With -O, the code chunks of executable sections are rewritten
+// before layout, by a table of rules that each look at one instruction, and at most the
+// one right before it. The instructions are matched on their encoding, the same way
+// branches.c recognizes jumps. A rule shrinks the instruction in place, or removes it
+// by setting its size to zero, after which the chunk stream is compacted.
+//
+// Rewrites that change the flags are only done if the flags are dead, i.e. if they are
+// set by a later instruction before anything reads them. This is determined by looking
+// ahead a few instructions. Labels don't stop the look-ahead, since the code after a
+// label is what runs next, whichever way it is reached. A pair of instructions is only
+// matched if there is no label in between, since the second one could be jumped to.
+
+// Rules are enabled with -O, unless they are switched on or off on their own
+int optimize;
+
+int peephole_saved_bytes;
+
+// How many instructions to look at to find out if the flags are dead
+#define FLAGS_LOOKAHEAD 16
+
+// Register numbers in the modrm byte, including the REX bits
+#define MODRM_REG(rex, modrm) ((((modrm) >> 3) & 7) | ((rex) & REX_R ? 8 : 0))
+#define MODRM_RM(rex, modrm)  (((modrm) & 7) | ((rex) & REX_B ? 8 : 0))
+
+static uint8_t *skip_prefixes(uint8_t *data) {
+    while (*data == 0x66 || (*data & 0xf0) == 0x40) data++;
+    return data;
+}
+
+// Does the instruction set all arithmetic flags without reading any of them
+static int sets_flags(uint8_t *data) {
+    data = skip_prefixes(data);
+    int reg = (data[1] >> 3) & 7;
+
+    switch (data[0]) {
+        case 0x00: case 0x01: case 0x02: case 0x03: case 0x04: case 0x05:   // add
+        case 0x08: case 0x09: case 0x0a: case 0x0b: case 0x0c: case 0x0d:   // or
+        case 0x20: case 0x21: case 0x22: case 0x23: case 0x24: case 0x25:   // and
+        case 0x28: case 0x29: case 0x2a: case 0x2b: case 0x2c: case 0x2d:   // sub
+        case 0x30: case 0x31: case 0x32: case 0x33: case 0x34: case 0x35:   // xor
+        case 0x38: case 0x39: case 0x3a: case 0x3b: case 0x3c: case 0x3d:   // cmp
+        case 0x84: case 0x85: case 0xa8: case 0xa9:                         // test
+            return 1;
+
+        case 0x80: case 0x81: case 0x83: return reg != 2 && reg != 3;       // Not adc or sbb
+        case 0xf6: case 0xf7:            return reg == 0;                   // test $imm
+        case 0x0f:                       return data[1] == 0xaf;            // imul
+        default:                         return 0;
+    }
+}
+
+// Does the instruction leave the flags alone
+static int preserves_flags(uint8_t *data) {
+    data = skip_prefixes(data);
+
+    if (data[0] >= 0x50 && data[0] <= 0x5f) return 1; // push, pop
+    if (data[0] >= 0xb0 && data[0] <= 0xbf) return 1; // mov $imm
+
+    switch (data[0]) {
+        case 0x63:                                              // movslq
+        case 0x88: case 0x89: case 0x8a: case 0x8b: case 0x8d:  // mov, lea
+        case 0x90: case 0x98: case 0x99:                        // nop, cltq, cqto
+        case 0xc6: case 0xc7:                                   // mov $imm
+            return 1;
+
+        case 0x0f: // movzx, movsx, nop
+            return data[1] == 0xb6 || data[1] == 0xb7 || data[1] == 0xbe || data[1] == 0xbf || data[1] == 0x1f;
+
+        default:
+            return 0;
+    }
+}
+
+// Are the flags set before they are read, after the chunk? Calls and returns count as
+// setting them, since the ABI doesn't keep them across calls.
+static int flags_are_dead(Chunk *chunk, Chunk *end) {
+    int instructions = 0;
+
+    for (chunk = NEXT_CHUNK(chunk); chunk < end && instructions < FLAGS_LOOKAHEAD; chunk = NEXT_CHUNK(chunk)) {
+        uint8_t *data;
+
+        switch (chunk->type) {
+            case CT_LABEL: case CT_LOC: case CT_SIZE_EXPR:
+                continue;
+
+            case CT_ALIGN:
+                if (((AlignChunk *) chunk)->fill != -1) return 0;
+                continue;
+
+            case CT_CODE:
+                data = ((CodeChunk *) chunk)->data;
+                if (data[0] == 0xc3) return 1; // ret
+                break;
+
+            case CT_RELOCATED_CODE:
+                data = ((RelocatedCodeChunk *) chunk)->data;
+                if (data[0] == 0xe8) return 1; // call
+                break;
+
+            default:
+                return 0;
+        }
+
+        if (sets_flags(data)) return 1;
+        if (!preserves_flags(data)) return 0;
+        instructions++;
+    }
+
+    return 0;
+}
+
+// Decode a mov of an immediate to a register: mov $imm32, %r64 (sign extended),
+// movabs $imm64, %r64 or mov $imm32, %r32. Returns the operand size, or zero if it
+// isn't one of these.
+static int decode_immediate_move(CodeChunk *chunk, int *reg, long *value) {
+    uint8_t *data = chunk->data;
+    int rex = (data[0] & 0xf0) == 0x40 ? data[0] : 0;
+    uint8_t *opcode = rex ? data + 1 : data;
+    int opcode_size = chunk->size - (opcode - data);
+
+    if (rex & ~(REX_W | REX_B) & 0xf) return 0;
+
+    if (rex & REX_W) {
+        if (opcode[0] == 0xc7 && opcode[1] >> 3 == 0x18 && opcode_size == 6) {
+            *reg = MODRM_RM(rex, opcode[1]);
+            int imm;
+            memcpy(&imm, opcode + 2, 4);
+            *value = imm;
+            return 8;
+        }
+
+        if ((opcode[0] & 0xf8) == 0xb8 && opcode_size == 9) {
+            *reg = (opcode[0] & 7) | (rex & REX_B ? 8 : 0);
+            memcpy(value, opcode + 1, 8);
+            return 8;
+        }
+    }
+    else if ((opcode[0] & 0xf8) == 0xb8 && opcode_size == 5) {
+        *reg = (opcode[0] & 7) | (rex & REX_B ? 8 : 0);
+        unsigned int imm;
+        memcpy(&imm, opcode + 1, 4);
+        *value = imm;
+        return 4;
+    }
+
+    return 0;
+}
+
+// Decode a 64 bit register to register mov. Returns 0 if it isn't one.
+static int decode_register_move(CodeChunk *chunk, int *src, int *dst) {
+    uint8_t *data = chunk->data;
+    if (chunk->size != 3 || (data[0] & 0xf8) != 0x48 || data[2] >> 6 != 3) return 0;
+
+    int reg = MODRM_REG(data[0], data[2]);
+    int rm = MODRM_RM(data[0], data[2]);
+
+    if (data[1] == 0x89)      { *src = reg; *dst = rm; }
+    else if (data[1] == 0x8b) { *src = rm; *dst = reg; }
+    else return 0;
+
+    return 1;
+}
+
+// Replace the instruction with xorl %r32, %r32
+static void make_xor(CodeChunk *chunk, int reg) {
+    uint8_t *data = chunk->data;
+    int size = 0;
+    if (reg >= 8) data[size++] = 0x40 | REX_R | REX_B;
+    data[size++] = 0x31;
+    data[size++] = 0xc0 | (reg & 7) << 3 | (reg & 7);
+    chunk->size = size;
+}
+
+// Replace the instruction with movl $imm32, %r32
+static void make_move_32(CodeChunk *chunk, int reg, unsigned int value) {
+    uint8_t *data = chunk->data;
+    int size = 0;
+    if (reg >= 8) data[size++] = 0x40 | REX_B;
+    data[size++] = 0xb8 | (reg & 7);
+    memcpy(data + size, &value, 4);
+    chunk->size = size + 4;
+}
+
+// mov $0, %reg -> xorl %r32, %r32, if the flags are dead
+static int zero_idiom(CodeChunk *chunk, CodeChunk *previous, Chunk *end) {
+    int reg;
+    long value;
+    if (!decode_immediate_move(chunk, &reg, &value) || value != 0) return 0;
+    if (!flags_are_dead(&chunk->chunk, end)) return 0;
+
+    make_xor(chunk, reg);
+    return 1;
+}
+
+// movq %reg, %reg -> nothing. movl %r32, %r32 clears the top half, so it stays.
+static int self_move(CodeChunk *chunk, CodeChunk *previous, Chunk *end) {
+    int src, dst;
+    if (!decode_register_move(chunk, &src, &dst) || src != dst) return 0;
+
+    chunk->size = 0;
+    return 1;
+}
+
+// movq %a, %b followed by movq %b, %a or movq %a, %b -> the second one is dropped
+static int redundant_move(CodeChunk *chunk, CodeChunk *previous, Chunk *end) {
+    int src, dst, previous_src, previous_dst;
+    if (!previous || !decode_register_move(previous, &previous_src, &previous_dst)) return 0;
+    if (!decode_register_move(chunk, &src, &dst)) return 0;
+    if (previous_src == previous_dst) return 0;
+
+    if ((src == previous_dst && dst == previous_src) || (src == previous_src && dst == previous_dst)) {
+        chunk->size = 0;
+        return 1;
+    }
+
+    return 0;
+}
+
+// movq %reg, mem followed by movq mem, %reg -> the load is dropped
+static int store_reload(CodeChunk *chunk, CodeChunk *previous, Chunk *end) {
+    if (!previous || previous->size != chunk->size || chunk->size < 3) return 0;
+
+    uint8_t *store = previous->data;
+    uint8_t *load = chunk->data;
+    if ((store[0] & 0xf8) != 0x48 || store[1] != 0x89 || load[0] != store[0] || load[1] != 0x8b) return 0;
+
+    // A memory operand that isn't %rip relative, which would be a different address
+    int modrm = store[2];
+    if (modrm >> 6 == 3 || (modrm >> 6 == 0 && (modrm & 7) == 5)) return 0;
+    if (memcmp(store + 2, load + 2, chunk->size - 2)) return 0;
+
+    chunk->size = 0;
+    return 1;
+}
+
+// addq $0, %reg or subq $0, %reg -> nothing, if the flags are dead
+static int add_zero(CodeChunk *chunk, CodeChunk *previous, Chunk *end) {
+    uint8_t *data = chunk->data;
+    if ((data[0] & 0xfe) != 0x48 || chunk->size < 4 || data[2] >> 6 != 3) return 0;
+
+    int reg = (data[2] >> 3) & 7;
+    if (reg != 0 && reg != 5) return 0;
+
+    int is_zero =
+        (data[1] == 0x83 && chunk->size == 4 && data[3] == 0) ||
+        (data[1] == 0x81 && chunk->size == 7 && !data[3] && !data[4] && !data[5] && !data[6]);
+    if (!is_zero || !flags_are_dead(&chunk->chunk, end)) return 0;
+
+    chunk->size = 0;
+    return 1;
+}
+
+// mov $imm, %r64 -> movl $imm, %r32 if the value fits when zero extended
+static int move_immediate_32(CodeChunk *chunk, CodeChunk *previous, Chunk *end) {
+    int reg;
+    long value;
+    if (decode_immediate_move(chunk, &reg, &value) != 8) return 0;
+    if (value < 0 || value > 0xffffffffL) return 0;
+
+    make_move_32(chunk, reg, value);
+    return 1;
+}
+
+// The rules are tried in this order, until one of them applies
+PeepholeRule peephole_rules[] = {
+    { .name = "self-move",      .apply = self_move,         .enabled = -1 },
+    { .name = "redundant-move", .apply = redundant_move,    .enabled = -1 },
+    { .name = "store-reload",   .apply = store_reload,      .enabled = -1 },
+    { .name = "add-zero",       .apply = add_zero,          .enabled = -1 },
+    { .name = "zero-idiom",     .apply = zero_idiom,        .enabled = -1 },
+    { .name = "mov-imm32",      .apply = move_immediate_32, .enabled = -1 },
+    { .name = NULL },
+};
+
+// Switch a rule on or off. Returns 0 if there is no rule with the name.
+int set_peephole_rule(char *name, int enabled) {
+    for (PeepholeRule *rule = peephole_rules; rule->name; rule++) {
+        if (!strcmp(rule->name, name)) {
+            rule->enabled = enabled;
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+static int rule_is_enabled(PeepholeRule *rule) {
+    return rule->enabled == 1 || (rule->enabled == -1 && optimize);
+}
+
+static void apply_rules(CodeChunk *chunk, CodeChunk *previous, Chunk *end) {
+    int size = chunk->size;
+
+    for (PeepholeRule *rule = peephole_rules; rule->name; rule++) {
+        if (rule_is_enabled(rule) && rule->apply(chunk, previous, end)) {
+            rule->count++;
+            peephole_saved_bytes += size - chunk->size;
+            return;
+        }
+    }
+}
+
+// Apply the rules to the code chunks of a section and drop the removed instructions
+static void optimize_section(Section *section) {
+    Chunks *chunks = section->chunks;
+    Chunk *end = END_OF_CHUNKS(chunks);
+    char *write = chunks->data;
+    CodeChunk *previous = NULL; // The code before the chunk, if only .locs are in between
+
+    for (Chunk *chunk = FIRST_CHUNK(chunks); chunk < end;) {
+        Chunk *next = NEXT_CHUNK(chunk);
+        int length = chunk->length;
+
+        if (chunk->type == CT_CODE) {
+            CodeChunk *code_chunk = (CodeChunk *) chunk;
+            apply_rules(code_chunk, previous, end);
+
+            if (!code_chunk->size) {
+                chunks->count--;
+                chunk = next;
+                continue;
+            }
+
+            length = ALIGN_UP(sizeof(CodeChunk) + code_chunk->size, CHUNK_ALIGNMENT);
+            chunk->length = length;
+            previous = (CodeChunk *) write;
+        }
+        else if (chunk->type != CT_LOC)
+            previous = NULL;
+
+        memmove(write, chunk, length);
+        write += length;
+        chunk = next;
+    }
+
+    chunks->size = write - chunks->data;
+}
+
+// Run the peephole optimizer over all code sections, if any rule is enabled
+void optimize_code(void) {
+    int enabled = 0;
+    for (PeepholeRule *rule = peephole_rules; rule->name; rule++) enabled |= rule_is_enabled(rule);
+    if (!enabled) return;
+
+    for (int i = 0; i < sections_list->length; i++) {
+        Section *section = sections_list->elements[i];
+        if (section->chunks && (section->flags & SHF_EXECINSTR)) optimize_section(section);
+    }
+}
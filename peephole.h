@@ -0,0 +1,22 @@
+#ifndef _PEEPHOLE_H
+#define _PEEPHOLE_H
+
+#include "elf.h"
+#include "parser.h"
+
+typedef struct peephole_rule {
+    char *name;
+    int (*apply)(CodeChunk *chunk, CodeChunk *previous, Chunk *end);
+    int enabled;                // 1 or 0 when set with -f[no-]peephole-<name>, -1 to follow -O
+    int count;                  // Number of times the rule was applied
+} PeepholeRule;
+
+extern int optimize;
+
+extern PeepholeRule peephole_rules[];
+extern int peephole_saved_bytes;
+
+int set_peephole_rule(char *name, int enabled);
+void optimize_code(void);
+
+#endif
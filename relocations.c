@@ -2,6 +2,7 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "arena.h"
 #include "elf.h"
 #include "list.h"
 #include "relocations.h"
@@ -15,7 +16,7 @@ void init_relocations(void) {
 // Get .rela.x associated with section .x. Create one if not existent
 Section *get_relocation_section(Section *section) {
     if (!section->rela_section) {
-        char *name = malloc(strlen(section->name + 5));
+        char *name = arena_alloc(strlen(section->name) + 6);
         sprintf(name, "%s%s", ".rela", section->name);
         section->rela_section = add_section(name, SHT_RELA, SHF_INFO_LINK, 0x08);
     }
@@ -24,7 +25,7 @@ Section *get_relocation_section(Section *section) {
 }
 
 void add_relocation(Section *section, Symbol *symbol, int type, long offset, int addend) {
-    Relocation *r = malloc(sizeof(Relocation));
+    Relocation *r = arena_alloc(sizeof(Relocation));
     r->type = type;
     r->offset = offset;
     r->symbol = symbol;
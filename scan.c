@@ -0,0 +1,210 @@
+#include <stdint.h>
+#include <string.h>
+
+#ifdef __x86_64__
+#include <immintrin.h>
+#endif
+
+#include "scan.h"
+
+// Character scanning for the lexer. Besides the scalar functions, there are SSE2 and
+// AVX2 ones that look at 16 or 32 characters at a time. The fastest one the CPU
+// supports is picked at runtime.
+//
+// The SIMD functions only do aligned loads, which can't cross into a page that isn't
+// mapped, so they may look a little before the start and past the end of the input.
+// The characters in the first block before p are ignored; the scan always ends at the
+// zero after the input.
+
+Scanner *scanner;
+
+static char *scalar_skip_whitespace(char *p) {
+    while (*p == ' ' || *p == '\t' || *p == '\f' || *p == '\v') p++;
+    return p;
+}
+
+static char *scalar_skip_identifier(char *p) {
+    while (
+            (*p >= 'a' && *p <= 'z') ||
+            (*p >= 'A' && *p <= 'Z') ||
+            (*p >= '0' && *p <= '9') ||
+            *p == '_' || *p == '@' || *p == ':' || *p == '.')
+        p++;
+
+    return p;
+}
+
+static char *scalar_find_end_of_line(char *p) {
+    while (*p && *p != '\n') p++;
+    return p;
+}
+
+#ifdef __x86_64__
+
+// Runs are mostly short, so the first few characters are checked one at a time, and
+// only longer runs are scanned a block at a time
+#define SCALAR_PREFIX 8
+
+// The vectors of a character, made at compile time
+#define SPLAT8(c) ((long long) (unsigned char) (c) * 0x0101010101010101LL)
+#define SPLAT16(c) { SPLAT8(c), SPLAT8(c) }
+#define SPLAT32(c) { SPLAT8(c), SPLAT8(c), SPLAT8(c), SPLAT8(c) }
+
+#define SCALAR_PREFIX_SCAN(p, IS_IN_CLASS) \
+    for (int i = 0; i < SCALAR_PREFIX; i++, p++) if (!(IS_IN_CLASS(*p))) return p;
+
+#define IS_WHITESPACE(c) ((c) == ' ' || (c) == '\t' || (c) == '\f' || (c) == '\v')
+#define IS_IDENTIFIER(c) (((c) >= 'a' && (c) <= 'z') || ((c) >= 'A' && (c) <= 'Z') || \
+    ((c) >= '0' && (c) <= '9') || (c) == '_' || (c) == '@' || (c) == ':' || (c) == '.')
+#define IS_NOT_END_OF_LINE(c) ((c) && (c) != '\n')
+
+// Scan the blocks from the one p is in, until one has a character that isn't in the
+// class. IN_CLASS sets in_class to 0xff in the bytes of v that are in it.
+#define SSE2_SCAN(p, IN_CLASS) { \
+    int offset = (uintptr_t) p & 15; \
+    char *block = p - offset; \
+    unsigned int stop = 0xffff << offset; \
+    while (1) { \
+        __m128i v = _mm_load_si128((__m128i *) block); \
+        __m128i in_class; \
+        IN_CLASS; \
+        stop &= ~_mm_movemask_epi8(in_class) & 0xffff; \
+        if (stop) return block + __builtin_ctz(stop); \
+        block += 16; \
+        stop = 0xffff; \
+    } \
+}
+
+#define AVX2_SCAN(p, IN_CLASS) { \
+    int offset = (uintptr_t) p & 31; \
+    char *block = p - offset; \
+    unsigned int stop = 0xffffffffu << offset; \
+    while (1) { \
+        __m256i v = _mm256_load_si256((__m256i *) block); \
+        __m256i in_class; \
+        IN_CLASS; \
+        stop &= ~_mm256_movemask_epi8(in_class); \
+        if (stop) return block + __builtin_ctz(stop); \
+        block += 32; \
+        stop = 0xffffffffu; \
+    } \
+}
+
+static const __m128i sse2_space      = SPLAT16(' ');
+static const __m128i sse2_tab        = SPLAT16('\t');
+static const __m128i sse2_form_feed  = SPLAT16('\f');
+static const __m128i sse2_vtab       = SPLAT16('\v');
+static const __m128i sse2_newline    = SPLAT16('\n');
+static const __m128i sse2_zero       = SPLAT16(0);
+static const __m128i sse2_case       = SPLAT16(0x20);
+static const __m128i sse2_before_a   = SPLAT16('a' - 1);
+static const __m128i sse2_after_z    = SPLAT16('z' + 1);
+static const __m128i sse2_before_0   = SPLAT16('0' - 1);
+static const __m128i sse2_after_9    = SPLAT16('9' + 1);
+static const __m128i sse2_underscore = SPLAT16('_');
+static const __m128i sse2_at         = SPLAT16('@');
+static const __m128i sse2_colon      = SPLAT16(':');
+static const __m128i sse2_dot        = SPLAT16('.');
+
+static char *sse2_skip_whitespace(char *p) {
+    SCALAR_PREFIX_SCAN(p, IS_WHITESPACE);
+    SSE2_SCAN(p, in_class = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi8(v, sse2_space), _mm_cmpeq_epi8(v, sse2_tab)),
+        _mm_or_si128(_mm_cmpeq_epi8(v, sse2_form_feed), _mm_cmpeq_epi8(v, sse2_vtab))));
+}
+
+// Setting bit 5 maps upper case letters onto lower case ones, and nothing else onto
+// them. Characters from 0x80 are negative, so they fail the signed compares.
+static char *sse2_skip_identifier(char *p) {
+    SCALAR_PREFIX_SCAN(p, IS_IDENTIFIER);
+    SSE2_SCAN(p, {
+        __m128i lower = _mm_or_si128(v, sse2_case);
+        in_class = _mm_or_si128(
+            _mm_or_si128(
+                _mm_and_si128(_mm_cmpgt_epi8(lower, sse2_before_a), _mm_cmpgt_epi8(sse2_after_z, lower)),
+                _mm_and_si128(_mm_cmpgt_epi8(v, sse2_before_0), _mm_cmpgt_epi8(sse2_after_9, v))),
+            _mm_or_si128(
+                _mm_or_si128(_mm_cmpeq_epi8(v, sse2_underscore), _mm_cmpeq_epi8(v, sse2_at)),
+                _mm_or_si128(_mm_cmpeq_epi8(v, sse2_colon), _mm_cmpeq_epi8(v, sse2_dot))));
+    });
+}
+
+static char *sse2_find_end_of_line(char *p) {
+    SCALAR_PREFIX_SCAN(p, IS_NOT_END_OF_LINE);
+    SSE2_SCAN(p, in_class = _mm_andnot_si128(
+        _mm_or_si128(_mm_cmpeq_epi8(v, sse2_newline), _mm_cmpeq_epi8(v, sse2_zero)),
+        _mm_cmpeq_epi8(v, v)));
+}
+
+#define AVX2 __attribute__((target("avx2")))
+
+static const __m256i avx2_space      = SPLAT32(' ');
+static const __m256i avx2_tab        = SPLAT32('\t');
+static const __m256i avx2_form_feed  = SPLAT32('\f');
+static const __m256i avx2_vtab       = SPLAT32('\v');
+static const __m256i avx2_newline    = SPLAT32('\n');
+static const __m256i avx2_zero       = SPLAT32(0);
+static const __m256i avx2_case       = SPLAT32(0x20);
+static const __m256i avx2_before_a   = SPLAT32('a' - 1);
+static const __m256i avx2_after_z    = SPLAT32('z' + 1);
+static const __m256i avx2_before_0   = SPLAT32('0' - 1);
+static const __m256i avx2_after_9    = SPLAT32('9' + 1);
+static const __m256i avx2_underscore = SPLAT32('_');
+static const __m256i avx2_at         = SPLAT32('@');
+static const __m256i avx2_colon      = SPLAT32(':');
+static const __m256i avx2_dot        = SPLAT32('.');
+
+AVX2 static char *avx2_skip_whitespace(char *p) {
+    SCALAR_PREFIX_SCAN(p, IS_WHITESPACE);
+    AVX2_SCAN(p, in_class = _mm256_or_si256(
+        _mm256_or_si256(_mm256_cmpeq_epi8(v, avx2_space), _mm256_cmpeq_epi8(v, avx2_tab)),
+        _mm256_or_si256(_mm256_cmpeq_epi8(v, avx2_form_feed), _mm256_cmpeq_epi8(v, avx2_vtab))));
+}
+
+AVX2 static char *avx2_skip_identifier(char *p) {
+    SCALAR_PREFIX_SCAN(p, IS_IDENTIFIER);
+    AVX2_SCAN(p, {
+        __m256i lower = _mm256_or_si256(v, avx2_case);
+        in_class = _mm256_or_si256(
+            _mm256_or_si256(
+                _mm256_and_si256(_mm256_cmpgt_epi8(lower, avx2_before_a), _mm256_cmpgt_epi8(avx2_after_z, lower)),
+                _mm256_and_si256(_mm256_cmpgt_epi8(v, avx2_before_0), _mm256_cmpgt_epi8(avx2_after_9, v))),
+            _mm256_or_si256(
+                _mm256_or_si256(_mm256_cmpeq_epi8(v, avx2_underscore), _mm256_cmpeq_epi8(v, avx2_at)),
+                _mm256_or_si256(_mm256_cmpeq_epi8(v, avx2_colon), _mm256_cmpeq_epi8(v, avx2_dot))));
+    });
+}
+
+AVX2 static char *avx2_find_end_of_line(char *p) {
+    SCALAR_PREFIX_SCAN(p, IS_NOT_END_OF_LINE);
+    AVX2_SCAN(p, in_class = _mm256_andnot_si256(
+        _mm256_or_si256(_mm256_cmpeq_epi8(v, avx2_newline), _mm256_cmpeq_epi8(v, avx2_zero)),
+        _mm256_cmpeq_epi8(v, v)));
+}
+
+#endif
+
+// The fastest first
+Scanner scanners[] = {
+#ifdef __x86_64__
+    { "avx2",   avx2_skip_whitespace,   avx2_skip_identifier,   avx2_find_end_of_line   },
+    { "sse2",   sse2_skip_whitespace,   sse2_skip_identifier,   sse2_find_end_of_line   },
+#endif
+    { "scalar", scalar_skip_whitespace, scalar_skip_identifier, scalar_find_end_of_line },
+    { NULL },
+};
+
+// Does the CPU support the scanner? This checks the CPUID feature bits, and for AVX2
+// also that the OS saves the ymm registers.
+int scanner_is_supported(Scanner *s) {
+#ifdef __x86_64__
+    __builtin_cpu_init();
+    if (!strcmp(s->name, "avx2")) return __builtin_cpu_supports("avx2");
+#endif
+
+    return 1; // SSE2 is part of x86-64
+}
+
+void select_scanner(void) {
+    for (scanner = scanners; !scanner_is_supported(scanner); scanner++);
+}
@@ -0,0 +1,19 @@
+#ifndef _SCAN_H
+#define _SCAN_H
+
+// Functions that find the end of a run of characters of a class. They all stop at a
+// zero, so the input must end with one.
+typedef struct scanner {
+    char *name;
+    char *(*skip_whitespace)(char *p);      // First character that isn't a space, \t, \f or \v
+    char *(*skip_identifier)(char *p);      // First character that can't be in an identifier
+    char *(*find_end_of_line)(char *p);     // First \n or zero
+} Scanner;
+
+extern Scanner scanners[];
+extern Scanner *scanner;
+
+int scanner_is_supported(Scanner *s);
+void select_scanner(void);
+
+#endif
@@ -0,0 +1,149 @@
+#!/usr/bin/env python3
+
+# Script to generate the perfect hash tables the lexer uses to look up directives and
+# registers. To add a directive or register, add it to the lists below and run
+#
+#   python3 scripts/keywords.py keywords-generated.c
+#
+# The first 16 characters of a name are packed into two 64 bit words, first character
+# in the lowest byte. The slot of a name in a table of 2^bits entries is the top bits
+# of (word0 ^ word1 * multiplier ^ size) * multiplier. The script looks for the
+# smallest table and a multiplier that give every name a slot of its own, so a lookup
+# is two multiplies, a shift and a compare of the words and the size. Names longer
+# than 16 characters also compare the rest of the name, so two of them can't share
+# both their first 16 characters and their size.
+
+import random
+import sys
+
+KEYWORD_PREFIX_SIZE = 16
+MAX_KEYWORD_SIZE = 127  # Keyword.size is a char
+MASK64 = 0xFFFFFFFFFFFFFFFF
+MAX_TRIES = 100000
+
+DIRECTIVES = [
+    (".align",   "TOK_DIRECTIVE_ALIGN"),
+    (".balign",  "TOK_DIRECTIVE_BALIGN"),
+    (".byte",    "TOK_DIRECTIVE_BYTE"),
+    (".comm",    "TOK_DIRECTIVE_COMM"),
+    (".data",    "TOK_DIRECTIVE_DATA"),
+    (".file",    "TOK_DIRECTIVE_FILE"),
+    (".globl",   "TOK_DIRECTIVE_GLOBL"),
+    (".loc",     "TOK_DIRECTIVE_LOC"),
+    (".local",   "TOK_DIRECTIVE_LOCAL"),
+    (".long",    "TOK_DIRECTIVE_LONG"),
+    (".p2align", "TOK_DIRECTIVE_P2ALIGN"),
+    (".quad",    "TOK_DIRECTIVE_QUAD"),
+    (".section", "TOK_DIRECTIVE_SECTION"),
+    (".size",    "TOK_DIRECTIVE_SIZE"),
+    (".sleb128", "TOK_DIRECTIVE_SLEB128"),
+    (".string",  "TOK_DIRECTIVE_STRING"),
+    (".text",    "TOK_DIRECTIVE_TEXT"),
+    (".type",    "TOK_DIRECTIVE_TYPE"),
+    (".uleb128", "TOK_DIRECTIVE_ULEB128"),
+    (".word",    "TOK_DIRECTIVE_WORD"),
+    (".value",   "TOK_DIRECTIVE_VALUE"),
+    (".zero",    "TOK_DIRECTIVE_ZERO"),
+    (".",        "TOK_DOT_SYMBOL"),
+]
+
+# https://wiki.osdev.org/X86-64_Instruction_Encoding#Registers
+# Each group is (base, names in register number order, alt 8 bit). An empty name
+# leaves the number unused.
+REGISTER_GROUPS = [
+    ("REG_BYTE", ["al", "cl", "dl", "bl", "ah", "ch", "dh", "bh"] + [f"r{i}b" for i in range(8, 16)], 0),
+    ("REG_BYTE", ["", "", "", "", "spl", "bpl", "sil", "dil"], 1),
+    ("REG_WORD", ["ax", "cx", "dx", "bx", "sp", "bp", "si", "di"] + [f"r{i}w" for i in range(8, 16)], 0),
+    ("REG_LONG", ["eax", "ecx", "edx", "ebx", "esp", "ebp", "esi", "edi"] + [f"r{i}d" for i in range(8, 16)], 0),
+    ("REG_QUAD", ["rax", "rcx", "rdx", "rbx", "rsp", "rbp", "rsi", "rdi"] + [f"r{i}" for i in range(8, 16)], 0),
+    ("REG_XMM",  [f"xmm{i}" for i in range(16)], 0),
+    ("REG_ST",   ["st"], 0),
+    ("REG_RIP",  ["rip"], 0),
+]
+
+
+def registers():
+    result = []
+    for base, names, alt_8bit in REGISTER_GROUPS:
+        for i, name in enumerate(names):
+            if name:
+                result.append((name, f"{base} + {i}" if i else base, alt_8bit))
+    return result
+
+
+def pack(name):
+    if len(name) > MAX_KEYWORD_SIZE:
+        raise ValueError(f"{name} is longer than {MAX_KEYWORD_SIZE} characters")
+
+    prefix = name[:KEYWORD_PREFIX_SIZE]
+    words = [0, 0]
+    for i, c in enumerate(prefix):
+        words[i // 8] |= ord(c) << (8 * (i % 8))
+    return words[0], words[1], len(name)
+
+
+def slot(key, multiplier, bits):
+    word0, word1, size = key
+    mixed = word0 ^ ((word1 * multiplier) & MASK64) ^ size
+    return ((mixed * multiplier) & MASK64) >> (64 - bits)
+
+
+def find_perfect_hash(names):
+    keys = [pack(name) for name in names]
+    if len(set(keys)) != len(keys):
+        raise ValueError("Names must differ in their size or their first %d characters" % KEYWORD_PREFIX_SIZE)
+
+    rng = random.Random(0)
+    bits = max(len(keys) - 1, 1).bit_length()
+    while True:
+        for _ in range(MAX_TRIES):
+            multiplier = rng.getrandbits(64) | 1
+            if len({slot(key, multiplier, bits) for key in keys}) == len(keys):
+                return multiplier, bits
+        bits += 1
+
+
+def make_table(name, entries):
+    multiplier, bits = find_perfect_hash([entry[0] for entry in entries])
+
+    lines = [
+        f"uint64_t {name}_hash_multiplier = 0x{multiplier:016x};",
+        f"int {name}_hash_bits = {bits};",
+        "",
+        f"Keyword {name}_keywords[{1 << bits}] = {{",
+    ]
+
+    rows = sorted((slot(pack(entry[0]), multiplier, bits), entry) for entry in entries)
+    for index, (keyword, value, alt_8bit) in rows:
+        word0, word1, size = pack(keyword)
+        lines.append(
+            f"    [{index:3}] = {{ {{ 0x{word0:016x}, 0x{word1:016x} }}, {size:2}, "
+            f"{value + ',':21} {alt_8bit}, {chr(34) + keyword + chr(34)} }},")
+
+    lines.append("};")
+    return lines
+
+
+def main():
+    if len(sys.argv) != 2:
+        print(f"Usage: {sys.argv[0]} OUTPUT")
+        sys.exit(1)
+
+    lines = [
+        "#include \"keywords.h\"",
+        "#include \"lexer.h\"",
+        "",
+        "// Generated by scripts/keywords.py",
+        "",
+    ]
+
+    lines += make_table("directive", [(name, value, 0) for name, value in DIRECTIVES])
+    lines += [""]
+    lines += make_table("register", registers())
+
+    with open(sys.argv[1], "w") as f:
+        f.write("\n".join(lines) + "\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -353,6 +353,14 @@ class WasOpcode:
     op2: WasOperand
     op3: WasOperand
 
+    @property
+    def arg_count(self):
+        return sum(1 for op in (self.op1, self.op2, self.op3) if op.am or op.is_gen_reg)
+
+    @property
+    def default_64bit(self):
+        return int(self.mnem in DEFAULT_64BIT_MNEMONICS)
+
     def __str__(self):
         opcd_ext = str(self.opcd_ext) if self.opcd_ext != -1 else " "
         if self.needs_mod_rm:
@@ -394,6 +402,9 @@ class WasOpcode:
 
 OPCODES = {opcode_alias_tuple[1].mnem for opcode_alias_tuple in OPCODE_ALIASES}
 
+# Instructions that default to a 64 bit operand size in long mode and don't need a REX prefix
+DEFAULT_64BIT_MNEMONICS = {"push"}
+
 
 def read_xml(input_path: str):
     with open(input_path, "r") as f:
@@ -647,17 +658,318 @@ def make_was_opcodes(x86reference):
     return was_opcodes
 
 
+def make_opcode_alias_opcodes(was_opcodes: List[WasOpcode], opcode_aliases):
+    # Group the indexes of opcodes by mnemonic, so that an opcode alias can refer to
+    # a slice of opcode indexes without having to search the opcodes at runtime.
+    # Aliases with the same mnemonic share the same slice.
+
+    opcode_indexes_by_mnem = {}
+    for i, was_opcode in enumerate(was_opcodes):
+        opcode_indexes_by_mnem.setdefault(was_opcode.mnem, []).append(i)
+
+    opcode_alias_opcodes = []  # List of (mnem, indexes)
+    starts = {}  # Mnemonic -> start index
+    count = 0
+
+    for _, wcc_opcode in opcode_aliases:
+        mnem = wcc_opcode.mnem
+        if mnem in starts:
+            continue
+
+        indexes = opcode_indexes_by_mnem.get(mnem, [])
+        starts[mnem] = count
+        count += len(indexes)
+        if indexes:
+            opcode_alias_opcodes.append((mnem, indexes))
+
+    opcode_alias_slices = [
+        (starts[wcc_opcode.mnem], len(opcode_indexes_by_mnem.get(wcc_opcode.mnem, [])))
+        for _, wcc_opcode in opcode_aliases
+    ]
+
+    return opcode_alias_opcodes, opcode_alias_slices
+
+
+# Sizes of the perfect hash table and the number of buckets for the displacements.
+# The table size must be a power of two.
+OPCODE_ALIAS_HASH_SIZE = 1024
+OPCODE_ALIAS_HASH_BUCKETS = 256
+
+
+def make_opcode_alias_groups(opcode_aliases):
+    # Aliases are sorted by name, so aliases with the same name are adjacent.
+    # Returns a list of (name, start, count)
+    groups = []
+    for i, (opcode_alias, _) in enumerate(opcode_aliases):
+        if groups and groups[-1][0] == opcode_alias:
+            name, start, count = groups[-1]
+            groups[-1] = (name, start, count + 1)
+        else:
+            groups.append((opcode_alias, i, 1))
+
+    return groups
+
+
+def make_opcode_mnemonics(was_opcodes: List[WasOpcode]):
+    # Intern opcode mnemonics. Returns a list of unique mnemonics and a dict of mnemonic to index.
+    mnemonics = []
+    mnemonic_ids = {}
+    for was_opcode in was_opcodes:
+        if was_opcode.mnem not in mnemonic_ids:
+            mnemonic_ids[was_opcode.mnem] = len(mnemonics)
+            mnemonics.append(was_opcode.mnem)
+
+    return mnemonics, mnemonic_ids
+
+
+def opcode_alias_hash(seed: int, name: str) -> int:
+    # Seeded FNV-1a hash. This must match opcode_alias_hash() in opcodes.j2
+    result = 2166136261 ^ seed
+    for c in name.encode():
+        result = ((result ^ c) * 16777619) & 0xFFFFFFFF
+    return result
+
+
+def make_perfect_hash(names: List[str]):
+    # Make a collision-free hash using the hash and displace algorithm. Names are
+    # assigned to buckets using the unseeded hash. Starting with the largest bucket,
+    # a seed (the displacement) is searched for each bucket that puts all its names
+    # in free slots.
+    # Returns a tuple (displacements, table)
+
+    if len(names) > OPCODE_ALIAS_HASH_SIZE:
+        raise Exception("OPCODE_ALIAS_HASH_SIZE is too small")
+
+    buckets = [[] for _ in range(OPCODE_ALIAS_HASH_BUCKETS)]
+    for i, name in enumerate(names):
+        buckets[opcode_alias_hash(0, name) % OPCODE_ALIAS_HASH_BUCKETS].append(i)
+
+    displacements = [0] * OPCODE_ALIAS_HASH_BUCKETS
+    table = [-1] * OPCODE_ALIAS_HASH_SIZE
+
+    for bucket_index in sorted(
+        range(OPCODE_ALIAS_HASH_BUCKETS), key=lambda b: -len(buckets[b])
+    ):
+        bucket = buckets[bucket_index]
+        if not bucket:
+            break
+
+        displacement = 1
+        while True:
+            slots = [
+                opcode_alias_hash(displacement, names[i]) % OPCODE_ALIAS_HASH_SIZE
+                for i in bucket
+            ]
+            if len(set(slots)) == len(slots) and all(table[s] == -1 for s in slots):
+                break
+            displacement += 1
+
+        displacements[bucket_index] = displacement
+        for i, slot in zip(bucket, slots):
+            table[slot] = i
+
+    return displacements, table
+
+
+# Addressing modes the specialised opcode encoders can handle. Opcodes with other
+# addressing modes, e.g. memory only, are always encoded by the generic code in instr.c.
+ENCODER_ADDRESSING_MODES = {
+    None,
+    AddressingMode.E,
+    AddressingMode.G,
+    AddressingMode.I,
+    AddressingMode.J,
+    AddressingMode.V,
+    AddressingMode.W,
+    AddressingMode.Z,
+}
+
+# Immediate and relative operand types that are a byte, regardless of the operand size
+BYTE_OPERAND_TYPES = {OperandType.b, OperandType.bs, OperandType.bss}
+
+
+def make_opcode_encoder(index: int, was_opcode: WasOpcode) -> Optional[str]:
+    # Make a C function that encodes an opcode with register, immediate or relative
+    # operands. It does the same as make_encoding() and emit_instructions() in instr.c,
+    # but everything that only depends on the opcode is worked out here. The function
+    # returns 0 if it can't handle the operands, e.g. if one of them is in memory.
+    # Returns None if the opcode can't be specialised.
+
+    ops = [was_opcode.op1, was_opcode.op2, was_opcode.op3][: was_opcode.arg_count]
+    names = ["op1", "op2", "op3"]
+
+    if was_opcode.x87fpu or was_opcode.op1.type == OperandType.one:
+        return None
+
+    if any(op.am not in ENCODER_ADDRESSING_MODES for op in ops):
+        return None
+
+    is_xmm = any(op.am in (AddressingMode.V, AddressingMode.W) for op in ops)
+
+    value_ops = [
+        (name, op)
+        for name, op in zip(names, ops)
+        if op.am in (AddressingMode.I, AddressingMode.J)
+    ]
+    if len(value_ops) > 1:
+        return None
+
+    for _, op in value_ops:
+        if op.uses_operand_size and is_xmm:
+            return None
+        if not op.uses_operand_size and op.type not in BYTE_OPERAND_TYPES:
+            return None
+
+    checks = []
+    reg = str(was_opcode.opcd_ext) if was_opcode.opcd_ext != -1 else "0"
+    rm = "0"
+    primary_opcode = f"0x{was_opcode.value}"
+
+    for name, op in zip(names, ops):
+        if op.am in (AddressingMode.V, AddressingMode.W):
+            checks.append(f"IS_XMM_REGISTER({name})")
+        elif op.am == AddressingMode.I:
+            checks.append(f"OP_TYPE_IS_IMM({name})")
+        elif op.am == AddressingMode.J:
+            checks.append(f"IS_RELATIVE({name})")
+        else:
+            checks.append(f"IS_REGISTER({name})")
+
+        if op.am in (AddressingMode.G, AddressingMode.V):
+            reg = f"{name}->reg"
+        elif op.am in (AddressingMode.E, AddressingMode.W, AddressingMode.Z):
+            rm = f"{name}->reg"
+
+        if op.am == AddressingMode.Z:
+            primary_opcode += f" + ({name}->reg & 7)"
+
+    rex_w = (
+        not was_opcode.op1.word_or_double_word_operand
+        and not was_opcode.op2.word_or_double_word_operand
+        and not was_opcode.branch
+        and not was_opcode.default_64bit
+    )
+
+    alt_8bit = (
+        []
+        if was_opcode.default_64bit
+        else [f"OP_TYPE_IS_ALT_8BIT({name})" for name, op in zip(names, ops) if op.am != AddressingMode.I and op.am != AddressingMode.J]
+    )
+
+    rex_conditions = alt_8bit + (["size == SIZE64"] if rex_w else [])
+    if reg != "0" and not reg.isdigit():
+        rex_conditions.append("reg >= 8")
+    if rm != "0":
+        rex_conditions.append("rm >= 8")
+
+    rex_w_bit = "((size == SIZE64) << 3)" if rex_w else "0"
+
+    body = []
+    if checks:
+        body.append(f"    if (!({' && '.join(checks)})) return 0;")
+        body.append("")
+
+    has_mod_rm = was_opcode.needs_mod_rm or was_opcode.opcd_ext != -1
+    if rex_conditions or has_mod_rm:
+        body.append(f"    int reg = {reg};")
+        body.append(f"    int rm = {rm};")
+        body.append("")
+    body.append("    memset(instr, 0, sizeof(Instructions));")
+    body.append("    uint8_t *data = instr->data;")
+    body.append("")
+
+    if not is_xmm:
+        body.append("    if (size == SIZE16) *data++ = 0x66;")
+    if was_opcode.prefix != "00":
+        body.append(f"    *data++ = 0x{was_opcode.prefix};")
+    if rex_conditions:
+        body.append(
+            f"    if ({' || '.join(rex_conditions)}) *data++ = 0x40 | {rex_w_bit} | ((reg >> 3) * 4) | (rm >> 3);"
+        )
+    if was_opcode.ohf_prefix != "00":
+        body.append(f"    *data++ = 0x{was_opcode.ohf_prefix};")
+    body.append(f"    *data++ = {primary_opcode};")
+    if was_opcode.sec_opcd:
+        body.append(f"    *data++ = 0x{was_opcode.sec_opcd};")
+    if has_mod_rm:
+        body.append("    *data++ = 0xc0 | ((reg & 7) << 3) | (rm & 7);")
+
+    for name, op in value_ops:
+        if not op.uses_operand_size:
+            value_size = "SIZE08"
+        elif op.can_be_imm64:
+            value_size = "size"
+        else:
+            value_size = "(size == SIZE64 ? SIZE32 : size)"
+
+        value = "0" if was_opcode.branch else f"{name}->imm_or_mem_value"
+
+        body.append("")
+        body.append("    instr->relocation.offset = data - instr->data;")
+        body.append(f"    instr->relocation.size = {value_size};")
+        body.append(f"    data = encode_value(data, {value}, {value_size});")
+
+    body.append("")
+    body.append("    instr->size = data - instr->data;")
+    if was_opcode.branch:
+        body.append("    instr->branch = 1;")
+    body.append("")
+    body.append("    return 1;")
+
+    operands = ", ".join(
+        f"{op.am.value if op.am else ''}{op.type.value if op.type else ''}" for op in ops
+    )
+
+    return (
+        f"// {was_opcode.mnem} {operands}".rstrip()
+        + "\n"
+        + f"static int encode_opcode_{index}(Instructions *instr, Operand *op1, Operand *op2, Operand *op3, int size) {{\n"
+        + "\n".join(body)
+        + "\n}"
+    )
+
+
+def make_opcode_encoders(was_opcodes: List[WasOpcode]):
+    # Returns a list of (index, code) for the opcodes that have a specialised encoder
+    encoders = []
+    for i, was_opcode in enumerate(was_opcodes):
+        code = make_opcode_encoder(i, was_opcode)
+        if code is not None:
+            encoders.append((i, code))
+
+    return encoders
+
+
 def output_code(was_opcodes: List[WasOpcode], output_path: str):
     template = Template(open("scripts/opcodes.j2").read())
 
     sorted_opcode_aliases = sorted(OPCODE_ALIASES, key=lambda oa: oa[0])
 
+    opcode_alias_opcodes, opcode_alias_slices = make_opcode_alias_opcodes(
+        was_opcodes, sorted_opcode_aliases
+    )
+
+    opcode_mnemonics, opcode_mnemonic_ids = make_opcode_mnemonics(was_opcodes)
+    opcode_alias_groups = make_opcode_alias_groups(sorted_opcode_aliases)
+    displacements, table = make_perfect_hash([g[0] for g in opcode_alias_groups])
+    opcode_encoders = make_opcode_encoders(was_opcodes)
+
     with open(output_path, "w") as f:
         f.write(
             template.render(
                 generator=sys.argv[0],
                 opcodes=was_opcodes,
-                opcode_aliases=sorted_opcode_aliases,
+                opcode_mnemonics=opcode_mnemonics,
+                opcode_mnemonic_ids=opcode_mnemonic_ids,
+                opcode_aliases=zip(sorted_opcode_aliases, opcode_alias_slices),
+                opcode_alias_opcodes=opcode_alias_opcodes,
+                opcode_alias_groups=opcode_alias_groups,
+                opcode_alias_hash_size=OPCODE_ALIAS_HASH_SIZE,
+                opcode_alias_hash_buckets=OPCODE_ALIAS_HASH_BUCKETS,
+                opcode_alias_hash_displacements=displacements,
+                opcode_alias_hash_table=table,
+                opcode_encoders=opcode_encoders,
+                opcode_encoder_indexes={i for i, _ in opcode_encoders},
             )
         )
 
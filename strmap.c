@@ -1,114 +1,158 @@
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 
 #include "strmap.h"
 #include "utils.h"
 
+// An open addressing hash table with Robin Hood probing. Entries that are further
+// away from their home slot take the place of entries that are closer to theirs, which
+// keeps probe sequences short and makes it possible to stop a lookup early. The hash
+// and length of each key are stored, so that a strcmp is only done on a likely match,
+// and growing the table doesn't need to rehash the keys. Deleted entries are removed
+// by shifting the entries after them back, so there are no tombstones.
+
 enum {
-    TOMBSTONE        = -1,
     DEFAULT_SIZE     = 16,
-    MAX_LOAD_FACTOR  = 666,  // 0.666 * 1000
-    EXPANSION_FACTOR = 333,  // 0.333 * 1000
+    MAX_LOAD_FACTOR  = 800,  // 0.8 * 1000
 };
 
+// Hash eight bytes at a time
+static uint32_t hash(char *key, int length) {
+    uint64_t result = 0x9e3779b97f4a7c15ULL ^ length;
+
+    while (length >= 8) {
+        uint64_t word;
+        memcpy(&word, key, 8);
+        result = (result ^ word) * 0xbf58476d1ce4e5b9ULL;
+        result ^= result >> 31;
+        key += 8;
+        length -= 8;
+    }
 
-static unsigned int hash(char *str) {
-    // FNV hash function
-    unsigned int result = 2166136261;
-    char *p = str;
-    while (*p) {
-        result = (result ^ (*p)) * 16777619;
-        p++;
+    if (length) {
+        uint64_t word = 0;
+        memcpy(&word, key, length);
+        result = (result ^ word) * 0xbf58476d1ce4e5b9ULL;
     }
+
+    result ^= result >> 32;
+    result *= 0x94d049bb133111ebULL;
+    result ^= result >> 29;
+
     return result;
 }
 
-static void maybe_rehash(StrMap *map) {
-    if (map->used_count * 1000 < map->size * MAX_LOAD_FACTOR) return;
-
-    int new_size;
-    if (map->element_count * 1000 < map->size * EXPANSION_FACTOR)
-        new_size = map->size;
-    else
-        new_size = map->size * 2;
-
-    int mask = new_size - 1;
-    char **keys = calloc(new_size,  sizeof(char *));
-    void **values = calloc(new_size,  sizeof(void *));
-
-    for (int i = 0; i < map->size; i++) {
-        char *key;
-        if (!(key = map->keys[i]) || key == (char *) TOMBSTONE) continue;
-        unsigned int pos = hash(key) & mask;
-        while (1) {
-            if (!keys[pos]) {
-                keys[pos] = key;
-                values[pos] = map->values[i];
-                break;
-            }
-            pos = (pos + 1) & mask;
-        }
-    }
+// The distance of the entry in pos from its home slot
+#define PROBE_DISTANCE(map, entry, pos) (((pos) - (entry)->hash) & ((map)->size - 1))
 
-    free(map->keys);
-    free(map->values);
-    map->keys = keys;
-    map->values = values;
-    map->size = new_size;
-    map->used_count = map->element_count;
-}
+static StrMapEntry *lookup(StrMap *map, char *key, uint32_t key_hash, int length) {
+    unsigned int mask = map->size - 1;
+    unsigned int pos = key_hash & mask;
 
-void strmap_put(StrMap *map, char *key, void *value) {
-    maybe_rehash(map);
+    for (unsigned int distance = 0; ; distance++) {
+        StrMapEntry *entry = &map->entries[pos];
+
+        // An empty slot or an entry closer to its home means the key isn't there
+        if (!entry->key || PROBE_DISTANCE(map, entry, pos) < distance) return NULL;
+
+        if (entry->hash == key_hash && entry->length == length && !memcmp(entry->key, key, length))
+            return entry;
 
+        pos = (pos + 1) & mask;
+    }
+}
+
+// Insert an entry for a key that isn't in the map. There must be a free slot.
+static void insert(StrMap *map, StrMapEntry entry) {
     unsigned int mask = map->size - 1;
-    unsigned int pos = hash(key) & mask;
+    unsigned int pos = entry.hash & mask;
 
-    char *k;
-    while (1) {
-        k = map->keys[pos];
-        if (!k || k == (char *) TOMBSTONE) {
-            map->keys[pos] = key;
-            map->values[pos] = value;
-            map->element_count++;
-            if (!k) map->used_count++;
+    for (unsigned int distance = 0; ; distance++) {
+        StrMapEntry *slot = &map->entries[pos];
+
+        if (!slot->key) {
+            *slot = entry;
             return;
         }
 
-        if (!strcmp(k, key)) {
-            map->values[pos] = value;
-            return;
+        // Take the slot from an entry that is closer to its home, then carry on
+        // inserting that one.
+        unsigned int slot_distance = PROBE_DISTANCE(map, slot, pos);
+        if (slot_distance < distance) {
+            StrMapEntry displaced = *slot;
+            *slot = entry;
+            entry = displaced;
+            distance = slot_distance;
         }
+
         pos = (pos + 1) & mask;
     }
 }
 
-void *strmap_get(StrMap *map, char *key) {
-    unsigned int mask = map->size - 1;
-    unsigned int pos = hash(key) & mask;
+static void maybe_rehash(StrMap *map) {
+    if ((map->element_count + 1) * 1000L < map->size * (long) MAX_LOAD_FACTOR) return;
 
-    char *k;
-    while ((k = map->keys[pos])) {
-        if (k != (char *) TOMBSTONE && !strcmp(k, key)) return map->values[pos];
-        pos = (pos + 1) & mask;
+    StrMapEntry *old_entries = map->entries;
+    int old_size = map->size;
+
+    map->size *= 2;
+    map->entries = calloc(map->size, sizeof(StrMapEntry));
+
+    for (int i = 0; i < old_size; i++)
+        if (old_entries[i].key) insert(map, old_entries[i]);
+
+    free(old_entries);
+}
+
+void strmap_put(StrMap *map, char *key, void *value) {
+    int length = strlen(key);
+    uint32_t key_hash = hash(key, length);
+
+    StrMapEntry *entry = lookup(map, key, key_hash, length);
+    if (entry) {
+        entry->value = value;
+        return;
     }
-    return 0;
+
+    maybe_rehash(map);
+
+    StrMapEntry new_entry = { key, value, key_hash, length };
+    insert(map, new_entry);
+    map->element_count++;
+}
+
+void *strmap_get(StrMap *map, char *key) {
+    return strmap_get_slice(map, key, strlen(key));
+}
+
+// Look up the length bytes at key, which don't need to be null terminated
+void *strmap_get_slice(StrMap *map, char *key, int length) {
+    StrMapEntry *entry = lookup(map, key, hash(key, length), length);
+
+    return entry ? entry->value : NULL;
 }
 
 void strmap_delete(StrMap *map, char *key) {
+    int length = strlen(key);
+    StrMapEntry *entry = lookup(map, key, hash(key, length), length);
+    if (!entry) return;
+
+    // Shift the following entries back until one is empty or already in its home slot
     unsigned int mask = map->size - 1;
-    unsigned int pos = hash(key) & mask;
-
-    char *k;
-    while ((k = map->keys[pos])) {
-        if (k != (char *) TOMBSTONE && !strcmp(k, key)) {
-            map->keys[pos] = (char *) TOMBSTONE;
-            map->values[pos] = 0;
-            map->element_count--;
-            return;
-        }
-        pos = (pos + 1) & mask;
+    unsigned int pos = entry - map->entries;
+
+    while (1) {
+        unsigned int next_pos = (pos + 1) & mask;
+        StrMapEntry *next_entry = &map->entries[next_pos];
+        if (!next_entry->key || PROBE_DISTANCE(map, next_entry, next_pos) == 0) break;
+
+        map->entries[pos] = *next_entry;
+        pos = next_pos;
     }
+
+    memset(&map->entries[pos], 0, sizeof(StrMapEntry));
+    map->element_count--;
 }
 
 int strmap_iterator_finished(StrMapIterator *iterator) {
@@ -120,16 +164,15 @@ void strmap_iterator_next(StrMapIterator *iterator) {
 
     iterator->pos++;
 
-    while (iterator->pos < iterator->map->size && (!iterator->map->keys[iterator->pos] || iterator->map->keys[iterator->pos] == (char *) TOMBSTONE))
+    while (iterator->pos < iterator->map->size && !iterator->map->entries[iterator->pos].key)
         iterator->pos++;
 
-    if (iterator->pos == iterator->map->size || (!iterator->map->keys[iterator->pos] || iterator->map->keys[iterator->pos] == (char *) TOMBSTONE))
-        iterator->pos = -1;
+    if (iterator->pos == iterator->map->size) iterator->pos = -1;
 }
 
 char *strmap_iterator_key(StrMapIterator *iterator) {
     if (iterator->pos == -1) panic("Attempt to iterate beyond the end of the iterator");
-    return iterator->map->keys[iterator->pos];
+    return iterator->map->entries[iterator->pos].key;
 }
 
 StrMapIterator strmap_iterator(StrMap *map) {
@@ -145,13 +188,11 @@ StrMapIterator strmap_iterator(StrMap *map) {
 StrMap *new_strmap(void) {
     StrMap *map = calloc(1, sizeof(StrMap));
     map->size = DEFAULT_SIZE;
-    map->keys = calloc(DEFAULT_SIZE, sizeof(void *));
-    map->values = calloc(DEFAULT_SIZE, sizeof(char *));
+    map->entries = calloc(DEFAULT_SIZE, sizeof(StrMapEntry));
     return map;
 }
 
 void free_strmap(StrMap *map) {
-    free(map->keys);
-    free(map->values);
+    free(map->entries);
     free(map);
 }
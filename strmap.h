@@ -1,11 +1,18 @@
 #ifndef _STRMAP_H
 #define _STRMAP_H
 
+#include <stdint.h>
+
+typedef struct strmap_entry {
+    char *key;          // NULL if the slot is empty
+    void *value;
+    uint32_t hash;
+    int length;         // Length of the key
+} StrMapEntry;
+
 typedef struct strmap {
-    char **keys;
-    void **values;
+    StrMapEntry *entries;
     int size;
-    int used_count;
     int element_count;
 } StrMap;
 
@@ -18,6 +25,7 @@ typedef struct strmap_iterator {
 StrMap *new_strmap(void);
 void free_strmap(StrMap *map);
 void *strmap_get(StrMap *strmap, char *key);
+void *strmap_get_slice(StrMap *strmap, char *key, int length);
 void strmap_put(StrMap *strmap, char *key, void *value);
 void strmap_delete(StrMap *strmap, char *key);
 StrMapIterator strmap_iterator(StrMap *map);
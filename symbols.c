@@ -1,6 +1,7 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "arena.h"
 #include "elf.h"
 #include "strmap.h"
 #include "symbols.h"
@@ -8,11 +9,13 @@
 // The naming is dubious: this covers both symbols and sections
 
 StrMap *symbols;
+List *symbols_list;     // Symbols in the order they were added
 
 Symbol builtin_dot_symbol = { ".", 0, STB_LOCAL, STT_NOTYPE };
 
 void init_symbols(void) {
     symbols = new_strmap();
+    symbols_list = new_list(1024);
 }
 
 // Get a symbol from the symbol table. Returns NULL if not present.
@@ -23,13 +26,14 @@ Symbol *get_symbol(char *name) {
 }
 
 Symbol *add_symbol(char *name) {
-    Symbol *symbol = calloc(1, sizeof(Symbol));
+    Symbol *symbol = arena_alloc(sizeof(Symbol));
 
     symbol->name    = name;
     symbol->type    = STT_NOTYPE;
     symbol->binding = STB_LOCAL;
 
     strmap_put(symbols, name, symbol);
+    append_to_list(symbols_list, symbol);
 
     return symbol;
 }
@@ -44,6 +48,14 @@ Symbol *get_or_add_symbol(char *name) {
         return add_symbol(name);
 }
 
+// Retrieve the symbol for an interned identifier. If it doesn't exist, create one.
+// The symbol is remembered in the identifier, so it's only looked up by name once.
+Symbol *get_or_add_identifier_symbol(Identifier *identifier) {
+    if (!identifier->symbol) identifier->symbol = get_or_add_symbol(identifier->name);
+
+    return identifier->symbol;
+}
+
 // Add a section + associated symbol
 Section *add_section(char *name, int type, int flags, int align) {
     Section *section = add_elf_section(name, type, flags, align);
@@ -54,7 +66,7 @@ Section *add_section(char *name, int type, int flags, int align) {
 
         // A symbol might already be defined before the section is created
         if (!symbol) {
-            symbol = add_symbol(strdup(name));
+            symbol = add_symbol(arena_strdup(name));
         }
 
         symbol->binding = STB_LOCAL;
@@ -68,9 +80,9 @@ Section *add_section(char *name, int type, int flags, int align) {
 // Add non-global, then global symbols to the symtab section
 void make_symbols_section(void) {
     // Add non-global symbols
-    for (StrMapIterator it = strmap_iterator(symbols); !strmap_iterator_finished(&it); strmap_iterator_next(&it)) {
-        char *name = strmap_iterator_key(&it);
-        Symbol *symbol = strmap_get(symbols, name);
+    for (int i = 0; i < symbols_list->length; i++) {
+        Symbol *symbol = symbols_list->elements[i];
+        char *name = symbol->name;
 
         if (symbol->section) symbol->section_index = symbol->section->index;
 
@@ -91,9 +103,9 @@ void make_symbols_section(void) {
     }
 
     // Add global symbols
-    for (StrMapIterator it = strmap_iterator(symbols); !strmap_iterator_finished(&it); strmap_iterator_next(&it)) {
-        char *name = strmap_iterator_key(&it);
-        Symbol *symbol = strmap_get(symbols, name);
+    for (int i = 0; i < symbols_list->length; i++) {
+        Symbol *symbol = symbols_list->elements[i];
+        char *name = symbol->name;
 
         if (symbol->section) symbol->section_index = symbol->section->index;
 
@@ -2,6 +2,7 @@
 #define _SYMBOLS_H
 
 #include "elf.h"
+#include "lexer.h"
 #include "strmap.h"
 
 // The naming is dubious: this covers both symbols and sections
@@ -23,14 +24,20 @@ typedef struct symbol {
     Section *section;   // Section the symbol was defined in. Zero if not in a section (e.g. an undefined symbol)
     int section_index;  // Section index the symbol was defined in. Set either in the final pass, or if section is unset, e.g. for the COMM section
     int value;          // Offset or alignment
+    int fragment_index; // For labels, the index of the first branch relaxation fragment after it
+    int is_loop_header; // Is the label the target of a backward jump
+    int order;          // Position in the symbol ordering file, zero if it isn't in it
+    struct symbol *jump_target; // For labels right before a jmp, the symbol it jumps to
 } Symbol;
 
 extern StrMap *symbols;
+extern List *symbols_list;
 
 void init_symbols(void);
 Symbol *get_symbol(char *name);
 Symbol *add_symbol(char *name);
 Symbol *get_or_add_symbol(char *name);
+Symbol *get_or_add_identifier_symbol(Identifier *identifier);
 Section *add_section(char *name, int type, int flags, int align);
 void make_symbols_section(void);
 void init_default_sections(void);
@@ -3,6 +3,7 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "branches.h"
 #include "dwarf.h"
 #include "elf.h"
 #include "lexer.h"
@@ -34,12 +35,16 @@ void test_assembly(char *input, ...) {
     parse_directive_statement();
     next();
 
-    while (cur_token != TOK_EOF) {
+    while (TOKEN_KIND(cur_token_index) != TOK_EOF) {
         parse_directive_statement();
-        while (cur_token == TOK_EOL) next();
+        while (TOKEN_KIND(cur_token_index) == TOK_EOL) next();
+    }
+
+    if (section->chunks) {
+        layout_section(section);
+        emit_section_code(section);
     }
 
-    if (section->chunks) emit_section_code(section);
     vassert_section_data(section, ap);
 
     printf("pass\n");
@@ -48,6 +53,11 @@ void test_assembly(char *input, ...) {
 int main() {
     init_tests();
 
+    test_assembly(".byte 1; .balign 4; .byte 2",          0x01, 0x00, 0x00, 0x00, 0x02, END);
+    test_assembly(".byte 1; .p2align 2, 0xff; .byte 2",   0x01, 0xff, 0xff, 0xff, 0x02, END);
+    test_assembly(".byte 1; .balign 4,, 2; .byte 2",      0x01, 0x02, END);
+    test_assembly(".byte 1; .balign 4, 0xff, 3; .byte 2", 0x01, 0xff, 0xff, 0xff, 0x02, END);
+
     test_assembly(".byte 1",  0x01, END);
     test_assembly(".word 1",  0x01, 0x00, END);
     test_assembly(".value 1", 0x01, 0x00, END);
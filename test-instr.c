@@ -1,13 +1,19 @@
 #include <stdarg.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
 
+#include "branches.h"
 #include "dwarf.h"
 #include "elf.h"
 #include "lexer.h"
+#include "ordering.h"
+#include "peephole.h"
 #include "instr.h"
 #include "parser.h"
 #include "relocations.h"
+#include "scan.h"
 #include "symbols.h"
 #include "utils.h"
 #include "test-utils.h"
@@ -46,6 +52,27 @@ void assert_instructions(Instructions* instr, va_list ap) {
     }
 }
 
+// Copy the primary instructions of a code chunk
+static Instructions chunk_instructions(Chunk *chunk) {
+    Instructions instr;
+    memset(&instr, 0, sizeof(Instructions));
+
+    if (chunk->type == CT_CODE) {
+        CodeChunk *code_chunk = (CodeChunk *) chunk;
+        instr.size = code_chunk->size;
+        memcpy(instr.data, code_chunk->data, code_chunk->size);
+    }
+    else if (chunk->type == CT_RELOCATED_CODE) {
+        RelocatedCodeChunk *code_chunk = (RelocatedCodeChunk *) chunk;
+        instr.size = code_chunk->size;
+        memcpy(instr.data, code_chunk->data, code_chunk->size);
+    }
+    else
+        panic("Not a code chunk: %d", chunk->type);
+
+    return instr;
+}
+
 void test_assembly(char *input, ...) {
     va_list ap;
     va_start(ap, input);
@@ -54,9 +81,8 @@ void test_assembly(char *input, ...) {
     init_lexer_from_string(input);
     init_parser();
     init_dwarf();
-    Chunk *c = parse_instruction_statement();
-    Instructions *instr = c->coc.primary;
-    assert_instructions(instr, ap);
+    Instructions instr = chunk_instructions(parse_instruction_statement());
+    assert_instructions(&instr, ap);
 
     printf("pass\n");
 }
@@ -742,6 +768,23 @@ void test_parse_instruction_statement() {
     test_assembly("callq    *%r15",   0x41, 0xff, 0xd7, END);
 }
 
+// Check every opcode alias group can be found with the perfect hash
+void test_opcode_alias_group_lookup(void) {
+    printf("%-60s", "opcode_alias_group_lookup");
+
+    for (int i = 0; i < opcode_alias_groups_count; i++) {
+        char *name = opcode_alias_groups[i].name;
+        int index = lookup_opcode_alias_group(name, strlen(name));
+        if (index != i) panic("Lookup of %s returned %d, expected %d", name, index, i);
+    }
+
+    if (lookup_opcode_alias_group("movqq", 5) != -1) panic("Unexpected lookup of movqq");
+    if (lookup_opcode_alias_group("movq", 3) == -1) panic("Lookup of mov failed");
+    if (lookup_opcode_alias_group("", 0) != -1) panic("Unexpected lookup of empty name");
+
+    printf("pass\n");
+}
+
 void test_reduce_branch_instructions(void) {
     char *input =
         "top:\n"
@@ -852,6 +895,55 @@ void test_reduce_branch_instructions(void) {
         0x90,                   // a: nop
         0x90,                   // b: nop
         END);
+
+    // 125 zeroes: the first branch only fits once the second one is shortened
+    input =
+        "jne a\n"
+        ".zero 125\n"
+        "jne b\n"
+        "a:\n"
+        "b: nop\n";
+
+    test_full_assembly("reduce_branch_instructions chain with 125 zeros", input,
+        0x75, 0x7f,             // jne a
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 125 zeroes
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0,
+        0x75, 0x00,             // jne b
+        0x90,                   // a: b: nop
+        END);
+
+    // 126 zeroes: only the second branch gets shortened
+    input =
+        "jne a\n"
+        ".zero 126\n"
+        "jne b\n"
+        "a:\n"
+        "b: nop\n";
+
+    test_full_assembly("reduce_branch_instructions chain with 126 zeros", input,
+        0x0f, 0x85, 0x80, 0x00, 0x00, 0x00,     // jne a
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 126 zeroes
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+        0x75, 0x00,                             // jne b
+        0x90,                                   // a: b: nop
+        END);
+
+    // Global symbols can be preempted, so branches to them are left for the linker
+    test_full_assembly("reduce_branch_instructions with a global symbol",
+        "jne foo; .globl foo; foo: nop",
+        0x0f, 0x85, 0x00, 0x00, 0x00, 0x00,     // jne foo
+        0x90,                                   // foo: nop
+        END);
 }
 
 void test_relocations_with_imm_rip_and_undefined_symbol(void) {
@@ -1251,6 +1343,70 @@ void test_zero_in_text_section(void) {
     test_full_assembly("test_zero_in_text_section byte", input, 0x90, 0x00, 0x00, 0x00, 0x00, 0x42, END);
 }
 
+// Identical statements without a relocation share their instructions. Statements with a
+// relocation are encoded separately, since the relocation is patched in.
+void test_shared_instructions(void) {
+    char *input =
+        "foo:\n"
+        "    movq $1, %rax\n"
+        "    movq $1,%rax # A comment\n"
+        "    leaq foo(%rip), %rax\n"
+        "    leaq foo(%rip), %rax\n"
+        "    movq  $1 , %rax; ret\n"
+        "    ret";
+
+    shared_instructions_hits = 0;
+    shared_instructions_misses = 0;
+
+    test_full_assembly("test_shared_instructions", input,
+        0x48, 0xc7, 0xc0, 0x01, 0x00, 0x00, 0x00,
+        0x48, 0xc7, 0xc0, 0x01, 0x00, 0x00, 0x00,
+        0x48, 0x8d, 0x05, 0xeb, 0xff, 0xff, 0xff,
+        0x48, 0x8d, 0x05, 0xe4, 0xff, 0xff, 0xff,
+        0x48, 0xc7, 0xc0, 0x01, 0x00, 0x00, 0x00,
+        0xc3,
+        0xc3,
+        END);
+
+    // The leaqs have a relocation and aren't shared. The first movq and ret are
+    // encoded, the others are shared.
+    if (shared_instructions_misses != 2) panic("Expected two shared instructions misses, got %d", shared_instructions_misses);
+    if (shared_instructions_hits != 3) panic("Expected three shared instructions hits, got %d", shared_instructions_hits);
+}
+
+// Check the short and long forms of a branch, parsed twice so that the second time the
+// precomputed forms are used
+static void test_branch_forms(char *mnemonic, int long_size, int short_size, uint8_t *long_data, uint8_t *short_data) {
+    char input[32];
+    sprintf(input, "%s foo\n%s bar", mnemonic, mnemonic);
+    printf("branch forms %-47s", mnemonic);
+
+    init_lexer_from_string(input);
+    init_parser();
+    init_dwarf();
+
+    for (int i = 0; i < 2; i++) {
+        RelocatedCodeChunk *c = (RelocatedCodeChunk *) parse_instruction_statement();
+
+        if (c->chunk.type != CT_RELOCATED_CODE || !c->secondary_size) panic("Missing short form");
+        if (c->size != long_size || memcmp(c->data, long_data, long_size)) panic("Mismatch in long form");
+        if (c->secondary_size != short_size || memcmp(c->data + long_size, short_data, short_size)) panic("Mismatch in short form");
+        if (c->relocation_type != R_X86_64_PLT32) panic("Expected a PLT32 relocation");
+        if (c->relocation_offset != long_size - 4) panic("Wrong long form relocation");
+        if (c->secondary_relocation_offset != short_size - 1) panic("Wrong short form relocation");
+
+        while (TOKEN_KIND(cur_token_index) == TOK_EOL) next();
+    }
+
+    printf("pass\n");
+}
+
+void test_branches_forms(void) {
+    test_branch_forms("jne", 6, 2, (uint8_t[]) {0x0f, 0x85, 0, 0, 0, 0}, (uint8_t[]) {0x75, 0});
+    test_branch_forms("jle", 6, 2, (uint8_t[]) {0x0f, 0x8e, 0, 0, 0, 0}, (uint8_t[]) {0x7e, 0});
+    test_branch_forms("jz",  6, 2, (uint8_t[]) {0x0f, 0x84, 0, 0, 0, 0}, (uint8_t[]) {0x74, 0});
+}
+
 void test_symbol_types_and_binding(void) {
     int text_index = section_text->index;
     int data_index = section_data->index;
@@ -1311,8 +1467,8 @@ void test_symbol_types_and_binding(void) {
         ".local foo3; .comm foo3, 4, 8",
         END);
     assert_symbols(
+        0,  8, STT_OBJECT, STB_LOCAL, bss_index, "foo1",
         8,  4, STT_OBJECT, STB_LOCAL, bss_index, "foo2",
-        0,  8, STT_OBJECT, STB_LOCAL, bss_index, "foo1", // The odd order is due to the strmap_iterator
         12, 4, STT_OBJECT, STB_LOCAL, bss_index, "foo3",
         END);
 
@@ -1341,8 +1497,8 @@ static void test_size_difference(void) {
         0x90, 0x90, END);
 
     assert_symbols(
+        1, 0, STT_NOTYPE, STB_LOCAL,  text_index, "bar", // Symbols are in the order they are first seen
         0, 0, STT_NOTYPE, STB_LOCAL,  text_index, "foo",
-        1, 0, STT_NOTYPE, STB_LOCAL,  text_index, "bar",
         0, 1, STT_NOTYPE, STB_GLOBAL, SHN_UNDEF,  "obj", // Size of nop instruction
         END);
 
@@ -1404,6 +1560,8 @@ static void test_section_creation(void) {
     assert_section(".foo", SHT_PROGBITS, SHF_MERGE | SHF_STRINGS);
 }
 
+#define NOP9 0x66, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00
+
 static void test_align(void) {
     test_full_assembly(
         "ret; .align 2; ret", NULL,
@@ -1413,30 +1571,493 @@ static void test_align(void) {
     test_full_assembly(
         "ret; .align 8; ret", NULL,
         0xc3,
-        0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
+        0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00,
         0xc3, END);
 
     test_full_assembly(
         "je foo; .align 256; foo: ret", NULL,
         0x0f, 0x84, 0xfa, 0x00, 0x00, 0x00,
-        0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-        0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-        0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-        0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-        0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-        0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-        0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-        0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-        0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-        0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-        0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-        0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-        0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-        0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-        0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
-        0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
+        NOP9, NOP9, NOP9, NOP9, NOP9, NOP9, NOP9, NOP9, NOP9,
+        NOP9, NOP9, NOP9, NOP9, NOP9, NOP9, NOP9, NOP9, NOP9,
+        NOP9, NOP9, NOP9, NOP9, NOP9, NOP9, NOP9, NOP9, NOP9,
+        0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00,
+        0xc3,
+        END);
+
+    test_full_assembly(
+        "ret; .balign 16; ret", NULL,
+        0xc3,
+        NOP9, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00,
+        0xc3, END);
+
+    test_full_assembly(
+        "ret; .p2align 3; ret", NULL,
+        0xc3,
+        0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00,
+        0xc3, END);
+
+    test_full_assembly(
+        "ret; .p2align 3, 0xcc; ret", NULL,
+        0xc3,
+        0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+        0xc3, END);
+
+    // Padding of 15 is more than the max skip of 10
+    test_full_assembly(
+        "ret; .p2align 4,,10; ret", NULL,
+        0xc3, 0xc3, END);
+
+    // Padding of 9 is within the max skip of 10
+    test_full_assembly(
+        "ret; .zero 6; .p2align 4,,10; ret", NULL,
+        0xc3,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        NOP9,
+        0xc3, END);
+
+    // Shortening the first branch moves the second one back, but not its target after
+    // the alignment, so the second one no longer fits and goes back to the long form.
+    // That in turn takes the first one out of reach.
+    test_full_assembly("branch over an alignment goes back to the long form",
+        "jne a; .zero 121; jne t; jne b; b: a: .p2align 8; t: nop",
+        0x0f, 0x85, 0x81, 0x00, 0x00, 0x00,     // jne a
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 121 zeroes
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0,
+        0x0f, 0x85, 0x7b, 0x00, 0x00, 0x00,     // jne t
+        0x75, 0x00,                             // jne b
+        NOP9, NOP9, NOP9, NOP9, NOP9, NOP9, NOP9, NOP9, NOP9, NOP9, NOP9, NOP9, NOP9,
+        0x0f, 0x1f, 0x40, 0x00,
+        0x90,                                   // t: nop
+        END);
+
+    test_full_assembly(".p2align raises the section alignment", ".p2align 6; ret", 0xc3, END);
+    if (section_text->align != 64) panic("Expected .text to be aligned to 64, got %d", section_text->align);
+}
+
+static void test_align_loops_and_functions(void) {
+    align_functions = 16;
+    align_functions_max_skip = 15;
+
+    test_full_assembly("function entry is aligned",
+        "ret; .type foo, @function; foo: ret",
         0xc3,
+        NOP9, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00,
+        0xc3, END);
+
+    // Padding of 15 is more than the max skip of 7
+    align_functions_max_skip = 7;
+    test_full_assembly("function entry alignment with a max skip",
+        "ret; .type foo, @function; foo: ret",
+        0xc3, 0xc3, END);
+
+    align_functions = 0;
+    align_functions_max_skip = 0;
+    align_loops = 8;
+    align_loops_max_skip = 7;
+
+    // The target of the backward branch is aligned. The branch is still short, since
+    // relaxation sees the padding.
+    test_full_assembly("loop header is aligned",
+        "nop; loop: nop; jne loop",
+        0x90,
+        0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00,
+        0x90,                   // loop: nop
+        0x75, 0xfd,             // jne loop
+        END);
+
+    // The target of a forward branch isn't a loop header
+    test_full_assembly("forward branch target isn't aligned",
+        "nop; jne foo; foo: ret",
+        0x90,
+        0x75, 0x00,             // jne foo
+        0xc3,                   // foo: ret
+        END);
+
+    // No extra alignment if there already is one
+    test_full_assembly("loop header after an alignment",
+        "nop; .p2align 2; loop: jne loop",
+        0x90,
+        0x0f, 0x1f, 0x00,
+        0x75, 0xfe,             // loop: jne loop
         END);
+
+    test_full_assembly("loop header of a jmp is aligned",
+        "nop; loop: nop; jmp loop",
+        0x90,
+        0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00,
+        0x90,                           // loop: nop
+        0xe9, 0xfa, 0xff, 0xff, 0xff,   // jmp loop
+        END);
+
+    align_loops = 0;
+    align_loops_max_skip = 0;
+
+    // The section must be aligned at least as much as the labels in it, or the
+    // alignment is lost after linking
+    align_functions = 32;
+    align_functions_max_skip = 31;
+    test_full_assembly("function alignment raises the section alignment",
+        ".type foo, @function; foo: ret", 0xc3, END);
+    if (section_text->align != 32) panic("Expected .text to be aligned to 32, got %d", section_text->align);
+
+    align_functions = 0;
+    align_functions_max_skip = 0;
+    align_loops = 64;
+    align_loops_max_skip = 63;
+    test_full_assembly("loop alignment raises the section alignment",
+        "loop: jne loop", 0x75, 0xfe, END);
+    if (section_text->align != 64) panic("Expected .text to be aligned to 64, got %d", section_text->align);
+
+    align_loops = 0;
+    align_loops_max_skip = 0;
+}
+
+static void test_branches_within_boundaries(void) {
+    branch_boundary = 32;
+
+    test_full_assembly("branch that fits isn't padded",
+        ".zero 20; jne foo; foo: ret",
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0x75, 0x00,                     // jne foo
+        0xc3,                           // foo: ret
+        END);
+
+    test_full_assembly("branch ending on a boundary is padded",
+        ".zero 30; jne foo; foo: ret",
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0x66, 0x90,
+        0x75, 0x00,                     // jne foo
+        0xc3,                           // foo: ret
+        END);
+
+    test_full_assembly("jmp crossing a boundary is padded",
+        ".zero 31; jmp *%rax",
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0x90,
+        0xff, 0xe0,                     // jmp *%rax
+        END);
+
+    test_full_assembly("fused cmp and jne are padded together",
+        ".zero 28; cmp %eax, %ebx; foo: jne foo",
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0x0f, 0x1f, 0x40, 0x00,
+        0x39, 0xc3,                     // cmp %eax, %ebx
+        0x75, 0xfe,                     // foo: jne foo
+        END);
+
+    test_full_assembly("call ending on a boundary is padded",
+        ".zero 28; call foo; foo: ret",
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0x0f, 0x1f, 0x40, 0x00,
+        0xe8, 0x00, 0x00, 0x00, 0x00,   // call foo
+        0xc3,                           // foo: ret
+        END);
+
+    test_full_assembly("indirect call crossing a boundary is padded",
+        ".zero 31; call *%rax",
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0x90,
+        0xff, 0xd0,                     // call *%rax
+        END);
+
+    test_full_assembly("ret ending on a boundary is padded",
+        ".zero 31; ret",
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0x90,
+        0xc3,                           // ret
+        END);
+
+    // A loop header in between doesn't get an alignment that would split the pair
+    align_loops = 16;
+    align_loops_max_skip = 0;
+    test_full_assembly("loop header in a fused pair isn't aligned",
+        ".zero 26; cmp $0, %rax; loop: jne loop",
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+        0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00,
+        0x48, 0x83, 0xf8, 0x00,         // cmp $0, %rax
+        0x75, 0xfe,                     // loop: jne loop
+        END);
+    align_loops = 0;
+
+    // The long form needs padding, but the short one doesn't
+    test_full_assembly("shortened branch loses its padding",
+        ".zero 27; jne foo; foo: ret",
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0,
+        0x75, 0x00,                     // jne foo
+        0xc3,                           // foo: ret
+        END);
+
+    // The padding is relative to the section, so it only works after linking if the
+    // section is aligned to the boundary
+    if (section_text->align != 32) panic("Expected .text to be aligned to 32, got %d", section_text->align);
+
+    branch_boundary = 0;
+}
+
+static void test_symbol_ordering(void) {
+    symbol_ordering_filename = "/tmp/was-test-symbol-ordering";
+    FILE *f = fopen(symbol_ordering_filename, "w");
+    fprintf(f, "# Comment\nc\n\nb\nmissing\n");
+    fclose(f);
+
+    // b takes the alignment before it along. a isn't in the file, so it goes last.
+    test_full_assembly("functions are put in the order of the ordering file",
+        ".type a, @function; a: nop; .size a, .-a;"
+        ".p2align 2; .type b, @function; b: ret; .size b, .-b;"
+        ".type c, @function; c: jmp a; .size c, .-c",
+        0xe9, 0x04, 0x00, 0x00, 0x00,   // c: jmp a
+        0x0f, 0x1f, 0x00,
+        0xc3,                           // b: ret
+        0x90,                           // a: nop
+        END);
+
+    int text_index = section_text->index;
+    assert_symbols(
+        9, 1, STT_FUNC, STB_LOCAL, text_index, "a",
+        8, 1, STT_FUNC, STB_LOCAL, text_index, "b",
+        0, 5, STT_FUNC, STB_LOCAL, text_index, "c",
+        END);
+
+    // Anything after the last function's .size stays at the end
+    test_full_assembly("code after the last function stays last",
+        "start: nop;"
+        ".type a, @function; a: nop; .size a, .-a;"
+        ".type b, @function; b: ret; .size b, .-b;"
+        "end: hlt",
+        0x90,                           // start: nop
+        0xc3,                           // b: ret
+        0x90,                           // a: nop
+        0xf4,                           // end: hlt
+        END);
+
+    remove(symbol_ordering_filename);
+    symbol_ordering_filename = NULL;
+}
+
+static void test_function_sections(void) {
+    function_sections = 1;
+
+    // Only code outside of functions stays in .text
+    test_full_assembly("functions are moved to their own sections",
+        "start: nop;"
+        ".type a, @function; a: nop; .size a, .-a;"
+        ".p2align 2; .type b, @function; b: jmp a; .size b, .-b",
+        0x90,                           // start: nop
+        END);
+
+    Section *section_a = get_section(".text.a");
+    Section *section_b = get_section(".text.b");
+    assert_section_data(section_a, 0x90, END);
+    assert_section_data(section_b, 0xe9, 0x00, 0x00, 0x00, 0x00, END);
+    if (section_b->align != 4) panic("Expected .text.b to be aligned like its .p2align, got %d", section_b->align);
+    if (section_b->flags != (SHF_ALLOC | SHF_EXECINSTR)) panic("Expected .text.b to be executable");
+
+    function_sections = 0;
+}
+
+static void test_peephole(void) {
+    optimize = 1;
+
+    test_full_assembly("peephole self-move", "movq %rax, %rax; movq %r8, %r8; movl %eax, %eax",
+        0x89, 0xc0,                                     // movl %eax, %eax
+        END);
+
+    test_full_assembly("peephole redundant-move", "movq %rax, %rdi; movq %rdi, %rax; movq %rax, %rdi",
+        0x48, 0x89, 0xc7,                               // movq %rax, %rdi
+        END);
+
+    test_full_assembly("peephole redundant-move with a label in between", "movq %rax, %rdi; l: movq %rdi, %rax",
+        0x48, 0x89, 0xc7,                               // movq %rax, %rdi
+        0x48, 0x89, 0xf8,                               // movq %rdi, %rax
+        END);
+
+    test_full_assembly("peephole store-reload", "movq %rax, -8(%rbp); movq -8(%rbp), %rax; movl -8(%rbp), %eax",
+        0x48, 0x89, 0x45, 0xf8,                         // movq %rax, -8(%rbp)
+        0x8b, 0x45, 0xf8,                               // movl -8(%rbp), %eax
+        END);
+
+    test_full_assembly("peephole add-zero", "addq $0, %rax; subq $0, %r12; ret",
+        0xc3,                                           // ret
+        END);
+
+    test_full_assembly("peephole zero-idiom", "movq $0, %rax; movq $0, %r9; test %rax, %rax",
+        0x31, 0xc0,                                     // xorl %eax, %eax
+        0x45, 0x31, 0xc9,                               // xorl %r9d, %r9d
+        0x48, 0x85, 0xc0,                               // test %rax, %rax
+        END);
+
+    // The flags are read by the jumps
+    test_full_assembly("peephole with live flags", "cmpq %rax, %rbx; movq $0, %rax; je l; addq $0, %rax; l: jne l",
+        0x48, 0x39, 0xc3,                               // cmpq %rax, %rbx
+        0xb8, 0x00, 0x00, 0x00, 0x00,                   // movl $0, %eax
+        0x74, 0x04,                                     // je l
+        0x48, 0x83, 0xc0, 0x00,                         // addq $0, %rax
+        0x75, 0xfe,                                     // l: jne l
+        END);
+
+    test_full_assembly("peephole mov-imm32", "movq $5, %rcx; movq $-1, %rcx; movq $0x80000000, %r10; movq $0x100000000, %rdx",
+        0xb9, 0x05, 0x00, 0x00, 0x00,                   // movl $5, %ecx
+        0x48, 0xc7, 0xc1, 0xff, 0xff, 0xff, 0xff,       // movq $-1, %rcx
+        0x41, 0xba, 0x00, 0x00, 0x00, 0x80,             // movl $0x80000000, %r10d
+        0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+        END);
+
+    // Rules can be switched off on their own
+    set_peephole_rule("zero-idiom", 0);
+    test_full_assembly("peephole without zero-idiom", "movq $0, %rax; ret",
+        0xb8, 0x00, 0x00, 0x00, 0x00,                   // movl $0, %eax
+        0xc3,                                           // ret
+        END);
+    set_peephole_rule("zero-idiom", -1);
+
+    optimize = 0;
+}
+
+static void test_thread_jumps(void) {
+    thread_jumps = 1;
+
+    // The je goes straight to l2, which is close enough for the short form
+    test_full_assembly("jumps are threaded through jmps", "l2: nop; je l1; .zero 140; l1: jmp l2",
+        0x90,                                           // l2: nop
+        0x74, 0xfd,                                     // je l2
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 140 zeroes
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0xe9, 0x6c, 0xff, 0xff, 0xff,                   // l1: jmp l2
+        END);
+
+    test_full_assembly("jump chains are followed", "je l1; nop; l1: jmp l2; nop; l2: jmp l3; nop; l3: nop",
+        0x74, 0x0d,                                     // je l3
+        0x90,
+        0xe9, 0x07, 0x00, 0x00, 0x00,                   // l1: jmp l3
+        0x90,
+        0xe9, 0x01, 0x00, 0x00, 0x00,                   // l2: jmp l3
+        0x90,
+        0x90,                                           // l3: nop
+        END);
+
+    test_full_assembly("jumps to the next instruction are removed",
+        "jne l1; l1: jmp l2; l2: .loc 1 1; jmp l3; nop; l3: ret",
+        0xe9, 0x01, 0x00, 0x00, 0x00,                   // jmp l3
+        0x90,
+        0xc3,                                           // l3: ret
+        END);
+
+    test_full_assembly("jump loops are left alone", "l1: jmp l2; l2: jmp l1",
+        0xe9, 0xfb, 0xff, 0xff, 0xff,                   // l2: jmp l2
+        END);
+
+    thread_jumps = 0;
+}
+
+// The SIMD scanners must stop where the scalar one does, wherever the run starts
+// and ends relative to a block
+static void test_scanners(void) {
+    Scanner *scalar = scanners;
+    while (strcmp(scalar->name, "scalar")) scalar++;
+
+    char *characters[] = { " \t\f\v", "azAZ09_@:.mQ5", "ab \t#;/x\x80\xff:" };
+    char *buffer = aligned_alloc(64, 256);
+
+    for (int class = 0; class < 3; class++)
+    for (int offset = 0; offset < 40; offset++)
+    for (int length = 0; length < 100; length++)
+    for (int end = 0; end < 256; end++) {
+        memset(buffer, 0, 256);
+        char *p = buffer + offset;
+        for (int i = 0; i < length; i++) p[i] = characters[class][(i * 7 + offset) % strlen(characters[class])];
+        p[length] = end;
+
+        for (Scanner *s = scanners; s->name; s++) {
+            if (!scanner_is_supported(s)) continue;
+            char *got =
+                class == 0 ? s->skip_whitespace(p) : class == 1 ? s->skip_identifier(p) : s->find_end_of_line(p);
+            char *expected =
+                class == 0 ? scalar->skip_whitespace(p) : class == 1 ? scalar->skip_identifier(p) : scalar->find_end_of_line(p);
+            if (got != expected)
+                panic("%s scanner class %d at offset %d with length %d and end %d: got %ld, expected %ld",
+                    s->name, class, offset, length, end, got - p, expected - p);
+        }
+    }
+
+    free(buffer);
+}
+
+// A pipe has no size, so the lexer reads it instead of mapping it
+static void test_input_from_pipe(void) {
+    printf("%-60s", "input from a pipe");
+
+    // More than a page, so the buffer has to grow, but less than the pipe can hold
+    int fds[2];
+    if (pipe(fds) == -1) panic("Unable to create a pipe");
+    for (int i = 0; i < 2000; i++) write(fds[1], "nop\n", 4);
+    write(fds[1], "ret", 3);
+    close(fds[1]);
+
+    char filename[32];
+    sprintf(filename, "/dev/fd/%d", fds[0]);
+    init_lexer(filename);
+    close(fds[0]);
+
+    int instructions = 0;
+    for (; TOKEN_KIND(cur_token_index) != TOK_EOF; next())
+        if (TOKEN_KIND(cur_token_index) == TOK_INSTRUCTION) instructions++;
+
+    if (instructions != 2001) panic("Expected 2001 instructions from the pipe, got %d", instructions);
+    if (cur_line != 2001) panic("Expected to end on line 2001, got %d", cur_line);
+    free_lexer();
+
+    printf("pass\n");
+}
+
+static void test_pretokenize(void) {
+    pretokenize = 1;
+
+    // The second instruction is shared, which skips its tokens
+    test_full_assembly("pretokenized instructions and labels",
+        "l1: l2:\n"
+        "    mov %spl, (%rip)   # Comment\n"
+        "    mov %spl, (%rip); xor %eax, %eax\n"
+        "    jmp l1\n",
+        0x40, 0x88, 0x25, 0x00, 0x00, 0x00, 0x00,       // mov %spl, (%rip)
+        0x40, 0x88, 0x25, 0x00, 0x00, 0x00, 0x00,       // mov %spl, (%rip)
+        0x31, 0xc0,                                     // xor %eax, %eax
+        0xe9, 0xeb, 0xff, 0xff, 0xff,                   // jmp l1
+        END);
+
+    test_full_assembly("pretokenized directives",
+        ".byte 1; .byte -2; .string \"a\\tb\"; .string \"c\"; .zero 2",
+        0x01, 0xfe, 'a', '\t', 'b', 0, 'c', 0, 0, 0,
+        END);
+
+    init_lexer_from_string("foo: mov $1, %rax\n");
+    if (TOKEN_KIND(cur_token_index) != TOK_LABEL || peek_token(1) != TOK_INSTRUCTION || peek_token(2) != TOK_DOLLAR ||
+            peek_token(5) != TOK_REGISTER || peek_token(6) != TOK_EOL || peek_token(7) != TOK_EOF ||
+            peek_token(100) != TOK_EOF)
+        panic("Unexpected tokens from peek_token()");
+
+    next();
+    if (TOKEN_KIND(cur_token_index) != TOK_INSTRUCTION || peek_token(1) != TOK_DOLLAR)
+        panic("Unexpected tokens from peek_token() after next()");
+
+    pretokenize = 0;
 }
 
 static void test_string_with_label(void) {
@@ -1530,7 +2151,7 @@ static void test_debug_line_program(void) {
     assert_dwarf_line_program(START,
         DWARF_PROLOGUE,
         0x15,               // Special opcode 8: advance Address by 0 to 0x0 and Line by 3 to 4
-        0x20,               // Special opcode 19: advance Address by 1 to 0x1 and Line by 0 to 4
+        0x02, 0x01,         // Advance PC by 1 to 0x1
         DWARF_EPILOGUE,     // Extended opcode 1: End of Sequence
         END);
 
@@ -1545,7 +2166,7 @@ static void test_debug_line_program(void) {
         DWARF_PROLOGUE,
         0x15,               // Special opcode 8: advance Address by 0 to 0x0 and Line by 3 to 4
         0x26,               // Special opcode 25: advance Address by 1 to 0x1 and Line by 6 to 10
-        0x20,               // Special opcode 19: advance Address by 1 to 0x2 and Line by 0 to 10
+        0x02, 0x01,         // Advance PC by 1 to 0x2
         DWARF_EPILOGUE,     // Extended opcode 1: End of Sequence
         END);
 
@@ -1560,9 +2181,10 @@ static void test_debug_line_program(void) {
     assert_dwarf_line_program(START,
         DWARF_PROLOGUE,
         0x03, 0xe3, 0x00,   // Advance Line by 99 to 100
+        0x12,               // Special opcode 5: advance Address by 0 to 0x0 and Line by 0 to 100
         0x03, 0x7a,         // Advance Line by -6 to 94
-        0x02, 0x01,         // Advance PC by 1 to 0x1
-        0x20,               // Special opcode 19: advance Address by 1 to 0x2 and Line by 0 to 10
+        0x20,               // Special opcode 19: advance Address by 1 to 0x1 and Line by 0 to 94
+        0x02, 0x01,         // Advance PC by 1 to 0x2
         DWARF_EPILOGUE,     // Extended opcode 1: End of Sequence
         END);
 
@@ -1576,8 +2198,9 @@ static void test_debug_line_program(void) {
     assert_dwarf_line_program(START,
         DWARF_PROLOGUE,
         0x03, 0xe3, 0x00,   // Advance Line by 99 to 100
+        0x12,               // Special opcode 5: advance Address by 0 to 0x0 and Line by 0 to 100
         0x1b,               // Special opcode 14: advance Address by 1 to 0x1 and Line by -5 to 95
-        0x20,               // Special opcode 19: advance Address by 1 to 0x2 and Line by 0 to 10
+        0x02, 0x01,         // Advance PC by 1 to 0x2
         DWARF_EPILOGUE,     // Extended opcode 1: End of Sequence
         END);
 
@@ -1591,8 +2214,9 @@ static void test_debug_line_program(void) {
     assert_dwarf_line_program(START,
         DWARF_PROLOGUE,
         0x03, 0xe3, 0x00,   // Advance Line by 99 to 100
+        0x12,               // Special opcode 5: advance Address by 0 to 0x0 and Line by 0 to 100
         0x28,               // Special opcode 27: advance Address by 1 to 0x1 and Line by 8 to 108
-        0x20,               // Special opcode 19: advance Address by 1 to 0x2 and Line by 0 to 10
+        0x02, 0x01,         // Advance PC by 1 to 0x2
         DWARF_EPILOGUE,     // Extended opcode 1: End of Sequence
         END);
 
@@ -1606,9 +2230,10 @@ static void test_debug_line_program(void) {
     assert_dwarf_line_program(START,
         DWARF_PROLOGUE,
         0x03, 0xe3, 0x00,   // Advance Line by 99 to 100
+        0x12,               // Special opcode 5: advance Address by 0 to 0x0 and Line by 0 to 100
         0x03, 0x09,         // Advance Line by 9 to 109
-        0x02, 0x01,         // Advance PC by 1 to 0x1
-        0x20,               // Special opcode 19: advance Address by 1 to 0x2 and Line by 0 to 109
+        0x20,               // Special opcode 19: advance Address by 1 to 0x1 and Line by 0 to 109
+        0x02, 0x01,         // Advance PC by 1 to 0x2
         DWARF_EPILOGUE,     // Extended opcode 1: End of Sequence
         END);
 
@@ -1627,8 +2252,9 @@ static void test_debug_line_program(void) {
     assert_dwarf_line_program(START,
         DWARF_PROLOGUE,
         0x03, 0xe3, 0x00,   // Advance Line by 99 to 100
+        0x12,               // Special opcode 5: advance Address by 0 to 0x0 and Line by 0 to 100
         0xff,               // Special opcode 242: advance Address by 17 to 0x11 and Line by -1 to 99
-        0x20,               // Special opcode 19: advance Address by 1 to 0x12 and Line by 0 to 99
+        0x02, 0x01,         // Advance PC by 1 to 0x12
         DWARF_EPILOGUE,     // Extended opcode 1: End of Sequence
         END);
 
@@ -1647,9 +2273,10 @@ static void test_debug_line_program(void) {
     assert_dwarf_line_program(START,
         DWARF_PROLOGUE,
         0x03, 0xe3, 0x00,   // Advance Line by 99 to 100
+        0x12,               // Special opcode 5: advance Address by 0 to 0x0 and Line by 0 to 100
         0x08,               // Advance PC by constant 17 to 0x11
         0xc9,               // Special opcode 188: advance Address by 13 to 0x1e and Line by 1 to 101
-        0x20,               // Special opcode 19: advance Address by 1 to 0x1f and Line by 0 to 101
+        0x02, 0x01,         // Advance PC by 1 to 0x1f
         DWARF_EPILOGUE,     // Extended opcode 1: End of Sequence
         END);
 
@@ -1668,7 +2295,8 @@ static void test_debug_line_program(void) {
     assert_dwarf_line_program(START,
         DWARF_PROLOGUE,
         0x02, 0x22,         // Advance PC by 34 to 0x22
-        0x20,               // Special opcode 19: advance Address by 1 to 0x1f and Line by 0 to 101
+        0x01,               // Copy
+        0x02, 0x01,         // Advance PC by 1 to 0x23
         DWARF_EPILOGUE,     // Extended opcode 1: End of Sequence
         END);
 
@@ -1686,18 +2314,21 @@ static void test_debug_line_program(void) {
         DWARF_PROLOGUE,
         0x04, 0x02,         // Set File Name to entry 2 in the File Name Table
         0x03, 0xe3, 0x00,   // Advance Line by 99 to 100
+        0x12,               // Special opcode 5: advance Address by 0 to 0x0 and Line by 0 to 100
         0x04, 0x01,         // Set File Name to entry 1 in the File Name Table
         0x03, 0x9e, 0x7f,   // Advance Line by -98 to 2
-        0x02, 0x01,         // Advance PC by 1 to 0x1
-        0x20,               // Special opcode 19: advance Address by 1 to 0x2 and Line by 0 to 2
+        0x20,               // Special opcode 19: advance Address by 1 to 0x1 and Line by 0 to 2
+        0x02, 0x01,         // Advance PC by 1 to 0x2
         DWARF_EPILOGUE,     // Extended opcode 1: End of Sequence
         END);
 }
 
 int main() {
     init_tests();
+    check_opcode_encoders = 1;
 
     test_parse_instruction_statement();
+    test_opcode_alias_group_lookup();
     test_reduce_branch_instructions();
     test_relocations_with_imm_rip_and_undefined_symbol();
     test_relocations_with_rip_and_undefined_symbol();
@@ -1708,6 +2339,8 @@ int main() {
     test_data_with_defined_symbol();
     test_GOTPCREL_relocations();
     test_zero_in_text_section();
+    test_shared_instructions();
+    test_branches_forms();
     test_symbol_types_and_binding();
     test_size_with_number();
     test_size_difference();
@@ -1715,6 +2348,15 @@ int main() {
     test_cross_section_quad_label_difference();
     test_section_creation();
     test_align();
+    test_align_loops_and_functions();
+    test_branches_within_boundaries();
+    test_symbol_ordering();
+    test_function_sections();
+    test_peephole();
+    test_thread_jumps();
+    test_scanners();
+    test_input_from_pipe();
+    test_pretokenize();
     test_string_with_label();
     test_relocation_to_section_symbol();
     test_debug_line_files();
@@ -21,7 +21,6 @@ const char *symbol_binding_names[] = {
 
 void init_tests(void) {
     init_sections();
-    init_opcodes();
     init_symbols();
     init_default_sections();
     init_relocations();
@@ -1,41 +1,115 @@
 #include <stdio.h>
+#include <time.h>
 
+#include "arena.h"
 #include "branches.h"
 #include "dwarf.h"
 #include "elf.h"
+#include "instr.h"
 #include "lexer.h"
-#include "opcodes.h"
+#include "ordering.h"
 #include "parser.h"
+#include "peephole.h"
 #include "relocations.h"
 #include "was.h"
 
+int print_statistics;
+
+// Time spent in each phase, in seconds
+static double tokenize_time;
+static double parse_time;
+static double layout_time;
+static double emit_time;
+static double output_time;
+
+// Return a monotonic time in seconds
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static int token_count;
+
+static void print_assembly_statistics(void) {
+    if (pretokenize) fprintf(stderr, "tokenize time: %.3f s\n", tokenize_time);
+    fprintf(stderr, "parse time: %.3f s\n", parse_time);
+    fprintf(stderr, "layout time: %.3f s\n", layout_time);
+    fprintf(stderr, "emit time: %.3f s\n", emit_time);
+    fprintf(stderr, "output time: %.3f s\n", output_time);
+    if (pretokenize) fprintf(stderr, "tokens: %d\n", token_count);
+    fprintf(stderr, "encoding cache hits: %d\n", encoding_cache_hits);
+    fprintf(stderr, "encoding cache misses: %d\n", encoding_cache_misses);
+    fprintf(stderr, "specialised encodings: %d\n", specialised_encodings);
+    fprintf(stderr, "branch forms hits: %d\n", branch_forms_hits);
+    fprintf(stderr, "shared instructions hits: %d\n", shared_instructions_hits);
+    fprintf(stderr, "shared instructions misses: %d\n", shared_instructions_misses);
+    fprintf(stderr, "ordered functions: %d\n", ordered_functions);
+    fprintf(stderr, "function sections: %d\n", function_section_count);
+    fprintf(stderr, "aligned loops: %d\n", aligned_loops);
+    fprintf(stderr, "aligned functions: %d\n", aligned_functions);
+    fprintf(stderr, "threaded jumps: %d\n", threaded_jumps);
+    fprintf(stderr, "removed jumps: %d\n", removed_jumps);
+    fprintf(stderr, "padded branches: %d\n", padded_branches);
+    fprintf(stderr, "branch padding bytes: %d\n", branch_padding_bytes);
+
+    for (PeepholeRule *rule = peephole_rules; rule->name; rule++)
+        fprintf(stderr, "peephole %s: %d\n", rule->name, rule->count);
+    fprintf(stderr, "peephole saved bytes: %d\n", peephole_saved_bytes);
+}
+
 void emit_code(void) {
+    double start = now();
+
+    optimize_code();
+    place_functions();
+
     for (int i = 0; i < sections_list->length; i++) {
         Section *section = sections_list->elements[i];
         if (section->chunks) layout_section(section);
     }
 
+    double layout_end = now();
+
     for (int i = 0; i < sections_list->length; i++) {
         Section *section = sections_list->elements[i];
         if (section->chunks) emit_section_code(section);
     }
+
+    layout_time = layout_end - start;
+    emit_time = now() - layout_end;
 }
 
 void assemble(char *input_filename, char *output_filename) {
+    double start = now();
     init_lexer(input_filename);
+    tokenize_time = now() - start;
+    token_count = tokens.count;
+
     init_sections();
     init_symbols();
     init_default_sections();
     init_relocations();
-    init_opcodes();
     init_parser();
     init_dwarf();
+
+    start = now();
     parse();
+    parse_time = now() - start;
+
     emit_code();
+
+    start = now();
     make_dwarf_debug_line_section();
     make_section_indexes();
     make_symbols_section();
     make_rela_sections();
     finish_elf(output_filename);
+    output_time = now() - start;
+
     free_lexer();
+
+    if (print_statistics) print_assembly_statistics();
+
+    free_arena();
 }
@@ -1,6 +1,8 @@
 #ifndef _WAS_H
 #define _WAS_H
 
+extern int print_statistics;
+
 void emit_code(void);
 void assemble(char *input_filename, char *output_filename);
 